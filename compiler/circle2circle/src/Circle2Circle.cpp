@@ -133,6 +133,9 @@ int entry(int argc, char **argv)
   add_switch(arser, "--fuse_prelu", "This will fuse operators to PReLU operator");
   add_switch(arser, "--fuse_gelu", "This will fuse operators to GeLU operator");
   add_switch(arser, "--fuse_rsqrt", "This will fuse operators to Rsqrt operator");
+  add_switch(arser, "--fuse_attention",
+             "This will fuse scaled dot-product attention to ScaledDotProductAttention custom "
+             "operator. Note that only onert supports this custom operator.");
   add_switch(arser, "--remove_duplicate_const", "This will remove all duplicate constant nodes");
   add_switch(arser, "--remove_fakequant", "This will remove FakeQuant operators");
   add_switch(arser, "--remove_gather_guard",
@@ -230,6 +233,13 @@ int entry(int argc, char **argv)
   arser.add_argument("--change_outputs")
     .help("Experimental: Change first subgraph output nodes to CSV names");
 
+  arser.add_argument("--fuse_attention_cache_size")
+    .type(arser::DataType::INT32)
+    .help("Number of tokens in kv cache of attention fused by --fuse_attention. Runtime keeps K "
+          "and V of previous runs in the cache, and K and V of the model are those of new tokens "
+          "only (e.g. a model of one decoding step). Attention with mask other than constant causal "
+          "mask is not fused with it.");
+
   arser.add_argument("input").help("Input circle model");
   arser.add_argument("output").help("Output circle model");
 
@@ -300,6 +310,7 @@ int entry(int argc, char **argv)
   option_str_to_enum["fuse_prelu"] = Algorithms::FusePRelu;
   option_str_to_enum["fuse_gelu"] = Algorithms::FuseGelu;
   option_str_to_enum["fuse_rsqrt"] = Algorithms::FuseRsqrt;
+  option_str_to_enum["fuse_attention"] = Algorithms::FuseAttention;
   option_str_to_enum["fuse_transpose_with_mean"] = Algorithms::FuseTransposeWithMean;
   option_str_to_enum["remove_duplicate_const"] = Algorithms::RemoveDuplicateConst;
   option_str_to_enum["remove_fakequant"] = Algorithms::RemoveFakeQuant;
@@ -393,6 +404,17 @@ int entry(int argc, char **argv)
                    arser.get<std::string>("--sparsify_block_map"));
   }
 
+  if (arser["--fuse_attention_cache_size"])
+  {
+    const auto cache_size = arser.get<int32_t>("--fuse_attention_cache_size");
+    if (cache_size <= 0)
+    {
+      std::cerr << "ERROR: --fuse_attention_cache_size should be positive" << std::endl;
+      return 255;
+    }
+    options->param(AlgorithmParameters::FuseAttention_cache_size, std::to_string(cache_size));
+  }
+
   if (arser.get<bool>("--convert_nchw_to_nhwc"))
   {
     options->enable(Algorithms::ConvertNCHWToNHWC);
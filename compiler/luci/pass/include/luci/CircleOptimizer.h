@@ -38,6 +38,7 @@ public:
       FuseAddWithConv,
       FuseAddWithFullyConnected,
       FuseAddWithTConv,
+      FuseAttention,
       FuseBatchNormWithConv,
       FuseBatchNormWithDwConv,
       FuseBatchNormWithTConv,
@@ -127,6 +128,9 @@ public:
       // convert NCHW to NHWC
       NCHW_to_NHWC_input_shape,
       NCHW_to_NHWC_output_shape,
+
+      // fuse attention
+      FuseAttention_cache_size,
     };
 
     virtual ~Options() = default;
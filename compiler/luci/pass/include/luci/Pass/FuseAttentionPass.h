@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __LUCI_FUSE_ATTENTION_PASS_H__
+#define __LUCI_FUSE_ATTENTION_PASS_H__
+
+#include <logo/Pass.h>
+
+namespace luci
+{
+
+/**
+ * @brief  Class to fuse scaled dot-product attention into CircleCustom(ScaledDotProductAttention)
+ *
+ * BEFORE
+ *   BatchMatMul(Q, K^T) - Mul(scale) - Add(mask) - Softmax - BatchMatMul(V)
+ *
+ * AFTER
+ *   CircleCustom(ScaledDotProductAttention)(Q, K, V[, mask]) with custom option "scale"
+ *
+ * If mask is a constant causal mask, it is not taken as input and custom option "causal" is set.
+ *
+ * With cache_size, custom option "cache_size" is also set. Then runtime keeps K and V of
+ * previous runs in a kv cache of cache_size tokens, and K and V of the model are those of new
+ * tokens only, e.g. a model of one decoding step. As mask can not cover cached tokens, only
+ * attention without mask or with causal mask is fused.
+ *
+ * For detailed subgraph pattern to be fused, please check its implementation.
+ */
+struct FuseAttentionPass final : public logo::Pass
+{
+  FuseAttentionPass() = default;
+  explicit FuseAttentionPass(int32_t cache_size) : _cache_size{cache_size} {}
+
+  const char *name(void) const final { return "luci::FuseAttentionPass"; }
+
+  bool run(loco::Graph *g) final;
+
+private:
+  int32_t _cache_size = 0;
+};
+
+} // namespace luci
+
+#endif // __LUCI_FUSE_ATTENTION_PASS_H__
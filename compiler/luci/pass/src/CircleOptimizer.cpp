@@ -39,6 +39,7 @@
 #include "luci/Pass/FuseAddWithConvPass.h"
 #include "luci/Pass/FuseAddWithFullyConnectedPass.h"
 #include "luci/Pass/FuseAddWithTConvPass.h"
+#include "luci/Pass/FuseAttentionPass.h"
 #include "luci/Pass/FuseBatchNormWithConvPass.h"
 #include "luci/Pass/FuseBatchNormWithDwConvPass.h"
 #include "luci/Pass/FuseBatchNormWithTConvPass.h"
@@ -397,6 +398,13 @@ void CircleOptimizer::optimize(loco::Graph *g) const
     }
   }
 
+  if (_options->query(Options::Algorithm::FuseAttention))
+  {
+    const auto cache_size = _options->param(Options::AlgorithmParameters::FuseAttention_cache_size);
+    phase.emplace_back(
+      std::make_unique<luci::FuseAttentionPass>(cache_size.empty() ? 0 : std::stoi(cache_size)));
+  }
+
   // TODO Extend `option_to_pass` to be able to instantiate two or more pass objects.
   if (_options->query(Options::Algorithm::RemoveUnnecessaryReshape))
   {
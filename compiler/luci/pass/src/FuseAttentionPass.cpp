@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAttentionPass.h"
+#include "helpers/NodeFiller.h"
+
+#include <luci/IR/CircleNodes.h>
+#include <luci/Profile/CircleNodeOrigin.h>
+
+#include <flatbuffers/flexbuffers.h>
+
+#include <cassert>
+
+// Helper to fuse scaled dot-product attention
+namespace
+{
+
+#define CHECK_OR_FALSE(condition) \
+  if (not(condition))             \
+    return false;
+
+bool is_float_const_scalar(const luci::CircleConst *node)
+{
+  return node->dtype() == loco::DataType::FLOAT32 &&
+         node->size<loco::DataType::FLOAT32>() == 1;
+}
+
+bool has_valid_shape(const luci::CircleNode *node)
+{
+  return node->shape_status() == luci::ShapeStatus::VALID;
+}
+
+/**
+ * Returns true if mask is a constant causal mask of [..., q_len, k_len] with 1 for other dims,
+ * i.e. 0 where query i attends key j (j <= k_len - q_len + i) and large negative elsewhere
+ */
+bool is_causal_mask(const luci::CircleNode *mask, uint32_t q_len, uint32_t k_len)
+{
+  auto mask_const = dynamic_cast<const luci::CircleConst *>(mask);
+  if (mask_const == nullptr || mask_const->dtype() != loco::DataType::FLOAT32)
+    return false;
+
+  const auto rank = mask_const->rank();
+  if (rank < 2 || q_len > k_len)
+    return false;
+  for (uint32_t i = 0; i < rank - 2; ++i)
+  {
+    if (mask_const->dim(i).value() != 1)
+      return false;
+  }
+  if (mask_const->dim(rank - 2).value() != q_len || mask_const->dim(rank - 1).value() != k_len)
+    return false;
+  if (mask_const->size<loco::DataType::FLOAT32>() != q_len * k_len)
+    return false;
+
+  // Masked scores vanish after softmax with this
+  const float masked_max = -1e4f;
+  const uint32_t offset = k_len - q_len;
+  for (uint32_t i = 0; i < q_len; ++i)
+  {
+    for (uint32_t j = 0; j < k_len; ++j)
+    {
+      const float value = mask_const->at<loco::DataType::FLOAT32>(i * k_len + j);
+      const bool attended = j <= offset + i;
+      if (attended && value != 0.0f)
+        return false;
+      if (not attended && value > masked_max)
+        return false;
+    }
+  }
+  return true;
+}
+
+/**
+ * Below diagram shows scaled dot-product attention pattern to fuse.
+ * - Attention(Q, K, V, mask) = softmax(Q * K^T * scale + mask) * V
+ * - scale (Mul, or Div with reciprocal of it), mask (Add) and Transpose are optional
+ *
+ *      [Q]        [K]
+ *       |          |
+ *       |      transpose (swaps last two axes, or adj_y = true without it)
+ *       |          |
+ *       +--> batch_matmul_qk
+ *                  |
+ *                  V
+ *            mul_scale (scalar)
+ *                  |
+ *                  V
+ *              add_mask <-- [mask]
+ *                  |
+ *                  V
+ *               softmax (beta = 1)
+ *                  |
+ *                  V
+ *           batch_matmul_v <-- [V]
+ *                  |
+ *                  V
+ *                [Out]
+ *
+ * Q, K and V are [..., seq, depth] of the same rank (2 ~ 4), and their batch dims should be
+ * same or 1 for K and V. As multiple heads are batch dims, this covers multi-head attention.
+ *
+ * A constant causal mask is not taken as an input but fused into option "causal".
+ */
+class AttentionPattern final
+{
+public:
+  AttentionPattern(luci::CircleBatchMatMul *candidate)
+  {
+    assert(candidate);
+    _bmm_v = candidate;
+  }
+
+public:
+  bool matched();
+
+private:
+  bool match_scores(loco::Node *node);
+
+public:
+  luci::CircleNode *_query = nullptr;
+  luci::CircleNode *_key = nullptr;
+  luci::CircleNode *_value = nullptr;
+  luci::CircleNode *_mask = nullptr;
+  float _scale = 1.0f;
+
+  luci::CircleTranspose *_transpose_k = nullptr;
+  luci::CircleBatchMatMul *_bmm_qk = nullptr;
+  luci::CircleNode *_scale_op = nullptr;
+  luci::CircleAdd *_add_mask = nullptr;
+  luci::CircleSoftmax *_softmax = nullptr;
+  luci::CircleBatchMatMul *_bmm_v = nullptr;
+};
+
+// Match 'node' with batch_matmul_qk or scaled one
+bool AttentionPattern::match_scores(loco::Node *node)
+{
+  _bmm_qk = nullptr;
+  _scale_op = nullptr;
+  _scale = 1.0f;
+
+  luci::CircleConst *scale = nullptr;
+  if (auto mul = dynamic_cast<luci::CircleMul *>(node))
+  {
+    CHECK_OR_FALSE(luci::fill(&_bmm_qk, &scale).with_commutative_args_of(mul));
+    CHECK_OR_FALSE(mul->fusedActivationFunction() == luci::FusedActFunc::NONE);
+    CHECK_OR_FALSE(is_float_const_scalar(scale));
+    _scale = scale->at<loco::DataType::FLOAT32>(0);
+    _scale_op = mul;
+  }
+  else if (auto div = dynamic_cast<luci::CircleDiv *>(node))
+  {
+    CHECK_OR_FALSE(luci::fill(&_bmm_qk, &scale).with_args_of(div));
+    CHECK_OR_FALSE(div->fusedActivationFunction() == luci::FusedActFunc::NONE);
+    CHECK_OR_FALSE(is_float_const_scalar(scale));
+    CHECK_OR_FALSE(scale->at<loco::DataType::FLOAT32>(0) != 0.0f);
+    _scale = 1.0f / scale->at<loco::DataType::FLOAT32>(0);
+    _scale_op = div;
+  }
+  else
+  {
+    _bmm_qk = dynamic_cast<luci::CircleBatchMatMul *>(node);
+  }
+
+  return _bmm_qk != nullptr;
+}
+
+bool AttentionPattern::matched()
+{
+  // check pattern
+  CHECK_OR_FALSE(not _bmm_v->adj_x() && not _bmm_v->adj_y());
+  _softmax = dynamic_cast<luci::CircleSoftmax *>(_bmm_v->x());
+  CHECK_OR_FALSE(_softmax != nullptr);
+  CHECK_OR_FALSE(_softmax->beta() == 1.0f);
+  _value = loco::must_cast<luci::CircleNode *>(_bmm_v->y());
+
+  _add_mask = dynamic_cast<luci::CircleAdd *>(_softmax->logits());
+  if (_add_mask != nullptr)
+  {
+    CHECK_OR_FALSE(_add_mask->fusedActivationFunction() == luci::FusedActFunc::NONE);
+    if (match_scores(_add_mask->x()))
+      _mask = loco::must_cast<luci::CircleNode *>(_add_mask->y());
+    else if (match_scores(_add_mask->y()))
+      _mask = loco::must_cast<luci::CircleNode *>(_add_mask->x());
+    CHECK_OR_FALSE(_mask != nullptr);
+  }
+  else
+  {
+    CHECK_OR_FALSE(match_scores(_softmax->logits()));
+  }
+
+  CHECK_OR_FALSE(not _bmm_qk->adj_x());
+  _query = loco::must_cast<luci::CircleNode *>(_bmm_qk->x());
+  if (_bmm_qk->adj_y())
+  {
+    _key = loco::must_cast<luci::CircleNode *>(_bmm_qk->y());
+  }
+  else
+  {
+    // K^T should be made by Transpose which swaps last two axes of K
+    _transpose_k = dynamic_cast<luci::CircleTranspose *>(_bmm_qk->y());
+    CHECK_OR_FALSE(_transpose_k != nullptr);
+    auto perm = dynamic_cast<luci::CircleConst *>(_transpose_k->perm());
+    CHECK_OR_FALSE(perm != nullptr);
+    CHECK_OR_FALSE(perm->dtype() == loco::DataType::S32);
+    const auto perm_size = perm->size<loco::DataType::S32>();
+    CHECK_OR_FALSE(perm_size >= 2);
+    for (uint32_t i = 0; i < perm_size - 2; ++i)
+      CHECK_OR_FALSE(perm->at<loco::DataType::S32>(i) == static_cast<int32_t>(i));
+    CHECK_OR_FALSE(perm->at<loco::DataType::S32>(perm_size - 2) ==
+                   static_cast<int32_t>(perm_size - 1));
+    CHECK_OR_FALSE(perm->at<loco::DataType::S32>(perm_size - 1) ==
+                   static_cast<int32_t>(perm_size - 2));
+    _key = loco::must_cast<luci::CircleNode *>(_transpose_k->a());
+  }
+
+  // check dtypes
+  for (auto node : {_query, _key, _value, _mask, static_cast<luci::CircleNode *>(_bmm_v)})
+  {
+    if (node != nullptr)
+      CHECK_OR_FALSE(node->dtype() == loco::DataType::FLOAT32);
+  }
+
+  // check shapes: only K and V can be broadcasted along batch dims
+  CHECK_OR_FALSE(has_valid_shape(_query) && has_valid_shape(_key) && has_valid_shape(_value));
+  CHECK_OR_FALSE(has_valid_shape(_bmm_qk) && has_valid_shape(_bmm_v));
+  const auto rank = _query->rank();
+  CHECK_OR_FALSE(rank >= 2 && rank <= 4);
+  CHECK_OR_FALSE(_key->rank() == rank && _value->rank() == rank);
+  CHECK_OR_FALSE(_bmm_qk->rank() == rank && _bmm_v->rank() == rank);
+  for (uint32_t i = 0; i < rank; ++i)
+  {
+    CHECK_OR_FALSE(_query->dim(i).known() && _key->dim(i).known() && _value->dim(i).known());
+    CHECK_OR_FALSE(_bmm_qk->dim(i).known() && _bmm_v->dim(i).known());
+    if (i < rank - 2)
+    {
+      const auto q_dim = _query->dim(i).value();
+      CHECK_OR_FALSE(_key->dim(i).value() == 1 || _key->dim(i).value() == q_dim);
+      CHECK_OR_FALSE(_value->dim(i).value() == 1 || _value->dim(i).value() == q_dim);
+      CHECK_OR_FALSE(_bmm_v->dim(i).value() == q_dim);
+    }
+  }
+  CHECK_OR_FALSE(_key->dim(rank - 1).value() == _query->dim(rank - 1).value());
+  CHECK_OR_FALSE(_value->dim(rank - 2).value() == _key->dim(rank - 2).value());
+
+  // mask should be broadcasted to scores, not the other way around
+  if (_mask != nullptr)
+  {
+    CHECK_OR_FALSE(has_valid_shape(_mask) && has_valid_shape(_add_mask));
+    CHECK_OR_FALSE(_mask->rank() <= rank && _add_mask->rank() == rank);
+    for (uint32_t i = 0; i < rank; ++i)
+    {
+      CHECK_OR_FALSE(_add_mask->dim(i).known());
+      CHECK_OR_FALSE(_add_mask->dim(i).value() == _bmm_qk->dim(i).value());
+    }
+  }
+
+  return true;
+}
+
+#undef CHECK_OR_FALSE
+
+class FuseAttention final
+{
+public:
+  FuseAttention(const AttentionPattern *p, int32_t cache_size, bool causal)
+    : _p(p), _cache_size(cache_size), _causal(causal)
+  {
+  }
+
+public:
+  void apply(void);
+
+private:
+  luci::CircleCustom *create_attention(loco::Graph *graph);
+
+private:
+  const AttentionPattern *_p;
+  int32_t _cache_size;
+  bool _causal;
+};
+
+luci::CircleCustom *FuseAttention::create_attention(loco::Graph *graph)
+{
+  assert(graph);
+
+  const bool has_mask = _p->_mask != nullptr && not _causal;
+  auto attention = graph->nodes()->create<luci::CircleCustom>(has_mask ? 4 : 3, 1);
+  attention->inputs(0, _p->_query);
+  attention->inputs(1, _p->_key);
+  attention->inputs(2, _p->_value);
+  if (has_mask)
+    attention->inputs(3, _p->_mask);
+
+  auto flex_buffers = std::make_unique<flexbuffers::Builder>();
+  size_t map_start = flex_buffers->StartMap();
+  flex_buffers->Float("scale", _p->_scale);
+  if (_cache_size > 0)
+    flex_buffers->Int("cache_size", _cache_size);
+  if (_causal)
+    flex_buffers->Bool("causal", true);
+  flex_buffers->EndMap(map_start);
+  flex_buffers->Finish();
+
+  attention->custom_code("ScaledDotProductAttention");
+  attention->custom_options(flex_buffers->GetBuffer());
+  attention->dtype(_p->_bmm_v->dtype());
+  attention->rank(_p->_bmm_v->rank());
+  for (uint32_t i = 0; i < _p->_bmm_v->rank(); ++i)
+    attention->dim(i) = _p->_bmm_v->dim(i);
+  attention->shape_status(luci::ShapeStatus::VALID);
+  attention->name(_p->_bmm_v->name() + "/ScaledDotProductAttention");
+  return attention;
+}
+
+void FuseAttention::apply()
+{
+  auto graph = _p->_bmm_v->graph();
+
+  auto attention = create_attention(graph);
+
+  auto attention_out = graph->nodes()->create<luci::CircleCustomOut>();
+  attention_out->input(attention);
+  attention_out->index(0);
+  attention_out->dtype(attention->dtype());
+  attention_out->rank(attention->rank());
+  for (uint32_t i = 0; i < attention->rank(); ++i)
+    attention_out->dim(i) = attention->dim(i);
+  attention_out->shape_status(luci::ShapeStatus::VALID);
+  attention_out->name(_p->_bmm_v->name());
+
+  // set origin
+  std::vector<std::shared_ptr<luci::CircleNodeOrigin>> origin_vec{
+    luci::get_origin(_p->_bmm_qk), luci::get_origin(_p->_softmax), luci::get_origin(_p->_bmm_v)};
+  for (luci::CircleNode *node : {static_cast<luci::CircleNode *>(_p->_transpose_k), _p->_scale_op,
+                                 static_cast<luci::CircleNode *>(_p->_add_mask)})
+  {
+    if (node != nullptr)
+      origin_vec.push_back(luci::get_origin(node));
+  }
+
+  luci::add_origin(attention, luci::composite_origin(origin_vec));
+  luci::add_origin(attention_out, luci::get_origin(_p->_bmm_v));
+
+  replace(_p->_bmm_v).with(attention_out);
+}
+
+} // namespace
+
+namespace
+{
+
+bool fuse_attention(luci::CircleBatchMatMul *bmm, int32_t cache_size)
+{
+  assert(bmm);
+
+  AttentionPattern pattern(bmm);
+  if (pattern.matched())
+  {
+    const auto rank = pattern._bmm_qk->rank();
+    const bool causal =
+      pattern._mask != nullptr &&
+      is_causal_mask(pattern._mask, pattern._bmm_qk->dim(rank - 2).value(),
+                     pattern._bmm_qk->dim(rank - 1).value());
+
+    // Mask can not cover tokens in kv cache, so only causal mask is fused with kv cache
+    if (cache_size > 0 && pattern._mask != nullptr && not causal)
+      return false;
+
+    FuseAttention fuse(&pattern, cache_size, causal);
+    fuse.apply();
+    return true;
+  }
+  return false;
+}
+
+} // namespace
+
+namespace luci
+{
+
+bool FuseAttentionPass::run(loco::Graph *g)
+{
+  bool changed = false;
+
+  for (auto node : loco::active_nodes(loco::output_nodes(g)))
+  {
+    auto bmm = dynamic_cast<luci::CircleBatchMatMul *>(node);
+    if (not bmm)
+      continue;
+
+    if (fuse_attention(bmm, _cache_size))
+      changed = true;
+  }
+
+  return changed;
+}
+
+} // namespace luci
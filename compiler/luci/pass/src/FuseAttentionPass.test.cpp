@@ -0,0 +1,337 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "luci/Pass/FuseAttentionPass.h"
+
+#include <luci/IR/CircleNodes.h>
+
+#include <luci/test/TestIOGraph.h>
+
+#include <flatbuffers/flexbuffers.h>
+#include <gtest/gtest.h>
+
+namespace
+{
+
+using namespace luci::test;
+
+/**
+ *  Graph of scaled dot-product attention with 2 heads
+ *
+ *  [Q]   [K]
+ *   |     |
+ *   |  [Transpose]
+ *    \   /
+ *  [BatchMatMul]
+ *       |
+ *     [Mul] (scale)
+ *       |
+ *     [Add] <-- [mask]
+ *       |
+ *   [Softmax]
+ *       |    [V]
+ *        \   /
+ *  [BatchMatMul]
+ */
+class AttentionGraph : public TestIsGraphlet<4>, public TestOGraphlet
+{
+public:
+  AttentionGraph() = default;
+
+  void init(void)
+  {
+    TestIsGraphlet<4>::init(g(), {{1, 2, 4, 8}, {1, 2, 6, 8}, {1, 2, 6, 16}, {1, 1, 4, 6}});
+    TestOGraphlet::init(g(), {1, 2, 4, 16});
+
+    _perm = g()->nodes()->create<luci::CircleConst>();
+    _perm->dtype(loco::DataType::S32);
+    _perm->size<loco::DataType::S32>(4);
+    _perm->shape({4});
+    _perm->at<loco::DataType::S32>(0) = 0;
+    _perm->at<loco::DataType::S32>(1) = 1;
+    _perm->at<loco::DataType::S32>(2) = 3;
+    _perm->at<loco::DataType::S32>(3) = 2;
+    _perm->shape_status(luci::ShapeStatus::VALID);
+    _perm->name("perm");
+
+    _scale = g()->nodes()->create<luci::CircleConst>();
+    _scale->dtype(loco::DataType::FLOAT32);
+    _scale->size<loco::DataType::FLOAT32>(1);
+    _scale->shape({1});
+    _scale->at<loco::DataType::FLOAT32>(0) = 0.125f;
+    _scale->shape_status(luci::ShapeStatus::VALID);
+    _scale->name("scale");
+
+    _transpose = g()->nodes()->create<luci::CircleTranspose>();
+    _transpose->a(input(1));
+    _transpose->perm(_perm);
+    set(_transpose, {1, 2, 8, 6}, "transpose");
+
+    _bmm_qk = g()->nodes()->create<luci::CircleBatchMatMul>();
+    _bmm_qk->x(input(0));
+    _bmm_qk->y(_transpose);
+    set(_bmm_qk, {1, 2, 4, 6}, "bmm_qk");
+
+    _mul = g()->nodes()->create<luci::CircleMul>();
+    _mul->x(_bmm_qk);
+    _mul->y(_scale);
+    _mul->fusedActivationFunction(luci::FusedActFunc::NONE);
+    set(_mul, {1, 2, 4, 6}, "mul");
+
+    _add = g()->nodes()->create<luci::CircleAdd>();
+    _add->x(_mul);
+    _add->y(input(3));
+    _add->fusedActivationFunction(luci::FusedActFunc::NONE);
+    set(_add, {1, 2, 4, 6}, "add");
+
+    _softmax = g()->nodes()->create<luci::CircleSoftmax>();
+    _softmax->logits(_add);
+    _softmax->beta(1.0f);
+    set(_softmax, {1, 2, 4, 6}, "softmax");
+
+    _bmm_v = g()->nodes()->create<luci::CircleBatchMatMul>();
+    _bmm_v->x(_softmax);
+    _bmm_v->y(input(2));
+    set(_bmm_v, {1, 2, 4, 16}, "bmm_v");
+
+    output()->from(_bmm_v);
+  }
+
+private:
+  void set(luci::CircleNode *node, const ShapeU32 shape, const std::string &name)
+  {
+    node->dtype(loco::DataType::FLOAT32);
+    node->shape(shape);
+    node->shape_status(luci::ShapeStatus::VALID);
+    node->name(name);
+  }
+
+public:
+  luci::CircleConst *_perm = nullptr;
+  luci::CircleConst *_scale = nullptr;
+  luci::CircleTranspose *_transpose = nullptr;
+  luci::CircleBatchMatMul *_bmm_qk = nullptr;
+  luci::CircleMul *_mul = nullptr;
+  luci::CircleAdd *_add = nullptr;
+  luci::CircleSoftmax *_softmax = nullptr;
+  luci::CircleBatchMatMul *_bmm_v = nullptr;
+};
+
+class FuseAttentionPassTest : public ::testing::Test
+{
+public:
+  AttentionGraph g;
+  luci::FuseAttentionPass pass;
+};
+
+// Constant mask of [1, 1, 4, 6] where query i attends keys up to (2 + i)
+luci::CircleConst *causal_mask(loco::Graph *g)
+{
+  auto mask = g->nodes()->create<luci::CircleConst>();
+  mask->dtype(loco::DataType::FLOAT32);
+  mask->size<loco::DataType::FLOAT32>(4 * 6);
+  mask->shape({1, 1, 4, 6});
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    for (uint32_t j = 0; j < 6; ++j)
+      mask->at<loco::DataType::FLOAT32>(i * 6 + j) = j <= 2 + i ? 0.0f : -1e9f;
+  }
+  mask->shape_status(luci::ShapeStatus::VALID);
+  mask->name("mask");
+  return mask;
+}
+
+luci::CircleCustom *fused_attention(AttentionGraph &g)
+{
+  auto custom_out = dynamic_cast<luci::CircleCustomOut *>(g.output()->from());
+  if (custom_out == nullptr)
+    return nullptr;
+  return dynamic_cast<luci::CircleCustom *>(custom_out->input());
+}
+
+} // namespace
+
+TEST_F(FuseAttentionPassTest, name)
+{
+  auto const name = pass.name();
+  ASSERT_NE(nullptr, name);
+}
+
+TEST_F(FuseAttentionPassTest, fuse_transposed_key_with_mask)
+{
+  g.init();
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  EXPECT_EQ("ScaledDotProductAttention", attention->custom_code());
+  ASSERT_EQ(4, attention->numInputs());
+  EXPECT_EQ(g.input(0), attention->inputs(0));
+  EXPECT_EQ(g.input(1), attention->inputs(1));
+  EXPECT_EQ(g.input(2), attention->inputs(2));
+  EXPECT_EQ(g.input(3), attention->inputs(3));
+
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_FLOAT_EQ(0.125f, map["scale"].AsFloat());
+
+  auto custom_out = loco::must_cast<luci::CircleCustomOut *>(g.output()->from());
+  EXPECT_EQ(4, custom_out->rank());
+  EXPECT_EQ(16, custom_out->dim(3).value());
+}
+
+TEST_F(FuseAttentionPassTest, fuse_adj_y_without_mask)
+{
+  g.init();
+  // Q * K^T by adj_y, and scale by Div
+  g._bmm_qk->y(g.input(1));
+  g._bmm_qk->adj_y(true);
+  auto div = g.g()->nodes()->create<luci::CircleDiv>();
+  div->x(g._bmm_qk);
+  div->y(g._scale);
+  div->fusedActivationFunction(luci::FusedActFunc::NONE);
+  div->dtype(loco::DataType::FLOAT32);
+  div->shape({1, 2, 4, 6});
+  div->shape_status(luci::ShapeStatus::VALID);
+  g._softmax->logits(div);
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  ASSERT_EQ(3, attention->numInputs());
+  EXPECT_EQ(g.input(1), attention->inputs(1));
+
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_FLOAT_EQ(8.0f, map["scale"].AsFloat());
+}
+
+TEST_F(FuseAttentionPassTest, wrong_perm_NEG)
+{
+  g.init();
+  g._perm->at<loco::DataType::S32>(1) = 3;
+  g._perm->at<loco::DataType::S32>(3) = 1;
+
+  EXPECT_FALSE(pass.run(g.g()));
+}
+
+TEST_F(FuseAttentionPassTest, softmax_beta_NEG)
+{
+  g.init();
+  g._softmax->beta(0.5f);
+
+  EXPECT_FALSE(pass.run(g.g()));
+}
+
+TEST_F(FuseAttentionPassTest, broadcast_query_NEG)
+{
+  g.init();
+  // Query shared over heads can not be fused as output follows shape of query
+  g.input(0)->shape({1, 1, 4, 8});
+
+  EXPECT_FALSE(pass.run(g.g()));
+}
+
+TEST(FuseAttentionPassCacheTest, fuse_with_cache_size)
+{
+  AttentionGraph g;
+  luci::FuseAttentionPass pass{128};
+  g.init();
+  // Attention of new tokens does not take mask
+  g._softmax->logits(g._mul);
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  ASSERT_EQ(3, attention->numInputs());
+
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_FLOAT_EQ(0.125f, map["scale"].AsFloat());
+  EXPECT_EQ(128, map["cache_size"].AsInt32());
+  // Attention is not causal without causal mask
+  EXPECT_TRUE(map["causal"].IsNull());
+}
+
+TEST_F(FuseAttentionPassTest, fuse_causal_mask)
+{
+  g.init();
+  g._add->y(causal_mask(g.g()));
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  ASSERT_EQ(3, attention->numInputs());
+
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_TRUE(map["causal"].AsBool());
+}
+
+TEST(FuseAttentionPassCacheTest, fuse_causal_mask_with_cache_size)
+{
+  AttentionGraph g;
+  luci::FuseAttentionPass pass{128};
+  g.init();
+  g._add->y(causal_mask(g.g()));
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  ASSERT_EQ(3, attention->numInputs());
+
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_EQ(128, map["cache_size"].AsInt32());
+  EXPECT_TRUE(map["causal"].AsBool());
+}
+
+TEST(FuseAttentionPassCacheTest, cache_size_with_non_causal_mask_NEG)
+{
+  AttentionGraph g;
+  luci::FuseAttentionPass pass{128};
+  g.init();
+  auto mask = causal_mask(g.g());
+  // Query 0 attends key 3 which is after it
+  mask->at<loco::DataType::FLOAT32>(3) = 0.0f;
+  g._add->y(mask);
+
+  EXPECT_FALSE(pass.run(g.g()));
+}
+
+TEST_F(FuseAttentionPassTest, no_cache_size)
+{
+  g.init();
+
+  EXPECT_TRUE(pass.run(g.g()));
+
+  auto attention = fused_attention(g);
+  ASSERT_NE(nullptr, attention);
+  const auto map = flexbuffers::GetRoot(attention->custom_options()).AsMap();
+  EXPECT_TRUE(map["cache_size"].IsNull());
+  // Mask of graph input is not fused into causal
+  ASSERT_EQ(4, attention->numInputs());
+  EXPECT_TRUE(map["causal"].IsNull());
+}
+
+TEST(FuseAttentionPassCacheTest, cache_size_with_mask_NEG)
+{
+  AttentionGraph g;
+  luci::FuseAttentionPass pass{128};
+  g.init();
+
+  EXPECT_FALSE(pass.run(g.g()));
+}
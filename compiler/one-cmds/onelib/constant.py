@@ -49,6 +49,7 @@ class CONSTANT:
         'fuse_prelu',
         'fuse_gelu',
         'fuse_rsqrt',
+        'fuse_attention',
         'fuse_mean_with_mean',
         'fuse_mul_with_conv',
         'fuse_mul_with_div',
@@ -146,6 +147,8 @@ class CONSTANT:
         ('fuse_prelu', 'fuse ops to PReLU operator'),
         ('fuse_gelu', 'fuse ops to GeLU operator'),
         ('fuse_rsqrt', 'fuse ops to Rsqrt operator'),
+        ('fuse_attention', 'fuse scaled dot-product attention to ScaledDotProductAttention'
+         ' custom op, which is supported by onert only'),
         ('replace_cw_mul_add_with_depthwise_conv',
          'replace channel-wise Mul/Add with DepthwiseConv2D'),
         ('remove_fakequant', 'remove FakeQuant ops'),
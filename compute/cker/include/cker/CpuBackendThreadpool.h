@@ -21,7 +21,11 @@
 #include <ruy/context.h>     // from @ruy
 #include <ruy/thread_pool.h> // from @ruy
 
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
 #include <stdexcept>
+#include <vector>
 
 namespace nnfw
 {
@@ -44,6 +48,69 @@ void Execute(int tasks_count, TaskType *tasks, ruy::Context *ruy_context)
   ruy_context->mutable_thread_pool()->Execute(tasks_count, tasks);
 }
 
+// Number of threads to split 'work' over 'num_units' units, where one more thread is used for
+// each 'min_work_per_thread' of work. Small work stays on the calling thread, since waking up
+// workers costs more than it saves. Work is in any unit of the caller, e.g. bytes to move or
+// multiplications.
+inline int HowManyThreads(int64_t work, int64_t min_work_per_thread, int num_units,
+                          ruy::Context *ruy_context)
+{
+  assert(min_work_per_thread > 0);
+  const int max_threads = (ruy_context == nullptr) ? 1 : ruy_context->max_num_threads();
+  const int64_t by_work = std::min<int64_t>(work / min_work_per_thread, max_threads);
+  return std::max(1, std::min({static_cast<int>(by_work), num_units, max_threads}));
+}
+
+// Runs fn(unit_start, unit_end) for ranges of units [0, num_units) on threads of ruy_context.
+// Ranges are split evenly over thread_count threads, and fn runs on the calling thread if
+// thread_count is 1.
+template <typename Fn>
+inline void ParallelFor(int num_units, int thread_count, ruy::Context *ruy_context, const Fn &fn)
+{
+  if (thread_count <= 1 || num_units <= 1)
+  {
+    fn(0, num_units);
+    return;
+  }
+
+  struct RangeTask : Task
+  {
+    RangeTask(const Fn &fn, int unit_start, int unit_end)
+      : fn_(fn), unit_start_(unit_start), unit_end_(unit_end)
+    {
+    }
+    void Run() override { fn_(unit_start_, unit_end_); }
+
+  private:
+    const Fn &fn_;
+    int unit_start_;
+    int unit_end_;
+  };
+
+  thread_count = std::min(thread_count, num_units);
+  std::vector<RangeTask> tasks;
+  tasks.reserve(thread_count);
+  int unit_start = 0;
+  for (int i = 0; i < thread_count; ++i)
+  {
+    int unit_end = unit_start + (num_units - unit_start) / (thread_count - i);
+    tasks.emplace_back(fn, unit_start, unit_end);
+    unit_start = unit_end;
+  }
+  Execute(tasks.size(), tasks.data(), ruy_context);
+}
+
+// Runs fn(unit_start, unit_end) for ranges of units in parallel if each thread has at least
+// 'min_work_per_thread' of work, where each unit has 'work_per_unit'
+template <typename Fn>
+inline void ParallelFor(int num_units, int64_t work_per_unit, int64_t min_work_per_thread,
+                        ruy::Context *ruy_context, const Fn &fn)
+{
+  const int thread_count = HowManyThreads(static_cast<int64_t>(num_units) * work_per_unit,
+                                          min_work_per_thread, num_units, ruy_context);
+  ParallelFor(num_units, thread_count, ruy_context, fn);
+}
+
 } // namespace cpu_backend_threadpool
 } // namespace cker
 } // namespace nnfw
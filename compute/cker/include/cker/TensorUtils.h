@@ -21,6 +21,7 @@
 #include "cker/Types.h"
 #include "cker/PortableTensorUtils.h"
 #include "cker/NeonTensorUtils.h"
+#include "cker/X86TensorUtils.h"
 #include "cker/neon/neon_check.h"
 
 #include <cstring>
@@ -111,6 +111,9 @@ struct SoftmaxParams
   float *table;
   uint8_t *uint8_table1;
   uint8_t *uint8_table2;
+  // int16 lookup tables of exp(x) and 1 / (1 + x)
+  int16_t *exp_lut;
+  int16_t *one_over_one_plus_x_lut;
 };
 
 struct PackParams
@@ -301,6 +304,18 @@ struct GatherParams
   int32_t axis;
 };
 
+struct AttentionParams
+{
+  // Multiplied to query-key products before softmax
+  float scale;
+  // Number of leading rows of key and value to attend, e.g. filled part of a kv cache.
+  // -1 for all rows. Rows of key shape are still the stride between heads.
+  int32_t key_len = -1;
+  // Query i attends only keys up to (key_len - query_len + i), i.e. queries are the last tokens
+  // of the sequence of keys
+  bool causal = false;
+};
+
 struct InstanceNormParams
 {
   float epsilon;
@@ -23,7 +23,9 @@
 #include "neon/neon_check.h"
 
 #include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 #include <fixedpoint/fixedpoint.h>
 
 namespace nnfw
@@ -99,6 +101,22 @@ inline int32_t MultiplyByQuantizedMultiplier(int32_t x, int32_t quantized_multip
     right_shift);
 }
 
+// Requantizes 64 bits accumulator of int16 activation kernels
+// x should be in the range of [-(1 << 47), (1 << 47)) and the result should fit in int32_t.
+inline int32_t MultiplyByQuantizedMultiplier(int64_t x, int32_t quantized_multiplier, int shift)
+{
+  assert(quantized_multiplier >= 0);
+  assert(shift >= -31 && shift < 8);
+  assert(x >= -(static_cast<int64_t>(1) << 47) && x < (static_cast<int64_t>(1) << 47));
+
+  // Use 16 bits multiplier to keep the product within 64 bits
+  const int32_t reduced_multiplier =
+    (quantized_multiplier < 0x7FFF0000) ? ((quantized_multiplier + (1 << 15)) >> 16) : 0x7FFF;
+  const int total_shift = 15 - shift;
+  const int64_t round = static_cast<int64_t>(1) << (total_shift - 1);
+  return static_cast<int32_t>((x * reduced_multiplier + round) >> total_shift);
+}
+
 inline int32_t MultiplyByQuantizedMultiplierGreaterThanOne(int32_t x, int32_t quantized_multiplier,
                                                            int left_shift)
 {
@@ -459,6 +477,60 @@ template <typename T> void optimized_ops_preload_l1_keep(const T *ptr)
 #endif
 }
 
+// Populates a lookup table of 513 entries for int16 functions. Entries sample transform(x) for x in
+// [input_min, input_max] evenly, which is mapped to the whole int16 range of lookup values, and are
+// quantized by output_scale with zero point 0. Each entry is biased by half of interpolation error
+// at the midpoint of its interval.
+template <typename Fn>
+inline void PopulateInt16LookupTable(const Fn &transform, double input_min, double input_max,
+                                     double output_scale, int16_t *lut)
+{
+  const double table_min = std::numeric_limits<int16_t>::min();
+  const double table_max = std::numeric_limits<int16_t>::max();
+  const double output_scale_inv = 1.0 / output_scale;
+
+  constexpr int kNumSteps = 512;
+  const double step = (input_max - input_min) / kNumSteps;
+  for (int i = 0; i < kNumSteps; ++i)
+  {
+    const double val = std::round(transform(input_min + i * step) * output_scale_inv);
+    const double val_next = transform(input_min + (i + 1) * step) * output_scale_inv;
+    const double val_midpoint =
+      std::round(transform(input_min + i * step + step / 2) * output_scale_inv);
+    const double midpoint_interp_val = std::round((val_next + val) / 2);
+    const double bias = std::round((midpoint_interp_val - val_midpoint) / 2);
+    lut[i] = static_cast<int16_t>(std::min(std::max(val - bias, table_min), table_max));
+  }
+  lut[kNumSteps] = static_cast<int16_t>(
+    std::min(std::max(std::round(transform(input_max) * output_scale_inv), table_min), table_max));
+}
+
+// Populates a lookup table of an int16 activation function, whose input and output zero points
+// are 0
+template <typename Fn>
+inline void PopulateInt16ActivationLookupTable(const Fn &transform, double input_scale,
+                                               double output_scale, int16_t *lut)
+{
+  PopulateInt16LookupTable(transform, input_scale * std::numeric_limits<int16_t>::min(),
+                           input_scale * std::numeric_limits<int16_t>::max(), output_scale, lut);
+}
+
+// Looks up a table populated by PopulateInt16LookupTable with linear interpolation
+inline int16_t LookupInt16(int16_t value, const int16_t *lut)
+{
+  // 512 base values, lut[512] is only used to calculate the slope
+  const uint16_t index = static_cast<uint16_t>(256 + (value >> 7));
+  assert(index < 512);
+  const int16_t offset = value & 0x7f;
+
+  const int32_t base = lut[index];
+  const int32_t slope = lut[index + 1] - lut[index];
+  // Q0.15 * Q0.7 = Q0.22, which is rounded to Q0.15
+  const int32_t delta = (slope * offset + 64) >> 7;
+  const int32_t result = std::max<int32_t>(base + delta, std::numeric_limits<int16_t>::min());
+  return static_cast<int16_t>(std::min<int32_t>(result, std::numeric_limits<int16_t>::max()));
+}
+
 // Writes randomly accessed values from `input` sequentially into `output`.
 template <typename T> class SequentialTensorWriter
 {
@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_TENSOR_UTILS_H__
+#define __NNFW_CKER_X86_TENSOR_UTILS_H__
+
+#include "cker/PortableTensorUtils.h"
+#include "cker/x86/x86_check.h"
+
+#include <cmath>
+#include <cstring>
+
+#ifdef USE_X86_SIMD
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+X86_TARGET_AVX2 inline void CwiseClippingAvx2(float *vector, const int v_size,
+                                              const float clipping_value)
+{
+  const __m256 max_value = _mm256_set1_ps(clipping_value);
+  const __m256 min_value = _mm256_set1_ps(-clipping_value);
+  int i = 0;
+  for (; i <= v_size - 8; i += 8)
+  {
+    const __m256 value = _mm256_loadu_ps(vector + i);
+    _mm256_storeu_ps(vector + i, _mm256_max_ps(_mm256_min_ps(max_value, value), min_value));
+  }
+  for (; i < v_size; i++)
+  {
+    vector[i] = std::max(std::min(clipping_value, vector[i]), -clipping_value);
+  }
+}
+
+X86_TARGET_AVX2 inline bool IsZeroVectorAvx2(const float *vector, int v_size)
+{
+  const __m256 zero = _mm256_setzero_ps();
+  int i = 0;
+  for (; i <= v_size - 8; i += 8)
+  {
+    const __m256 not_zero = _mm256_cmp_ps(_mm256_loadu_ps(vector + i), zero, _CMP_NEQ_UQ);
+    if (_mm256_movemask_ps(not_zero) != 0)
+      return false;
+  }
+  for (; i < v_size; ++i)
+  {
+    if (vector[i] != 0.0f)
+      return false;
+  }
+  return true;
+}
+
+X86_TARGET_AVX2 inline void Sub1VectorAvx2(const float *vector, int v_size, float *result)
+{
+  const __m256 one = _mm256_set1_ps(1.0f);
+  int v = 0;
+  for (; v <= v_size - 8; v += 8)
+  {
+    _mm256_storeu_ps(result + v, _mm256_sub_ps(one, _mm256_loadu_ps(vector + v)));
+  }
+  for (; v < v_size; v++)
+  {
+    result[v] = 1.0f - vector[v];
+  }
+}
+
+X86_TARGET_AVX2 inline void SymmetricQuantizeFloatsAvx2(const float *values, const int size,
+                                                        int8_t *quantized_values, float *min_value,
+                                                        float *max_value, float *scaling_factor)
+{
+  if (size == 0)
+  {
+    // Keep behavior of portable code for empty input
+    PortableSymmetricQuantizeFloats(values, size, quantized_values, min_value, max_value,
+                                    scaling_factor);
+    return;
+  }
+
+  __m256 min_vec = _mm256_set1_ps(values[0]);
+  __m256 max_vec = min_vec;
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m256 value = _mm256_loadu_ps(values + i);
+    min_vec = _mm256_min_ps(min_vec, value);
+    max_vec = _mm256_max_ps(max_vec, value);
+  }
+  float min = -ReduceMax(_mm256_sub_ps(_mm256_setzero_ps(), min_vec));
+  float max = ReduceMax(max_vec);
+  for (; i < size; ++i)
+  {
+    min = std::min(min, values[i]);
+    max = std::max(max, values[i]);
+  }
+  *min_value = min;
+  *max_value = max;
+
+  const int kScale = 127;
+  const float range = std::max(std::abs(min), std::abs(max));
+  if (range == 0)
+  {
+    memset(quantized_values, 0, size * sizeof(int8_t));
+    *scaling_factor = 1;
+    return;
+  }
+  *scaling_factor = range / kScale;
+  const float scaling_factor_inv = kScale / range;
+
+  const __m256 inv = _mm256_set1_ps(scaling_factor_inv);
+  const __m256 max_q = _mm256_set1_ps(kScale);
+  const __m256 min_q = _mm256_set1_ps(-kScale);
+  i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    __m256 low = RoundHalfAwayFromZero(_mm256_mul_ps(_mm256_loadu_ps(values + i), inv));
+    __m256 high = RoundHalfAwayFromZero(_mm256_mul_ps(_mm256_loadu_ps(values + i + 8), inv));
+    low = _mm256_max_ps(_mm256_min_ps(low, max_q), min_q);
+    high = _mm256_max_ps(_mm256_min_ps(high, max_q), min_q);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(quantized_values + i),
+                     PackInt32ToInt8(_mm256_cvtps_epi32(low), _mm256_cvtps_epi32(high)));
+  }
+  for (; i < size; ++i)
+  {
+    const int32_t quantized_value =
+      static_cast<int32_t>(std::round(values[i] * scaling_factor_inv));
+    quantized_values[i] = std::min(kScale, std::max(-kScale, quantized_value));
+  }
+}
+
+X86_TARGET_AVX2 inline void
+MatrixBatchVectorMultiplyAccumulateAvx2(const float *matrix, int m_rows, int m_cols,
+                                        const float *vector, int n_batch, float *result,
+                                        int result_stride)
+{
+  float *result_in_batch = result;
+  for (int b = 0; b < n_batch; b++)
+  {
+    const float *vector_in_batch = vector + b * m_cols;
+    const float *matrix_ptr = matrix;
+    for (int r = 0; r < m_rows; r++, matrix_ptr += m_cols)
+    {
+      __m256 acc0 = _mm256_setzero_ps();
+      __m256 acc1 = _mm256_setzero_ps();
+      int c = 0;
+      for (; c <= m_cols - 16; c += 16)
+      {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_ptr + c),
+                               _mm256_loadu_ps(vector_in_batch + c), acc0);
+        acc1 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_ptr + c + 8),
+                               _mm256_loadu_ps(vector_in_batch + c + 8), acc1);
+      }
+      for (; c <= m_cols - 8; c += 8)
+      {
+        acc0 = _mm256_fmadd_ps(_mm256_loadu_ps(matrix_ptr + c),
+                               _mm256_loadu_ps(vector_in_batch + c), acc0);
+      }
+      float dot_prod = ReduceAdd(_mm256_add_ps(acc0, acc1));
+      for (; c < m_cols; c++)
+      {
+        dot_prod += matrix_ptr[c] * vector_in_batch[c];
+      }
+      *result_in_batch += dot_prod;
+      result_in_batch += result_stride;
+    }
+  }
+}
+
+X86_TARGET_AVX512 inline void
+MatrixBatchVectorMultiplyAccumulateAvx512(const float *matrix, int m_rows, int m_cols,
+                                          const float *vector, int n_batch, float *result,
+                                          int result_stride)
+{
+  float *result_in_batch = result;
+  for (int b = 0; b < n_batch; b++)
+  {
+    const float *vector_in_batch = vector + b * m_cols;
+    const float *matrix_ptr = matrix;
+    for (int r = 0; r < m_rows; r++, matrix_ptr += m_cols)
+    {
+      __m512 acc0 = _mm512_setzero_ps();
+      __m512 acc1 = _mm512_setzero_ps();
+      int c = 0;
+      for (; c <= m_cols - 32; c += 32)
+      {
+        acc0 = _mm512_fmadd_ps(_mm512_loadu_ps(matrix_ptr + c),
+                               _mm512_loadu_ps(vector_in_batch + c), acc0);
+        acc1 = _mm512_fmadd_ps(_mm512_loadu_ps(matrix_ptr + c + 16),
+                               _mm512_loadu_ps(vector_in_batch + c + 16), acc1);
+      }
+      // Remaining columns are loaded with mask
+      for (; c < m_cols; c += 16)
+      {
+        const int remain = std::min(16, m_cols - c);
+        const __mmask16 mask = static_cast<__mmask16>((1u << remain) - 1);
+        acc0 = _mm512_fmadd_ps(_mm512_maskz_loadu_ps(mask, matrix_ptr + c),
+                               _mm512_maskz_loadu_ps(mask, vector_in_batch + c), acc0);
+      }
+      *result_in_batch += ReduceAdd(_mm512_add_ps(acc0, acc1));
+      result_in_batch += result_stride;
+    }
+  }
+}
+
+X86_TARGET_AVX2 inline void
+MatrixBatchVectorMultiplyAccumulateAvx2(const int8_t *matrix, const int m_rows, const int m_cols,
+                                        const int8_t *vectors, const float *scaling_factors,
+                                        int n_batch, float *result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      // Products of int8 are summed in pairs into int32 by madd
+      __m256i acc = _mm256_setzero_si256();
+      int col = 0;
+      for (; col <= m_cols - 16; col += 16)
+      {
+        const __m256i m = _mm256_cvtepi8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(row_ptr + col)));
+        const __m256i v = _mm256_cvtepi8_epi16(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(vectors + col)));
+        acc = _mm256_add_epi32(acc, _mm256_madd_epi16(m, v));
+      }
+      int32_t dotprod = ReduceAdd(acc);
+      for (; col < m_cols; ++col)
+      {
+        dotprod += row_ptr[col] * vectors[col];
+      }
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+X86_TARGET_AVX512 inline void
+MatrixBatchVectorMultiplyAccumulateAvx512(const int8_t *matrix, const int m_rows,
+                                          const int m_cols, const int8_t *vectors,
+                                          const float *scaling_factors, int n_batch,
+                                          float *result, int result_stride)
+{
+  for (int batch = 0; batch < n_batch; ++batch, vectors += m_cols)
+  {
+    const float batch_scaling_factor = scaling_factors[batch];
+    const int8_t *row_ptr = matrix;
+    for (int row = 0; row < m_rows; ++row, row_ptr += m_cols, result += result_stride)
+    {
+      __m512i acc = _mm512_setzero_si512();
+      int col = 0;
+      for (; col <= m_cols - 32; col += 32)
+      {
+        const __m512i m = _mm512_cvtepi8_epi16(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(row_ptr + col)));
+        const __m512i v = _mm512_cvtepi8_epi16(
+          _mm256_loadu_si256(reinterpret_cast<const __m256i *>(vectors + col)));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(m, v));
+      }
+      if (col < m_cols)
+      {
+        const __mmask64 mask = (1ull << (m_cols - col)) - 1;
+        const __m256i m_i8 = ExtractHalf<0>(_mm512_maskz_loadu_epi8(mask, row_ptr + col));
+        const __m256i v_i8 = ExtractHalf<0>(_mm512_maskz_loadu_epi8(mask, vectors + col));
+        acc = _mm512_add_epi32(
+          acc, _mm512_madd_epi16(_mm512_cvtepi8_epi16(m_i8), _mm512_cvtepi8_epi16(v_i8)));
+      }
+      const int32_t dotprod = ReduceAdd(acc);
+      *result += dotprod * batch_scaling_factor;
+    }
+  }
+}
+
+} // namespace x86
+
+inline void X86CwiseClipping(float *vector, const int v_size, const float clipping_value)
+{
+  if (x86::HasAvx2())
+    x86::CwiseClippingAvx2(vector, v_size, clipping_value);
+  else
+    PortableCwiseClipping(vector, v_size, clipping_value);
+}
+
+inline bool X86IsZeroVector(const float *vector, int v_size)
+{
+  if (x86::HasAvx2())
+    return x86::IsZeroVectorAvx2(vector, v_size);
+  return PortableIsZeroVector(vector, v_size);
+}
+
+inline void X86Sub1Vector(const float *vector, int v_size, float *result)
+{
+  if (x86::HasAvx2())
+    x86::Sub1VectorAvx2(vector, v_size, result);
+  else
+    PortableSub1Vector(vector, v_size, result);
+}
+
+inline void X86SymmetricQuantizeFloats(const float *values, const int size,
+                                       int8_t *quantized_values, float *min_value,
+                                       float *max_value, float *scaling_factor)
+{
+  if (x86::HasAvx2())
+    x86::SymmetricQuantizeFloatsAvx2(values, size, quantized_values, min_value, max_value,
+                                     scaling_factor);
+  else
+    PortableSymmetricQuantizeFloats(values, size, quantized_values, min_value, max_value,
+                                    scaling_factor);
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows,
+                                                   const int m_cols, const int8_t *vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   float *result, int result_stride)
+{
+  if (x86::HasAvx512())
+    x86::MatrixBatchVectorMultiplyAccumulateAvx512(matrix, m_rows, m_cols, vectors,
+                                                   scaling_factors, n_batch, result, result_stride);
+  else if (x86::HasAvx2())
+    x86::MatrixBatchVectorMultiplyAccumulateAvx2(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                                 n_batch, result, result_stride);
+  else
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors,
+                                                n_batch, result, result_stride);
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const int8_t *matrix, const int m_rows,
+                                                   const int m_cols, const int8_t *vectors,
+                                                   const float *scaling_factors, int n_batch,
+                                                   int32_t *, float *result, int result_stride,
+                                                   ruy::Context *)
+{
+  X86MatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vectors, scaling_factors, n_batch,
+                                         result, result_stride);
+}
+
+inline void X86MatrixBatchVectorMultiplyAccumulate(const float *matrix, int m_rows, int m_cols,
+                                                   const float *vector, int n_batch, float *result,
+                                                   int result_stride)
+{
+  if (x86::HasAvx512())
+    x86::MatrixBatchVectorMultiplyAccumulateAvx512(matrix, m_rows, m_cols, vector, n_batch, result,
+                                                   result_stride);
+  else if (x86::HasAvx2())
+    x86::MatrixBatchVectorMultiplyAccumulateAvx2(matrix, m_rows, m_cols, vector, n_batch, result,
+                                                 result_stride);
+  else
+    PortableMatrixBatchVectorMultiplyAccumulate(matrix, m_rows, m_cols, vector, n_batch, result,
+                                                result_stride);
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // USE_X86_SIMD
+
+#endif // __NNFW_CKER_X86_TENSOR_UTILS_H__
@@ -21,6 +21,7 @@
 // #if defined(CKER_OPTIMIZED_EIGEN)
 
 #include <Eigen/Core>
+#include <atomic>
 #include <thread>
 #include "cker/eigen/eigen_spatial_convolutions.h"
 
@@ -90,7 +91,9 @@ struct EigenContext
 
   EigenContext()
   {
-    int num_threads = std::thread::hardware_concurrency();
+    int num_threads = MaxNumThreads().load();
+    if (num_threads <= 0)
+      num_threads = std::thread::hardware_concurrency();
     if (num_threads == 0)
     {
       num_threads = default_num_threadpool_threads;
@@ -100,6 +103,14 @@ struct EigenContext
     device.reset(new Eigen::ThreadPoolDevice(thread_pool_wrapper.get(), num_threads));
   }
 
+  // Number of threads of the pool, which is applied when it is created on first use.
+  // Hardware concurrency is used if it is 0 or less.
+  static inline std::atomic<int> &MaxNumThreads()
+  {
+    static std::atomic<int> max_num_threads{0};
+    return max_num_threads;
+  }
+
   static inline EigenContext &GetEigenContext()
   {
     static EigenContext instance;
@@ -18,6 +18,8 @@
 #ifndef __NNFW_CKER_NEON_CHECK_H__
 #define __NNFW_CKER_NEON_CHECK_H__
 
+#include "cker/x86/x86_check.h"
+
 #if defined(__ARM_NEON__) || defined(__ARM_NEON)
 #define USE_NEON
 #include <arm_neon.h>
@@ -37,11 +39,15 @@
 #endif
 
 // NEON_OR_PORTABLE(SomeFunc, args) calls NeonSomeFunc(args) if USE_NEON is
-// defined, PortableSomeFunc(args) otherwise.
+// defined, X86SomeFunc(args) if USE_X86_SIMD is defined, PortableSomeFunc(args) otherwise.
 #ifdef USE_NEON
 // Always use Neon code
 #define NEON_OR_PORTABLE(funcname, ...) Neon##funcname(__VA_ARGS__)
 
+#elif defined(USE_X86_SIMD)
+// X86 code checks CPU features at runtime and falls back to Portable code
+#define NEON_OR_PORTABLE(funcname, ...) X86##funcname(__VA_ARGS__)
+
 #else
 // No NEON available: Use Portable code
 #define NEON_OR_PORTABLE(funcname, ...) Portable##funcname(__VA_ARGS__)
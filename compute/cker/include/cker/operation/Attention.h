@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_ATTENTION_H__
+#define __NNFW_CKER_ATTENTION_H__
+
+#include "cker/CpuBackendThreadpool.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/eigen/Utils.h"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace attention
+{
+
+// Rows of query and key processed at once. A tile of scores (kQueryBlock x kKeyBlock) and
+// a tile of key and value rows stay in cache while they are used.
+constexpr int kQueryBlock = 32;
+constexpr int kKeyBlock = 64;
+
+// How many multiply-adds are needed to make it worth using one more thread
+constexpr int64_t kMinWorkPerThread = 1 << 16;
+
+// Stride of dim 'i' of 4D extended 'shape' to be used for output index,
+// or 0 if the dim is broadcasted
+inline int BroadcastStride(const Shape &shape, int i, int stride)
+{
+  return shape.Dims(i) == 1 ? 0 : stride;
+}
+
+} // namespace attention
+
+/**
+ * @brief Scaled dot-product attention, softmax(query * key^T * scale + mask) * value
+ *
+ * query : [batch, heads, query_len, depth]
+ * key   : [batch, heads, key_len, depth]
+ * value : [batch, heads, key_len, value_depth]
+ * mask  : [batch, heads, query_len, key_len], optional (mask_data can be nullptr)
+ * output: [batch, heads, query_len, value_depth]
+ *
+ * Shapes of lower ranks are extended to 4D. Each dim of key, value and mask can be 1 to be
+ * broadcasted to the dim of query (or key_len for the last dim of mask).
+ *
+ * If params.key_len is given, only the first key_len rows of each head of key and value are
+ * attended, so that a preallocated kv cache can be used as key and value. If params.causal is
+ * set, query i is the (key_len - query_len + i)-th token and attends keys up to itself.
+ *
+ * Scores are computed by tiles and normalized with online softmax: each query row keeps
+ * the running max and the sum of exponentials, and rescales its accumulated output whenever
+ * the max grows. So [query_len, key_len] scores are never materialized.
+ *
+ * A query row whose scores are all -inf gets zeros.
+ */
+inline void Attention(const AttentionParams &params, const Shape &query_shape,
+                      const float *query_data, const Shape &key_shape, const float *key_data,
+                      const Shape &value_shape, const float *value_data, const Shape &mask_shape,
+                      const float *mask_data, const Shape &output_shape, float *output_data,
+                      ruy::Context *ruy_context = nullptr)
+{
+  using attention::BroadcastStride;
+  using attention::kKeyBlock;
+  using attention::kQueryBlock;
+
+  assert(query_shape.DimensionsCount() <= 4);
+  assert(key_shape.DimensionsCount() <= 4);
+  assert(value_shape.DimensionsCount() <= 4);
+  assert(output_shape.DimensionsCount() <= 4);
+
+  const Shape query = Shape::ExtendedShape(4, query_shape);
+  const Shape key = Shape::ExtendedShape(4, key_shape);
+  const Shape value = Shape::ExtendedShape(4, value_shape);
+
+  const int batches = query.Dims(0);
+  const int heads = query.Dims(1);
+  const int query_len = query.Dims(2);
+  const int depth = query.Dims(3);
+  const int key_rows = key.Dims(2);
+  const int key_len = params.key_len < 0 ? key_rows : params.key_len;
+  const int value_depth = value.Dims(3);
+  assert(key.Dims(3) == depth);
+  assert(value.Dims(2) == key_rows);
+  assert(key_len <= key_rows);
+  assert(output_shape.FlatSize() == batches * heads * query_len * value_depth);
+  UNUSED_RELEASE(output_shape);
+
+  const int key_head_stride = BroadcastStride(key, 1, key_rows * depth);
+  const int key_batch_stride = BroadcastStride(key, 0, key.Dims(1) * key_rows * depth);
+  const int value_head_stride = BroadcastStride(value, 1, key_rows * value_depth);
+  const int value_batch_stride =
+    BroadcastStride(value, 0, value.Dims(1) * key_rows * value_depth);
+
+  int mask_col_stride = 0;
+  int mask_row_stride = 0;
+  int mask_head_stride = 0;
+  int mask_batch_stride = 0;
+  if (mask_data != nullptr)
+  {
+    assert(mask_shape.DimensionsCount() <= 4);
+    const Shape mask = Shape::ExtendedShape(4, mask_shape);
+    const int mask_cols = mask.Dims(3);
+    mask_col_stride = BroadcastStride(mask, 3, 1);
+    mask_row_stride = BroadcastStride(mask, 2, mask_cols);
+    mask_head_stride = BroadcastStride(mask, 1, mask.Dims(2) * mask_cols);
+    mask_batch_stride = BroadcastStride(mask, 0, mask.Dims(1) * mask.Dims(2) * mask_cols);
+  }
+
+  if (query_len == 0 || value_depth == 0)
+    return;
+
+  const int query_blocks = (query_len + kQueryBlock - 1) / kQueryBlock;
+  const int num_units = batches * heads * query_blocks;
+  const int64_t work_per_unit = static_cast<int64_t>(std::min(query_len, kQueryBlock)) *
+                                key_len * (depth + value_depth);
+  const float scale = params.scale;
+  // Last key attended by query 0 is causal_offset with causal masking
+  const int causal_offset = key_len - query_len;
+  constexpr float kNegInf = -std::numeric_limits<float>::infinity();
+
+  // Each unit computes kQueryBlock rows of output of a head
+  cpu_backend_threadpool::ParallelFor(
+    num_units, work_per_unit, attention::kMinWorkPerThread, ruy_context,
+    [&](int unit_start, int unit_end) {
+      std::vector<float> scores(kQueryBlock * kKeyBlock);
+      float row_max[kQueryBlock];
+      float row_sum[kQueryBlock];
+
+      for (int unit = unit_start; unit < unit_end; ++unit)
+      {
+        const int q_block = unit % query_blocks;
+        const int h = (unit / query_blocks) % heads;
+        const int b = unit / query_blocks / heads;
+        const int q_start = q_block * kQueryBlock;
+        const int q_rows = std::min(kQueryBlock, query_len - q_start);
+
+        const float *q_ptr = query_data + ((b * heads + h) * query_len + q_start) * depth;
+        const float *k_head = key_data + b * key_batch_stride + h * key_head_stride;
+        const float *v_head = value_data + b * value_batch_stride + h * value_head_stride;
+        const float *m_head = mask_data == nullptr
+                                ? nullptr
+                                : mask_data + b * mask_batch_stride + h * mask_head_stride;
+        float *o_ptr = output_data + ((b * heads + h) * query_len + q_start) * value_depth;
+
+        // Matrices are column-major, so row-major [rows, cols] is mapped as (cols x rows)
+        const MatrixMap<const float> q_mat(q_ptr, depth, q_rows);
+        MatrixMap<float> o_mat(o_ptr, value_depth, q_rows);
+        o_mat.setZero();
+        std::fill(row_max, row_max + q_rows, kNegInf);
+        std::fill(row_sum, row_sum + q_rows, 0.f);
+
+        // Keys after the last query of the block are masked out with causal masking
+        const int k_end =
+          params.causal ? std::min(key_len, causal_offset + q_start + q_rows) : key_len;
+        for (int k_start = 0; k_start < k_end; k_start += kKeyBlock)
+        {
+          const int k_rows = std::min(kKeyBlock, k_end - k_start);
+          const MatrixMap<const float> k_mat(k_head + k_start * depth, depth, k_rows);
+          const MatrixMap<const float> v_mat(v_head + k_start * value_depth, value_depth, k_rows);
+          MatrixMap<float> s_mat(scores.data(), k_rows, q_rows);
+
+          // scores[q_rows, k_rows] = query * key^T
+          s_mat.noalias() = k_mat.transpose() * q_mat;
+
+          for (int i = 0; i < q_rows; ++i)
+          {
+            auto s_row = s_mat.col(i).array();
+            s_row *= scale;
+            if (m_head != nullptr)
+            {
+              const float *m_ptr =
+                m_head + (q_start + i) * mask_row_stride + k_start * mask_col_stride;
+              if (mask_col_stride == 0)
+                s_row += m_ptr[0];
+              else
+                s_row += Eigen::Map<const Eigen::ArrayXf>(m_ptr, k_rows);
+            }
+            if (params.causal)
+            {
+              const int visible = causal_offset + q_start + i + 1 - k_start;
+              if (visible < k_rows)
+                s_row.tail(k_rows - std::max(visible, 0)).setConstant(kNegInf);
+            }
+
+            const float new_max = std::max(row_max[i], s_row.maxCoeff());
+            if (new_max == kNegInf)
+            {
+              // Nothing to attend yet
+              s_row.setZero();
+              continue;
+            }
+
+            s_row = (s_row - new_max).exp();
+            const float correction = std::exp(row_max[i] - new_max);
+            row_sum[i] = row_sum[i] * correction + s_row.sum();
+            row_max[i] = new_max;
+            if (correction != 1.f)
+              o_mat.col(i) *= correction;
+          }
+
+          // output[q_rows, value_depth] += probs * value
+          o_mat.noalias() += v_mat * s_mat;
+        }
+
+        for (int i = 0; i < q_rows; ++i)
+        {
+          if (row_sum[i] > 0.f)
+            o_mat.col(i) *= 1.f / row_sum[i];
+        }
+      }
+    });
+}
+
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_ATTENTION_H__
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include "cker/operation/optimized/BinaryArithmeticOps.h"
 #include "cker/operation/reference/BinaryArithmeticOps.h"
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -362,6 +363,179 @@ inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const S
   }
 }
 
+// Quantized int16 add/sub/mul, whose zero points are all 0
+template <BinaryArithmeticOpType op_type>
+inline int16_t BinaryArithmeticInt16(const BinaryArithmeticOpParam &params, int16_t input1,
+                                     int16_t input2)
+{
+  int32_t result = 0;
+  if (op_type == BinaryArithmeticOpType::MUL)
+  {
+    result = MultiplyByQuantizedMultiplier(static_cast<int32_t>(input1) * input2,
+                                           params.output_multiplier, params.output_shift);
+  }
+  else
+  {
+    // input2_multiplier is negated for SUB
+    const int32_t scaled_input1 = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+      static_cast<int32_t>(input1) * (1 << params.left_shift), params.input1_multiplier,
+      params.input1_shift);
+    const int32_t scaled_input2 = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+      static_cast<int32_t>(input2) * (1 << params.left_shift), params.input2_multiplier,
+      params.input2_shift);
+    result = MultiplyByQuantizedMultiplierSmallerThanOneExp(
+      scaled_input1 + scaled_input2, params.output_multiplier, params.output_shift);
+  }
+  result += params.output_offset;
+  result = std::max(result, params.quantized_activation_min);
+  result = std::min(result, params.quantized_activation_max);
+  return static_cast<int16_t>(result);
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BinaryArithmeticOp(const BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                               const int16_t *input1_data, const Shape &input2_shape,
+                               const int16_t *input2_data, const Shape &output_shape,
+                               int16_t *output_data)
+{
+  if (op_type != BinaryArithmeticOpType::ADD && op_type != BinaryArithmeticOpType::SUB &&
+      op_type != BinaryArithmeticOpType::MUL)
+    throw std::runtime_error{"Quant16 NYI"};
+
+  const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = BinaryArithmeticInt16<op_type>(params, input1_data[i], input2_data[i]);
+  }
+}
+
+template <BinaryArithmeticOpType op_type>
+inline void BroadcastBinaryArithmeticOp(BinaryArithmeticOpParam &params, const Shape &input1_shape,
+                                        const int16_t *input1_data, const Shape &input2_shape,
+                                        const int16_t *input2_data, const Shape &output_shape,
+                                        int16_t *output_data)
+{
+  if (output_shape.DimensionsCount() > 4)
+    throw std::runtime_error(
+      std::string("cker::BroadcastBinaryArithmeticOp: Unsupported rank size : ") +
+      std::to_string(output_shape.DimensionsCount()));
+  if (op_type != BinaryArithmeticOpType::ADD && op_type != BinaryArithmeticOpType::SUB &&
+      op_type != BinaryArithmeticOpType::MUL)
+    throw std::runtime_error{"Quant16 NYI"};
+
+  NdArrayDesc<4> desc1;
+  NdArrayDesc<4> desc2;
+  NdArrayDescsForElementwiseBroadcast(input1_shape, input2_shape, &desc1, &desc2);
+  const Shape extended_output_shape = Shape::ExtendedShape(4, output_shape);
+  for (int b = 0; b < extended_output_shape.Dims(0); ++b)
+  {
+    for (int y = 0; y < extended_output_shape.Dims(1); ++y)
+    {
+      for (int x = 0; x < extended_output_shape.Dims(2); ++x)
+      {
+        for (int c = 0; c < extended_output_shape.Dims(3); ++c)
+        {
+          output_data[Offset(extended_output_shape, b, y, x, c)] = BinaryArithmeticInt16<op_type>(
+            params, input1_data[SubscriptToIndex(desc1, b, y, x, c)],
+            input2_data[SubscriptToIndex(desc2, b, y, x, c)]);
+        }
+      }
+    }
+  }
+}
+
+// How many output elements are needed to make it worth using one more thread for elementwise
+// binary ops
+constexpr int64_t kBinaryArithmeticMinElementsPerThread = 1 << 15; // 32k
+
+// Runs BinaryArithmeticOp on ranges of elements, which are split over threads of ruy_context if it
+// is given and output is large enough
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BinaryArithmeticOpParallel(const BinaryArithmeticOpParam &params,
+                                       const Shape &input1_shape, const T *input1_data,
+                                       const Shape &input2_shape, const T *input2_data,
+                                       const Shape &output_shape, T *output_data,
+                                       ruy::Context *ruy_context)
+{
+  const int size = MatchingElementsSize(input1_shape, input2_shape, output_shape);
+  const int thread_count = cpu_backend_threadpool::HowManyThreads(
+    size, kBinaryArithmeticMinElementsPerThread, size, ruy_context);
+  if (thread_count <= 1)
+  {
+    BinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape, input2_data,
+                                output_shape, output_data);
+    return;
+  }
+
+  cpu_backend_threadpool::ParallelFor(size, thread_count, ruy_context, [&](int start, int end) {
+    const Shape range_shape{end - start};
+    BinaryArithmeticOp<op_type>(params, range_shape, input1_data + start, range_shape,
+                                input2_data + start, range_shape, output_data + start);
+  });
+}
+
+// Runs BroadcastBinaryArithmeticOp on slices along the outermost non-unit axis of output, which
+// are split over threads of ruy_context if it is given and output is large enough
+template <BinaryArithmeticOpType op_type, typename T>
+inline void BroadcastBinaryArithmeticOpParallel(BinaryArithmeticOpParam &params,
+                                                const Shape &input1_shape, const T *input1_data,
+                                                const Shape &input2_shape, const T *input2_data,
+                                                const Shape &output_shape, T *output_data,
+                                                ruy::Context *ruy_context)
+{
+  const int rank = output_shape.DimensionsCount();
+  int axis = 0;
+  while (axis < rank - 1 && output_shape.Dims(axis) == 1)
+  {
+    ++axis;
+  }
+  const int num_slices = (rank > 0) ? output_shape.Dims(axis) : 1;
+  const int thread_count = cpu_backend_threadpool::HowManyThreads(
+    output_shape.FlatSize(), kBinaryArithmeticMinElementsPerThread, num_slices, ruy_context);
+  if (thread_count <= 1)
+  {
+    BroadcastBinaryArithmeticOp<op_type>(params, input1_shape, input1_data, input2_shape,
+                                         input2_data, output_shape, output_data);
+    return;
+  }
+
+  const Shape extended_input1_shape = Shape::ExtendedShape(rank, input1_shape);
+  const Shape extended_input2_shape = Shape::ExtendedShape(rank, input2_shape);
+
+  // An input is sliced along with output unless it is broadcast along the axis
+  auto slice = [&](const Shape &shape, int start, int end, Shape *slice_shape) -> int64_t {
+    if (shape.Dims(axis) == 1)
+      return 0;
+    slice_shape->SetDim(axis, end - start);
+    return static_cast<int64_t>(start) * (shape.FlatSize() / num_slices);
+  };
+
+  cpu_backend_threadpool::ParallelFor(
+    num_slices, thread_count, ruy_context, [&](int start, int end) {
+      Shape slice_input1_shape(extended_input1_shape);
+      Shape slice_input2_shape(extended_input2_shape);
+      Shape slice_output_shape(output_shape);
+      const auto input1_offset = slice(extended_input1_shape, start, end, &slice_input1_shape);
+      const auto input2_offset = slice(extended_input2_shape, start, end, &slice_input2_shape);
+      const auto output_offset = slice(output_shape, start, end, &slice_output_shape);
+
+      // Broadcast category of a slice may differ from the whole one
+      BinaryArithmeticOpParam slice_params = params;
+      if (ProcessBroadcastShapes(slice_input1_shape, slice_input2_shape, &slice_params))
+      {
+        BroadcastBinaryArithmeticOp<op_type>(
+          slice_params, slice_input1_shape, input1_data + input1_offset, slice_input2_shape,
+          input2_data + input2_offset, slice_output_shape, output_data + output_offset);
+      }
+      else
+      {
+        BinaryArithmeticOp<op_type>(slice_params, slice_input1_shape, input1_data + input1_offset,
+                                    slice_input2_shape, input2_data + input2_offset,
+                                    slice_output_shape, output_data + output_offset);
+      }
+    });
+}
+
 } // namespace cker
 } // namespace nnfw
 
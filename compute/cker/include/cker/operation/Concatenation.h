@@ -18,11 +18,13 @@
 #ifndef __NNFW_CKER_CONCATENATION_H__
 #define __NNFW_CKER_CONCATENATION_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 
 #include <cstdint>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
@@ -32,7 +34,7 @@ namespace cker
 template <typename Scalar>
 inline void Concatenation(const ConcatenationParams &params, const Shape *const *input_shapes,
                           const Scalar *const *input_data, const Shape &output_shape,
-                          Scalar *output_data)
+                          Scalar *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = params.axis;
   int inputs_count = params.inputs_count;
@@ -68,16 +70,46 @@ inline void Concatenation(const ConcatenationParams &params, const Shape *const
     base_inner_size *= output_shape.Dims(i);
   }
 
-  Scalar *output_ptr = output_data;
-  for (int k = 0; k < outer_size; k++)
+  if (ruy_context == nullptr || outer_size * inputs_count <= 1)
   {
-    for (int i = 0; i < inputs_count; ++i)
+    Scalar *output_ptr = output_data;
+    for (int k = 0; k < outer_size; k++)
     {
-      const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
-      memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
-      output_ptr += copy_size;
+      for (int i = 0; i < inputs_count; ++i)
+      {
+        const int copy_size = input_shapes[i]->Dims(axis) * base_inner_size;
+        memcpy(output_ptr, input_data[i] + k * copy_size, copy_size * sizeof(Scalar));
+        output_ptr += copy_size;
+      }
     }
+    return;
   }
+
+  // Offsets of inputs in a row of output
+  std::vector<int64_t> copy_offsets(inputs_count + 1, 0);
+  for (int i = 0; i < inputs_count; ++i)
+  {
+    copy_offsets[i + 1] = copy_offsets[i] + input_shapes[i]->Dims(axis) * base_inner_size;
+  }
+  const int64_t output_row_size = copy_offsets[inputs_count];
+
+  // How many bytes are needed to make it worth using one more thread
+  static constexpr int64_t kMinBytesPerThread = 1 << 16; // 64KB
+
+  // Each unit copies a row of an input, and units are split over threads
+  const int num_units = outer_size * inputs_count;
+  cpu_backend_threadpool::ParallelFor(
+    num_units, output_row_size * sizeof(Scalar) / inputs_count, kMinBytesPerThread, ruy_context,
+    [&](int unit_start, int unit_end) {
+      for (int unit = unit_start; unit < unit_end; ++unit)
+      {
+        const int k = unit / inputs_count;
+        const int i = unit % inputs_count;
+        const int64_t copy_size = copy_offsets[i + 1] - copy_offsets[i];
+        memcpy(output_data + k * output_row_size + copy_offsets[i], input_data[i] + k * copy_size,
+               copy_size * sizeof(Scalar));
+      }
+    });
 }
 
 // quantized as it takes scale as a floating point value. This should be fixed
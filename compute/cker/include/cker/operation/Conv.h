@@ -24,6 +24,7 @@
 #include "cker/operation/reference/Conv.h"
 #include "cker/operation/optimized/Conv.h"
 #include <iostream>
+#include <memory>
 #include <vector>
 
 namespace nnfw
@@ -71,6 +72,33 @@ public:
     }
   }
 
+  void prepareF32(const std::shared_ptr<const std::vector<float>> &transposed_filter,
+                  PaddingType padding_type, bool &is_replaced_weights,
+                  uint32_t dilationWidthFactor, uint32_t dilationHeightFactor)
+  {
+    // Use filter transposed by other Conv with the same constant filter
+    if (!_prepared)
+    {
+      if (usableMultiThreaded(padding_type, dilationWidthFactor, dilationHeightFactor))
+      {
+        _shared_filter_data = transposed_filter;
+        is_replaced_weights = true;
+      }
+      _prepared = true;
+    }
+  }
+
+  // Move filter transposed by prepareF32 to be shared with other Conv
+  std::shared_ptr<const std::vector<float>> shareTransposedFilter()
+  {
+    if (!_shared_filter_data && !_modified_filter_data.empty())
+    {
+      _shared_filter_data = std::make_shared<std::vector<float>>(std::move(_modified_filter_data));
+      _modified_filter_data.clear();
+    }
+    return _shared_filter_data;
+  }
+
   void prepareQ8uPerTensor(const Shape &input_shape, const Shape &kernel_shape,
                            const Shape &output_shape, uint32_t stride_width, uint32_t stride_height,
                            uint32_t dilation_width_factor, uint32_t dilation_height_factor)
@@ -98,7 +126,9 @@ public:
         // transposing filter data
         transposeFilter(filter_shape, filter_data, transposed_in_execution);
       }
-      multithreaded::Conv(params, input_shape, input_data, filter_shape, &_modified_filter_data[0],
+      const float *transposed_filter_data =
+        _shared_filter_data ? _shared_filter_data->data() : &_modified_filter_data[0];
+      multithreaded::Conv(params, input_shape, input_data, filter_shape, transposed_filter_data,
                           bias_shape, bias_data, output_shape, output_data);
     }
     else
@@ -158,6 +188,18 @@ public:
                                    filter_shape, filter_data, nullptr /* filter_zero_point */,
                                    bias_shape, bias_data, output_shape, output_data);
   }
+
+  template <typename BiasT>
+  void operator()(const ConvParams &params, const Shape &input_shape, const int16_t *input_data,
+                  const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                  const BiasT *bias_data, const Shape &output_shape, int16_t *output_data)
+  {
+    reference::Conv<BiasT>(params, _per_channel_output_multiplier.data(),
+                           _per_channel_output_shift.data(), input_shape, input_data,
+                           filter_shape, filter_data, bias_shape, bias_data, output_shape,
+                           output_data);
+  }
+
   std::vector<int32_t> &per_channel_output_multiplier() { return _per_channel_output_multiplier; }
   std::vector<int> &per_channel_output_shift() { return _per_channel_output_shift; }
 
@@ -200,6 +242,7 @@ private:
 
 private:
   std::vector<float> _modified_filter_data;
+  std::shared_ptr<const std::vector<float>> _shared_filter_data;
   Shape _im2col_shape;
   bool _need_im2col;
   bool _prepared;
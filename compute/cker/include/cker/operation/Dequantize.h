@@ -41,6 +41,44 @@ inline void ScaleWithNewZeroPoint(const int32x4_t input, const float32x4_t scale
 } // namespace
 #endif // USE_NEON
 
+#ifdef USE_X86_SIMD
+namespace x86
+{
+
+X86_TARGET_AVX2 inline __m256i LoadAsInt32(const uint8_t *input)
+{
+  return _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input)));
+}
+
+X86_TARGET_AVX2 inline __m256i LoadAsInt32(const int8_t *input)
+{
+  return _mm256_cvtepi8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(input)));
+}
+
+X86_TARGET_AVX2 inline __m256i LoadAsInt32(const int16_t *input)
+{
+  return _mm256_cvtepi16_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(input)));
+}
+
+// Dequantize 8 values at a time as scalar code does, and return number of dequantized values
+template <typename InputT>
+X86_TARGET_AVX2 inline int DequantizeAvx2(int size, const InputT *input_data, float *output_data,
+                                          const float scale, const int32_t zero_point)
+{
+  const __m256 scale_dup = _mm256_set1_ps(scale);
+  const __m256i zero_point_dup = _mm256_set1_epi32(zero_point);
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    const __m256i val = _mm256_sub_epi32(LoadAsInt32(input_data + i), zero_point_dup);
+    _mm256_storeu_ps(output_data + i, _mm256_mul_ps(_mm256_cvtepi32_ps(val), scale_dup));
+  }
+  return i;
+}
+
+} // namespace x86
+#endif // USE_X86_SIMD
+
 inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
                        const Shape &output_shape, float *output_data, const float scale,
                        const int32_t zero_point)
@@ -68,6 +106,9 @@ inline void Dequantize(const Shape &input_shape, const uint8_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::DequantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
@@ -103,6 +144,9 @@ inline void Dequantize(const Shape &input_shape, const int8_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::DequantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
@@ -136,6 +180,9 @@ inline void Dequantize(const Shape &input_shape, const int16_t *input_data,
     vst1q_f32(output_data + i, result_low);
     vst1q_f32(output_data + i + 4, result_high);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::DequantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
   for (; i < flat_size; ++i)
   {
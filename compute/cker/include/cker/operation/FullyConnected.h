@@ -182,6 +182,56 @@ inline void FullyConnected(const FullyConnectedParams &params, const Shape &inpu
   }
 }
 
+// Per-channel quantized FullyConnected with int16 input/output and int8 weights, whose zero points
+// are all 0. It accumulates into 64 bits.
+template <typename BiasT>
+inline void FullyConnectedPerChannel(const FullyConnectedParams &params,
+                                     const int32_t *output_multiplier, const int *output_shift,
+                                     const Shape &input_shape, const int16_t *input_data,
+                                     const Shape &filter_shape, const int8_t *filter_data,
+                                     const Shape &bias_shape, const BiasT *bias_data,
+                                     const Shape &output_shape, int16_t *output_data)
+{
+  static_assert(std::is_same<BiasT, int32_t>::value || std::is_same<BiasT, int64_t>::value,
+                "Bias of int16 FullyConnected should be int32_t or int64_t");
+  UNUSED_RELEASE(input_shape);
+  UNUSED_RELEASE(bias_shape);
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+  assert(filter_shape.DimensionsCount() >= 2);
+  assert(output_shape.DimensionsCount() >= 1);
+  assert(output_activation_min <= output_activation_max);
+
+  const int output_dim_count = output_shape.DimensionsCount();
+  const int filter_dim_count = filter_shape.DimensionsCount();
+  const int batches = FlatSizeSkipDim(output_shape, output_dim_count - 1);
+  const int output_depth =
+    MatchingDim(filter_shape, filter_dim_count - 2, output_shape, output_dim_count - 1);
+  const int accum_depth = filter_shape.Dims(filter_dim_count - 1);
+  for (int b = 0; b < batches; ++b)
+  {
+    const int16_t *input_ptr = input_data + b * accum_depth;
+    for (int out_c = 0; out_c < output_depth; ++out_c)
+    {
+      const int8_t *filter_ptr = filter_data + out_c * accum_depth;
+      int64_t acc = 0;
+      for (int d = 0; d < accum_depth; ++d)
+      {
+        acc += static_cast<int32_t>(filter_ptr[d]) * input_ptr[d];
+      }
+      if (bias_data)
+      {
+        acc += bias_data[out_c];
+      }
+      int32_t scaled_acc =
+        MultiplyByQuantizedMultiplier(acc, output_multiplier[out_c], output_shift[out_c]);
+      scaled_acc = std::max(scaled_acc, output_activation_min);
+      scaled_acc = std::min(scaled_acc, output_activation_max);
+      output_data[out_c + output_depth * b] = static_cast<int16_t>(scaled_acc);
+    }
+  }
+}
+
 inline void FullyConnectedHybrid(const FullyConnectedParams &params, const Shape &input_shape,
                                  const float *input_data, const Shape &filter_shape,
                                  const int8_t *filter_data, const Shape &, const float *bias_data,
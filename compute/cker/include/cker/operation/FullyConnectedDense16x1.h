@@ -45,32 +45,140 @@
 #ifndef __NNFW_CKER_FULLY_CONNECTED_DENSE16x1_H__
 #define __NNFW_CKER_FULLY_CONNECTED_DENSE16x1_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
 #include "cker/TensorUtils.h"
 
+#include <algorithm>
+
 namespace nnfw
 {
 namespace cker
 {
-#if defined(__aarch64__) && defined(USE_NEON)
+
+#ifdef USE_X86_SIMD
+namespace x86
+{
+
+X86_TARGET_AVX2 inline void FullyConnected16x1BlockAvx2(const float *w, const float *x, int cols,
+                                                        float *__restrict y)
+{
+  /* keep y[0..15] in registers for duration of inner loop */
+  __m256 y0_7 = _mm256_loadu_ps(&y[0]);
+  __m256 y8_15 = _mm256_loadu_ps(&y[8]);
+  for (int j = 0; j < cols; j++)
+  {
+    // Multiply and add are fused, so results may differ in the last bits from other paths
+    const __m256 xj = _mm256_set1_ps(x[j]);
+    y0_7 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[0]), xj, y0_7);
+    y8_15 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[8]), xj, y8_15);
+    w += 16;
+  }
+  _mm256_storeu_ps(&y[0], y0_7);
+  _mm256_storeu_ps(&y[8], y8_15);
+}
+
+X86_TARGET_AVX512 inline void FullyConnected16x1BlockAvx512(const float *w, const float *x,
+                                                            int cols, float *__restrict y)
+{
+  __m512 y0_15 = _mm512_loadu_ps(&y[0]);
+  for (int j = 0; j < cols; j++)
+  {
+    const __m512 xj = _mm512_set1_ps(x[j]);
+    y0_15 = _mm512_fmadd_ps(_mm512_loadu_ps(&w[0]), xj, y0_15);
+    w += 16;
+  }
+  _mm512_storeu_ps(&y[0], y0_15);
+}
+
+} // namespace x86
+#endif // USE_X86_SIMD
+
+// Accumulate products of a shuffled 16x1 weight block, whose 16 rows of each column are
+// contiguous, and input vector into y[0..15]
+inline void FullyConnected16x1Block(const float *w, const float *x, int cols, float *__restrict y)
+{
+#ifdef USE_NEON
+  /* keep y[0..15] in registers for duration of inner loop */
+  float32x4_t y0_3 = vld1q_f32(&y[0]);
+  float32x4_t y4_7 = vld1q_f32(&y[4]);
+  float32x4_t y8_11 = vld1q_f32(&y[8]);
+  float32x4_t y12_15 = vld1q_f32(&y[12]);
+
+  for (int j = 0; j < cols; j++)
+  {
+    float32x4_t wvec0_3, wvec4_7, wvec8_11, wvec12_15;
+    float32x4_t xj;
+
+    xj = vld1q_dup_f32(&x[j]);
+
+    wvec0_3 = vld1q_f32(&w[0]);
+    y0_3 = vmlaq_f32(y0_3, wvec0_3, xj);
+    wvec4_7 = vld1q_f32(&w[4]);
+    y4_7 = vmlaq_f32(y4_7, wvec4_7, xj);
+    wvec8_11 = vld1q_f32(&w[8]);
+    y8_11 = vmlaq_f32(y8_11, wvec8_11, xj);
+    wvec12_15 = vld1q_f32(&w[12]);
+    y12_15 = vmlaq_f32(y12_15, wvec12_15, xj);
+
+    w += 16;
+  }
+
+  /* save y[0..15] back to memory */
+
+  vst1q_f32(&y[0], y0_3);
+  vst1q_f32(&y[4], y4_7);
+  vst1q_f32(&y[8], y8_11);
+  vst1q_f32(&y[12], y12_15);
+#else
+#ifdef USE_X86_SIMD
+  if (x86::HasAvx512())
+  {
+    x86::FullyConnected16x1BlockAvx512(w, x, cols, y);
+    return;
+  }
+  if (x86::HasAvx2())
+  {
+    x86::FullyConnected16x1BlockAvx2(w, x, cols, y);
+    return;
+  }
+#endif // USE_X86_SIMD
+  for (int j = 0; j < cols; j++)
+  {
+    const float xj = x[j];
+    for (int k = 0; k < 16; k++)
+    {
+      y[k] += w[k] * xj;
+    }
+    w += 16;
+  }
+#endif // USE_NEON
+}
+
+// Number of threads for 16x1 FullyConnected, which runs in parallel over output blocks
+inline int HowManyFullyConnected16x1Threads(int num_muls, int num_blocks,
+                                            ruy::Context *ruy_context)
+{
+  // How many scalar multiplications are needed to make it worth using one
+  // more thread
+  static constexpr int kMinMulPerThread = 1 << 13; // 8k
+  return cpu_backend_threadpool::HowManyThreads(num_muls, kMinMulPerThread, num_blocks,
+                                                ruy_context);
+}
+
 inline void FullyConnected16x1Float32(const FullyConnectedParams &params, const Shape &input_shape,
                                       const float *input_data, const Shape &weights_shape,
                                       const float *weights_data, const Shape &,
-                                      const float *bias_data, const Shape &, float *output_data)
+                                      const float *bias_data, const Shape &, float *output_data,
+                                      ruy::Context *ruy_context = nullptr)
 {
   int total_input_size = input_shape.FlatSize();
   int input_size = weights_shape.Dims(1);
   const int batch_size = total_input_size / input_size;
   const int num_units = weights_shape.Dims(0);
-
-  float *out = output_data;
-  const float *weights = weights_data;
-  int rows = num_units;
-  int cols = input_size;
-  int col_stride = input_size;
-  const float *x = input_data;
+  assert(num_units % 16 == 0);
 
   // Output = bias if bias tensor exists.
   if (bias_data)
@@ -83,52 +191,28 @@ inline void FullyConnected16x1Float32(const FullyConnectedParams &params, const
   }
 
   //  rows : out, cols : in
-  int i, j;
-  for (i = 0; i < rows; i += 16)
-  {
-    const float *w = &weights[i * col_stride];
-
-    /* keep y[0..15] in registers for duration of inner loop */
-    float *__restrict y = &out[i];
-
-    float32x4_t y0_3 = vld1q_f32(&y[0]);
-    float32x4_t y4_7 = vld1q_f32(&y[4]);
-    float32x4_t y8_11 = vld1q_f32(&y[8]);
-    float32x4_t y12_15 = vld1q_f32(&y[12]);
-
-    for (j = 0; j < cols; j++)
+  const int num_blocks = num_units / 16;
+  const int thread_count = HowManyFullyConnected16x1Threads(
+    batch_size * num_units * input_size, num_blocks, ruy_context);
+  auto run_blocks = [&](int block_start, int block_end) {
+    for (int i = block_start; i < block_end; ++i)
     {
-      float32x4_t wvec0_3, wvec4_7, wvec8_11, wvec12_15;
-      float32x4_t xj;
-
-      xj = vld1q_dup_f32(&x[j]);
-
-      wvec0_3 = vld1q_f32(&w[0]);
-      y0_3 = vmlaq_f32(y0_3, wvec0_3, xj);
-      wvec4_7 = vld1q_f32(&w[4]);
-      y4_7 = vmlaq_f32(y4_7, wvec4_7, xj);
-      wvec8_11 = vld1q_f32(&w[8]);
-      y8_11 = vmlaq_f32(y8_11, wvec8_11, xj);
-      wvec12_15 = vld1q_f32(&w[12]);
-      y12_15 = vmlaq_f32(y12_15, wvec12_15, xj);
-
-      w += 16;
+      const float *w = &weights_data[i * 16 * input_size];
+      for (int b = 0; b < batch_size; ++b)
+      {
+        FullyConnected16x1Block(w, &input_data[b * input_size], input_size,
+                                &output_data[b * num_units + i * 16]);
+      }
     }
+  };
+  cpu_backend_threadpool::ParallelFor(num_blocks, thread_count, ruy_context, run_blocks);
 
-    /* save y[0..15] back to memory */
-
-    vst1q_f32(&y[0], y0_3);
-    vst1q_f32(&y[4], y4_7);
-    vst1q_f32(&y[8], y8_11);
-    vst1q_f32(&y[12], y12_15);
-  }
   if (params.activation != FusedActivationFunctionType::kNone)
   {
     // Apply activation function
     ApplyActivationToVector(output_data, batch_size * num_units, params.activation, output_data);
   }
 }
-#endif
 } // namespace cker
 } // namespace nnfw
 #endif // __NNFW_CKER_FULLY_CONNECTED_DENSE16x1_H__
@@ -45,6 +45,7 @@
 #ifndef __NNFW_CKER_FULLY_CONNECTED_SPARSE16x1_H__
 #define __NNFW_CKER_FULLY_CONNECTED_SPARSE16x1_H__
 
+#include "cker/operation/FullyConnectedDense16x1.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -54,12 +55,111 @@ namespace nnfw
 {
 namespace cker
 {
+
+#ifdef USE_X86_SIMD
+namespace x86
+{
+
+X86_TARGET_AVX2 inline void FullyConnectedSparse16x1BlockAvx2(const float *w, const float *x,
+                                                              const uint16_t *indices, int count,
+                                                              float *__restrict y)
+{
+  /* keep y[0..15] in registers for duration of inner loop */
+  __m256 y0_7 = _mm256_loadu_ps(&y[0]);
+  __m256 y8_15 = _mm256_loadu_ps(&y[8]);
+  for (int j = 0; j < count; j++)
+  {
+    // Multiply and add are fused, so results may differ in the last bits from other paths
+    const __m256 xj = _mm256_set1_ps(x[indices[j]]);
+    y0_7 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[0]), xj, y0_7);
+    y8_15 = _mm256_fmadd_ps(_mm256_loadu_ps(&w[8]), xj, y8_15);
+    w += 16;
+  }
+  _mm256_storeu_ps(&y[0], y0_7);
+  _mm256_storeu_ps(&y[8], y8_15);
+}
+
+X86_TARGET_AVX512 inline void FullyConnectedSparse16x1BlockAvx512(const float *w, const float *x,
+                                                                  const uint16_t *indices,
+                                                                  int count, float *__restrict y)
+{
+  __m512 y0_15 = _mm512_loadu_ps(&y[0]);
+  for (int j = 0; j < count; j++)
+  {
+    const __m512 xj = _mm512_set1_ps(x[indices[j]]);
+    y0_15 = _mm512_fmadd_ps(_mm512_loadu_ps(&w[0]), xj, y0_15);
+    w += 16;
+  }
+  _mm512_storeu_ps(&y[0], y0_15);
+}
+
+} // namespace x86
+#endif // USE_X86_SIMD
+
+// Accumulate products of non-zero 16x1 weight blocks of a block row and input elements of their
+// column indices into y[0..15]
+inline void FullyConnectedSparse16x1Block(const float *weights_data, const float *x,
+                                          const uint16_t *indices, int count, float *__restrict y)
+{
+#ifdef USE_NEON
+  /* keep y[0..15] in registers for duration of inner loop */
+  float32x4_t y0_3 = vld1q_f32(&y[0]);
+  float32x4_t y4_7 = vld1q_f32(&y[4]);
+  float32x4_t y8_11 = vld1q_f32(&y[8]);
+  float32x4_t y12_15 = vld1q_f32(&y[12]);
+  for (int j = 0; j < count; ++j)
+  {
+    float32x4_t xj = vld1q_dup_f32(&x[indices[j]]);
+    float32x4_t wvec;
+
+    wvec = vld1q_f32(&weights_data[0]);
+    y0_3 = vmlaq_f32(y0_3, wvec, xj);
+    wvec = vld1q_f32(&weights_data[4]);
+    y4_7 = vmlaq_f32(y4_7, wvec, xj);
+    wvec = vld1q_f32(&weights_data[8]);
+    y8_11 = vmlaq_f32(y8_11, wvec, xj);
+    wvec = vld1q_f32(&weights_data[12]);
+    y12_15 = vmlaq_f32(y12_15, wvec, xj);
+
+    weights_data += 16;
+  }
+  /* save y[0..15] back to memory */
+  vst1q_f32(&y[0], y0_3);
+  vst1q_f32(&y[4], y4_7);
+  vst1q_f32(&y[8], y8_11);
+  vst1q_f32(&y[12], y12_15);
+#else
+#ifdef USE_X86_SIMD
+  if (x86::HasAvx512())
+  {
+    x86::FullyConnectedSparse16x1BlockAvx512(weights_data, x, indices, count, y);
+    return;
+  }
+  if (x86::HasAvx2())
+  {
+    x86::FullyConnectedSparse16x1BlockAvx2(weights_data, x, indices, count, y);
+    return;
+  }
+#endif // USE_X86_SIMD
+  for (int j = 0; j < count; ++j)
+  {
+    const float xj = x[indices[j]];
+    for (int k = 0; k < 16; ++k)
+    {
+      y[k] += weights_data[k] * xj;
+    }
+    weights_data += 16;
+  }
+#endif // USE_NEON
+}
+
 inline void FullyConnectedSparseWeight16x1(const FullyConnectedParams &params,
                                            const Shape &input_shape, const float *input_data,
                                            const Shape &weights_shape, const float *weights_data,
                                            const Shape &bias_shape, const float *bias_data,
                                            const Shape &output_shape, float *output_data,
-                                           const uint16_t *w1_segments, const uint16_t *w1_indices)
+                                           const uint16_t *w1_segments, const uint16_t *w1_indices,
+                                           ruy::Context *ruy_context = nullptr)
 {
   UNUSED_RELEASE(input_shape);
 
@@ -82,72 +182,26 @@ inline void FullyConnectedSparseWeight16x1(const FullyConnectedParams &params,
   {
     ZeroVector(output_data, batches * output_depth);
   }
-  for (int b = 0; b < batches; ++b)
-  {
-    int depth_size = output_depth / 16;
-    for (int idx_0 = 0; idx_0 < depth_size; ++idx_0)
-#ifdef USE_NEON
-    {
-      float *__restrict y;
-      y = &output_data[b * output_depth + idx_0 * 16];
-      /* keep y[0..15] in registers for duration of inner loop */
-      float32x4_t y0_3 = vld1q_f32(&y[0]);
-      float32x4_t y4_7 = vld1q_f32(&y[4]);
-      float32x4_t y8_11 = vld1q_f32(&y[8]);
-      float32x4_t y12_15 = vld1q_f32(&y[12]);
-      for (auto pw1 = w1_segments[idx_0]; pw1 < w1_segments[idx_0 + 1]; ++pw1)
-      {
-        auto idx_1 = w1_indices[pw1];
-        float32x4_t xj = vld1q_dup_f32(&input_data[b * accum_depth + idx_1]);
-        float32x4_t wvec;
-
-        wvec = vld1q_f32(&weights_data[0]);
-        y0_3 = vmlaq_f32(y0_3, wvec, xj);
-        wvec = vld1q_f32(&weights_data[4]);
-        y4_7 = vmlaq_f32(y4_7, wvec, xj);
-        wvec = vld1q_f32(&weights_data[8]);
-        y8_11 = vmlaq_f32(y8_11, wvec, xj);
-        wvec = vld1q_f32(&weights_data[12]);
-        y12_15 = vmlaq_f32(y12_15, wvec, xj);
-
-        weights_data += 16;
-      }
-      /* save y[0..15] back to memory */
-      vst1q_f32(&y[0], y0_3);
-      vst1q_f32(&y[4], y4_7);
-      vst1q_f32(&y[8], y8_11);
-      vst1q_f32(&y[12], y12_15);
-    }
-#else
+
+  // Non-zero blocks of a block row start at weights of w1_segments[block row] * 16
+  const int depth_size = output_depth / 16;
+  const int thread_count = HowManyFullyConnected16x1Threads(
+    batches * w1_segments[depth_size] * 16, depth_size, ruy_context);
+  auto run_blocks = [&](int block_start, int block_end) {
+    for (int idx_0 = block_start; idx_0 < block_end; ++idx_0)
     {
-      for (auto pw1 = w1_segments[idx_0]; pw1 < w1_segments[idx_0 + 1]; ++pw1)
+      const int segment_start = w1_segments[idx_0];
+      const int count = w1_segments[idx_0 + 1] - segment_start;
+      for (int b = 0; b < batches; ++b)
       {
-        float *__restrict y;
-        float xj;
-        auto idx_1 = w1_indices[pw1];
-        xj = input_data[b * accum_depth + idx_1];
-        y = &output_data[b * output_depth + idx_0 * 16];
-        y[0] += weights_data[0] * xj;
-        y[1] += weights_data[1] * xj;
-        y[2] += weights_data[2] * xj;
-        y[3] += weights_data[3] * xj;
-        y[4] += weights_data[4] * xj;
-        y[5] += weights_data[5] * xj;
-        y[6] += weights_data[6] * xj;
-        y[7] += weights_data[7] * xj;
-        y[8] += weights_data[8] * xj;
-        y[9] += weights_data[9] * xj;
-        y[10] += weights_data[10] * xj;
-        y[11] += weights_data[11] * xj;
-        y[12] += weights_data[12] * xj;
-        y[13] += weights_data[13] * xj;
-        y[14] += weights_data[14] * xj;
-        y[15] += weights_data[15] * xj;
-        weights_data += 16;
+        FullyConnectedSparse16x1Block(&weights_data[segment_start * 16],
+                                      &input_data[b * accum_depth], &w1_indices[segment_start],
+                                      count, &output_data[b * output_depth + idx_0 * 16]);
       }
     }
-#endif
-  }
+  };
+  cpu_backend_threadpool::ParallelFor(depth_size, thread_count, ruy_context, run_blocks);
+
   if (params.activation != FusedActivationFunctionType::kNone)
   {
     // Apply activation function
@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_GATHER_H__
 #define __NNFW_CKER_GATHER_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -30,7 +31,7 @@ namespace cker
 template <typename T, typename CoordsT = int32_t>
 inline void Gather(const GatherParams &op_params, const Shape &input_shape, const T *input_data,
                    const Shape &coords_shape, const CoordsT *coords_data, const Shape &,
-                   T *output_data)
+                   T *output_data, ruy::Context *ruy_context = nullptr)
 {
   int axis = op_params.axis;
   if (axis < 0)
@@ -54,17 +55,24 @@ inline void Gather(const GatherParams &op_params, const Shape &input_shape, cons
     inner_size *= input_shape.Dims(i);
   }
 
-  for (int outer = 0; outer < outer_size; ++outer)
-  {
-    for (int i = 0; i < coords_count; ++i)
-    {
-      assert(coords_data[i] >= 0);
-      assert(coords_data[i] < axis_size);
-      std::memcpy(output_data + (outer * coords_count + i) * inner_size,
-                  input_data + (outer * axis_size + coords_data[i]) * inner_size,
-                  sizeof(T) * inner_size);
-    }
-  }
+  // How many bytes are needed to make it worth using one more thread
+  static constexpr int64_t kMinBytesPerThread = 1 << 16; // 64KB
+
+  // Each unit copies a slice of inner_size, and units are split over threads
+  cpu_backend_threadpool::ParallelFor(
+    outer_size * coords_count, sizeof(T) * inner_size, kMinBytesPerThread, ruy_context,
+    [&](int unit_start, int unit_end) {
+      for (int unit = unit_start; unit < unit_end; ++unit)
+      {
+        const int outer = unit / coords_count;
+        const int i = unit % coords_count;
+        assert(coords_data[i] >= 0);
+        assert(coords_data[i] < axis_size);
+        std::memcpy(output_data + unit * inner_size,
+                    input_data + (outer * axis_size + coords_data[i]) * inner_size,
+                    sizeof(T) * inner_size);
+      }
+    });
 }
 
 } // namespace cker
@@ -18,9 +18,15 @@
 #ifndef __NNFW_CKER_UNIDIRECTIONALSEQUENCELSTM_H__
 #define __NNFW_CKER_UNIDIRECTIONALSEQUENCELSTM_H__
 
+#include "cker/ruy/RuySupport.h"
 #include "cker/TensorUtils.h"
 #include "cker/Types.h"
 
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <initializer_list>
+
 namespace nnfw
 {
 namespace cker
@@ -59,6 +65,10 @@ namespace cker
 //   activation                                 - activation to use.
 //   is_input_all_zeros, is_aux_input_all_zeros - if input vectors are all zero.
 //   use_layer_norm                             - if doing layer norm LSTM.
+// Precomputed input term (optional):
+//   input_projection        - W_input * input (+ bias without layer norm) of the gate from
+//                             LstmInputProjectionFloat, used instead of computing it here
+//   input_projection_stride - distance between vectors of batches in input_projection
 inline void CalculateLstmGateFloat(const float *input, const float *input_to_gate_weights,
                                    const float *aux_input, const float *aux_input_to_gate_weights,
                                    const float *output_state,
@@ -68,14 +78,24 @@ inline void CalculateLstmGateFloat(const float *input, const float *input_to_gat
                                    const int n_batch, const int n_input, const int n_aux_input,
                                    const int n_output, const int n_cell,
                                    const FusedActivationFunctionType activation, float *gate,
-                                   const bool is_input_all_zeros, const bool is_aux_input_all_zeros)
+                                   const bool is_input_all_zeros, const bool is_aux_input_all_zeros,
+                                   const float *input_projection = nullptr,
+                                   const int input_projection_stride = 0)
 {
   const bool use_peephole = (cell_to_gate_weights != nullptr);
   const bool use_layer_norm = (layer_norm_coefficients != nullptr);
 
+  if (input_projection != nullptr)
+  {
+    // Input term and bias for regular lstm were computed for all time steps at once.
+    for (int b = 0; b < n_batch; ++b)
+    {
+      std::copy_n(input_projection + b * input_projection_stride, n_cell, gate + b * n_cell);
+    }
+  }
   // Initialize scratch buffers with bias for regular lstm or initialize with
   // zero for layer norm lstm.
-  if (use_layer_norm)
+  else if (use_layer_norm)
   {
     std::fill_n(gate, n_cell * n_batch, 0.0f);
   }
@@ -84,8 +104,8 @@ inline void CalculateLstmGateFloat(const float *input, const float *input_to_gat
     VectorBatchVectorAssign(gate_bias, n_cell, n_batch, gate);
   }
   // For each batch and cell: compute input_weight * input.
-  // Skip if input is all zeros.
-  if (!is_input_all_zeros)
+  // Skip if input is all zeros or it is precomputed.
+  if (input_projection == nullptr && !is_input_all_zeros)
   {
     MatrixBatchVectorMultiplyAccumulate(input_to_gate_weights, n_cell, n_input, input, n_batch,
                                         gate, /*result_stride=*/1);
@@ -218,6 +238,78 @@ void CalculateLstmOutputFloat(int n_batch, int n_cell, int n_output, const float
   }
 }
 
+// Stacks weights or biases of gates in the order of given pointers into one buffer, e.g.
+// input_to_{input,forget,cell,output}_weights into a matrix of 4 * n_cell rows. Null pointers
+// of gates not in use (input gate of CIFG) are skipped.
+//
+// Returns the number of stacked gates.
+inline int LstmStackGatesFloat(std::initializer_list<const float *> gates, int gate_size,
+                               float *stacked)
+{
+  int num_gates = 0;
+  for (const float *gate : gates)
+  {
+    if (gate == nullptr)
+      continue;
+    std::copy_n(gate, gate_size, stacked + num_gates * gate_size);
+    ++num_gates;
+  }
+  return num_gates;
+}
+
+// Calculates input terms of all gates for all time steps at once, which do not depend on the
+// recurrent state. Then each LstmStepFloat only multiplies recurrent weights.
+//
+// Implements the following formula for every input vector: (* is matrix multiply)
+//   input_projection = W_stacked * input + bias_stacked
+//
+// Parameters:
+//  - input: n_rows vectors of size n_input, i.e. all time steps of all batches
+//  - stacked_weights: input to gate weights stacked by LstmStackGatesFloat,
+//                     size n_stacked * n_input where n_stacked = number of gates * n_cell
+//  - stacked_bias: gate biases stacked by LstmStackGatesFloat, size n_stacked, or nullptr.
+//                  Bias of gates with layer norm must be zero (or all nullptr), since it is
+//                  added after normalization.
+//  - is_constant_weights: whether stacked_weights is not changed between calls, so that its
+//                         packing can be cached
+//  - input_projection: output of n_rows vectors of size n_stacked
+inline void LstmInputProjectionFloat(const float *input, int n_rows, int n_input,
+                                     const float *stacked_weights, const float *stacked_bias,
+                                     int n_stacked, bool is_constant_weights,
+                                     float *input_projection, ruy::Context *ruy_context)
+{
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = n_stacked;
+  lhs_params.cols = n_input;
+  lhs_params.cache_policy =
+    is_constant_weights ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = n_input;
+  rhs_params.cols = n_rows;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = n_stacked;
+  dst_params.cols = n_rows;
+
+  ruy::Matrix<float> ruy_lhs;
+  ruy::Matrix<float> ruy_rhs;
+  ruy::Matrix<float> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, stacked_weights, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, input, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, input_projection, &ruy_dst);
+
+  ruy::MulParams<float, float> ruy_mul_params;
+  if (stacked_bias != nullptr)
+  {
+    ruy_mul_params.set_bias(stacked_bias);
+  }
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
 // Performs an LSTM batch inference step for input specified by input_ptr.
 // The LSTM cell is specified by the pointers to its weights (*_weights_ptr) and
 // biases (*_bias_ptr), and buffers (*_scratch), along with additional
@@ -281,6 +373,10 @@ void CalculateLstmOutputFloat(int n_batch, int n_cell, int n_output, const float
 // for bidirectional LSTMs with merge_outputs. In this case, the batched
 // operations cannot be used since they assume that the batched outputs are
 // contiguous, and we manually loop over the batched outputs.
+//
+// input_projection_ptr (optional) points to 'n_batch' vectors of the step computed by
+// LstmInputProjectionFloat, whose gates are stacked in the order of input (if not CIFG), forget,
+// cell and output. Input weights and gate biases (if not layer norm) are not used with it.
 // LINT.IfChange
 inline void LstmStepFloat(
   const float *input_ptr, const float *input_to_input_weights_ptr,
@@ -299,12 +395,21 @@ inline void LstmStepFloat(
   const float *projection_bias_ptr, const LSTMParams *params, int n_batch, int n_cell, int n_input,
   int n_aux_input, int n_output, int output_batch_leading_dim, float *output_state_ptr,
   float *cell_state_ptr, float *scratch0, float *scratch1, float *scratch2, float *scratch3,
-  float *output_ptr)
+  float *output_ptr, const float *input_projection_ptr = nullptr)
 {
   // Since we have already checked that weights are all there or none, we can
   // check the existence of only one to the get the condition.
   const bool use_cifg = (input_to_input_weights_ptr == nullptr);
 
+  // Precomputed input terms of gates in use
+  const int input_projection_stride = (use_cifg ? 3 : 4) * n_cell;
+  const float *input_projection[4] = {nullptr, nullptr, nullptr, nullptr};
+  if (input_projection_ptr != nullptr)
+  {
+    for (int gate = use_cifg ? 1 : 0, i = 0; gate < 4; ++gate, ++i)
+      input_projection[gate] = input_projection_ptr + i * n_cell;
+  }
+
   // Make named scratch buffers.
   float *input_gate_scratch = scratch0;
   float *forget_gate_scratch = scratch1;
@@ -312,7 +417,8 @@ inline void LstmStepFloat(
   float *output_gate_scratch = scratch3;
 
   // Check if inputs are all zeros so we can skip some computations.
-  const bool is_input_all_zeros = IsZeroVector(input_ptr, n_batch * n_input);
+  const bool is_input_all_zeros =
+    input_projection_ptr == nullptr && IsZeroVector(input_ptr, n_batch * n_input);
   const bool is_aux_input_all_zeros =
     (aux_input_ptr == nullptr || IsZeroVector(aux_input_ptr, n_batch * n_aux_input));
   if (!use_cifg)
@@ -324,7 +430,8 @@ inline void LstmStepFloat(
                            cell_to_input_weights_ptr, input_layer_norm_coefficients_ptr,
                            input_gate_bias_ptr, n_batch, n_input, n_aux_input, n_output, n_cell,
                            /*activation=kTfLiteActSigmoid*/ FusedActivationFunctionType::kSigmoid,
-                           input_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros);
+                           input_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros,
+                           input_projection[0], input_projection_stride);
   }
   // Calculate the forget gate.
   CalculateLstmGateFloat(input_ptr, input_to_forget_weights_ptr, aux_input_ptr,
@@ -333,14 +440,15 @@ inline void LstmStepFloat(
                          cell_to_forget_weights_ptr, forget_layer_norm_coefficients_ptr,
                          forget_gate_bias_ptr, n_batch, n_input, n_aux_input, n_output, n_cell,
                          /*activation=kTfLiteActSigmoid*/ FusedActivationFunctionType::kSigmoid,
-                         forget_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros);
+                         forget_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros,
+                         input_projection[1], input_projection_stride);
   // Calculate the cell update gate.
   CalculateLstmGateFloat(
     input_ptr, input_to_cell_weights_ptr, aux_input_ptr, aux_input_to_cell_weights_ptr,
     output_state_ptr, recurrent_to_cell_weights_ptr, /*cell_state=*/nullptr,
     /*cell_to_gate_weights=*/nullptr, cell_layer_norm_coefficients_ptr, cell_gate_bias_ptr, n_batch,
     n_input, n_aux_input, n_output, n_cell, params->activation, cell_gate_scratch,
-    is_input_all_zeros, is_aux_input_all_zeros);
+    is_input_all_zeros, is_aux_input_all_zeros, input_projection[2], input_projection_stride);
   // Update the cell state.
   UpdateLstmCellFloat(n_batch, n_cell, cell_state_ptr, input_gate_scratch, forget_gate_scratch,
                       cell_gate_scratch, use_cifg, params->cell_clip);
@@ -351,7 +459,8 @@ inline void LstmStepFloat(
                          cell_to_output_weights_ptr, output_layer_norm_coefficients_ptr,
                          output_gate_bias_ptr, n_batch, n_input, n_aux_input, n_output, n_cell,
                          /*activation=kTfLiteActSigmoid*/ FusedActivationFunctionType::kSigmoid,
-                         output_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros);
+                         output_gate_scratch, is_input_all_zeros, is_aux_input_all_zeros,
+                         input_projection[3], input_projection_stride);
   // Update the output state.
   CalculateLstmOutputFloat(n_batch, n_cell, n_output, cell_state_ptr, output_gate_scratch,
                            params->activation, projection_weights_ptr, projection_bias_ptr,
@@ -19,6 +19,7 @@
 #define __NNFW_CKER_LOGISTIC_H__
 
 #include "cker/Shape.h"
+#include "cker/Utils.h"
 #include "cker/eigen/Utils.h"
 
 #include <cmath>
@@ -38,6 +39,24 @@ inline void Logistic(const Shape &input_shape, const float *input_data, const Sh
   output_map.array() = input_map.array().unaryExpr(Eigen::internal::scalar_logistic_op<float>());
 }
 
+// Populates a lookup table of int16 Logistic, which should have 513 entries
+inline void PopulateLogisticInt16LookupTable(float input_scale, float output_scale, int16_t *lut)
+{
+  PopulateInt16ActivationLookupTable([](double x) { return 1.0 / (1.0 + std::exp(-x)); },
+                                     input_scale, output_scale, lut);
+}
+
+// Quantized Logistic with int16 input and output, whose zero points are 0
+inline void Logistic(const int16_t *lut, const Shape &input_shape, const int16_t *input_data,
+                     const Shape &output_shape, int16_t *output_data)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = LookupInt16(input_data[i], lut);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
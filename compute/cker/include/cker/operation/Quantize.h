@@ -46,6 +46,57 @@ inline void Quantize(const Shape &input_shape, const InputT *input_data, const S
   }
 }
 
+#ifdef USE_X86_SIMD
+namespace x86
+{
+
+X86_TARGET_AVX2 inline void StoreQuantized(__m256i low, __m256i high, int8_t *output)
+{
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output), PackInt32ToInt8(low, high));
+}
+
+X86_TARGET_AVX2 inline void StoreQuantized(__m256i low, __m256i high, uint8_t *output)
+{
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(output), PackInt32ToUint8(low, high));
+}
+
+X86_TARGET_AVX2 inline void StoreQuantized(__m256i low, __m256i high, int16_t *output)
+{
+  _mm256_storeu_si256(reinterpret_cast<__m256i *>(output),
+                      _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8));
+}
+
+// Quantize 16 values at a time as scalar code does, and return number of quantized values
+template <typename OutputT>
+X86_TARGET_AVX2 inline int QuantizeAvx2(int size, const float *input_data, OutputT *output_data,
+                                        const float scale, const int32_t zero_point)
+{
+  // Values are clamped before conversion to int32 not to overflow
+  const __m256 scale_dup = _mm256_set1_ps(scale);
+  const __m256 min_val_dup =
+    _mm256_set1_ps(static_cast<float>(std::numeric_limits<OutputT>::min() - zero_point));
+  const __m256 max_val_dup =
+    _mm256_set1_ps(static_cast<float>(std::numeric_limits<OutputT>::max() - zero_point));
+  const __m256i zero_point_dup = _mm256_set1_epi32(zero_point);
+
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    __m256 val_0 = RoundHalfAwayFromZero(_mm256_div_ps(_mm256_loadu_ps(input_data + i), scale_dup));
+    __m256 val_1 =
+      RoundHalfAwayFromZero(_mm256_div_ps(_mm256_loadu_ps(input_data + i + 8), scale_dup));
+    val_0 = _mm256_min_ps(_mm256_max_ps(val_0, min_val_dup), max_val_dup);
+    val_1 = _mm256_min_ps(_mm256_max_ps(val_1, min_val_dup), max_val_dup);
+    const __m256i casted_val_0 = _mm256_add_epi32(_mm256_cvtps_epi32(val_0), zero_point_dup);
+    const __m256i casted_val_1 = _mm256_add_epi32(_mm256_cvtps_epi32(val_1), zero_point_dup);
+    StoreQuantized(casted_val_0, casted_val_1, output_data + i);
+  }
+  return i;
+}
+
+} // namespace x86
+#endif // USE_X86_SIMD
+
 template <>
 inline void Quantize(const Shape &input_shape, const float *input_data, const Shape &output_shape,
                      int8_t *output_data, const float scale, const int32_t zero_point)
@@ -88,6 +139,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     const int8x8_t combined_val_narrowed = vmovn_s16(combined_val);
     vst1_s8(output_data + i, combined_val_narrowed);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::QuantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
@@ -141,6 +195,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     const uint8x8_t combined_val_narrowed = vmovn_u16(combined_val);
     vst1_u8(output_data + i, combined_val_narrowed);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::QuantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
@@ -193,6 +250,9 @@ inline void Quantize(const Shape &input_shape, const float *input_data, const Sh
     vst1_s16(output_data + i, narrowed_val_0);
     vst1_s16(output_data + i + 4, narrowed_val_1);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx2())
+    i = x86::QuantizeAvx2(flat_size, input_data, output_data, scale, zero_point);
 #endif // NEON
 
   for (; i < flat_size; ++i)
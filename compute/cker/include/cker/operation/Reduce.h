@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_REDUCE_H__
 #define __NNFW_CKER_REDUCE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
@@ -33,19 +34,10 @@ namespace cker
 // dimensions given in axis.
 
 #ifdef USE_NEON
-inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape,
-                               float *output_data)
+// Sums each of input_size rows of reduce_size elements
+inline void OptimizedReduceSumRows(const float *input_data, int input_size, int reduce_size,
+                                   float *output_data)
 {
-  const auto input_dims = input_shape.DimsData();
-  const auto input_num_dims = input_shape.DimensionsCount();
-
-  int input_size = 1;
-  int reduce_size = 0;
-  for (int idx = 0; idx < input_num_dims - 1; idx++)
-  {
-    input_size *= input_dims[idx];
-  }
-  reduce_size = input_dims[input_num_dims - 1];
   int offset = 0;
   for (int idx = 0; idx < input_size; idx++)
   {
@@ -112,8 +104,108 @@ inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape
     offset += reduce_size;
   }
 }
+#elif defined(USE_X86_SIMD)
+X86_TARGET_AVX2 inline void OptimizedReduceSumAvx2(const float *input_data, int input_size,
+                                                   int reduce_size, float *output_data)
+{
+  for (int idx = 0; idx < input_size; idx++)
+  {
+    const float *input = input_data + idx * reduce_size;
+    __m256 acc0 = _mm256_setzero_ps();
+    __m256 acc1 = _mm256_setzero_ps();
+    __m256 acc2 = _mm256_setzero_ps();
+    __m256 acc3 = _mm256_setzero_ps();
+    int r_idx = 0;
+    for (; r_idx <= reduce_size - 32; r_idx += 32)
+    {
+      acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(input + r_idx));
+      acc1 = _mm256_add_ps(acc1, _mm256_loadu_ps(input + r_idx + 8));
+      acc2 = _mm256_add_ps(acc2, _mm256_loadu_ps(input + r_idx + 16));
+      acc3 = _mm256_add_ps(acc3, _mm256_loadu_ps(input + r_idx + 24));
+    }
+    for (; r_idx <= reduce_size - 8; r_idx += 8)
+    {
+      acc0 = _mm256_add_ps(acc0, _mm256_loadu_ps(input + r_idx));
+    }
+    float sum = x86::ReduceAdd(_mm256_add_ps(_mm256_add_ps(acc0, acc1), _mm256_add_ps(acc2, acc3)));
+    for (; r_idx < reduce_size; r_idx++)
+    {
+      sum += input[r_idx];
+    }
+    output_data[idx] = sum;
+  }
+}
+
+// Sums each of input_size rows of reduce_size elements
+inline void OptimizedReduceSumRows(const float *input_data, int input_size, int reduce_size,
+                                   float *output_data)
+{
+  if (x86::HasAvx2())
+  {
+    OptimizedReduceSumAvx2(input_data, input_size, reduce_size, output_data);
+    return;
+  }
+
+  for (int idx = 0; idx < input_size; idx++)
+  {
+    const float *input = input_data + idx * reduce_size;
+    float sum = 0;
+    for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+    {
+      sum += input[r_idx];
+    }
+    output_data[idx] = sum;
+  }
+}
 #endif // NEON
 
+#if defined(USE_NEON) || defined(USE_X86_SIMD)
+// Sums input along its innermost axis.
+// Rows are split over threads of ruy_context if it is given and the input is large enough.
+inline void OptimizedReduceSum(const float *input_data, const Shape &input_shape,
+                               float *output_data, ruy::Context *ruy_context = nullptr)
+{
+  const auto input_dims = input_shape.DimsData();
+  const auto input_num_dims = input_shape.DimensionsCount();
+
+  int input_size = 1;
+  for (int idx = 0; idx < input_num_dims - 1; idx++)
+  {
+    input_size *= input_dims[idx];
+  }
+  const int reduce_size = input_dims[input_num_dims - 1];
+
+  // How many elements are needed to make it worth using one more thread
+  static constexpr int64_t kMinElementsPerThread = 1 << 15; // 32k
+  cpu_backend_threadpool::ParallelFor(
+    input_size, reduce_size, kMinElementsPerThread, ruy_context, [&](int row_start, int row_end) {
+      OptimizedReduceSumRows(input_data + row_start * reduce_size, row_end - row_start,
+                             reduce_size, output_data + row_start);
+    });
+}
+#endif // defined(USE_NEON) || defined(USE_X86_SIMD)
+
+// Reduces rows [row_start, row_end) of input along the innermost axis of size reduce_size
+template <typename In, typename Out>
+inline void ReduceInnermostRows(const In *input_data, int reduce_size, int row_start, int row_end,
+                                Out reducer(const Out current, const In in), Out *output_data)
+{
+  for (int idx = row_start; idx < row_end; idx++)
+  {
+    for (int r_idx = 0; r_idx < reduce_size; r_idx++)
+    {
+      if (r_idx == 0)
+      {
+        output_data[idx] = input_data[idx * reduce_size];
+      }
+      else
+      {
+        output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
+      }
+    }
+  }
+}
+
 template <typename In, typename Out>
 inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Shape &,
                        const int *axis, const int num_axis, int *input_iter,
@@ -132,20 +224,7 @@ inline bool ReduceImpl(const In *input_data, const Shape &input_shape, const Sha
       input_size *= input_dims[idx];
     }
     reduce_size = input_dims[input_num_dims - 1];
-    for (int idx = 0; idx < input_size; idx++)
-    {
-      for (int r_idx = 0; r_idx < reduce_size; r_idx++)
-      {
-        if (r_idx == 0)
-        {
-          output_data[idx] = input_data[idx * reduce_size];
-        }
-        else
-        {
-          output_data[idx] = reducer(output_data[idx], input_data[idx * reduce_size + r_idx]);
-        }
-      }
-    }
+    ReduceInnermostRows<In, Out>(input_data, reduce_size, 0, input_size, reducer, output_data);
     return true;
   }
 
@@ -250,7 +329,8 @@ public:
   template <typename T>
   inline bool ReduceGeneric(const Shape &input_shape, const T *input_data,
                             const Shape &output_shape, T *output_data, const std::vector<int> &axes,
-                            bool, T init_value, T reducer(const T current, const T in))
+                            bool, T init_value, T reducer(const T current, const T in),
+                            ruy::Context *ruy_context = nullptr)
   {
     // Reset output data.
     if (!InitTensorDataForReduce(output_shape, init_value, output_data))
@@ -265,6 +345,26 @@ public:
       return false;
     }
 
+    // Rows are reduced independently when only the innermost axis is reduced, so they can be
+    // split over threads
+    const int num_dims = input_shape.DimensionsCount();
+    if (ruy_context != nullptr && num_resolved_axis == 1 &&
+        resolved_axis_data()[0] == num_dims - 1)
+    {
+      const int reduce_size = input_shape.Dims(num_dims - 1);
+      int rows = 1;
+      for (int idx = 0; idx < num_dims - 1; idx++)
+      {
+        rows *= input_shape.Dims(idx);
+      }
+      cpu_backend_threadpool::ParallelFor(
+        rows, reduce_size, kMinElementsPerThread, ruy_context, [&](int row_start, int row_end) {
+          ReduceInnermostRows<T, T>(input_data, reduce_size, row_start, row_end, reducer,
+                                    output_data);
+        });
+      return true;
+    }
+
     return ReduceImpl<T, T>(input_data, input_shape, output_shape, resolved_axis_data(),
                             num_resolved_axis, temp_index_data(), reducer, output_data);
   }
@@ -369,6 +469,8 @@ private:
   std::vector<int> _resolved_axis;
   bool _prepared;
   static constexpr int kMaxSmallSize = 4;
+  // How many elements are needed to make it worth using one more thread
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
   int _temp_index_small[kMaxSmallSize];
   int _resolved_axis_small[kMaxSmallSize];
 };
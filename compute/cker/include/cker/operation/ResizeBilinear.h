@@ -18,6 +18,7 @@
 #ifndef __NNFW_CKER_RESIZEBILINEAR_H__
 #define __NNFW_CKER_RESIZEBILINEAR_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include <cmath>
@@ -27,6 +28,24 @@ namespace nnfw
 namespace cker
 {
 
+// Runs fn(batch, row) for rows_per_batch rows of each batch, where each row has row_size output
+// elements. Rows are split over threads of ruy_context if it is given and output is large enough.
+template <typename Fn>
+inline void ResizeBilinearForEachRow(int32_t batches, int32_t rows_per_batch, int64_t row_size,
+                                     ruy::Context *ruy_context, const Fn &fn)
+{
+  // How many output elements are needed to make it worth using one more thread
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
+  cpu_backend_threadpool::ParallelFor(
+    batches * rows_per_batch, row_size, kMinElementsPerThread, ruy_context,
+    [&](int row_start, int row_end) {
+      for (int row = row_start; row < row_end; ++row)
+      {
+        fn(row / rows_per_batch, row % rows_per_batch);
+      }
+    });
+}
+
 inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t y1, int32_t x,
                                     int32_t y, int32_t depth, int32_t batch,
                                     const Shape &input_shape, const float *input_data,
@@ -69,12 +88,13 @@ inline void ResizeBilinearKernel2x2(int32_t x0, int32_t x1, int32_t y0, int32_t
 inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t input_width,
                               int32_t depth, int32_t output_height, int32_t output_width,
                               const Shape &input_shape, const float *input_data,
-                              const Shape &output_shape, float *output_data)
+                              const Shape &output_shape, float *output_data,
+                              ruy::Context *ruy_context = nullptr)
 {
-  for (int b = 0; b < batches; b++)
-  {
-    for (int y0 = 0, y = 0; y <= output_height - 2; y += 2, y0++)
-    {
+  // Each pair of output rows is computed from a row of input
+  ResizeBilinearForEachRow(
+    batches, output_height / 2, 2 * output_width * depth, ruy_context, [&](int b, int y0) {
+      const int y = 2 * y0;
       for (int x0 = 0, x = 0; x <= output_width - 2; x += 2, x0++)
       {
         int32_t x1 = std::min(x0 + 1, input_width - 1);
@@ -82,8 +102,7 @@ inline void ResizeBilinear2x2(int32_t batches, int32_t input_height, int32_t inp
         ResizeBilinearKernel2x2(x0, x1, y0, y1, x, y, depth, b, input_shape, input_data,
                                 output_shape, output_data);
       }
-    }
-  }
+    });
 }
 
 inline void ResizeBilinearKernel(const float *input_ptr, int32_t depth, float scale,
@@ -119,15 +138,15 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
                                   int32_t depth, int32_t output_height, int32_t output_width,
                                   float height_scale, float width_scale, const Shape &input_shape,
                                   const float *input_data, float *output_data,
-                                  const bool half_pixel_centers)
+                                  const bool half_pixel_centers,
+                                  ruy::Context *ruy_context = nullptr)
 {
-  memset(output_data, 0, batches * output_height * output_width * depth * sizeof(float));
+  const int64_t output_row_size = static_cast<int64_t>(output_width) * depth;
+  ResizeBilinearForEachRow(
+    batches, output_height, output_row_size, ruy_context, [&](int b, int y) {
+      int64_t output_offset = (static_cast<int64_t>(b) * output_height + y) * output_row_size;
+      memset(output_data + output_offset, 0, output_row_size * sizeof(float));
 
-  int32_t output_offset = 0;
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
       float input_y;
       int32_t y0, y1;
       ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
@@ -163,8 +182,7 @@ inline void ResizeBilinearGeneric(int32_t batches, int32_t input_height, int32_t
 
         output_offset += depth;
       }
-    }
-  }
+    });
 }
 
 template <typename T>
@@ -173,13 +191,15 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
                                               int32_t output_height, int32_t output_width,
                                               float height_scale, float width_scale,
                                               const Shape &input_shape, const T *input_data,
-                                              T *output_data, const bool half_pixel_centers)
+                                              T *output_data, const bool half_pixel_centers,
+                                              ruy::Context *ruy_context = nullptr)
 {
-  T *output_ptr = &output_data[0];
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
+  const int64_t output_row_size = static_cast<int64_t>(output_width) * depth;
+  ResizeBilinearForEachRow(
+    batches, output_height, output_row_size, ruy_context, [&](int b, int y) {
+      T *output_ptr =
+        &output_data[(static_cast<int64_t>(b) * output_height + y) * output_row_size];
+
       float input_y;
       int32_t y0, y1;
       ComputeInterpolationValues(y, height_scale, half_pixel_centers, input_height, &input_y, &y0,
@@ -206,12 +226,12 @@ inline void ResizeBilinearGenericSmallChannel(int32_t batches, int32_t input_hei
             input_ptr[input_offset[2]] * scale[2] + input_ptr[input_offset[3]] * scale[3]);
         }
       }
-    }
-  }
+    });
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, const float *input_data,
-                    const Shape &output_shape, float *output_data)
+                    const Shape &output_shape, float *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = static_cast<int32_t>(MatchingDim(input_shape, 0, output_shape, 0));
   int32_t input_height = input_shape.Dims(1);
@@ -223,7 +243,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
       params.output_height == 2 * input_height && params.output_width == 2 * input_width)
   {
     ResizeBilinear2x2(batches, input_height, input_width, depth, params.output_height,
-                      params.output_width, input_shape, input_data, output_shape, output_data);
+                      params.output_width, input_shape, input_data, output_shape, output_data,
+                      ruy_context);
   }
   else
   {
@@ -240,12 +261,13 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape, cons
 
     ResizeBilinearGeneric(batches, input_height, input_width, depth, params.output_height,
                           params.output_width, height_scale, width_scale, input_shape, input_data,
-                          output_data, params.half_pixel_centers);
+                          output_data, params.half_pixel_centers, ruy_context);
   }
 }
 
 void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
-                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data)
+                    const uint8_t *input_data, const Shape &output_shape, uint8_t *output_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   int32_t batches = MatchingDim(input_shape, 0, output_shape, 0);
   int32_t input_height = input_shape.Dims(1);
@@ -262,7 +284,8 @@ void ResizeBilinear(ResizeBilinearParams &params, const Shape &input_shape,
 
   ResizeBilinearGenericSmallChannel<uint8_t>(
     batches, input_height, input_width, depth, params.output_height, params.output_width,
-    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers);
+    height_scale, width_scale, input_shape, input_data, output_data, params.half_pixel_centers,
+    ruy_context);
 }
 
 inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_10,
@@ -284,7 +307,8 @@ inline void ComputeInterpolationValues(const int32_t value, const int32_t scale_
 
 inline void ResizeBilinear(const ResizeBilinearParams &op_params,
                            const Shape &unextended_input_shape, const int8_t *input_data,
-                           const Shape &unextended_output_shape, int8_t *output_data)
+                           const Shape &unextended_output_shape, int8_t *output_data,
+                           ruy::Context *ruy_context = nullptr)
 {
   // If half_pixel_centers is True, align_corners must be False.
   assert(!op_params.half_pixel_centers || !op_params.align_corners);
@@ -313,10 +337,9 @@ inline void ResizeBilinear(const ResizeBilinearParams &op_params,
     width_scale_10 = ((1 << 10) * (input_width - 1) + (output_width - 1) / 2) / (output_width - 1);
   }
 
-  for (int b = 0; b < batches; ++b)
-  {
-    for (int y = 0; y < output_height; ++y)
-    {
+  ResizeBilinearForEachRow(
+    batches, output_height, static_cast<int64_t>(output_width) * depth, ruy_context,
+    [&](int b, int y) {
       int32_t input_y, y0, y1;
       ComputeInterpolationValues(y, height_scale_10, op_params.half_pixel_centers, input_height,
                                  &input_y, &y0, &y1);
@@ -345,8 +368,7 @@ inline void ResizeBilinear(const ResizeBilinearParams &op_params,
           output_data[Offset(output_shape, b, y, x, c)] = interpolation;
         }
       }
-    }
-  }
+    });
 }
 
 } // namespace cker
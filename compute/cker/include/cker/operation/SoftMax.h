@@ -18,10 +18,12 @@
 #ifndef __NNFW_CKER_SOFTMAX_H__
 #define __NNFW_CKER_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/Types.h"
 #include "cker/eigen/Utils.h"
+#include "cker/neon/neon_check.h"
 
 #if __aarch64__ && __clang__
 #define TFLITE_SOFTMAX_USE_UINT16_LUT
@@ -30,6 +32,7 @@
 #include <Eigen/Core>
 #include <fixedpoint/fixedpoint.h>
 #include <cmath>
+#include <vector>
 
 namespace nnfw
 {
@@ -75,11 +78,68 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
 }
 } // namespace reference
 
-// Performs softmax along the input of size (input_size * batch_size).
-inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
-                    float *out)
+#ifdef USE_X86_SIMD
+// Softmax of a batch with vectorized exp, whose result is close to std::exp within 1e-6 relatively
+X86_TARGET_AVX2 inline void SoftmaxAvx2(const float *in, const int input_size, const float beta,
+                                        float *out)
 {
-  assert(input_size > 0);
+  int i = 0;
+  __m256 max_dup = _mm256_set1_ps(in[0]);
+  for (; i <= input_size - 8; i += 8)
+  {
+    max_dup = _mm256_max_ps(max_dup, _mm256_loadu_ps(in + i));
+  }
+  float max_coeff = x86::ReduceMax(max_dup);
+  for (; i < input_size; i++)
+  {
+    max_coeff = std::max(max_coeff, in[i]);
+  }
+
+  const __m256 max_coeff_dup = _mm256_set1_ps(max_coeff);
+  const __m256 beta_dup = _mm256_set1_ps(beta);
+  __m256 exp_sum_dup = _mm256_setzero_ps();
+  i = 0;
+  for (; i <= input_size - 8; i += 8)
+  {
+    const __m256 x = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(in + i), max_coeff_dup), beta_dup);
+    const __m256 exp = x86::Exp(x);
+    _mm256_storeu_ps(out + i, exp);
+    exp_sum_dup = _mm256_add_ps(exp_sum_dup, exp);
+  }
+  float exp_sum = x86::ReduceAdd(exp_sum_dup);
+  for (; i < input_size; i++)
+  {
+    out[i] = std::exp((in[i] - max_coeff) * beta);
+    exp_sum += out[i];
+  }
+
+  const __m256 reciprocal_sum_exp_dup = _mm256_set1_ps(1.f / exp_sum);
+  i = 0;
+  for (; i <= input_size - 8; i += 8)
+  {
+    _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_loadu_ps(out + i), reciprocal_sum_exp_dup));
+  }
+  for (; i < input_size; i++)
+  {
+    out[i] *= 1.f / exp_sum;
+  }
+}
+#endif // USE_X86_SIMD
+
+// Performs softmax of batches in a single thread
+inline void SoftmaxBatches(const float *in, const int input_size, const int batch_size,
+                           const float beta, float *out)
+{
+#ifdef USE_X86_SIMD
+  if (x86::HasAvx2())
+  {
+    for (int b = 0; b < batch_size; b++)
+    {
+      SoftmaxAvx2(in + b * input_size, input_size, beta, out + b * input_size);
+    }
+    return;
+  }
+#endif // USE_X86_SIMD
 
   // For each batch
   for (int b = 0; b < batch_size; b++)
@@ -113,6 +173,24 @@ inline void Softmax(const float *in, const int input_size, const int batch_size,
   }
 }
 
+// Performs softmax along the input of size (input_size * batch_size).
+// Batches are split over threads of ruy_context if it is given and the input is large enough.
+inline void Softmax(const float *in, const int input_size, const int batch_size, const float beta,
+                    float *out, ruy::Context *ruy_context = nullptr)
+{
+  assert(input_size > 0);
+
+  // How many elements are needed to make it worth using one more thread, each of which takes
+  // an exp
+  static constexpr int64_t kMinElementsPerThread = 1 << 13; // 8k
+  cpu_backend_threadpool::ParallelFor(
+    batch_size, input_size, kMinElementsPerThread, ruy_context,
+    [&](int batch_start, int batch_end) {
+      SoftmaxBatches(in + batch_start * input_size, input_size, batch_end - batch_start, beta,
+                     out + batch_start * input_size);
+    });
+}
+
 inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const float *input_data,
                     const Shape &output_shape, float *output_data)
 {
@@ -196,6 +274,73 @@ inline void Softmax(const SoftmaxParams &params, const Shape &input_shape, const
   }
 }
 
+// Populates lookup tables of int16 Softmax, exp(x) for x in [-10, 0] and 1 / (1 + x) for x in
+// [0, 1]. Both are in Q0.15 and should have 513 entries.
+inline void PopulateSoftmaxInt16LookupTables(int16_t *exp_lut, int16_t *one_over_one_plus_x_lut)
+{
+  constexpr double kQ015Scale = 1.0 / 32768;
+  PopulateInt16LookupTable([](double x) { return std::exp(x); }, -10.0, 0.0, kQ015Scale, exp_lut);
+  PopulateInt16LookupTable([](double x) { return 1.0 / (1.0 + x); }, 0.0, 1.0, kQ015Scale,
+                           one_over_one_plus_x_lut);
+}
+
+// Quantized Softmax with int16 input and output, whose zero points are 0 and output scale is
+// 1 / 32768. params.input_multiplier and params.input_left_shift scale input differences by
+// input_scale * beta / (10 / 65535), so that [-65535, 0] corresponds to [-10.0, 0.0].
+inline void Softmax(const SoftmaxParams &params, const Shape &input_shape,
+                    const int16_t *input_data, const Shape &output_shape, int16_t *output_data)
+{
+  const int trailing_dim = input_shape.DimensionsCount() - 1;
+  const int outer_size = MatchingFlatSizeSkipDim(input_shape, trailing_dim, output_shape);
+  const int depth = MatchingDim(input_shape, trailing_dim, output_shape, trailing_dim);
+
+  std::vector<int16_t> exp_result_q015(depth);
+  for (int i = 0; i < outer_size; ++i)
+  {
+    int16_t max_in_row = std::numeric_limits<int16_t>::min();
+    for (int j = 0; j < depth; ++j)
+    {
+      max_in_row = std::max(max_in_row, input_data[j]);
+    }
+
+    // Compute exp(input - max_input) and sum of them in Q16.15
+    int32_t sum_of_exps = 0;
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t input_diff = input_data[j] - max_in_row;
+      const int32_t scaled_diff =
+        MultiplyByQuantizedMultiplier(input_diff, params.input_multiplier, params.input_left_shift);
+      // Recenter [-65535, 0] to [-32768, 32767], the input range of lookup table
+      const int32_t sym_scaled_diff = std::min(std::max(scaled_diff + 32767, -32768), 32767);
+      exp_result_q015[j] = LookupInt16(static_cast<int16_t>(sym_scaled_diff), params.exp_lut);
+      sum_of_exps += exp_result_q015[j];
+    }
+
+    // Compute 1 / sum_of_exps as 1 / (1 + x) for x in [0, 1] after normalizing sum_of_exps into
+    // [1, 2)
+    const int headroom_plus_one = CountLeadingZeros(static_cast<uint32_t>(sum_of_exps));
+    const int32_t shifted_sum =
+      ((static_cast<int64_t>(sum_of_exps) << (headroom_plus_one - 1)) + (1 << 13)) >> 14;
+    // Recenter x from [0, 65535] to [-32768, 32767]
+    const int32_t sym_shifted_sum =
+      std::min(std::max(shifted_sum - ((1 << 15) + (1 << 16)), -32768), 32767);
+    const int16_t reciprocal_scale_q015 =
+      LookupInt16(static_cast<int16_t>(sym_shifted_sum), params.one_over_one_plus_x_lut);
+
+    // Rescale exp results by the reciprocal, [0, 32767] of output corresponds to [0.0, 1.0]
+    const int right_shift = 31 - headroom_plus_one;
+    const int64_t round = static_cast<int64_t>(1) << (right_shift - 1);
+    for (int j = 0; j < depth; ++j)
+    {
+      const int32_t result = static_cast<int32_t>(
+        (static_cast<int64_t>(exp_result_q015[j]) * reciprocal_scale_q015 + round) >> right_shift);
+      output_data[j] = static_cast<int16_t>(std::min(std::max(result, 0), 32767));
+    }
+    input_data += depth;
+    output_data += depth;
+  }
+}
+
 #ifdef TFLITE_SOFTMAX_USE_UINT16_LUT
 // Looks up each element of <indices> in <table>, returns them in a vector.
 inline uint8x16_t aarch64_lookup_vector(const uint8x16x4_t table[4], uint8x16_t indices)
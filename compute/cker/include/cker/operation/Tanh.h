@@ -21,6 +21,8 @@
 #include "cker/eigen/Utils.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/Utils.h"
+#include <cmath>
 #include <Eigen/Core>
 
 namespace nnfw
@@ -36,6 +38,24 @@ inline void Tanh(const Shape &input_shape, const float *input_data, const Shape
   output_map.array() = input_map.array().tanh();
 }
 
+// Populates a lookup table of int16 Tanh, which should have 513 entries
+inline void PopulateTanhInt16LookupTable(float input_scale, float output_scale, int16_t *lut)
+{
+  PopulateInt16ActivationLookupTable([](double x) { return std::tanh(x); }, input_scale,
+                                     output_scale, lut);
+}
+
+// Quantized Tanh with int16 input and output, whose zero points are 0
+inline void Tanh(const int16_t *lut, const Shape &input_shape, const int16_t *input_data,
+                 const Shape &output_shape, int16_t *output_data)
+{
+  const int size = MatchingFlatSize(input_shape, output_shape);
+  for (int i = 0; i < size; ++i)
+  {
+    output_data[i] = LookupInt16(input_data[i], lut);
+  }
+}
+
 } // namespace cker
 } // namespace nnfw
 
@@ -18,9 +18,14 @@
 #ifndef __NNFW_CKER_TRANSPOSE_H__
 #define __NNFW_CKER_TRANSPOSE_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Types.h"
 #include "cker/Utils.h"
+#include "cker/neon/neon_check.h"
+
+#include <algorithm>
+#include <cstring>
 
 namespace nnfw
 {
@@ -118,460 +123,353 @@ void Transpose(const TransposeParams &params, const Shape &unextended_input_shap
 }
 } // namespace reference
 
-namespace
+namespace transpose_utils
 {
 
-bool IsTranspose2DApplicable(const TransposeParams &params, const Shape &input_shape, int *dim0,
-                             int *dim1)
+// Transpose problem in the simplest form. Dimensions of size one are removed and input axes
+// which stay adjacent in the output are merged, e.g. NHWC to NCHW becomes [N, HW, C] with
+// perm (0, 2, 1) and the rotations of axes become 2D transposes.
+struct TransposeDims
 {
-  const int dims_cnt = input_shape.DimensionsCount();
-
-  if (dims_cnt == 2)
-  {
-    *dim0 = input_shape.Dims(0);
-    *dim1 = input_shape.Dims(1);
-    return true;
-  }
-
-  const int first_perm = params.perm[0];
-  for (int i = 1; i < dims_cnt; ++i)
-  {
-    int rebased = params.perm[i] - first_perm;
-    if (rebased < 0)
-    {
-      rebased += dims_cnt;
-    }
-    if (rebased != i)
-    {
-      return false;
-    }
-  }
-  *dim0 = 1;
-  *dim1 = 1;
-  for (int i = 0; i < dims_cnt; ++i)
-  {
-    if (i < first_perm)
-    {
-      *dim0 *= input_shape.Dims(i);
-    }
-    else
-    {
-      *dim1 *= input_shape.Dims(i);
-    }
-  }
-  return true;
-}
+  int count = 0;
+  int dims[4];
+  int perm[4];
+};
 
-void RemoveOneSizeDimensions(Shape *input_shape, Shape *output_shape, TransposeParams *params)
+inline TransposeDims CanonicalizeTranspose(const TransposeParams &params, const Shape &input_shape)
 {
-  const int dims_cnt = input_shape->DimensionsCount();
-  assert(params->perm_count == dims_cnt);
+  const int rank = input_shape.DimensionsCount();
+  assert(rank <= 4);
+  assert(params.perm_count == rank);
 
-  bool foundOneSizeDim = false;
-  for (int i = 0; i < dims_cnt; ++i)
+  int new_axis[4];
+  int dims[4];
+  int count = 0;
+  for (int i = 0; i < rank; ++i)
   {
-    if (input_shape->Dims(i) == 1)
-    {
-      foundOneSizeDim = true;
-      break;
-    }
+    const int dim = input_shape.Dims(i);
+    new_axis[i] = (dim == 1) ? -1 : count;
+    if (dim != 1)
+      dims[count++] = dim;
   }
-
-  // Return here if there is no one size dimension.
-  if (!foundOneSizeDim)
-    return;
-
-  // Handle the case where all the dimension size is one.
-  if (input_shape->FlatSize() == 1)
+  int perm[4];
+  int perm_count = 0;
+  for (int i = 0; i < rank; ++i)
   {
-    input_shape->Resize(1);
-    input_shape->SetDim(0, 1);
-    output_shape->Resize(1);
-    output_shape->SetDim(0, 1);
-    params->perm_count = 1;
-    params->perm[0] = 0;
-    return;
+    if (new_axis[params.perm[i]] >= 0)
+      perm[perm_count++] = new_axis[params.perm[i]];
   }
+  assert(perm_count == count);
 
-  // Resize input shape.
-  int new_dims_cnt = 0;
-  for (int i = 0; i < dims_cnt; ++i)
+  // Groups of input axes in the output order
+  int group_first_axis[4];
+  int group_size[4];
+  int group_count = 0;
+  for (int i = 0; i < perm_count; ++i)
   {
-    if (input_shape->Dims(i) == 1)
+    if (i > 0 && perm[i] == perm[i - 1] + 1)
     {
+      group_size[group_count - 1] *= dims[perm[i]];
       continue;
     }
-    input_shape->SetDim(new_dims_cnt, input_shape->Dims(i));
-    ++new_dims_cnt;
+    group_first_axis[group_count] = perm[i];
+    group_size[group_count] = dims[perm[i]];
+    ++group_count;
   }
-  input_shape->Resize(new_dims_cnt);
 
-  // Resize output shape and re-calculate the perm parameter.
-  TransposeParams new_params;
-  new_dims_cnt = 0;
-  for (int i = 0; i < dims_cnt; ++i)
+  TransposeDims result;
+  result.count = group_count;
+  for (int g = 0; g < group_count; ++g)
   {
-    if (output_shape->Dims(i) == 1)
+    int input_axis = 0;
+    for (int h = 0; h < group_count; ++h)
     {
-      continue;
+      if (group_first_axis[h] < group_first_axis[g])
+        ++input_axis;
     }
-    new_params.perm[new_dims_cnt] = params->perm[i];
-    output_shape->SetDim(new_dims_cnt, output_shape->Dims(i));
-    ++new_dims_cnt;
+    result.perm[g] = input_axis;
+    result.dims[input_axis] = group_size[g];
   }
-  output_shape->Resize(new_dims_cnt);
-  new_params.perm_count = new_dims_cnt;
+  return result;
+}
 
-  for (int i = 0; i < new_dims_cnt; ++i)
-  {
-    int min_val_idx = -1;
-    for (int j = 0; j < new_dims_cnt; ++j)
-    {
-      if (new_params.perm[j] >= i &&
-          (min_val_idx == -1 || new_params.perm[min_val_idx] > new_params.perm[j]))
-      {
-        min_val_idx = j;
-      }
-    }
-    new_params.perm[min_val_idx] = i;
-  }
-  *params = new_params;
+// Number of threads for Transpose, which runs in parallel over work units
+inline int HowManyTransposeThreads(size_t num_bytes, int num_units, ruy::Context *ruy_context)
+{
+  // How many bytes to move are needed to make it worth using one more thread
+  static constexpr int64_t kMinBytesPerThread = 1 << 16; // 64KB
+  return cpu_backend_threadpool::HowManyThreads(static_cast<int64_t>(num_bytes),
+                                                kMinBytesPerThread, num_units, ruy_context);
 }
 
-size_t Flatten(const Shape &input_shape, const Shape &output_shape, const TransposeParams &params,
-               Shape *non_flatten_input_shape, Shape *non_flatten_output_shape,
-               TransposeParams *non_flatten_params)
+// out[c * out_stride + r] = in[r * in_stride + c] for 4x4 elements
+template <typename T>
+inline void Transpose4x4(const T *in, int in_stride, T *out, int out_stride)
 {
-  // Calculate the total size of non-flatten dimensions.
-  int skip_dims_cnt = 0;
-  size_t flat_size = input_shape.FlatSize();
-  for (int i = 0; i < params.perm_count; ++i)
+  for (int r = 0; r < 4; ++r)
   {
-    if (params.perm[i] == i)
-    {
-      flat_size /= input_shape.Dims(i);
-      ++skip_dims_cnt;
-    }
-    else
-    {
-      break;
-    }
+    const T a0 = in[r * in_stride];
+    const T a1 = in[r * in_stride + 1];
+    const T a2 = in[r * in_stride + 2];
+    const T a3 = in[r * in_stride + 3];
+    out[r] = a0;
+    out[out_stride + r] = a1;
+    out[2 * out_stride + r] = a2;
+    out[3 * out_stride + r] = a3;
   }
+}
 
-  // Shrink the shapes and re-calculate the perm parameter.
-  const int new_dims_cnt = params.perm_count - skip_dims_cnt;
-  non_flatten_input_shape->Resize(new_dims_cnt);
-  non_flatten_output_shape->Resize(new_dims_cnt);
-  non_flatten_params->perm_count = new_dims_cnt;
+#if defined(USE_NEON)
+template <>
+inline void Transpose4x4<int32_t>(const int32_t *in, int in_stride, int32_t *out, int out_stride)
+{
+  const int32x4x2_t t01 = vtrnq_s32(vld1q_s32(in), vld1q_s32(in + in_stride));
+  const int32x4x2_t t23 = vtrnq_s32(vld1q_s32(in + 2 * in_stride), vld1q_s32(in + 3 * in_stride));
+  vst1q_s32(out, vcombine_s32(vget_low_s32(t01.val[0]), vget_low_s32(t23.val[0])));
+  vst1q_s32(out + out_stride, vcombine_s32(vget_low_s32(t01.val[1]), vget_low_s32(t23.val[1])));
+  vst1q_s32(out + 2 * out_stride,
+            vcombine_s32(vget_high_s32(t01.val[0]), vget_high_s32(t23.val[0])));
+  vst1q_s32(out + 3 * out_stride,
+            vcombine_s32(vget_high_s32(t01.val[1]), vget_high_s32(t23.val[1])));
+}
+#elif defined(USE_X86_SIMD) && defined(__SSE2__)
+template <>
+inline void Transpose4x4<int32_t>(const int32_t *in, int in_stride, int32_t *out, int out_stride)
+{
+  // Only moves bits, so float shuffles are safe for any 4-byte type
+  __m128 r0 = _mm_loadu_ps(reinterpret_cast<const float *>(in));
+  __m128 r1 = _mm_loadu_ps(reinterpret_cast<const float *>(in + in_stride));
+  __m128 r2 = _mm_loadu_ps(reinterpret_cast<const float *>(in + 2 * in_stride));
+  __m128 r3 = _mm_loadu_ps(reinterpret_cast<const float *>(in + 3 * in_stride));
+  _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+  _mm_storeu_ps(reinterpret_cast<float *>(out), r0);
+  _mm_storeu_ps(reinterpret_cast<float *>(out + out_stride), r1);
+  _mm_storeu_ps(reinterpret_cast<float *>(out + 2 * out_stride), r2);
+  _mm_storeu_ps(reinterpret_cast<float *>(out + 3 * out_stride), r3);
+}
+#endif
 
-  for (int i = skip_dims_cnt; i < params.perm_count; ++i)
-  {
-    non_flatten_input_shape->SetDim(i - skip_dims_cnt, input_shape.Dims(i));
-    non_flatten_output_shape->SetDim(i - skip_dims_cnt, output_shape.Dims(i));
-    non_flatten_params->perm[i - skip_dims_cnt] = params.perm[i];
-  }
-  for (int i = 0; i < new_dims_cnt; ++i)
+// out[c * out_stride + r] = in[r * in_stride + c] for rows x cols elements. Columns are visited
+// in tiles so that the tile of input and output stays in L1 cache while it is transposed.
+template <typename T>
+inline void TransposeTile(const T *in, int in_stride, T *out, int out_stride, int rows, int cols)
+{
+  // Tile of kTile x kTile elements of input and output fits in 16KB
+  constexpr int kTile = sizeof(T) <= 2 ? 64 : 32;
+
+  for (int c0 = 0; c0 < cols; c0 += kTile)
   {
-    int min_val_idx = -1;
-    for (int j = 0; j < new_dims_cnt; ++j)
+    const int c_end = std::min(c0 + kTile, cols);
+    int r = 0;
+    for (; r + 4 <= rows; r += 4)
     {
-      if (non_flatten_params->perm[j] >= i &&
-          (min_val_idx == -1 ||
-           non_flatten_params->perm[min_val_idx] > non_flatten_params->perm[j]))
+      const T *in_row = in + r * in_stride;
+      int c = c0;
+      for (; c + 4 <= c_end; c += 4)
+      {
+        Transpose4x4(in_row + c, in_stride, out + c * out_stride + r, out_stride);
+      }
+      for (; c < c_end; ++c)
       {
-        min_val_idx = j;
+        for (int i = 0; i < 4; ++i)
+          out[c * out_stride + r + i] = in_row[i * in_stride + c];
       }
     }
-    non_flatten_params->perm[min_val_idx] = i;
+    for (; r < rows; ++r)
+    {
+      for (int c = c0; c < c_end; ++c)
+        out[c * out_stride + r] = in[r * in_stride + c];
+    }
   }
-
-  return flat_size;
 }
 
-} // namespace
-
-// Transpose2D only deals with typical 2D matrix transpose ops.
-// Perform transpose by transposing 4x4 blocks of the input, proceeding from
-// left to right (down the rows) of the input, and then from top to bottom.
+// Transpose whose innermost input axis stays innermost, e.g. 0,2,1,3. Each run of the innermost
+// axis is contiguous in both input and output, so it is copied by memcpy.
 template <typename T>
-inline void Transpose2D(const Shape &input_shape, const T *input_data, const Shape &output_shape,
-                        T *output_data)
+void TransposeInnerContiguous(const TransposeDims &t, const T *input_data, T *output_data,
+                              ruy::Context *ruy_context)
 {
-  assert(input_shape.DimensionsCount() == 2);
-  assert(output_shape.DimensionsCount() == 2);
-  UNUSED_RELEASE(output_shape);
-
-  const int d0 = input_shape.DimsData()[0];
-  const int d1 = input_shape.DimsData()[1];
-  const int kLines = 4;
-  const int kSkipSize = (kLines - 1) * d1;
-
-  const T *input = input_data;
-
-  int i = 0;
-  for (; i <= d0 - kLines; i += kLines)
-  {
-    T *output = output_data + i;
-
-    const T *input_ptr = input;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-    input_ptr += d1;
-    optimized_ops_preload_l1_keep(input_ptr);
-
-    int j = 0;
-    for (; j <= d1 - kLines; j += kLines)
-    {
-      input_ptr = input;
-      const T a00 = input_ptr[0];
-      const T a01 = input_ptr[1];
-      const T a02 = input_ptr[2];
-      const T a03 = input_ptr[3];
-      input_ptr += d1;
-      const T a10 = input_ptr[0];
-      const T a11 = input_ptr[1];
-      const T a12 = input_ptr[2];
-      const T a13 = input_ptr[3];
-      input_ptr += d1;
-      const T a20 = input_ptr[0];
-      const T a21 = input_ptr[1];
-      const T a22 = input_ptr[2];
-      const T a23 = input_ptr[3];
-      input_ptr += d1;
-      const T a30 = input_ptr[0];
-      const T a31 = input_ptr[1];
-      const T a32 = input_ptr[2];
-      const T a33 = input_ptr[3];
-
-      output[0] = a00;
-      output[1] = a10;
-      output[2] = a20;
-      output[3] = a30;
-      output += d0;
-
-      output[0] = a01;
-      output[1] = a11;
-      output[2] = a21;
-      output[3] = a31;
-      output += d0;
-
-      output[0] = a02;
-      output[1] = a12;
-      output[2] = a22;
-      output[3] = a32;
-      output += d0;
-
-      output[0] = a03;
-      output[1] = a13;
-      output[2] = a23;
-      output[3] = a33;
-      output += d0;
-
-      input += kLines;
-    }
-    if (j == d1)
+  const int n = t.count;
+  int in_strides[4];
+  in_strides[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i)
+    in_strides[i] = in_strides[i + 1] * t.dims[i + 1];
+
+  const int inner = t.dims[n - 1];
+  int outer_dims[3];
+  int outer_strides[3];
+  int num_runs = 1;
+  for (int i = 0; i < n - 1; ++i)
+  {
+    outer_dims[i] = t.dims[t.perm[i]];
+    outer_strides[i] = in_strides[t.perm[i]];
+    num_runs *= outer_dims[i];
+  }
+
+  auto copy_runs = [&](int run_start, int run_end) {
+    // Index of output position over outer dims, counted up like an odometer
+    int index[3] = {0, 0, 0};
+    int in_offset = 0;
+    for (int i = n - 2, rest = run_start; i >= 0; --i)
     {
-      input += kSkipSize;
+      index[i] = rest % outer_dims[i];
+      rest /= outer_dims[i];
+      in_offset += index[i] * outer_strides[i];
     }
-    else
+    T *out = output_data + static_cast<size_t>(run_start) * inner;
+    for (int run = run_start; run < run_end; ++run)
     {
-      for (int p = 0; p < kLines; ++p)
+      memcpy(out, input_data + in_offset, inner * sizeof(T));
+      out += inner;
+      for (int i = n - 2; i >= 0; --i)
       {
-        for (int q = 0; q < d1 - j; ++q)
-        {
-          *(output + q * d0 + p) = *(input + p * d1 + q);
-        }
+        in_offset += outer_strides[i];
+        if (++index[i] < outer_dims[i])
+          break;
+        in_offset -= index[i] * outer_strides[i];
+        index[i] = 0;
       }
-      input += (d1 - j) + kSkipSize;
     }
-  }
-  for (; i < d0; ++i)
-  {
-    T *output = output_data + i;
-    for (int j = 0; j < d1; ++j)
-    {
-      *output = *input;
-      output += d0;
-      ++input;
-    }
-  }
+  };
+
+  const int thread_count =
+    HowManyTransposeThreads(static_cast<size_t>(num_runs) * inner * sizeof(T), num_runs,
+                            ruy_context);
+  cpu_backend_threadpool::ParallelFor(num_runs, thread_count, ruy_context, copy_runs);
 }
 
-// TODO(alanchiao): see if we can reduce the number
-// of lines of code in branching without affecting latency.
+// Transpose whose innermost input axis moves, e.g. 2D, 0,2,1 and 0,3,1,2. Input axis becoming the
+// innermost output axis and the innermost input axis form 2D transposes of tiles, which are
+// repeated over the other axes.
 template <typename T>
-inline void Transpose3D(const TransposeParams &params, const Shape &input_shape,
-                        const T *input_data, const Shape &, T *output_data)
+void TransposeStrided(const TransposeDims &t, const T *input_data, T *output_data,
+                      ruy::Context *ruy_context)
 {
-  int s2, s3;
-  s2 = input_shape.Dims(1);
-  s3 = input_shape.Dims(2);
-
-  int p1 = 0;
-  int p2 = 0;
-  int p3 = 0;
-
-  if (params.perm[0] == 2)
-  {
-    p1 = 1;
-  }
-  else if (params.perm[1] == 2)
-  {
-    p2 = 1;
-  }
-  else
-  {
-    p3 = 1;
-  }
-
-  if (params.perm[0] == 1)
-  {
-    p1 = s3;
-  }
-  else if (params.perm[1] == 1)
-  {
-    p2 = s3;
-  }
-  else
-  {
-    p3 = s3;
-  }
-
-  if (params.perm[0] == 0)
-  {
-    p1 = s2 * s3;
-  }
-  else if (params.perm[1] == 0)
-  {
-    p2 = s2 * s3;
-  }
-  else
-  {
-    p3 = s2 * s3;
+  const int n = t.count;
+  int in_strides[4];
+  in_strides[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i)
+    in_strides[i] = in_strides[i + 1] * t.dims[i + 1];
+  int out_strides[4];
+  out_strides[n - 1] = 1;
+  for (int i = n - 2; i >= 0; --i)
+    out_strides[i] = out_strides[i + 1] * t.dims[t.perm[i + 1]];
+
+  // Rows of the 2D transpose are along input axis row_axis and columns along the innermost one
+  const int row_axis = t.perm[n - 1];
+  const int rows = t.dims[row_axis];
+  const int cols = t.dims[n - 1];
+  const int row_stride = in_strides[row_axis];
+  int col_stride = 0;
+  int batch_dims[2] = {1, 1};
+  int batch_in_strides[2] = {0, 0};
+  int batch_out_strides[2] = {0, 0};
+  int batch_count = 0;
+  for (int i = 0; i < n; ++i)
+  {
+    const int axis = t.perm[i];
+    if (axis == n - 1)
+    {
+      col_stride = out_strides[i];
+    }
+    else if (axis != row_axis)
+    {
+      batch_dims[batch_count] = t.dims[axis];
+      batch_in_strides[batch_count] = in_strides[axis];
+      batch_out_strides[batch_count] = out_strides[i];
+      ++batch_count;
+    }
   }
 
-  int o_s[3];
-  o_s[0] = input_shape.Dims(params.perm[0]);
-  o_s[1] = input_shape.Dims(params.perm[1]);
-  o_s[2] = input_shape.Dims(params.perm[2]);
+  // Work unit is a strip of rows of one batch
+  constexpr int kRowsPerUnit = sizeof(T) <= 2 ? 64 : 32;
+  const int strips = (rows + kRowsPerUnit - 1) / kRowsPerUnit;
+  const int num_units = batch_dims[0] * batch_dims[1] * strips;
 
-  for (int i1 = 0; i1 < o_s[0]; ++i1)
-  {
-    for (int i2 = 0; i2 < o_s[1]; ++i2)
+  auto transpose_units = [&](int unit_start, int unit_end) {
+    for (int unit = unit_start; unit < unit_end; ++unit)
     {
-      for (int i3 = 0; i3 < o_s[2]; ++i3)
-      {
-        const int i = i1 * p1 + i2 * p2 + i3 * p3;
-        const int o = i1 * o_s[1] * o_s[2] + i2 * o_s[2] + i3;
-        output_data[o] = input_data[i];
-      }
+      const int strip = unit % strips;
+      const int batch = unit / strips;
+      const int b0 = batch / batch_dims[1];
+      const int b1 = batch % batch_dims[1];
+      const int row = strip * kRowsPerUnit;
+      const T *in = input_data + b0 * batch_in_strides[0] + b1 * batch_in_strides[1] +
+                    row * row_stride;
+      T *out = output_data + b0 * batch_out_strides[0] + b1 * batch_out_strides[1] + row;
+      TransposeTile(in, row_stride, out, col_stride, std::min(kRowsPerUnit, rows - row), cols);
     }
-  }
+  };
+
+  const int thread_count = HowManyTransposeThreads(
+    static_cast<size_t>(batch_dims[0]) * batch_dims[1] * rows * cols * sizeof(T), num_units,
+    ruy_context);
+  cpu_backend_threadpool::ParallelFor(num_units, thread_count, ruy_context, transpose_units);
 }
 
 template <typename T>
 void TransposeImpl(const TransposeParams &params, const Shape &input_shape, const T *input_data,
-                   const Shape &output_shape, T *output_data)
+                   T *output_data, ruy::Context *ruy_context)
 {
-  const int dims_cnt = input_shape.DimensionsCount();
+  const TransposeDims t = CanonicalizeTranspose(params, input_shape);
 
-  int dim0, dim1;
-  if (IsTranspose2DApplicable(params, input_shape, &dim0, &dim1))
+  // Identity, including the permutations of dimensions of size one
+  if (t.count <= 1)
   {
-    Transpose2D(Shape({dim0, dim1}), input_data, Shape({dim1, dim0}), output_data);
+    memcpy(output_data, input_data, input_shape.FlatSize() * sizeof(T));
     return;
   }
 
-  // TODO(b/141217325): notably Eigen is better suited for
-  // larger inputs whereas Transpose3D is generally
-  // better for smaller ones.
-  //
-  // E.g. on Nexus 5, Eigen is better for size 96^3 and up
-  // and Transpose3D is better for 72^3 and down.
-  //
-  // 96^3 is not mobile-friendly for certain usecases
-  // (e.g. model used in beam search for seq2seq) but is in others.
-  // Consider tradeoffs.
-  if (dims_cnt == 3)
+  if (t.perm[t.count - 1] == t.count - 1)
   {
-    Transpose3D(params, input_shape, input_data, output_shape, output_data);
+    TransposeInnerContiguous(t, input_data, output_data, ruy_context);
     return;
   }
 
-  // Reroute to the reference version if an optimized method for the given data
-  // is not available.
-  reference::Transpose(params, input_shape, input_data, output_shape, output_data);
+  TransposeStrided(t, input_data, output_data, ruy_context);
 }
 
+} // namespace transpose_utils
+
+// Transpose with cache-blocked 2D tiles and memcpy of contiguous runs. It runs on the threads of
+// ruy_context for large tensors when ruy_context is given.
 template <typename T>
-void Transpose(const TransposeParams &unshrunk_params, const Shape &unshrunk_input_shape,
-               const T *input_data, const Shape &unshrunk_output_shape, T *output_data)
+void Transpose(const TransposeParams &params, const Shape &input_shape, const T *input_data,
+               const Shape &output_shape, T *output_data, ruy::Context *ruy_context = nullptr)
 {
-  const int output_size = unshrunk_output_shape.DimensionsCount();
-  assert(unshrunk_input_shape.DimensionsCount() <= 4);
-  assert(output_size <= 4);
-  assert(output_size == unshrunk_params.perm_count);
-
-  Shape shrunk_input_shape = Shape(unshrunk_input_shape);
-
-  Shape shrunk_output_shape = Shape(unshrunk_output_shape);
-
-  TransposeParams shrunk_params = unshrunk_params;
-
-  // Reduce any dimensions that have one size. Lower transpose op usually
-  // performs better since memory access patterns will be improved.
-  RemoveOneSizeDimensions(&shrunk_input_shape, &shrunk_output_shape, &shrunk_params);
-
-  // Handle identity cases.
-  // TODO(b/140779653): Add an optimization pass in the conversion process to
-  // remove transpose op nodes where they do nothing like the below one.
-  bool identical = true;
-  for (int i = 0; i < shrunk_params.perm_count; ++i)
+  assert(input_shape.DimensionsCount() <= 4);
+  assert(output_shape.DimensionsCount() == params.perm_count);
+  assert(input_shape.FlatSize() == output_shape.FlatSize());
+  UNUSED_RELEASE(output_shape);
 
+  // Transpose only moves values, so it is implemented per size of scalar type to keep the
+  // code size small like reference::Transpose
+  switch (sizeof(T))
   {
-    if (shrunk_params.perm[i] != i)
-
-    {
-      identical = false;
+    case 1:
+      transpose_utils::TransposeImpl(params, input_shape,
+                                     reinterpret_cast<const int8_t *>(input_data),
+                                     reinterpret_cast<int8_t *>(output_data), ruy_context);
+      break;
+    case 2:
+      transpose_utils::TransposeImpl(params, input_shape,
+                                     reinterpret_cast<const int16_t *>(input_data),
+                                     reinterpret_cast<int16_t *>(output_data), ruy_context);
+      break;
+    case 4:
+      transpose_utils::TransposeImpl(params, input_shape,
+                                     reinterpret_cast<const int32_t *>(input_data),
+                                     reinterpret_cast<int32_t *>(output_data), ruy_context);
+      break;
+    case 8:
+      transpose_utils::TransposeImpl(params, input_shape,
+                                     reinterpret_cast<const int64_t *>(input_data),
+                                     reinterpret_cast<int64_t *>(output_data), ruy_context);
+      break;
+    default:
+      reference::TransposeImpl(params, input_shape, input_data, output_shape, output_data);
       break;
-    }
-  }
-  if (identical)
-  {
-    memcpy(output_data, input_data, unshrunk_input_shape.FlatSize() * sizeof(T));
-    return;
-  }
-
-  // Reduce dimensions by flattening.
-  if (shrunk_params.perm[0] == 0 && output_size >= 3)
-
-  {
-    Shape non_flatten_input_shape;
-    Shape non_flatten_output_shape;
-    TransposeParams non_flatten_params;
-    const int total_size = shrunk_input_shape.FlatSize();
-
-    const int non_flatten_size =
-      Flatten(shrunk_input_shape, shrunk_output_shape, shrunk_params,
-
-              &non_flatten_input_shape, &non_flatten_output_shape, &non_flatten_params);
-    assert(non_flatten_params.perm[0] != 0);
-
-    for (int i = 0; i < total_size; i += non_flatten_size)
-    {
-      TransposeImpl(non_flatten_params, non_flatten_input_shape, input_data + i,
-                    non_flatten_output_shape, output_data + i);
-    }
-    return;
   }
-
-  // Call non-flattened case.
-  TransposeImpl(shrunk_params, shrunk_input_shape, input_data, shrunk_output_shape,
-
-                output_data);
 }
 
 } // namespace cker
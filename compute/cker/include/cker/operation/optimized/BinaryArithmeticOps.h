@@ -440,6 +440,16 @@ struct BinaryOpFuncAddFloat
     return vaddq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_add_ps(a, b);
+  }
+  X86_TARGET_AVX512 static inline __m512 calculate(const __m512 &a, const __m512 &b)
+  {
+    return _mm512_add_ps(a, b);
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a + b; }
 };
 
@@ -451,6 +461,16 @@ struct BinaryOpFuncSubFloat
     return vsubq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_sub_ps(a, b);
+  }
+  X86_TARGET_AVX512 static inline __m512 calculate(const __m512 &a, const __m512 &b)
+  {
+    return _mm512_sub_ps(a, b);
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a - b; }
 };
 
@@ -462,6 +482,16 @@ struct BinaryOpFuncMulFloat
     return vmulq_f32(a, b);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_mul_ps(a, b);
+  }
+  X86_TARGET_AVX512 static inline __m512 calculate(const __m512 &a, const __m512 &b)
+  {
+    return _mm512_mul_ps(a, b);
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a * b; }
 };
 
@@ -475,6 +505,16 @@ struct BinaryOpFuncDivFloat
   }
 #endif // __aarch64__
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return _mm256_div_ps(a, b);
+  }
+  X86_TARGET_AVX512 static inline __m512 calculate(const __m512 &a, const __m512 &b)
+  {
+    return _mm512_div_ps(a, b);
+  }
+#endif // USE_X86_SIMD
   static inline float calculate(const float a, const float b) { return a / b; }
 };
 
@@ -484,6 +524,16 @@ template <class BASEOPERATOR> struct BinaryOpFuncSwapArgs
   {
     return BASEOPERATOR::calculate(b, a);
   }
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 calculate(const __m256 &a, const __m256 &b)
+  {
+    return BASEOPERATOR::calculate(b, a);
+  }
+  X86_TARGET_AVX512 static inline __m512 calculate(const __m512 &a, const __m512 &b)
+  {
+    return BASEOPERATOR::calculate(b, a);
+  }
+#endif // USE_X86_SIMD
 };
 
 struct BinaryOpActivationFloatNone
@@ -500,6 +550,29 @@ struct BinaryOpActivationFloatNone
     return value;
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value, const __m256 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  X86_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    (void)floorParam;
+    return value;
+  }
+  X86_TARGET_AVX512 static inline __m512 applyCeiling(const __m512 &value,
+                                                      const __m512 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  X86_TARGET_AVX512 static inline __m512 applyFloor(const __m512 &value, const __m512 &floorParam)
+  {
+    (void)floorParam;
+    return value;
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -525,6 +598,29 @@ struct BinaryOpActivationFloatMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value, const __m256 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  X86_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+  X86_TARGET_AVX512 static inline __m512 applyCeiling(const __m512 &value,
+                                                      const __m512 &ceilingParam)
+  {
+    (void)ceilingParam;
+    return value;
+  }
+  // Full zero-masked max and min are used for AVX512, because _mm512_max_ps and _mm512_min_ps of
+  // GCC 12 pass an undefined value through, which makes -Wmaybe-uninitialized warning.
+  X86_TARGET_AVX512 static inline __m512 applyFloor(const __m512 &value, const __m512 &floorParam)
+  {
+    return _mm512_maskz_max_ps(0xffff, value, floorParam);
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     (void)ceilingParam;
@@ -548,6 +644,25 @@ struct BinaryOpActivationFloatMinMax
     return vmaxq_f32(value, floorParam);
   }
 #endif // USE_NEON
+#ifdef USE_X86_SIMD
+  X86_TARGET_AVX2 static inline __m256 applyCeiling(const __m256 &value, const __m256 &ceilingParam)
+  {
+    return _mm256_min_ps(value, ceilingParam);
+  }
+  X86_TARGET_AVX2 static inline __m256 applyFloor(const __m256 &value, const __m256 &floorParam)
+  {
+    return _mm256_max_ps(value, floorParam);
+  }
+  X86_TARGET_AVX512 static inline __m512 applyCeiling(const __m512 &value,
+                                                      const __m512 &ceilingParam)
+  {
+    return _mm512_maskz_min_ps(0xffff, value, ceilingParam);
+  }
+  X86_TARGET_AVX512 static inline __m512 applyFloor(const __m512 &value, const __m512 &floorParam)
+  {
+    return _mm512_maskz_max_ps(0xffff, value, floorParam);
+  }
+#endif // USE_X86_SIMD
   static inline float applyCeiling(const float value, const float ceilingParam)
   {
     return std::min(value, ceilingParam);
@@ -558,6 +673,84 @@ struct BinaryOpActivationFloatMinMax
   }
 };
 
+#ifdef USE_X86_SIMD
+// Vector loops of BinaryOpElementwise and BinaryOpScalarBroadcast for x86
+// They return number of processed elements, and remaining elements are done by scalar loop.
+template <class OPERATOR, class ACTIVATION>
+X86_TARGET_AVX2 inline int BinaryOpElementwiseAvx2(int size, const BinaryArithmeticOpParam &params,
+                                                   const float *input1_data,
+                                                   const float *input2_data, float *output_data)
+{
+  const __m256 activation_min = _mm256_set1_ps(params.float_activation_min);
+  const __m256 activation_max = _mm256_set1_ps(params.float_activation_max);
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    auto x =
+      OPERATOR::calculate(_mm256_loadu_ps(input1_data + i), _mm256_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+
+template <class OPERATOR, class ACTIVATION>
+X86_TARGET_AVX512 inline int
+BinaryOpElementwiseAvx512(int size, const BinaryArithmeticOpParam &params,
+                          const float *input1_data, const float *input2_data, float *output_data)
+{
+  const __m512 activation_min = _mm512_set1_ps(params.float_activation_min);
+  const __m512 activation_max = _mm512_set1_ps(params.float_activation_max);
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    auto x =
+      OPERATOR::calculate(_mm512_loadu_ps(input1_data + i), _mm512_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm512_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+
+template <class OPERATOR, class ACTIVATION>
+X86_TARGET_AVX2 inline int
+BinaryOpScalarBroadcastAvx2(int size, const BinaryArithmeticOpParam &params,
+                            const float broadcast_value, const float *input2_data,
+                            float *output_data)
+{
+  const __m256 activation_min = _mm256_set1_ps(params.float_activation_min);
+  const __m256 activation_max = _mm256_set1_ps(params.float_activation_max);
+  const __m256 broadcast_value_dup = _mm256_set1_ps(broadcast_value);
+  int i = 0;
+  for (; i <= size - 8; i += 8)
+  {
+    auto x = OPERATOR::calculate(broadcast_value_dup, _mm256_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm256_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+
+template <class OPERATOR, class ACTIVATION>
+X86_TARGET_AVX512 inline int
+BinaryOpScalarBroadcastAvx512(int size, const BinaryArithmeticOpParam &params,
+                              const float broadcast_value, const float *input2_data,
+                              float *output_data)
+{
+  const __m512 activation_min = _mm512_set1_ps(params.float_activation_min);
+  const __m512 activation_max = _mm512_set1_ps(params.float_activation_max);
+  const __m512 broadcast_value_dup = _mm512_set1_ps(broadcast_value);
+  int i = 0;
+  for (; i <= size - 16; i += 16)
+  {
+    auto x = OPERATOR::calculate(broadcast_value_dup, _mm512_loadu_ps(input2_data + i));
+    x = ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
+    _mm512_storeu_ps(output_data + i, x);
+  }
+  return i;
+}
+#endif // USE_X86_SIMD
+
 template <class OPERATOR, class ACTIVATION>
 inline void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
                                 const float *input1_data, const float *input2_data,
@@ -604,6 +797,13 @@ inline void BinaryOpElementwise(int size, const BinaryArithmeticOpParam &params,
       ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
     vst1q_f32(output_data + i, x_clamped);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx512())
+    i = BinaryOpElementwiseAvx512<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                        output_data);
+  else if (x86::HasAvx2())
+    i = BinaryOpElementwiseAvx2<OPERATOR, ACTIVATION>(size, params, input1_data, input2_data,
+                                                      output_data);
 #endif // USE_NEON
   for (; i < size; i++)
   {
@@ -658,6 +858,13 @@ inline void BinaryOpScalarBroadcast(int size, const BinaryArithmeticOpParam &par
       ACTIVATION::applyCeiling(ACTIVATION::applyFloor(x, activation_min), activation_max);
     vst1q_f32(output_data + i, x_clamped);
   }
+#elif defined(USE_X86_SIMD)
+  if (x86::HasAvx512())
+    i = BinaryOpScalarBroadcastAvx512<OPERATOR, ACTIVATION>(size, params, broadcast_value,
+                                                            input2_data, output_data);
+  else if (x86::HasAvx2())
+    i = BinaryOpScalarBroadcastAvx2<OPERATOR, ACTIVATION>(size, params, broadcast_value,
+                                                          input2_data, output_data);
 #endif // USE_NEON
   for (; i < size; i++)
   {
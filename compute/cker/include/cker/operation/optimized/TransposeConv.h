@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ * Copyright 2019 The TensorFlow Authors. All Rights Reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+#define __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
+
+#include "cker/ruy/RuySupport.h"
+#include "cker/Shape.h"
+#include "cker/Types.h"
+#include "cker/Utils.h"
+
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace optimized
+{
+
+/* From tensorflow/tensorflow/lite/kernels/internal/optimized/optimized_ops.h */
+// Reorder filter from [out_channel][filter_y][filter_x][in_channel] to
+// [filter_y][filter_x][out_channel][in_channel], so that GEMM result of each input pixel is laid
+// out in the order of output elements it contributes to.
+template <typename T>
+inline void TransposeConvFilterToHWOI(const Shape &filter_shape, const T *filter_data,
+                                      T *hwoi_filter_data)
+{
+  assert(filter_shape.DimensionsCount() == 4);
+  const int output_depth = filter_shape.Dims(0);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int input_depth = filter_shape.Dims(3);
+
+  for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+  {
+    for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+    {
+      for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+      {
+        const T *src = filter_data + Offset(filter_shape, out_channel, filter_y, filter_x, 0);
+        T *dst = hwoi_filter_data +
+                 ((filter_y * filter_width + filter_x) * output_depth + out_channel) * input_depth;
+        std::memcpy(dst, src, input_depth * sizeof(T));
+      }
+    }
+  }
+}
+
+// Size of GEMM result buffer for one batch, which TransposeConv requires as col2im_data
+inline int TransposeConvCol2imSize(const Shape &input_shape, const Shape &filter_shape)
+{
+  return input_shape.Dims(1) * input_shape.Dims(2) * filter_shape.Dims(0) * filter_shape.Dims(1) *
+         filter_shape.Dims(2);
+}
+
+// Accumulate GEMM result of [in_y][in_x][filter_y][filter_x][depth] into output image
+template <typename T>
+inline void Col2im(const T *col_data, int depth, int input_height, int input_width,
+                   int filter_height, int filter_width, int pad_height, int pad_width,
+                   int stride_height, int stride_width, int output_height, int output_width,
+                   T *im_data)
+{
+  for (int in_y = 0; in_y < input_height; ++in_y)
+  {
+    for (int in_x = 0; in_x < input_width; ++in_x)
+    {
+      const int out_y_origin = in_y * stride_height - pad_height;
+      const int out_x_origin = in_x * stride_width - pad_width;
+      for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+      {
+        const int out_y = out_y_origin + filter_y;
+        if (out_y < 0 || out_y >= output_height)
+        {
+          col_data += filter_width * depth;
+          continue;
+        }
+        for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+        {
+          const int out_x = out_x_origin + filter_x;
+          if (out_x >= 0 && out_x < output_width)
+          {
+            T *im = im_data + (out_y * output_width + out_x) * depth;
+            for (int c = 0; c < depth; ++c)
+              im[c] += col_data[c];
+          }
+          col_data += depth;
+        }
+      }
+    }
+  }
+}
+
+// GEMM of [filter_y * filter_x * out_channel, in_channel] filter and
+// [in_channel, in_y * in_x] input of a batch
+template <typename LhsScalar, typename DstScalar>
+inline void TransposeConvGemm(const LhsScalar *hwoi_filter_data, LhsScalar filter_zero_point,
+                              const LhsScalar *input_data, LhsScalar input_zero_point, int rows,
+                              int depth, int cols, DstScalar *col2im_data, bool is_constant_filter,
+                              ruy::Context *ruy_context)
+{
+  MatrixParams<LhsScalar> lhs_params;
+  lhs_params.order = Order::kRowMajor;
+  lhs_params.rows = rows;
+  lhs_params.cols = depth;
+  lhs_params.zero_point = filter_zero_point;
+  // Packing of filter is cached only if its data never changes at the same address
+  lhs_params.cache_policy =
+    is_constant_filter ? CachePolicy::kCacheIfLargeSpeedup : CachePolicy::kNeverCache;
+
+  MatrixParams<LhsScalar> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = depth;
+  rhs_params.cols = cols;
+  rhs_params.zero_point = input_zero_point;
+
+  MatrixParams<DstScalar> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = rows;
+  dst_params.cols = cols;
+
+  ruy::Matrix<LhsScalar> ruy_lhs;
+  ruy::Matrix<LhsScalar> ruy_rhs;
+  ruy::Matrix<DstScalar> ruy_dst;
+  ruy_support::MakeRuyMatrix(lhs_params, hwoi_filter_data, &ruy_lhs, true);
+  ruy_support::MakeRuyMatrix(rhs_params, input_data, &ruy_rhs);
+  ruy_support::MakeRuyMatrix(dst_params, col2im_data, &ruy_dst);
+
+  ruy::MulParams<DstScalar, DstScalar> ruy_mul_params;
+  ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+}
+
+/* From tensorflow/tensorflow/lite/kernels/internal/optimized/optimized_ops.h TransposeConvV2 */
+// Transpose convolution by GEMM followed by col2im
+//  - hwoi_filter_data   : filter reordered by TransposeConvFilterToHWOI
+//  - col2im_data        : buffer of TransposeConvCol2imSize() elements
+//  - is_constant_filter : whether hwoi_filter_data is not changed between calls
+inline void TransposeConv(const TransposeConvParams &params, const Shape &input_shape,
+                          const float *input_data, const Shape &filter_shape,
+                          const float *hwoi_filter_data, const Shape &output_shape,
+                          float *output_data, float *col2im_data, bool is_constant_filter,
+                          ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  const int gemm_rows = filter_height * filter_width * output_depth;
+  const int gemm_cols = input_height * input_width;
+  const int input_offset = input_height * input_width * input_depth;
+  const int output_offset = output_height * output_width * output_depth;
+
+  std::fill_n(output_data, output_shape.FlatSize(), 0.0f);
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    TransposeConvGemm<float, float>(hwoi_filter_data, 0.0f, input_data + batch * input_offset,
+                                    0.0f, gemm_rows, input_depth, gemm_cols, col2im_data,
+                                    is_constant_filter, ruy_context);
+    Col2im(col2im_data, output_depth, input_height, input_width, filter_height, filter_width,
+           params.padding_values.height, params.padding_values.width, params.stride_height,
+           params.stride_width, output_height, output_width, output_data + batch * output_offset);
+  }
+}
+
+// Quantized transpose convolution for uint8 per-tensor and int8 per-channel
+//  - params.input_offset/weights_offset : negated zero points of input and filter
+//  - output_multiplier/output_shift     : requantization parameters of each output channel
+//  - scratch_data                       : buffer of output elements of a batch
+template <typename T>
+inline void TransposeConv(const TransposeConvParams &params, const int32_t *output_multiplier,
+                          const int *output_shift, const Shape &input_shape, const T *input_data,
+                          const Shape &filter_shape, const T *hwoi_filter_data,
+                          const Shape &output_shape, T *output_data, int32_t *col2im_data,
+                          int32_t *scratch_data, bool is_constant_filter,
+                          ruy::Context *ruy_context)
+{
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  assert(params.quantized_activation_min <= params.quantized_activation_max);
+
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+
+  const int gemm_rows = filter_height * filter_width * output_depth;
+  const int gemm_cols = input_height * input_width;
+  const int input_offset = input_height * input_width * input_depth;
+  const int output_offset = output_height * output_width * output_depth;
+  const int output_pixels = output_height * output_width;
+
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    // ruy subtracts zero points of operands while accumulating in int32
+    TransposeConvGemm<T, int32_t>(hwoi_filter_data, static_cast<T>(-params.weights_offset),
+                                  input_data + batch * input_offset,
+                                  static_cast<T>(-params.input_offset), gemm_rows, input_depth,
+                                  gemm_cols, col2im_data, is_constant_filter, ruy_context);
+
+    std::fill_n(scratch_data, output_offset, 0);
+    Col2im(col2im_data, output_depth, input_height, input_width, filter_height, filter_width,
+           params.padding_values.height, params.padding_values.width, params.stride_height,
+           params.stride_width, output_height, output_width, scratch_data);
+
+    T *output = output_data + batch * output_offset;
+    for (int i = 0; i < output_pixels; ++i)
+    {
+      for (int c = 0; c < output_depth; ++c)
+      {
+        int32_t acc = scratch_data[i * output_depth + c];
+        acc = MultiplyByQuantizedMultiplier(acc, output_multiplier[c], output_shift[c]);
+        acc += params.output_offset;
+        acc = std::max(acc, params.quantized_activation_min);
+        acc = std::min(acc, params.quantized_activation_max);
+        output[i * output_depth + c] = static_cast<T>(acc);
+      }
+    }
+  }
+}
+
+} // namespace optimized
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_OPTIMIZED_TRANSPOSE_CONV_H__
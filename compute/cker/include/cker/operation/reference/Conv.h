@@ -20,8 +20,10 @@
 
 #include "cker/Shape.h"
 #include "cker/Types.h"
+#include "cker/Utils.h"
 
 #include <cmath>
+#include <type_traits>
 
 namespace nnfw
 {
@@ -311,6 +313,94 @@ inline void Conv(const ConvParams &params, const int32_t *output_multiplier,
   }
 }
 
+// Per-channel quantized conv with int16 input/output and int8 filter, whose zero points are all 0.
+// It accumulates into 64 bits to avoid overflow of int16 x int8 products.
+template <typename BiasT>
+inline void Conv(const ConvParams &params, const int32_t *output_multiplier,
+                 const int32_t *output_shift, const Shape &input_shape, const int16_t *input_data,
+                 const Shape &filter_shape, const int8_t *filter_data, const Shape &bias_shape,
+                 const BiasT *bias_data, const Shape &output_shape, int16_t *output_data)
+{
+  static_assert(std::is_same<BiasT, int32_t>::value || std::is_same<BiasT, int64_t>::value,
+                "Bias of int16 Conv should be int32_t or int64_t");
+  UNUSED_RELEASE(bias_shape);
+  const int stride_width = params.stride_width;
+  const int stride_height = params.stride_height;
+  const int dilation_width_factor = params.dilation_width_factor;
+  const int dilation_height_factor = params.dilation_height_factor;
+  const int pad_width = params.padding_values.width;
+  const int pad_height = params.padding_values.height;
+  const int32_t output_activation_min = params.quantized_activation_min;
+  const int32_t output_activation_max = params.quantized_activation_max;
+
+  assert(output_activation_min <= output_activation_max);
+  assert(input_shape.DimensionsCount() == 4);
+  assert(filter_shape.DimensionsCount() == 4);
+  assert(output_shape.DimensionsCount() == 4);
+  const int batches = MatchingDim(input_shape, 0, output_shape, 0);
+  const int input_depth = MatchingDim(input_shape, 3, filter_shape, 3);
+  const int output_depth = MatchingDim(filter_shape, 0, output_shape, 3);
+  if (bias_data)
+  {
+    assert(bias_shape.FlatSize() == output_depth);
+  }
+
+  const int input_height = input_shape.Dims(1);
+  const int input_width = input_shape.Dims(2);
+  const int filter_height = filter_shape.Dims(1);
+  const int filter_width = filter_shape.Dims(2);
+  const int output_height = output_shape.Dims(1);
+  const int output_width = output_shape.Dims(2);
+  for (int batch = 0; batch < batches; ++batch)
+  {
+    for (int out_y = 0; out_y < output_height; ++out_y)
+    {
+      const int in_y_origin = (out_y * stride_height) - pad_height;
+      for (int out_x = 0; out_x < output_width; ++out_x)
+      {
+        const int in_x_origin = (out_x * stride_width) - pad_width;
+        for (int out_channel = 0; out_channel < output_depth; ++out_channel)
+        {
+          int64_t acc = 0;
+          for (int filter_y = 0; filter_y < filter_height; ++filter_y)
+          {
+            const int in_y = in_y_origin + dilation_height_factor * filter_y;
+            if (in_y < 0 || in_y >= input_height)
+              continue;
+            for (int filter_x = 0; filter_x < filter_width; ++filter_x)
+            {
+              const int in_x = in_x_origin + dilation_width_factor * filter_x;
+              // Zero padding by omitting the areas outside the image.
+              if (in_x < 0 || in_x >= input_width)
+                continue;
+
+              const int16_t *input_ptr = &input_data[Offset(input_shape, batch, in_y, in_x, 0)];
+              const int8_t *filter_ptr =
+                &filter_data[Offset(filter_shape, out_channel, filter_y, filter_x, 0)];
+              for (int in_channel = 0; in_channel < input_depth; ++in_channel)
+              {
+                acc += static_cast<int32_t>(filter_ptr[in_channel]) * input_ptr[in_channel];
+              }
+            }
+          }
+
+          if (bias_data)
+          {
+            acc += bias_data[out_channel];
+          }
+          int32_t scaled_acc =
+            MultiplyByQuantizedMultiplier(acc, output_multiplier[out_channel],
+                                          output_shift[out_channel]);
+          scaled_acc = std::max(scaled_acc, output_activation_min);
+          scaled_acc = std::min(scaled_acc, output_activation_max);
+          output_data[Offset(output_shape, batch, out_y, out_x, out_channel)] =
+            static_cast<int16_t>(scaled_acc);
+        }
+      }
+    }
+  }
+}
+
 // Slightly modified from tflite 2.13.0 HybridConvPerChannel
 // im2col and im2col_shape are removed since it is not used in reference kernel.
 inline void HybridConvPerChannel(const ConvParams &params, float *scaling_factors_ptr,
@@ -18,7 +18,11 @@
 #define __NNFW_CKER_TRAIN_OPERATION_FULLY_CONNECTED_H__
 
 #include "cker/eigen/Utils.h"
+#include "cker/ruy/RuySupport.h"
 #include "cker/Shape.h"
+#include "cker/Types.h"
+
+#include <ruy/context.h>
 
 namespace nnfw
 {
@@ -42,6 +46,130 @@ inline void FullyConnectedBiasGrad(const Shape &incomming_shape, const T *incomm
   grad_mat = in_mat.rowwise().sum();
 }
 
+// Computes dst = lhs * rhs of column-major matrices on threads of ruy_context. Operands are
+// given as views of row-major tensors, so that backward does not have to transpose them.
+// Eigen is used on the calling thread if ruy_context is nullptr.
+inline void FullyConnectedGradGemm(const MatrixParams<float> &lhs_params, const float *lhs_data,
+                                   const MatrixParams<float> &rhs_params, const float *rhs_data,
+                                   const MatrixParams<float> &dst_params, float *dst_data,
+                                   ruy::Context *ruy_context)
+{
+  assert(lhs_params.cols == rhs_params.rows);
+  assert(dst_params.order == Order::kColMajor);
+  assert(dst_params.rows == lhs_params.rows && dst_params.cols == rhs_params.cols);
+
+  if (ruy_context != nullptr)
+  {
+    ruy::Matrix<float> ruy_lhs;
+    ruy::Matrix<float> ruy_rhs;
+    ruy::Matrix<float> ruy_dst;
+    ruy_support::MakeRuyMatrix(lhs_params, lhs_data, &ruy_lhs);
+    ruy_support::MakeRuyMatrix(rhs_params, rhs_data, &ruy_rhs);
+    ruy_support::MakeRuyMatrix(dst_params, dst_data, &ruy_dst);
+
+    ruy::MulParams<float, float> ruy_mul_params;
+    ruy::Mul(ruy_lhs, ruy_rhs, ruy_mul_params, ruy_context, &ruy_dst);
+    return;
+  }
+
+  using ColMajorConst = Eigen::Map<const Eigen::MatrixXf>;
+  using RowMajorConst =
+    Eigen::Map<const Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+  Eigen::Map<Eigen::MatrixXf> dst(dst_data, dst_params.rows, dst_params.cols);
+  const auto lhs_rows = lhs_params.rows;
+  const auto lhs_cols = lhs_params.cols;
+  const auto rhs_rows = rhs_params.rows;
+  const auto rhs_cols = rhs_params.cols;
+  if (lhs_params.order == Order::kColMajor && rhs_params.order == Order::kColMajor)
+    dst.noalias() = ColMajorConst(lhs_data, lhs_rows, lhs_cols) *
+                    ColMajorConst(rhs_data, rhs_rows, rhs_cols);
+  else if (lhs_params.order == Order::kColMajor)
+    dst.noalias() = ColMajorConst(lhs_data, lhs_rows, lhs_cols) *
+                    RowMajorConst(rhs_data, rhs_rows, rhs_cols);
+  else if (rhs_params.order == Order::kColMajor)
+    dst.noalias() = RowMajorConst(lhs_data, lhs_rows, lhs_cols) *
+                    ColMajorConst(rhs_data, rhs_rows, rhs_cols);
+  else
+    dst.noalias() = RowMajorConst(lhs_data, lhs_rows, lhs_cols) *
+                    RowMajorConst(rhs_data, rhs_rows, rhs_cols);
+}
+
+// Computes gradient of input, dX = dY * W
+//  - incoming: dY of [batches, num_units]
+//  - weights: W of [num_units, input_size]
+//  - grad: dX of [batches, input_size]
+inline void FullyConnectedInputGrad(const Shape &incoming_shape, const float *incoming_data,
+                                    const Shape &weights_shape, const float *weights_data,
+                                    const Shape &grad_shape, float *grad_data,
+                                    ruy::Context *ruy_context = nullptr)
+{
+  if (weights_shape.DimensionsCount() != 2)
+    throw std::runtime_error("cker::FullyConnectedInputGrad: weights should be 2D");
+  const int num_units = weights_shape.Dims(0);
+  const int input_size = weights_shape.Dims(1);
+  const int batches = FlatSizeSkipDim(incoming_shape, incoming_shape.DimensionsCount() - 1);
+  if (num_units != incoming_shape.Dims(incoming_shape.DimensionsCount() - 1) ||
+      grad_shape.FlatSize() != batches * input_size)
+    throw std::runtime_error("cker::FullyConnectedInputGrad: Unmatched shape");
+
+  // dX^T[input_size, batches] = W^T * dY^T, where W^T and dY^T are column-major views of W and dY
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kColMajor;
+  lhs_params.rows = input_size;
+  lhs_params.cols = num_units;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kColMajor;
+  rhs_params.rows = num_units;
+  rhs_params.cols = batches;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = input_size;
+  dst_params.cols = batches;
+
+  FullyConnectedGradGemm(lhs_params, weights_data, rhs_params, incoming_data, dst_params,
+                         grad_data, ruy_context);
+}
+
+// Computes gradient of weights, dW = dY^T * X
+//  - incoming: dY of [batches, num_units]
+//  - input: X of [batches, input_size]
+//  - grad: dW of [num_units, input_size]
+inline void FullyConnectedWeightsGrad(const Shape &incoming_shape, const float *incoming_data,
+                                      const Shape &input_shape, const float *input_data,
+                                      const Shape &grad_shape, float *grad_data,
+                                      ruy::Context *ruy_context = nullptr)
+{
+  if (grad_shape.DimensionsCount() != 2)
+    throw std::runtime_error("cker::FullyConnectedWeightsGrad: weights should be 2D");
+  const int num_units = grad_shape.Dims(0);
+  const int input_size = grad_shape.Dims(1);
+  const int batches = FlatSizeSkipDim(incoming_shape, incoming_shape.DimensionsCount() - 1);
+  if (num_units != incoming_shape.Dims(incoming_shape.DimensionsCount() - 1) ||
+      input_shape.FlatSize() != batches * input_size)
+    throw std::runtime_error("cker::FullyConnectedWeightsGrad: Unmatched shape");
+
+  // dW^T[input_size, num_units] = X^T * dY, where X^T is a column-major view of X
+  MatrixParams<float> lhs_params;
+  lhs_params.order = Order::kColMajor;
+  lhs_params.rows = input_size;
+  lhs_params.cols = batches;
+
+  MatrixParams<float> rhs_params;
+  rhs_params.order = Order::kRowMajor;
+  rhs_params.rows = batches;
+  rhs_params.cols = num_units;
+
+  MatrixParams<float> dst_params;
+  dst_params.order = Order::kColMajor;
+  dst_params.rows = input_size;
+  dst_params.cols = num_units;
+
+  FullyConnectedGradGemm(lhs_params, input_data, rhs_params, incoming_data, dst_params, grad_data,
+                         ruy_context);
+}
+
 } // namespace train
 } // namespace cker
 } // namespace nnfw
@@ -19,9 +19,12 @@
 
 #include <numeric>
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
+#include <ruy/context.h>
+
 namespace nnfw
 {
 namespace cker
@@ -59,7 +62,8 @@ inline void MSE(const Shape &y_pred_shape, const T *y_pred_data, const Shape &y_
 
 template <typename T>
 inline void MSEGrad(const Shape &y_pred_shape, const T *y_pred_data, const Shape &y_true_shape,
-                    const T *y_true_data, const Shape &grad_shape, T *grad_data)
+                    const T *y_true_data, const Shape &grad_shape, T *grad_data,
+                    ruy::Context *ruy_context = nullptr)
 {
   if (y_pred_shape != y_true_shape)
     throw std::runtime_error("cker::MSEGrad: y_pred_shape != y_true_shape");
@@ -67,10 +71,15 @@ inline void MSEGrad(const Shape &y_pred_shape, const T *y_pred_data, const Shape
     throw std::runtime_error("cker::MSEGrad: y_pred_shape != grad_shape");
 
   const int size = grad_shape.FlatSize();
-  for (int i = 0; i < size; ++i)
-  {
-    grad_data[i] = static_cast<T>(-2 * (y_true_data[i] - y_pred_data[i]) / size);
-  }
+  const T scale = static_cast<T>(2) / static_cast<T>(size);
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
+  cpu_backend_threadpool::ParallelFor(
+    size, 1, kMinElementsPerThread, ruy_context, [&](int start, int end) {
+      const auto y_pred = MapAsVector(y_pred_data + start, Shape{end - start});
+      const auto y_true = MapAsVector(y_true_data + start, Shape{end - start});
+      auto grad = MapAsVector(grad_data + start, Shape{end - start});
+      grad.array() = (y_pred.array() - y_true.array()) * scale;
+    });
 }
 
 template <typename T>
@@ -97,7 +106,8 @@ inline void CategoricalCrossEntropy(const Shape &y_pred_shape, const T *y_pred_d
 template <typename T>
 inline void CategoricalCrossEntropyGrad(const Shape &y_pred_shape, const T *y_pred_data,
                                         const Shape &y_true_shape, const T *y_true_data,
-                                        const Shape &grad_shape, T *grad_data)
+                                        const Shape &grad_shape, T *grad_data,
+                                        ruy::Context *ruy_context = nullptr)
 {
   if (y_pred_shape != y_true_shape)
     throw std::runtime_error(
@@ -106,11 +116,14 @@ inline void CategoricalCrossEntropyGrad(const Shape &y_pred_shape, const T *y_pr
     throw std::runtime_error(
       "cker::CategoricalCrossEntropyGrad: y_pred and grad do not have the same shape");
 
-  const auto y_pred = MapAsMatrixWithLastDimAsRows(y_pred_data, y_pred_shape);
-  const auto y_true = MapAsMatrixWithLastDimAsRows(y_true_data, y_true_shape);
-  auto grad = MapAsMatrixWithLastDimAsRows(grad_data, grad_shape);
-
-  grad = -(y_true.array() / y_pred.array().cwiseMax(log_threshold<T>()));
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
+  cpu_backend_threadpool::ParallelFor(
+    grad_shape.FlatSize(), 1, kMinElementsPerThread, ruy_context, [&](int start, int end) {
+      const auto y_pred = MapAsVector(y_pred_data + start, Shape{end - start});
+      const auto y_true = MapAsVector(y_true_data + start, Shape{end - start});
+      auto grad = MapAsVector(grad_data + start, Shape{end - start});
+      grad = -(y_true.array() / y_pred.array().cwiseMax(log_threshold<T>()));
+    });
 }
 
 } // namespace train
@@ -17,11 +17,13 @@
 #ifndef __NNFW_CKER_TRAIN_OPERATION_MAXPOOL_H__
 #define __NNFW_CKER_TRAIN_OPERATION_MAXPOOL_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/Utils.h"
 #include "cker/eigen/Utils.h"
 
 #include <Eigen/Core>
+#include <ruy/context.h>
 
 namespace nnfw
 {
@@ -127,31 +129,42 @@ inline void MaxPool2D(const PoolParams &params, const Shape &input_shape, const
 }
 
 inline void MaxPool2DGrad(const Shape &incoming_shape, const float *incoming_data,
-                          const int *arg_max_index, const Shape &grad_shape, float *grad_data)
+                          const int *arg_max_index, const Shape &grad_shape, float *grad_data,
+                          ruy::Context *ruy_context = nullptr)
 {
   assert(grad_shape.DimensionsCount() == 4);
   assert(incoming_shape.DimensionsCount() == 4);
 
-  // initialize grad_data
-  std::fill(grad_data, grad_data + grad_shape.FlatSize(), 0.0);
-
+  const int batches = MatchingDim(grad_shape, 0, incoming_shape, 0);
   const int depth = MatchingDim(grad_shape, 3, incoming_shape, 3);
   const auto incoming_mat = MapAsMatrixWithLastDimAsRows(incoming_data, incoming_shape);
   auto arg_max_index_mat = MapAsMatrixWithLastDimAsRows(arg_max_index, incoming_shape);
   auto grad_mat = MapAsMatrixWithLastDimAsRows(grad_data, grad_shape);
 
-  for (int col_index = 0; col_index < incoming_mat.cols(); col_index++)
-  {
-    auto arg_indices = arg_max_index_mat.col(col_index);
-    for (int d = 0; d < depth; d++)
-    {
-      // output value is from padding, so nothing to propagate
-      if (arg_indices(d) == -1)
-        continue;
+  // Max arguments of a batch are in the same batch, so batches are split over threads
+  const int incoming_batch_size = incoming_mat.cols() / batches;
+  const int grad_batch_size = grad_mat.cols() / batches;
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
+  cpu_backend_threadpool::ParallelFor(
+    batches, incoming_shape.FlatSize() / batches, kMinElementsPerThread, ruy_context,
+    [&](int start, int end) {
+      // initialize grad_data
+      grad_mat.middleCols(start * grad_batch_size, (end - start) * grad_batch_size).setZero();
+
+      for (int col_index = start * incoming_batch_size; col_index < end * incoming_batch_size;
+           col_index++)
+      {
+        auto arg_indices = arg_max_index_mat.col(col_index);
+        for (int d = 0; d < depth; d++)
+        {
+          // output value is from padding, so nothing to propagate
+          if (arg_indices(d) == -1)
+            continue;
 
-      grad_mat(d, arg_indices(d)) += incoming_mat(d, col_index);
-    }
-  }
+          grad_mat(d, arg_indices(d)) += incoming_mat(d, col_index);
+        }
+      }
+    });
 }
 
 } // namespace train
@@ -17,10 +17,12 @@
 #ifndef __NNFW_CKER_TRAIN_OPERATION_RELU_H__
 #define __NNFW_CKER_TRAIN_OPERATION_RELU_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
 #include <Eigen/Core>
+#include <ruy/context.h>
 
 namespace nnfw
 {
@@ -31,16 +33,20 @@ namespace train
 
 inline void ReLUGrad(const Shape &output_shape, const float *output_data,
                      const Shape &incoming_shape, const float *incoming_data,
-                     const Shape &grad_shape, float *grad_data)
+                     const Shape &grad_shape, float *grad_data, ruy::Context *ruy_context = nullptr)
 {
-  const auto output_map = MapAsVector(output_data, output_shape);
-  const auto incoming_map = MapAsVector(incoming_data, incoming_shape);
-  auto grad_map = MapAsVector(grad_data, grad_shape);
-
-  if (output_shape == incoming_shape && output_shape == grad_shape)
-    grad_map.array() = incoming_map.array() * (output_map.array() > 0.0f).template cast<float>();
-  else
+  if (output_shape != incoming_shape || output_shape != grad_shape)
     throw std::runtime_error("cker::ReLUGrad: Unsupported shape");
+
+  static constexpr int64_t kMinElementsPerThread = 1 << 14; // 16k
+  cpu_backend_threadpool::ParallelFor(
+    output_shape.FlatSize(), 1, kMinElementsPerThread, ruy_context, [&](int start, int end) {
+      const auto output_map = MapAsVector(output_data + start, Shape{end - start});
+      const auto incoming_map = MapAsVector(incoming_data + start, Shape{end - start});
+      auto grad_map = MapAsVector(grad_data + start, Shape{end - start});
+      grad_map.array() =
+        incoming_map.array() * (output_map.array() > 0.0f).template cast<float>();
+    });
 }
 
 } // namespace train
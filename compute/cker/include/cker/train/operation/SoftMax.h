@@ -17,9 +17,12 @@
 #ifndef __NNFW_CKER_TRAIN_SOFTMAX_H__
 #define __NNFW_CKER_TRAIN_SOFTMAX_H__
 
+#include "cker/CpuBackendThreadpool.h"
 #include "cker/Shape.h"
 #include "cker/eigen/Utils.h"
 
+#include <ruy/context.h>
+
 namespace nnfw
 {
 namespace cker
@@ -29,7 +32,8 @@ namespace train
 
 inline void SoftMaxGrad(const Shape &output_shape, const float *output_data,
                         const Shape &incoming_shape, const float *incoming_data,
-                        const Shape &grad_shape, float *grad_data)
+                        const Shape &grad_shape, float *grad_data,
+                        ruy::Context *ruy_context = nullptr)
 {
   // TODO Support 4dim softmax gradient
   assert(incoming_shape.DimensionsCount() == 2);
@@ -38,29 +42,19 @@ inline void SoftMaxGrad(const Shape &output_shape, const float *output_data,
   const int batches = incoming_shape.Dims(0);
   const int width = incoming_shape.Dims(1);
 
-  for (int b = 0; b < batches; ++b)
-  {
-    int b_offset = b * width;
-    for (int w1 = 0; w1 < width; ++w1)
-    {
-      float sum = 0.0f;
-      for (int w2 = 0; w2 < width; ++w2)
-      {
-        float val;
-        if (w1 == w2)
-        {
-          val = output_data[b_offset + w2] * (1.f - output_data[b_offset + w2]);
-        }
-        else
-        {
-          val = -output_data[b_offset + w2] * output_data[b_offset + w1];
-        }
-        val *= incoming_data[b_offset + w2];
-        sum += val;
-      }
-      grad_data[b_offset + w1] = sum;
-    }
-  }
+  // Product with the jacobian of softmax in O(width),
+  // dx_i = sum_j(y_i * (δ_ij - y_j) * dy_j) = y_i * (dy_i - sum_j(y_j * dy_j))
+  static constexpr int64_t kMinElementsPerThread = 1 << 13; // 8k
+  cpu_backend_threadpool::ParallelFor(
+    batches, width, kMinElementsPerThread, ruy_context, [&](int start, int end) {
+      const Shape shape{end - start, width};
+      const auto output = MapAsMatrixWithLastDimAsRows(output_data + start * width, shape);
+      const auto incoming = MapAsMatrixWithLastDimAsRows(incoming_data + start * width, shape);
+      auto grad = MapAsMatrixWithLastDimAsRows(grad_data + start * width, shape);
+
+      const Eigen::RowVectorXf dots = (output.array() * incoming.array()).colwise().sum();
+      grad.array() = output.array() * (incoming.rowwise() - dots).array();
+    });
 }
 
 } // namespace train
@@ -20,7 +20,9 @@
 
 #include "cker/eigen/training_ops.h"
 #include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/MultiTensorApply.h"
 
+#include <cmath>
 #include <vector>
 
 namespace nnfw
@@ -94,6 +96,39 @@ inline void Adam(const Shape &trainable_shape, float *trainable_data, const Shap
     use_nesterov);
 }
 
+/**
+ * @brief Adam of multiple tensors in one pass over all of their elements
+ *
+ * The moments and the variable of an element are updated together while its block is in cache,
+ * instead of a pass over each of them.
+ */
+inline void MultiTensorAdam(const std::vector<OptimizerBuffers> &tensors, float beta1_power,
+                            float beta2_power, float learning_rate, float beta1, float beta2,
+                            float epsilon)
+{
+  for (const auto &t : tensors)
+  {
+    if (t.size > 0 && (t.m == nullptr || t.v == nullptr))
+      throw std::runtime_error("cker::MultiTensorAdam: m and v are not given");
+  }
+
+  const float alpha = learning_rate * std::sqrt(1.0f - beta2_power) / (1.0f - beta1_power);
+  // Input data: var, m, v, grad. Output data: var, m, v. Consider Sqrt as Div.
+  const Eigen::TensorOpCost cost(sizeof(float) * 4, sizeof(float) * 3,
+                                 Eigen::TensorOpCost::AddCost<float>() * 5 +
+                                   Eigen::TensorOpCost::MulCost<float>() * 4 +
+                                   Eigen::TensorOpCost::DivCost<float>() * 2);
+  MultiTensorApply(tensors, cost, [=](const OptimizerBuffers &t, int64_t begin, int64_t size) {
+    Eigen::Map<Eigen::ArrayXf> var(t.var + begin, size);
+    Eigen::Map<Eigen::ArrayXf> m(t.m + begin, size);
+    Eigen::Map<Eigen::ArrayXf> v(t.v + begin, size);
+    Eigen::Map<const Eigen::ArrayXf> g(t.grad + begin, size);
+    m += (g - m) * (1.0f - beta1);
+    v += (g.square() - v) * (1.0f - beta2);
+    var -= (m * alpha) / (v.sqrt() + epsilon);
+  });
+}
+
 } // namespace train
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_APPLY_H__
+#define __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_APPLY_H__
+
+#include "cker/eigen/EigenSupport.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+namespace nnfw
+{
+namespace cker
+{
+namespace train
+{
+
+/**
+ * @brief Buffers of a trainable tensor to be updated with other tensors at once
+ *
+ * Optimizer variables not used by the optimizer are nullptr.
+ */
+struct OptimizerBuffers
+{
+  float *var;
+  const float *grad;
+  float *m;
+  float *v;
+  int64_t size;
+};
+
+// Elements of a tensor updated at once. All of their variables stay in L1 while they are updated.
+constexpr int64_t kMultiTensorBlockSize = 1024;
+
+/**
+ * @brief Run fn(tensor, begin, size) over elements of all tensors as a flattened range
+ *
+ * The range is split over the Eigen thread pool regardless of tensor boundaries, so small tensors
+ * do not cost a dispatch each. A piece of a tensor is given in blocks of kMultiTensorBlockSize.
+ */
+template <typename Fn>
+void MultiTensorApply(const std::vector<OptimizerBuffers> &tensors,
+                      const Eigen::TensorOpCost &cost_per_element, const Fn &fn)
+{
+  std::vector<int64_t> offsets(tensors.size() + 1, 0);
+  std::transform(tensors.begin(), tensors.end(), offsets.begin() + 1,
+                 [](const OptimizerBuffers &t) { return t.size; });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+  const auto total = offsets.back();
+  if (total == 0)
+    return;
+
+  const Eigen::ThreadPoolDevice &device = *eigen_support::GetThreadPoolDevice();
+  device.parallelFor(total, cost_per_element, [&](Eigen::Index first, Eigen::Index last) {
+    size_t t = std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+    for (int64_t i = first; i < last;)
+    {
+      // Skip empty tensors
+      while (offsets[t + 1] <= i)
+        ++t;
+      const auto end =
+        std::min({static_cast<int64_t>(last), offsets[t + 1], i + kMultiTensorBlockSize});
+      fn(tensors[t], i - offsets[t], end - i);
+      i = end;
+    }
+  });
+}
+
+} // namespace train
+} // namespace cker
+} // namespace nnfw
+
+#endif // __NNFW_CKER_TRAIN_OPTIMIZER_MULTI_TENSOR_APPLY_H__
@@ -20,6 +20,7 @@
 
 #include "cker/eigen/training_ops.h"
 #include "cker/eigen/EigenSupport.h"
+#include "cker/train/optimizer/MultiTensorApply.h"
 
 #include <vector>
 
@@ -56,6 +57,24 @@ inline void GradientDescent(const Shape &output_shape, float *output_data, const
     static_cast<const Tensor &>(grad_tensor).flat<float>());
 }
 
+/**
+ * @brief Gradient descent of multiple tensors in one pass over all of their elements
+ */
+inline void MultiTensorGradientDescent(const std::vector<OptimizerBuffers> &tensors,
+                                       float learning_rate)
+{
+  // Input data: var, grad. Output data: var.
+  const Eigen::TensorOpCost cost(sizeof(float) * 2, sizeof(float),
+                                 Eigen::TensorOpCost::AddCost<float>() +
+                                   Eigen::TensorOpCost::MulCost<float>());
+  MultiTensorApply(tensors, cost, [learning_rate](const OptimizerBuffers &t, int64_t begin,
+                                                  int64_t size) {
+    Eigen::Map<Eigen::ArrayXf> var(t.var + begin, size);
+    Eigen::Map<const Eigen::ArrayXf> grad(t.grad + begin, size);
+    var -= grad * learning_rate;
+  });
+}
+
 } // namespace train
 } // namespace cker
 } // namespace nnfw
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __NNFW_CKER_X86_CHECK_H__
+#define __NNFW_CKER_X86_CHECK_H__
+
+// x86 SIMD code is compiled for AVX2 and AVX-512 with target attributes and chosen at runtime by
+// CPU features, so that binaries built for baseline x86-64 use them on capable CPUs.
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__)) && \
+  !defined(CKER_DISABLE_X86_SIMD)
+#define USE_X86_SIMD
+#include <immintrin.h>
+
+#include <algorithm>
+#include <cstdint>
+
+#define X86_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#define X86_TARGET_AVX512 __attribute__((target("avx512f,avx512bw,avx2,fma")))
+
+namespace nnfw
+{
+namespace cker
+{
+namespace x86
+{
+
+enum class SimdLevel
+{
+  kNone = 0,
+  kAvx2,
+  kAvx512,
+};
+
+inline SimdLevel DetectSimdLevel()
+{
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+    return SimdLevel::kAvx512;
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    return SimdLevel::kAvx2;
+  return SimdLevel::kNone;
+}
+
+inline SimdLevel &CurrentSimdLevel()
+{
+  static SimdLevel level = DetectSimdLevel();
+  return level;
+}
+
+// SIMD level used by x86 kernels
+inline SimdLevel GetSimdLevel() { return CurrentSimdLevel(); }
+
+// Limit SIMD level used by x86 kernels, e.g. to compare with lower level in benchmark
+// It cannot raise the level over what CPU supports.
+inline void SetSimdLevel(SimdLevel level)
+{
+  CurrentSimdLevel() = std::min(level, DetectSimdLevel());
+}
+
+inline bool HasAvx2() { return GetSimdLevel() >= SimdLevel::kAvx2; }
+inline bool HasAvx512() { return GetSimdLevel() >= SimdLevel::kAvx512; }
+
+// Horizontal sum of 8 floats
+X86_TARGET_AVX2 inline float ReduceAdd(__m256 value)
+{
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_movehdup_ps(sum));
+  return _mm_cvtss_f32(sum);
+}
+
+// Horizontal max of 8 floats
+X86_TARGET_AVX2 inline float ReduceMax(__m256 value)
+{
+  __m128 max = _mm_max_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+  max = _mm_max_ps(max, _mm_movehl_ps(max, max));
+  max = _mm_max_ss(max, _mm_movehdup_ps(max));
+  return _mm_cvtss_f32(max);
+}
+
+// Horizontal sum of 8 int32s
+X86_TARGET_AVX2 inline int32_t ReduceAdd(__m256i value)
+{
+  __m128i sum = _mm_add_epi32(_mm256_castsi256_si128(value), _mm256_extracti128_si256(value, 1));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(1, 0, 3, 2)));
+  sum = _mm_add_epi32(sum, _mm_shuffle_epi32(sum, _MM_SHUFFLE(2, 3, 0, 1)));
+  return _mm_cvtsi128_si32(sum);
+}
+
+// 256-bit half of 512 bits, kIndex is 0 for the lower half
+// Extract is zero-masked because unmasked extract and cast of GCC 12 pass an undefined value
+// through, which makes -Wmaybe-uninitialized warning where they are inlined.
+template <int kIndex> X86_TARGET_AVX512 inline __m256 ExtractHalf(__m512 value)
+{
+  return _mm256_castpd_ps(_mm512_maskz_extractf64x4_pd(0xf, _mm512_castps_pd(value), kIndex));
+}
+
+template <int kIndex> X86_TARGET_AVX512 inline __m256i ExtractHalf(__m512i value)
+{
+  return _mm512_maskz_extracti64x4_epi64(0xf, value, kIndex);
+}
+
+// Horizontal sum of 16 floats
+X86_TARGET_AVX512 inline float ReduceAdd(__m512 value)
+{
+  return ReduceAdd(_mm256_add_ps(ExtractHalf<0>(value), ExtractHalf<1>(value)));
+}
+
+// Horizontal sum of 16 int32s
+X86_TARGET_AVX512 inline int32_t ReduceAdd(__m512i value)
+{
+  return ReduceAdd(_mm256_add_epi32(ExtractHalf<0>(value), ExtractHalf<1>(value)));
+}
+
+// Round half away from zero as std::round does
+X86_TARGET_AVX2 inline __m256 RoundHalfAwayFromZero(__m256 value)
+{
+  const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+  const __m256 truncated = _mm256_round_ps(value, _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+  const __m256 fraction = _mm256_andnot_ps(sign_mask, _mm256_sub_ps(value, truncated));
+  const __m256 round_up = _mm256_cmp_ps(fraction, _mm256_set1_ps(0.5f), _CMP_GE_OQ);
+  const __m256 signed_one = _mm256_or_ps(_mm256_and_ps(value, sign_mask), _mm256_set1_ps(1.0f));
+  return _mm256_add_ps(truncated, _mm256_and_ps(round_up, signed_one));
+}
+
+// Saturate 16 int32s of two vectors to int8s in order
+X86_TARGET_AVX2 inline __m128i PackInt32ToInt8(__m256i low, __m256i high)
+{
+  const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8);
+  return _mm_packs_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+}
+
+// Saturate 16 int32s of two vectors to uint8s in order
+X86_TARGET_AVX2 inline __m128i PackInt32ToUint8(__m256i low, __m256i high)
+{
+  const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(low, high), 0xD8);
+  return _mm_packus_epi16(_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1));
+}
+
+// exp(x) by Cephes polynomial, whose relative error is about 1e-7 in range of float
+X86_TARGET_AVX2 inline __m256 Exp(__m256 x)
+{
+  x = _mm256_min_ps(x, _mm256_set1_ps(88.3762626647949f));
+  x = _mm256_max_ps(x, _mm256_set1_ps(-88.3762626647949f));
+
+  // exp(x) = 2^n * exp(r), n = round(x / ln2), r = x - n * ln2
+  __m256 n = _mm256_fmadd_ps(x, _mm256_set1_ps(1.44269504088896341f), _mm256_set1_ps(0.5f));
+  n = _mm256_floor_ps(n);
+  x = _mm256_fnmadd_ps(n, _mm256_set1_ps(0.693359375f), x);
+  x = _mm256_fnmadd_ps(n, _mm256_set1_ps(-2.12194440e-4f), x);
+
+  __m256 y = _mm256_set1_ps(1.9875691500E-4f);
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.3981999507E-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(8.3334519073E-3f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(4.1665795894E-2f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(1.6666665459E-1f));
+  y = _mm256_fmadd_ps(y, x, _mm256_set1_ps(5.0000001201E-1f));
+  y = _mm256_fmadd_ps(y, _mm256_mul_ps(x, x), _mm256_add_ps(x, _mm256_set1_ps(1.0f)));
+
+  __m256i pow2n = _mm256_add_epi32(_mm256_cvttps_epi32(n), _mm256_set1_epi32(127));
+  pow2n = _mm256_slli_epi32(pow2n, 23);
+  return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+
+} // namespace x86
+} // namespace cker
+} // namespace nnfw
+
+#endif
+
+#endif // __NNFW_CKER_X86_CHECK_H__
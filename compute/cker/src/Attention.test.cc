@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Attention.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+std::vector<float> makeInput(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 37 + seed * 11) % 101 - 50) / 25.f;
+  return data;
+}
+
+// Index of 4D 'dims' broadcasted to 'b, h, r, c'
+int broadcastIndex(const std::vector<int> &dims, int b, int h, int r, int c)
+{
+  b = dims[0] == 1 ? 0 : b;
+  h = dims[1] == 1 ? 0 : h;
+  r = dims[2] == 1 ? 0 : r;
+  c = dims[3] == 1 ? 0 : c;
+  return ((b * dims[1] + h) * dims[2] + r) * dims[3] + c;
+}
+
+// Materializes all scores as BatchMatMul, Mul, Add, Softmax and BatchMatMul do
+std::vector<float> naiveAttention(float scale, const std::vector<int> &q_dims,
+                                  const std::vector<float> &query, const std::vector<int> &k_dims,
+                                  const std::vector<float> &key, const std::vector<int> &v_dims,
+                                  const std::vector<float> &value, const std::vector<int> &m_dims,
+                                  const float *mask)
+{
+  const int batches = q_dims[0], heads = q_dims[1], query_len = q_dims[2], depth = q_dims[3];
+  const int key_len = k_dims[2], value_depth = v_dims[3];
+  std::vector<float> output(batches * heads * query_len * value_depth);
+  std::vector<float> scores(key_len);
+
+  for (int b = 0; b < batches; ++b)
+    for (int h = 0; h < heads; ++h)
+      for (int i = 0; i < query_len; ++i)
+      {
+        float max = -std::numeric_limits<float>::infinity();
+        for (int j = 0; j < key_len; ++j)
+        {
+          float dot = 0.f;
+          for (int d = 0; d < depth; ++d)
+            dot += query[broadcastIndex(q_dims, b, h, i, d)] *
+                   key[broadcastIndex(k_dims, b, h, j, d)];
+          scores[j] = dot * scale + (mask ? mask[broadcastIndex(m_dims, b, h, i, j)] : 0.f);
+          max = std::max(max, scores[j]);
+        }
+        float sum = 0.f;
+        for (int j = 0; j < key_len; ++j)
+        {
+          scores[j] = std::exp(scores[j] - max);
+          sum += scores[j];
+        }
+        for (int d = 0; d < value_depth; ++d)
+        {
+          float acc = 0.f;
+          for (int j = 0; j < key_len; ++j)
+            acc += scores[j] / sum * value[broadcastIndex(v_dims, b, h, j, d)];
+          output[((b * heads + h) * query_len + i) * value_depth + d] = acc;
+        }
+      }
+  return output;
+}
+
+void verifyAttention(const std::vector<int> &q_dims, const std::vector<int> &k_dims,
+                     const std::vector<int> &v_dims, const std::vector<int> &m_dims,
+                     ruy::Context *ruy_context = nullptr)
+{
+  auto flatSize = [](const std::vector<int> &dims) {
+    return dims[0] * dims[1] * dims[2] * dims[3];
+  };
+  const auto query = makeInput(flatSize(q_dims), 1);
+  const auto key = makeInput(flatSize(k_dims), 2);
+  const auto value = makeInput(flatSize(v_dims), 3);
+  std::vector<float> mask;
+  if (!m_dims.empty())
+  {
+    // Causal-like mask with large negative values and some fully masked columns
+    mask.resize(flatSize(m_dims));
+    for (size_t i = 0; i < mask.size(); ++i)
+      mask[i] = (i % 7 == 3) ? -1e9f : static_cast<float>(i % 5) / 4.f;
+  }
+  const float *mask_data = mask.empty() ? nullptr : mask.data();
+  const float scale = 1.f / std::sqrt(static_cast<float>(q_dims[3]));
+
+  const auto expected =
+    naiveAttention(scale, q_dims, query, k_dims, key, v_dims, value, m_dims, mask_data);
+
+  const Shape q_shape{q_dims[0], q_dims[1], q_dims[2], q_dims[3]};
+  const Shape k_shape{k_dims[0], k_dims[1], k_dims[2], k_dims[3]};
+  const Shape v_shape{v_dims[0], v_dims[1], v_dims[2], v_dims[3]};
+  const Shape m_shape =
+    m_dims.empty() ? Shape{} : Shape{m_dims[0], m_dims[1], m_dims[2], m_dims[3]};
+  const Shape o_shape{q_dims[0], q_dims[1], q_dims[2], v_dims[3]};
+  std::vector<float> output(o_shape.FlatSize());
+
+  nnfw::cker::AttentionParams params;
+  params.scale = scale;
+  nnfw::cker::Attention(params, q_shape, query.data(), k_shape, key.data(), v_shape, value.data(),
+                        m_shape, mask_data, o_shape, output.data(), ruy_context);
+
+  ASSERT_EQ(output.size(), expected.size());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-4f);
+}
+
+} // namespace
+
+TEST(CKer_Attention, Simple)
+{
+  verifyAttention({1, 1, 4, 8}, {1, 1, 6, 8}, {1, 1, 6, 8}, {});
+  verifyAttention({1, 1, 4, 8}, {1, 1, 6, 8}, {1, 1, 6, 8}, {1, 1, 4, 6});
+}
+
+TEST(CKer_Attention, MultiTiles)
+{
+  // Lengths which are not multiples of tile sizes
+  verifyAttention({2, 3, 77, 16}, {2, 3, 150, 16}, {2, 3, 150, 24}, {});
+  verifyAttention({2, 3, 77, 16}, {2, 3, 150, 16}, {2, 3, 150, 24}, {2, 3, 77, 150});
+}
+
+TEST(CKer_Attention, Broadcast)
+{
+  // Shared key and value over heads, padding mask over queries and heads
+  verifyAttention({2, 4, 40, 8}, {2, 1, 70, 8}, {2, 1, 70, 8}, {2, 1, 1, 70});
+  // Mask shared over batches
+  verifyAttention({3, 2, 33, 8}, {3, 2, 65, 8}, {3, 2, 65, 8}, {1, 1, 33, 65});
+}
+
+TEST(CKer_Attention, FullyMaskedRow)
+{
+  const std::vector<int> q_dims{1, 1, 2, 4};
+  const std::vector<int> kv_dims{1, 1, 3, 4};
+  const std::vector<int> m_dims{1, 1, 2, 3};
+  const auto query = makeInput(8, 1);
+  const auto key = makeInput(12, 2);
+  const auto value = makeInput(12, 3);
+  const float inf = std::numeric_limits<float>::infinity();
+  const std::vector<float> mask{-inf, -inf, -inf, 0.f, -inf, 0.f};
+  std::vector<float> output(8);
+
+  nnfw::cker::AttentionParams params;
+  params.scale = 0.5f;
+  nnfw::cker::Attention(params, Shape{1, 1, 2, 4}, query.data(), Shape{1, 1, 3, 4}, key.data(),
+                        Shape{1, 1, 3, 4}, value.data(), Shape{1, 1, 2, 3}, mask.data(),
+                        Shape{1, 1, 2, 4}, output.data());
+
+  // The first row attends nothing, and the second row is the same as finite masking
+  const std::vector<float> finite_mask{0.f, 0.f, 0.f, 0.f, -1e30f, 0.f};
+  const auto expected = naiveAttention(0.5f, q_dims, query, kv_dims, key, kv_dims, value, m_dims,
+                                       finite_mask.data());
+  for (int d = 0; d < 4; ++d)
+  {
+    EXPECT_EQ(output[d], 0.f);
+    EXPECT_NEAR(output[4 + d], expected[4 + d], 1e-5f);
+  }
+}
+
+TEST(CKer_Attention, MultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  verifyAttention({2, 4, 100, 32}, {2, 4, 130, 32}, {2, 4, 130, 32}, {}, &ruy_context);
+  verifyAttention({1, 8, 64, 16}, {1, 1, 257, 16}, {1, 1, 257, 16}, {1, 1, 64, 257},
+                  &ruy_context);
+}
+
+TEST(CKer_Attention, KVCache)
+{
+  // Prefill of some tokens and then decoding one token at a time with kv cache
+  const int heads = 2, seq_len = 70, prefill_len = 37, capacity = 80, depth = 8;
+  const std::vector<int> dims{1, heads, seq_len, depth};
+  const auto query = makeInput(heads * seq_len * depth, 1);
+  const auto key = makeInput(heads * seq_len * depth, 2);
+  const auto value = makeInput(heads * seq_len * depth, 3);
+  std::vector<float> causal_mask(seq_len * seq_len);
+  for (int i = 0; i < seq_len; ++i)
+    for (int j = 0; j < seq_len; ++j)
+      causal_mask[i * seq_len + j] = j > i ? -1e30f : 0.f;
+  const float scale = 0.25f;
+  const auto expected = naiveAttention(scale, dims, query, dims, key, dims, value,
+                                       {1, 1, seq_len, seq_len}, causal_mask.data());
+
+  std::vector<float> key_cache(heads * capacity * depth);
+  std::vector<float> value_cache(heads * capacity * depth);
+  const Shape cache_shape{1, heads, capacity, depth};
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+
+  for (int start = 0; start < seq_len;)
+  {
+    const int len = start == 0 ? prefill_len : 1;
+    std::vector<float> step_query(heads * len * depth);
+    for (int h = 0; h < heads; ++h)
+    {
+      const int src = (h * seq_len + start) * depth;
+      std::copy_n(query.begin() + src, len * depth, step_query.begin() + h * len * depth);
+      std::copy_n(key.begin() + src, len * depth,
+                  key_cache.begin() + (h * capacity + start) * depth);
+      std::copy_n(value.begin() + src, len * depth,
+                  value_cache.begin() + (h * capacity + start) * depth);
+    }
+    std::vector<float> output(heads * len * depth);
+
+    nnfw::cker::AttentionParams params;
+    params.scale = scale;
+    params.key_len = start + len;
+    params.causal = true;
+    nnfw::cker::Attention(params, Shape{1, heads, len, depth}, step_query.data(), cache_shape,
+                          key_cache.data(), cache_shape, value_cache.data(), Shape{}, nullptr,
+                          Shape{1, heads, len, depth}, output.data(), &ruy_context);
+
+    for (int h = 0; h < heads; ++h)
+      for (int i = 0; i < len * depth; ++i)
+        EXPECT_NEAR(output[h * len * depth + i], expected[(h * seq_len + start) * depth + i],
+                    1e-4f);
+    start += len;
+  }
+}
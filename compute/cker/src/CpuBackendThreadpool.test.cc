@@ -0,0 +1,276 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/CpuBackendThreadpool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Concatenation.h>
+#include <cker/operation/Gather.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/ResizeBilinear.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <atomic>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+template <typename T> std::vector<T> makeInput(int size)
+{
+  std::vector<T> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<T>((i * 37 + 11) % 101 - 50) / static_cast<T>(8);
+  return data;
+}
+
+template <> std::vector<uint8_t> makeInput<uint8_t>(int size)
+{
+  std::vector<uint8_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<uint8_t>((i * 37 + 11) % 256);
+  return data;
+}
+
+template <> std::vector<int8_t> makeInput<int8_t>(int size)
+{
+  std::vector<int8_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<int8_t>((i * 37 + 11) % 256 - 128);
+  return data;
+}
+
+class CKer_ParallelFor : public ::testing::Test
+{
+protected:
+  void SetUp() override { _ruy_context.set_max_num_threads(4); }
+
+  ruy::Context _ruy_context;
+};
+
+} // namespace
+
+TEST_F(CKer_ParallelFor, CoversAllUnits)
+{
+  for (int num_units : {0, 1, 3, 4, 7, 1000})
+  {
+    std::vector<std::atomic<int>> visits(num_units);
+    nnfw::cker::cpu_backend_threadpool::ParallelFor(num_units, 4, &_ruy_context,
+                                                    [&](int start, int end) {
+                                                      for (int i = start; i < end; ++i)
+                                                        visits[i]++;
+                                                    });
+    for (int i = 0; i < num_units; ++i)
+      EXPECT_EQ(visits[i], 1);
+  }
+}
+
+TEST_F(CKer_ParallelFor, HowManyThreads)
+{
+  using nnfw::cker::cpu_backend_threadpool::HowManyThreads;
+
+  // Small work stays on the calling thread
+  EXPECT_EQ(HowManyThreads(100, 1000, 100, &_ruy_context), 1);
+  // Threads are bounded by work, units and the context
+  EXPECT_EQ(HowManyThreads(2500, 1000, 100, &_ruy_context), 2);
+  EXPECT_EQ(HowManyThreads(100000, 1000, 3, &_ruy_context), 3);
+  EXPECT_EQ(HowManyThreads(100000, 1000, 100, &_ruy_context), 4);
+  EXPECT_EQ(HowManyThreads(100000, 1000, 100, nullptr), 1);
+}
+
+TEST_F(CKer_ParallelFor, Softmax)
+{
+  const int batch_size = 257;
+  const int input_size = 129;
+  const auto input = makeInput<float>(batch_size * input_size);
+  std::vector<float> expected(input.size());
+  std::vector<float> output(input.size());
+
+  nnfw::cker::Softmax(input.data(), input_size, batch_size, 1.f, expected.data());
+  nnfw::cker::Softmax(input.data(), input_size, batch_size, 1.f, output.data(), &_ruy_context);
+  EXPECT_EQ(output, expected);
+}
+
+TEST_F(CKer_ParallelFor, ReduceInnermostAxis)
+{
+  const Shape input_shape{3, 129, 257};
+  const Shape output_shape{3, 129};
+  const auto input = makeInput<float>(input_shape.FlatSize());
+  std::vector<float> expected(output_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+  auto reducer = [](const float current, const float in) -> float {
+    return (in > current) ? in : current;
+  };
+
+  nnfw::cker::Reduce serial;
+  serial.prepare(3, 1);
+  ASSERT_TRUE(serial.ReduceGeneric<float>(input_shape, input.data(), output_shape,
+                                          expected.data(), {-1}, false,
+                                          std::numeric_limits<float>::lowest(), reducer));
+  nnfw::cker::Reduce parallel;
+  parallel.prepare(3, 1);
+  ASSERT_TRUE(parallel.ReduceGeneric<float>(
+    input_shape, input.data(), output_shape, output.data(), {-1}, false,
+    std::numeric_limits<float>::lowest(), reducer, &_ruy_context));
+  EXPECT_EQ(output, expected);
+
+#if defined(USE_NEON) || defined(USE_X86_SIMD)
+  nnfw::cker::OptimizedReduceSum(input.data(), input_shape, expected.data());
+  nnfw::cker::OptimizedReduceSum(input.data(), input_shape, output.data(), &_ruy_context);
+  EXPECT_EQ(output, expected);
+#endif
+}
+
+TEST_F(CKer_ParallelFor, Gather)
+{
+  const Shape input_shape{4, 50, 4096};
+  const std::vector<int32_t> coords{3, 0, 49, 7, 7, 21};
+  const Shape coords_shape{static_cast<int>(coords.size())};
+  const Shape output_shape{4, static_cast<int>(coords.size()), 4096};
+  const auto input = makeInput<float>(input_shape.FlatSize());
+  std::vector<float> output(output_shape.FlatSize());
+
+  nnfw::cker::GatherParams params;
+  params.axis = 1;
+  nnfw::cker::Gather<float>(params, input_shape, input.data(), coords_shape, coords.data(),
+                            output_shape, output.data(), &_ruy_context);
+
+  for (int outer = 0; outer < 4; ++outer)
+    for (size_t i = 0; i < coords.size(); ++i)
+      for (int inner = 0; inner < 4096; ++inner)
+        EXPECT_EQ(output[(outer * coords.size() + i) * 4096 + inner],
+                  input[(outer * 50 + coords[i]) * 4096 + inner]);
+}
+
+TEST_F(CKer_ParallelFor, Concatenation)
+{
+  for (int axis : {0, 1, 2})
+  {
+    const Shape input1_shape{axis == 0 ? 3 : 8, axis == 1 ? 5 : 70, axis == 2 ? 100 : 129};
+    const Shape input2_shape{axis == 0 ? 5 : 8, axis == 1 ? 11 : 70, axis == 2 ? 33 : 129};
+    Shape output_shape(input1_shape);
+    output_shape.SetDim(axis, input1_shape.Dims(axis) + input2_shape.Dims(axis));
+    const auto input1 = makeInput<float>(input1_shape.FlatSize());
+    const auto input2 = makeInput<float>(input2_shape.FlatSize() + 1);
+    const Shape *input_shapes[] = {&input1_shape, &input2_shape};
+    const float *input_data[] = {input1.data(), input2.data() + 1};
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+
+    nnfw::cker::ConcatenationParams params;
+    params.axis = axis;
+    params.inputs_count = 2;
+    nnfw::cker::Concatenation<float>(params, input_shapes, input_data, output_shape,
+                                     expected.data());
+    nnfw::cker::Concatenation<float>(params, input_shapes, input_data, output_shape,
+                                     output.data(), &_ruy_context);
+    EXPECT_EQ(output, expected);
+  }
+}
+
+TEST_F(CKer_ParallelFor, ResizeBilinear)
+{
+  const Shape input_shape{2, 33, 31, 24};
+  const auto input = makeInput<float>(input_shape.FlatSize());
+  const auto input_u8 = makeInput<uint8_t>(input_shape.FlatSize());
+  const auto input_s8 = makeInput<int8_t>(input_shape.FlatSize());
+
+  // 2x2 upsample and generic ones
+  for (const auto &size : std::vector<std::pair<int, int>>{{66, 62}, {50, 40}, {17, 90}})
+  {
+    nnfw::cker::ResizeBilinearParams params;
+    params.output_height = size.first;
+    params.output_width = size.second;
+    params.align_corners = false;
+    params.half_pixel_centers = false;
+    const Shape output_shape{2, size.first, size.second, 24};
+
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+    nnfw::cker::ResizeBilinear(params, input_shape, input.data(), output_shape, expected.data());
+    nnfw::cker::ResizeBilinear(params, input_shape, input.data(), output_shape, output.data(),
+                               &_ruy_context);
+    EXPECT_EQ(output, expected);
+
+    std::vector<uint8_t> expected_u8(output_shape.FlatSize());
+    std::vector<uint8_t> output_u8(output_shape.FlatSize());
+    nnfw::cker::ResizeBilinear(params, input_shape, input_u8.data(), output_shape,
+                               expected_u8.data());
+    nnfw::cker::ResizeBilinear(params, input_shape, input_u8.data(), output_shape,
+                               output_u8.data(), &_ruy_context);
+    EXPECT_EQ(output_u8, expected_u8);
+
+    std::vector<int8_t> expected_s8(output_shape.FlatSize());
+    std::vector<int8_t> output_s8(output_shape.FlatSize());
+    nnfw::cker::ResizeBilinear(params, input_shape, input_s8.data(), output_shape,
+                               expected_s8.data());
+    nnfw::cker::ResizeBilinear(params, input_shape, input_s8.data(), output_shape,
+                               output_s8.data(), &_ruy_context);
+    EXPECT_EQ(output_s8, expected_s8);
+  }
+}
+
+TEST_F(CKer_ParallelFor, BinaryArithmetic)
+{
+  using nnfw::cker::BinaryArithmeticOpParam;
+  using nnfw::cker::BinaryArithmeticOpType;
+
+  auto verify = [&](const Shape &input1_shape, const Shape &input2_shape,
+                    const Shape &output_shape) {
+    const auto input1 = makeInput<float>(input1_shape.FlatSize());
+    const auto input2 = makeInput<float>(input2_shape.FlatSize() + 3);
+    std::vector<float> expected(output_shape.FlatSize());
+    std::vector<float> output(output_shape.FlatSize());
+
+    BinaryArithmeticOpParam params;
+    params.float_activation_min = -2.f;
+    params.float_activation_max = 3.f;
+    const bool need_broadcast =
+      nnfw::cker::ProcessBroadcastShapes(input1_shape, input2_shape, &params);
+    if (need_broadcast)
+    {
+      nnfw::cker::BroadcastBinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+        params, input1_shape, input1.data(), input2_shape, input2.data() + 3, output_shape,
+        expected.data());
+      nnfw::cker::BroadcastBinaryArithmeticOpParallel<BinaryArithmeticOpType::MUL>(
+        params, input1_shape, input1.data(), input2_shape, input2.data() + 3, output_shape,
+        output.data(), &_ruy_context);
+    }
+    else
+    {
+      nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+        params, input1_shape, input1.data(), input2_shape, input2.data() + 3, output_shape,
+        expected.data());
+      nnfw::cker::BinaryArithmeticOpParallel<BinaryArithmeticOpType::MUL>(
+        params, input1_shape, input1.data(), input2_shape, input2.data() + 3, output_shape,
+        output.data(), &_ruy_context);
+    }
+    EXPECT_EQ(output, expected);
+  };
+
+  verify({8, 64, 129}, {8, 64, 129}, {8, 64, 129});
+  verify({8, 64, 129}, {129}, {8, 64, 129});
+  verify({1, 64, 129}, {8, 1, 129}, {8, 64, 129});
+  verify({8, 64, 1}, {1, 64, 129}, {8, 64, 129});
+  verify({1, 7, 64, 129}, {1, 7, 1, 1}, {1, 7, 64, 129});
+  verify({9, 1, 3, 2000}, {1, 5, 1, 2000}, {9, 5, 3, 2000});
+}
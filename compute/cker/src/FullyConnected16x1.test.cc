@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/FullyConnectedDense16x1.h>
+#include <cker/operation/FullyConnectedSparse16x1.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+
+constexpr int kInputSize = 197;
+constexpr int kNumUnits = 64;
+constexpr int kBatches = 3;
+
+// Dense weights of [kNumUnits, kInputSize] with every other 16x1 block being zero
+std::vector<float> makeWeights()
+{
+  std::vector<float> weights(kNumUnits * kInputSize, 0.f);
+  for (int o = 0; o < kNumUnits; ++o)
+    for (int i = 0; i < kInputSize; ++i)
+      if ((o / 16 + i) % 2 == 0)
+        weights[o * kInputSize + i] = static_cast<float>((o * 7 + i * 3) % 11 - 5) * 0.1f;
+  return weights;
+}
+
+std::vector<float> makeInput()
+{
+  std::vector<float> input(kBatches * kInputSize);
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<float>(static_cast<int>(i * 5) % 13 - 6) * 0.2f;
+  return input;
+}
+
+// Reference result accumulated in the same order as 16x1 kernels
+std::vector<float> referenceFC(const std::vector<float> &weights, const std::vector<float> &input,
+                               const std::vector<float> &bias)
+{
+  std::vector<float> output(kBatches * kNumUnits);
+  for (int b = 0; b < kBatches; ++b)
+    for (int o = 0; o < kNumUnits; ++o)
+    {
+      float acc = bias[o];
+      for (int i = 0; i < kInputSize; ++i)
+        acc += weights[o * kInputSize + i] * input[b * kInputSize + i];
+      output[b * kNumUnits + o] = std::max(0.f, acc);
+    }
+  return output;
+}
+
+} // namespace
+
+TEST(CKer_Operation, FullyConnected16x1)
+{
+  const auto weights = makeWeights();
+  const auto input = makeInput();
+  std::vector<float> bias(kNumUnits);
+  for (int o = 0; o < kNumUnits; ++o)
+    bias[o] = 0.01f * o;
+  const auto expected = referenceFC(weights, input, bias);
+
+  // Shuffle weights so that 16 rows of each column in a 16x1 block are contiguous
+  std::vector<float> shuffled;
+  for (int block = 0; block < kNumUnits / 16; ++block)
+    for (int i = 0; i < kInputSize; ++i)
+      for (int k = 0; k < 16; ++k)
+        shuffled.push_back(weights[(block * 16 + k) * kInputSize + i]);
+
+  // Compress weights to non-zero 16x1 blocks
+  std::vector<uint16_t> segments{0};
+  std::vector<uint16_t> indices;
+  std::vector<float> sparse;
+  for (int block = 0; block < kNumUnits / 16; ++block)
+  {
+    for (int i = 0; i < kInputSize; ++i)
+    {
+      if ((block + i) % 2 != 0)
+        continue;
+      indices.push_back(i);
+      for (int k = 0; k < 16; ++k)
+        sparse.push_back(weights[(block * 16 + k) * kInputSize + i]);
+    }
+    segments.push_back(indices.size());
+  }
+
+  nnfw::cker::FullyConnectedParams params;
+  params.activation = nnfw::cker::FusedActivationFunctionType::kRelu;
+  const Shape input_shape{kBatches, kInputSize};
+  const Shape weights_shape{kNumUnits, kInputSize};
+  const Shape bias_shape{kNumUnits};
+  const Shape output_shape{kBatches, kNumUnits};
+
+  ruy::Context ruy_context;
+  for (int num_threads : {1, 4})
+  {
+    ruy_context.set_max_num_threads(num_threads);
+
+    std::vector<float> output(kBatches * kNumUnits);
+    nnfw::cker::FullyConnected16x1Float32(params, input_shape, input.data(), weights_shape,
+                                          shuffled.data(), bias_shape, bias.data(), output_shape,
+                                          output.data(), &ruy_context);
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-5f);
+
+    std::fill(output.begin(), output.end(), 0.f);
+    nnfw::cker::FullyConnectedSparseWeight16x1(
+      params, input_shape, input.data(), weights_shape, sparse.data(), bias_shape, bias.data(),
+      output_shape, output.data(), segments.data(), indices.data(), &ruy_context);
+    for (size_t i = 0; i < output.size(); ++i)
+      EXPECT_NEAR(output[i], expected[i], 1e-5f);
+  }
+}
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/AveragePool.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/FullyConnected.h>
+#include <cker/operation/Logistic.h>
+#include <cker/operation/MaxPool.h>
+#include <cker/operation/SoftMax.h>
+#include <cker/operation/Tanh.h>
+#include <cker/operation/reference/Conv.h>
+#include <cker/operation/reference/integer_ops/DepthwiseConvInt16.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+std::vector<int16_t> makeInt16s(int size, int32_t step)
+{
+  std::vector<int16_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<int16_t>(((i * 37) % 101 - 50) * step);
+  return data;
+}
+
+std::vector<int8_t> makeInt8s(int size)
+{
+  std::vector<int8_t> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<int8_t>((i * 29) % 255 - 127);
+  return data;
+}
+
+// Per-channel real multiplier 2^-(c + 12), whose Q0.31 form is 0.5 with shift
+void makePowerOfTwoMultipliers(int channels, std::vector<int32_t> &multipliers,
+                               std::vector<int32_t> &shifts)
+{
+  multipliers.assign(channels, 1 << 30);
+  shifts.resize(channels);
+  for (int c = 0; c < channels; ++c)
+    shifts[c] = -(c + 11);
+}
+
+// Reference value of acc requantized by the multiplier of channel c, clamped to int16
+double requantize(int64_t acc, int c)
+{
+  const double scaled = std::round(std::ldexp(static_cast<double>(acc), -(c + 12)));
+  return std::min(32767., std::max(-32768., scaled));
+}
+
+} // namespace
+
+TEST(CKer_Int16, LogisticTanh)
+{
+  // Input covers [-8.0, 8.0) and output is in Q0.15
+  const float input_scale = 8.f / 32768;
+  const float output_scale = 1.f / 32768;
+  std::vector<int16_t> input;
+  for (int32_t v = -32768; v < 32768; v += 97)
+    input.push_back(static_cast<int16_t>(v));
+  const nnfw::cker::Shape shape{static_cast<int>(input.size())};
+  std::vector<int16_t> output(input.size());
+  int16_t lut[513];
+
+  nnfw::cker::PopulateLogisticInt16LookupTable(input_scale, output_scale, lut);
+  nnfw::cker::Logistic(lut, shape, input.data(), shape, output.data());
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const float expected = 1.f / (1.f + std::exp(-input[i] * input_scale));
+    EXPECT_NEAR(output[i] * output_scale, expected, 1e-3f);
+  }
+
+  nnfw::cker::PopulateTanhInt16LookupTable(input_scale, output_scale, lut);
+  nnfw::cker::Tanh(lut, shape, input.data(), shape, output.data());
+  for (size_t i = 0; i < input.size(); ++i)
+  {
+    const float expected = std::tanh(input[i] * input_scale);
+    EXPECT_NEAR(output[i] * output_scale, expected, 2e-3f);
+  }
+}
+
+TEST(CKer_Int16, Softmax)
+{
+  const int depth = 13, outer_size = 3;
+  const float input_scale = 1.f / 4096;
+  const float beta = 1.f;
+  const auto input = makeInt16s(depth * outer_size, 311);
+  const nnfw::cker::Shape shape{outer_size, depth};
+  std::vector<int16_t> output(input.size());
+
+  int16_t exp_lut[513], one_over_one_plus_x_lut[513];
+  nnfw::cker::PopulateSoftmaxInt16LookupTables(exp_lut, one_over_one_plus_x_lut);
+  nnfw::cker::SoftmaxParams params;
+  params.exp_lut = exp_lut;
+  params.one_over_one_plus_x_lut = one_over_one_plus_x_lut;
+  // Multiplier in Q0.31 with left shift, same as QuantizeMultiplier of cpu backend
+  const double multiplier = input_scale * beta / (10.0 / 65535.0);
+  int shift = 0;
+  const double q = std::frexp(multiplier, &shift);
+  params.input_multiplier = static_cast<int32_t>(std::round(q * (1LL << 31)));
+  params.input_left_shift = shift;
+
+  nnfw::cker::Softmax(params, shape, input.data(), shape, output.data());
+  for (int b = 0; b < outer_size; ++b)
+  {
+    const int16_t *in = input.data() + b * depth;
+    const int16_t max = *std::max_element(in, in + depth);
+    float sum = 0.f;
+    for (int i = 0; i < depth; ++i)
+      sum += std::exp((in[i] - max) * input_scale * beta);
+    for (int i = 0; i < depth; ++i)
+    {
+      const float expected = std::exp((in[i] - max) * input_scale * beta) / sum;
+      EXPECT_NEAR(output[b * depth + i] / 32768.f, expected, 2e-3f);
+    }
+  }
+}
+
+TEST(CKer_Int16, FullyConnectedPerChannel)
+{
+  const int batches = 2, input_size = 19, num_units = 5;
+  const auto input = makeInt16s(batches * input_size, 523);
+  const auto weights = makeInt8s(num_units * input_size);
+  const std::vector<int64_t> bias{100000, -7, 0, 3, -123456};
+  std::vector<int32_t> multipliers, shifts;
+  makePowerOfTwoMultipliers(num_units, multipliers, shifts);
+
+  nnfw::cker::FullyConnectedParams params;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  std::vector<int16_t> output(batches * num_units);
+  nnfw::cker::FullyConnectedPerChannel(
+    params, multipliers.data(), shifts.data(), nnfw::cker::Shape{batches, input_size},
+    input.data(), nnfw::cker::Shape{num_units, input_size}, weights.data(),
+    nnfw::cker::Shape{num_units}, bias.data(), nnfw::cker::Shape{batches, num_units},
+    output.data());
+
+  for (int b = 0; b < batches; ++b)
+  {
+    for (int c = 0; c < num_units; ++c)
+    {
+      int64_t acc = bias[c];
+      for (int d = 0; d < input_size; ++d)
+        acc += static_cast<int64_t>(input[b * input_size + d]) * weights[c * input_size + d];
+      EXPECT_NEAR(output[b * num_units + c], requantize(acc, c), 1);
+    }
+  }
+}
+
+TEST(CKer_Int16, AddMul)
+{
+  using nnfw::cker::BinaryArithmeticOpType;
+
+  const int size = 29;
+  const auto input1 = makeInt16s(size, 301);
+  const auto input2 = makeInt16s(size, -173);
+  const nnfw::cker::Shape shape{size};
+  std::vector<int16_t> output(size);
+
+  // Same scale for all tensors; scales are normalized by twice the max input scale
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  params.output_offset = 0;
+  params.left_shift = 15;
+  params.input1_multiplier = params.input2_multiplier = 1 << 30;
+  params.input1_shift = params.input2_shift = 0;
+  // Input multipliers are 0.5 and output multiplier is 2 / 2^15
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -13;
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(params, shape, input1.data(), shape,
+                                                              input2.data(), shape, output.data());
+  for (int i = 0; i < size; ++i)
+  {
+    const int32_t expected = input1[i] + input2[i];
+    EXPECT_NEAR(output[i], std::min(32767, std::max(-32768, expected)), 1);
+  }
+
+  // Real multiplier 2^-10
+  params.output_multiplier = 1 << 30;
+  params.output_shift = -9;
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(params, shape, input1.data(), shape,
+                                                              input2.data(), shape, output.data());
+  for (int i = 0; i < size; ++i)
+  {
+    const double expected = std::round(input1[i] * input2[i] / 1024.);
+    EXPECT_NEAR(output[i], std::min(32767., std::max(-32768., expected)), 1);
+  }
+}
+
+TEST(CKer_Int16, ConvPerChannel)
+{
+  const int in_h = 5, in_w = 4, in_c = 3, out_c = 4, f_h = 3, f_w = 3;
+  const int out_h = 3, out_w = 2; // SAME padding with stride 2
+  const auto input = makeInt16s(in_h * in_w * in_c, 523);
+  const auto filter = makeInt8s(out_c * f_h * f_w * in_c);
+  const std::vector<int64_t> bias{100000, -7, 0, -123456};
+  std::vector<int32_t> multipliers, shifts;
+  makePowerOfTwoMultipliers(out_c, multipliers, shifts);
+
+  nnfw::cker::ConvParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.dilation_width_factor = 1;
+  params.dilation_height_factor = 1;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  std::vector<int16_t> output(out_h * out_w * out_c);
+  nnfw::cker::reference::Conv<int64_t>(
+    params, multipliers.data(), shifts.data(), nnfw::cker::Shape{1, in_h, in_w, in_c},
+    input.data(), nnfw::cker::Shape{out_c, f_h, f_w, in_c}, filter.data(),
+    nnfw::cker::Shape{out_c}, bias.data(), nnfw::cker::Shape{1, out_h, out_w, out_c},
+    output.data());
+
+  for (int oy = 0; oy < out_h; ++oy)
+  {
+    for (int ox = 0; ox < out_w; ++ox)
+    {
+      for (int oc = 0; oc < out_c; ++oc)
+      {
+        int64_t acc = bias[oc];
+        for (int fy = 0; fy < f_h; ++fy)
+        {
+          for (int fx = 0; fx < f_w; ++fx)
+          {
+            const int iy = oy * 2 - 1 + fy, ix = ox * 2 - 1 + fx;
+            if (iy < 0 || iy >= in_h || ix < 0 || ix >= in_w)
+              continue;
+            for (int ic = 0; ic < in_c; ++ic)
+              acc += static_cast<int64_t>(input[(iy * in_w + ix) * in_c + ic]) *
+                     filter[((oc * f_h + fy) * f_w + fx) * in_c + ic];
+          }
+        }
+        EXPECT_NEAR(output[(oy * out_w + ox) * out_c + oc], requantize(acc, oc), 1);
+      }
+    }
+  }
+}
+
+TEST(CKer_Int16, DepthwiseConvPerChannel)
+{
+  const int in_h = 4, in_w = 4, in_c = 2, multiplier = 2, f_h = 2, f_w = 2;
+  const int out_c = in_c * multiplier, out_h = 2, out_w = 2; // VALID padding with dilation 2
+  const auto input = makeInt16s(in_h * in_w * in_c, 523);
+  const auto filter = makeInt8s(f_h * f_w * out_c);
+  const std::vector<int32_t> bias{1000, -1000, 0, 77};
+  std::vector<int32_t> multipliers, shifts;
+  makePowerOfTwoMultipliers(out_c, multipliers, shifts);
+
+  nnfw::cker::DepthwiseConvParams params;
+  params.padding_values.width = 0;
+  params.padding_values.height = 0;
+  params.stride_width = 1;
+  params.stride_height = 1;
+  params.dilation_width_factor = 2;
+  params.dilation_height_factor = 2;
+  params.depth_multiplier = multiplier;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 32767;
+  std::vector<int16_t> output(out_h * out_w * out_c);
+  nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel<int32_t>(
+    params, multipliers.data(), shifts.data(), nnfw::cker::Shape{1, in_h, in_w, in_c},
+    input.data(), nnfw::cker::Shape{1, f_h, f_w, out_c}, filter.data(),
+    nnfw::cker::Shape{out_c}, bias.data(), nnfw::cker::Shape{1, out_h, out_w, out_c},
+    output.data());
+
+  for (int oy = 0; oy < out_h; ++oy)
+  {
+    for (int ox = 0; ox < out_w; ++ox)
+    {
+      for (int oc = 0; oc < out_c; ++oc)
+      {
+        int64_t acc = bias[oc];
+        for (int fy = 0; fy < f_h; ++fy)
+          for (int fx = 0; fx < f_w; ++fx)
+            acc += static_cast<int64_t>(input[((oy + fy * 2) * in_w + ox + fx * 2) * in_c +
+                                              oc / multiplier]) *
+                   filter[(fy * f_w + fx) * out_c + oc];
+        EXPECT_NEAR(output[(oy * out_w + ox) * out_c + oc], requantize(acc, oc), 1);
+      }
+    }
+  }
+}
+
+TEST(CKer_Int16, Pool)
+{
+  // 3x3 filter with stride 2 and padding 1 sees 2x2 of 3x3 input at every output
+  const nnfw::cker::Shape in_shape{1, 3, 3, 1};
+  const nnfw::cker::Shape out_shape{1, 2, 2, 1};
+  const std::vector<int16_t> input{1, 2, 3, 4, 5, 6, 7, 8, -30};
+  nnfw::cker::PoolParams params;
+  params.padding_values.width = 1;
+  params.padding_values.height = 1;
+  params.stride_width = 2;
+  params.stride_height = 2;
+  params.filter_width = 3;
+  params.filter_height = 3;
+  params.quantized_activation_min = -32768;
+  params.quantized_activation_max = 7;
+  std::vector<int16_t> output(4);
+
+  // Average of elements in input only, rounded half away from zero, e.g. -11 / 4 to -3
+  nnfw::cker::AveragePool<int16_t>(params, in_shape, input.data(), out_shape, output.data());
+  EXPECT_EQ(output, (std::vector<int16_t>{3, 4, 6, -3}));
+
+  // Maximum clamped to activation range
+  nnfw::cker::MaxPool<int16_t>(params, in_shape, input.data(), out_shape, output.data());
+  EXPECT_EQ(output, (std::vector<int16_t>{5, 6, 7, 7}));
+}
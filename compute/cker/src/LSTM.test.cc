@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/LSTM.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <vector>
+
+namespace
+{
+
+constexpr int kBatches = 2;
+constexpr int kSteps = 5;
+constexpr int kInput = 7;
+constexpr int kCell = 6;
+constexpr int kOutput = 6;
+
+std::vector<float> makeData(int size, int seed)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 7 + seed * 13) % 17 - 8) * 0.05f;
+  return data;
+}
+
+struct LstmWeights
+{
+  std::vector<float> input_to_gate[4];
+  std::vector<float> recurrent_to_gate[4];
+  std::vector<float> gate_bias[4];
+  std::vector<float> layer_norm[4];
+
+  LstmWeights()
+  {
+    for (int g = 0; g < 4; ++g)
+    {
+      input_to_gate[g] = makeData(kCell * kInput, g);
+      recurrent_to_gate[g] = makeData(kCell * kOutput, g + 4);
+      gate_bias[g] = makeData(kCell, g + 8);
+      layer_norm[g] = makeData(kCell, g + 12);
+    }
+  }
+
+  const float *ptr(const std::vector<float> *gates, int gate, bool use) const
+  {
+    return use ? gates[gate].data() : nullptr;
+  }
+};
+
+// Runs all time steps of a batch major sequence and returns outputs of every step
+std::vector<float> runLstm(const LstmWeights &w, const std::vector<float> &input, bool use_cifg,
+                           bool use_layer_norm, bool use_projection)
+{
+  nnfw::cker::LSTMParams params{};
+  params.activation = nnfw::cker::FusedActivationFunctionType::kTanh;
+
+  const int num_gates = use_cifg ? 3 : 4;
+  const int n_stacked = num_gates * kCell;
+  std::vector<float> input_projection;
+  if (use_projection)
+  {
+    std::vector<float> stacked_weights(n_stacked * kInput);
+    std::vector<float> stacked_bias(n_stacked);
+    const bool use_input = !use_cifg;
+    nnfw::cker::LstmStackGatesFloat(
+      {w.ptr(w.input_to_gate, 0, use_input), w.ptr(w.input_to_gate, 1, true),
+       w.ptr(w.input_to_gate, 2, true), w.ptr(w.input_to_gate, 3, true)},
+      kCell * kInput, stacked_weights.data());
+    nnfw::cker::LstmStackGatesFloat(
+      {w.ptr(w.gate_bias, 0, use_input), w.ptr(w.gate_bias, 1, true),
+       w.ptr(w.gate_bias, 2, true), w.ptr(w.gate_bias, 3, true)},
+      kCell, stacked_bias.data());
+
+    ruy::Context ruy_context;
+    input_projection.resize(kBatches * kSteps * n_stacked);
+    nnfw::cker::LstmInputProjectionFloat(
+      input.data(), kBatches * kSteps, kInput, stacked_weights.data(),
+      use_layer_norm ? nullptr : stacked_bias.data(), n_stacked, true, input_projection.data(),
+      &ruy_context);
+  }
+
+  std::vector<float> output(kBatches * kSteps * kOutput);
+  std::vector<float> output_state(kBatches * kOutput, 0.f);
+  std::vector<float> cell_state(kBatches * kCell, 0.f);
+  std::vector<float> scratch(4 * kBatches * kCell);
+  float *scratch_ptr = scratch.data();
+
+  const bool use_input = !use_cifg;
+  auto ln = [&](int g) { return w.ptr(w.layer_norm, g, use_layer_norm && (g != 0 || use_input)); };
+  // Batch major: each batch runs its time steps with n_batch == 1
+  for (int b = 0; b < kBatches; ++b)
+  {
+    for (int t = 0; t < kSteps; ++t)
+    {
+      const int row = b * kSteps + t;
+      nnfw::cker::LstmStepFloat(
+        input.data() + row * kInput, w.ptr(w.input_to_gate, 0, use_input),
+        w.input_to_gate[1].data(), w.input_to_gate[2].data(), w.input_to_gate[3].data(), nullptr,
+        nullptr, nullptr, nullptr, nullptr, w.ptr(w.recurrent_to_gate, 0, use_input),
+        w.recurrent_to_gate[1].data(), w.recurrent_to_gate[2].data(),
+        w.recurrent_to_gate[3].data(), nullptr, nullptr, nullptr, ln(0), ln(1), ln(2), ln(3),
+        w.ptr(w.gate_bias, 0, use_input), w.gate_bias[1].data(), w.gate_bias[2].data(),
+        w.gate_bias[3].data(), nullptr, nullptr, &params, 1, kCell, kInput, 0, kOutput, kOutput,
+        output_state.data() + b * kOutput, cell_state.data() + b * kCell, scratch_ptr,
+        scratch_ptr + kCell, scratch_ptr + 2 * kCell, scratch_ptr + 3 * kCell,
+        output.data() + row * kOutput,
+        use_projection ? input_projection.data() + row * n_stacked : nullptr);
+    }
+  }
+  return output;
+}
+
+void verifyInputProjection(bool use_cifg, bool use_layer_norm)
+{
+  const LstmWeights weights;
+  const auto input = makeData(kBatches * kSteps * kInput, 21);
+
+  const auto expected = runLstm(weights, input, use_cifg, use_layer_norm, false);
+  const auto output = runLstm(weights, input, use_cifg, use_layer_norm, true);
+  ASSERT_EQ(output.size(), expected.size());
+  for (size_t i = 0; i < output.size(); ++i)
+    EXPECT_NEAR(output[i], expected[i], 1e-5f) << "at " << i;
+}
+
+} // namespace
+
+TEST(CKer_LSTM, InputProjection)
+{
+  verifyInputProjection(false, false);
+  verifyInputProjection(true, false);
+  verifyInputProjection(false, true);
+  verifyInputProjection(true, true);
+}
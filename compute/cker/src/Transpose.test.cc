@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/Transpose.h>
+
+#include <gtest/gtest.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeParams;
+
+template <typename T>
+void verifyTranspose(const std::vector<int> &dims, const std::vector<int> &perm,
+                     ruy::Context *ruy_context = nullptr)
+{
+  const int rank = dims.size();
+  Shape input_shape(rank);
+  Shape output_shape(rank);
+  TransposeParams params;
+  params.perm_count = rank;
+  for (int i = 0; i < rank; ++i)
+  {
+    input_shape.SetDim(i, dims[i]);
+    output_shape.SetDim(i, dims[perm[i]]);
+    params.perm[i] = perm[i];
+  }
+
+  std::vector<T> input(input_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<T>(i * 7 + 3);
+  std::vector<T> expected(input.size());
+  std::vector<T> output(input.size());
+
+  nnfw::cker::reference::Transpose(params, input_shape, input.data(), output_shape,
+                                   expected.data());
+  nnfw::cker::Transpose(params, input_shape, input.data(), output_shape, output.data(),
+                        ruy_context);
+  EXPECT_EQ(output, expected);
+}
+
+// All permutations of shapes whose dims are not multiples of tile sizes
+template <typename T> void verifyAllPermutations(ruy::Context *ruy_context = nullptr)
+{
+  const std::vector<std::vector<int>> shapes{
+    {37, 70}, {3, 33, 67}, {2, 5, 1, 7}, {2, 9, 35, 6}, {1, 65, 3, 40}, {4, 1, 1, 1}};
+  for (const auto &dims : shapes)
+  {
+    std::vector<int> perm(dims.size());
+    std::iota(perm.begin(), perm.end(), 0);
+    do
+    {
+      verifyTranspose<T>(dims, perm, ruy_context);
+    } while (std::next_permutation(perm.begin(), perm.end()));
+  }
+}
+
+} // namespace
+
+TEST(CKer_Transpose, AllPermutations)
+{
+  verifyAllPermutations<int8_t>();
+  verifyAllPermutations<int16_t>();
+  verifyAllPermutations<float>();
+  verifyAllPermutations<int64_t>();
+}
+
+TEST(CKer_Transpose, MultiThreads)
+{
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+
+  verifyAllPermutations<uint8_t>(&ruy_context);
+  verifyAllPermutations<float>(&ruy_context);
+
+  // Large enough to be split over threads
+  verifyTranspose<float>({513, 257}, {1, 0}, &ruy_context);
+  verifyTranspose<float>({2, 12, 128, 64}, {0, 2, 1, 3}, &ruy_context);
+  verifyTranspose<float>({1, 56, 56, 96}, {0, 3, 1, 2}, &ruy_context);
+  verifyTranspose<uint8_t>({2, 96, 56, 56}, {0, 2, 3, 1}, &ruy_context);
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/operation/TransposeConv.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::TransposeConvParams;
+
+TransposeConvParams makeParams(int stride, int pad)
+{
+  TransposeConvParams params;
+  params.stride_width = stride;
+  params.stride_height = stride;
+  params.padding_values.width = pad;
+  params.padding_values.height = pad;
+  return params;
+}
+
+// Real values of quantized data are (q - zero_point) * scale
+template <typename T>
+std::vector<float> dequantize(const std::vector<T> &data, float scale, int32_t zero_point)
+{
+  std::vector<float> ret(data.size());
+  for (size_t i = 0; i < data.size(); ++i)
+    ret[i] = (static_cast<int32_t>(data[i]) - zero_point) * scale;
+  return ret;
+}
+
+template <typename T>
+void runQuantized(const TransposeConvParams &params, const std::vector<float> &filter_scales,
+                  float input_scale, float output_scale, const Shape &input_shape,
+                  const std::vector<T> &input, const Shape &filter_shape,
+                  const std::vector<T> &filter, const Shape &output_shape, std::vector<T> &output)
+{
+  const int output_depth = filter_shape.Dims(0);
+  std::vector<int32_t> multipliers(output_depth);
+  std::vector<int> shifts(output_depth);
+  for (int c = 0; c < output_depth; ++c)
+  {
+    const double scale = input_scale * filter_scales[c] / output_scale;
+    int exponent = 0;
+    const double q = std::frexp(scale, &exponent);
+    multipliers[c] = static_cast<int32_t>(std::round(q * (1ll << 31)));
+    shifts[c] = exponent;
+  }
+
+  std::vector<T> hwoi_filter(filter.size());
+  nnfw::cker::optimized::TransposeConvFilterToHWOI(filter_shape, filter.data(),
+                                                   hwoi_filter.data());
+  std::vector<int32_t> col2im(
+    nnfw::cker::optimized::TransposeConvCol2imSize(input_shape, filter_shape));
+  std::vector<int32_t> scratch(output_shape.FlatSize() / output_shape.Dims(0));
+
+  ruy::Context ruy_context;
+  output.resize(output_shape.FlatSize());
+  nnfw::cker::optimized::TransposeConv(params, multipliers.data(), shifts.data(), input_shape,
+                                       input.data(), filter_shape, hwoi_filter.data(),
+                                       output_shape, output.data(), col2im.data(), scratch.data(),
+                                       true, &ruy_context);
+}
+
+} // namespace
+
+TEST(CKer_Operation, TransposeConvFloat)
+{
+  // Compare with reference implementation
+  for (int stride : {1, 2, 3})
+  {
+    for (int pad : {0, 1})
+    {
+      const int in_h = 4, in_w = 5, in_c = 3, out_c = 2, k = 3;
+      const int out_h = (in_h - 1) * stride + k - 2 * pad;
+      const int out_w = (in_w - 1) * stride + k - 2 * pad;
+      Shape input_shape{2, in_h, in_w, in_c};
+      Shape filter_shape{out_c, k, k, in_c};
+      Shape output_shape{2, out_h, out_w, out_c};
+
+      std::vector<float> input(input_shape.FlatSize());
+      std::vector<float> filter(filter_shape.FlatSize());
+      for (size_t i = 0; i < input.size(); ++i)
+        input[i] = static_cast<float>(i % 7) - 3.f;
+      for (size_t i = 0; i < filter.size(); ++i)
+        filter[i] = static_cast<float>(i % 5) * 0.5f - 1.f;
+
+      const auto params = makeParams(stride, pad);
+      std::vector<float> expected(output_shape.FlatSize());
+      nnfw::cker::TransposeConv(params, input_shape, input.data(), filter_shape, filter.data(),
+                                output_shape, expected.data());
+
+      std::vector<float> hwoi_filter(filter.size());
+      nnfw::cker::optimized::TransposeConvFilterToHWOI(filter_shape, filter.data(),
+                                                       hwoi_filter.data());
+      std::vector<float> col2im(
+        nnfw::cker::optimized::TransposeConvCol2imSize(input_shape, filter_shape));
+      std::vector<float> output(output_shape.FlatSize(), 100.f);
+      ruy::Context ruy_context;
+      nnfw::cker::optimized::TransposeConv(params, input_shape, input.data(), filter_shape,
+                                           hwoi_filter.data(), output_shape, output.data(),
+                                           col2im.data(), true, &ruy_context);
+
+      for (size_t i = 0; i < output.size(); ++i)
+        EXPECT_NEAR(output[i], expected[i], 1e-4f);
+    }
+  }
+}
+
+TEST(CKer_Operation, TransposeConvUint8)
+{
+  Shape input_shape{1, 3, 3, 2};
+  Shape filter_shape{2, 3, 3, 2};
+  Shape output_shape{1, 7, 7, 2};
+  const float input_scale = 0.5f, filter_scale = 0.25f, output_scale = 1.f;
+  const int32_t input_zp = 128, filter_zp = 120, output_zp = 100;
+
+  std::vector<uint8_t> input(input_shape.FlatSize());
+  std::vector<uint8_t> filter(filter_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = 120 + i % 17;
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = 115 + i % 11;
+
+  auto params = makeParams(2, 0);
+  params.input_offset = -input_zp;
+  params.weights_offset = -filter_zp;
+  params.output_offset = output_zp;
+  params.quantized_activation_min = 0;
+  params.quantized_activation_max = 255;
+
+  std::vector<uint8_t> output;
+  runQuantized(params, {filter_scale, filter_scale}, input_scale, output_scale, input_shape,
+               input, filter_shape, filter, output_shape, output);
+
+  const auto real_input = dequantize(input, input_scale, input_zp);
+  const auto real_filter = dequantize(filter, filter_scale, filter_zp);
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::TransposeConv(params, input_shape, real_input.data(), filter_shape,
+                            real_filter.data(), output_shape, expected.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    const float value = std::min(255.f, std::max(0.f, expected[i] / output_scale + output_zp));
+    EXPECT_NEAR(output[i], value, 1.f);
+  }
+}
+
+TEST(CKer_Operation, TransposeConvInt8PerChannel)
+{
+  Shape input_shape{1, 4, 4, 3};
+  Shape filter_shape{2, 2, 2, 3};
+  Shape output_shape{1, 6, 6, 2};
+  const float input_scale = 0.5f, output_scale = 2.f;
+  const std::vector<float> filter_scales{0.25f, 0.125f};
+  const int32_t input_zp = -3, output_zp = 5;
+
+  std::vector<int8_t> input(input_shape.FlatSize());
+  std::vector<int8_t> filter(filter_shape.FlatSize());
+  for (size_t i = 0; i < input.size(); ++i)
+    input[i] = static_cast<int8_t>(static_cast<int>(i % 19) - 9);
+  for (size_t i = 0; i < filter.size(); ++i)
+    filter[i] = static_cast<int8_t>(static_cast<int>(i % 13) - 6);
+
+  auto params = makeParams(2, 1);
+  params.input_offset = -input_zp;
+  params.weights_offset = 0;
+  params.output_offset = output_zp;
+  params.quantized_activation_min = -128;
+  params.quantized_activation_max = 127;
+
+  std::vector<int8_t> output;
+  runQuantized(params, filter_scales, input_scale, output_scale, input_shape, input, filter_shape,
+               filter, output_shape, output);
+
+  const auto real_input = dequantize(input, input_scale, input_zp);
+  std::vector<float> real_filter(filter.size());
+  const int filter_size = filter_shape.FlatSize() / filter_shape.Dims(0);
+  for (size_t i = 0; i < filter.size(); ++i)
+    real_filter[i] = filter[i] * filter_scales[i / filter_size];
+  std::vector<float> expected(output_shape.FlatSize());
+  nnfw::cker::TransposeConv(params, input_shape, real_input.data(), filter_shape,
+                            real_filter.data(), output_shape, expected.data());
+
+  for (size_t i = 0; i < output.size(); ++i)
+  {
+    const float value = std::min(127.f, std::max(-128.f, expected[i] / output_scale + output_zp));
+    EXPECT_NEAR(output[i], value, 1.f);
+  }
+}
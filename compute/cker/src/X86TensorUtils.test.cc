@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cker/TensorUtils.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/Dequantize.h>
+#include <cker/operation/Quantize.h>
+#include <cker/operation/Reduce.h>
+#include <cker/operation/SoftMax.h>
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+
+#ifdef USE_X86_SIMD
+
+namespace
+{
+
+using nnfw::cker::Shape;
+using nnfw::cker::x86::SimdLevel;
+
+// Run test body on every SIMD level supported by CPU, and restore detected level at last
+class CKer_X86 : public ::testing::TestWithParam<SimdLevel>
+{
+protected:
+  void SetUp() override
+  {
+    _orig_level = nnfw::cker::x86::GetSimdLevel();
+    nnfw::cker::x86::SetSimdLevel(GetParam());
+    if (nnfw::cker::x86::GetSimdLevel() != GetParam())
+      GTEST_SKIP() << "SIMD level is not supported by CPU";
+  }
+  void TearDown() override { nnfw::cker::x86::SetSimdLevel(_orig_level); }
+
+  SimdLevel _orig_level = SimdLevel::kNone;
+};
+
+std::vector<float> makeFloats(int size, float scale)
+{
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i)
+    data[i] = static_cast<float>((i * 37) % 101 - 50) * scale;
+  return data;
+}
+
+} // namespace
+
+TEST_P(CKer_X86, MatrixBatchVectorMultiplyAccumulateFloat)
+{
+  // Sizes are not multiples of vector width to cover remainders
+  for (int m_cols : {5, 16, 45})
+  {
+    const int m_rows = 7, n_batch = 3;
+    const auto matrix = makeFloats(m_rows * m_cols, 0.01f);
+    const auto vector = makeFloats(n_batch * m_cols, 0.02f);
+    std::vector<float> expected(m_rows * n_batch, 1.f);
+    std::vector<float> result(m_rows * n_batch, 1.f);
+
+    nnfw::cker::PortableMatrixBatchVectorMultiplyAccumulate(
+      matrix.data(), m_rows, m_cols, vector.data(), n_batch, expected.data(), 1);
+    nnfw::cker::MatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vector.data(),
+                                                    n_batch, result.data(), 1);
+    for (size_t i = 0; i < result.size(); ++i)
+      EXPECT_NEAR(result[i], expected[i], 1e-4f);
+  }
+}
+
+TEST_P(CKer_X86, MatrixBatchVectorMultiplyAccumulateInt8)
+{
+  for (int m_cols : {7, 32, 77})
+  {
+    const int m_rows = 5, n_batch = 2;
+    std::vector<int8_t> matrix(m_rows * m_cols);
+    std::vector<int8_t> vectors(n_batch * m_cols);
+    for (size_t i = 0; i < matrix.size(); ++i)
+      matrix[i] = static_cast<int8_t>((i * 13) % 255 - 127);
+    for (size_t i = 0; i < vectors.size(); ++i)
+      vectors[i] = static_cast<int8_t>((i * 29) % 255 - 127);
+    const std::vector<float> scaling_factors{0.5f, 0.25f};
+    std::vector<float> expected(m_rows * n_batch, 0.f);
+    std::vector<float> result(m_rows * n_batch, 0.f);
+
+    nnfw::cker::PortableMatrixBatchVectorMultiplyAccumulate(
+      matrix.data(), m_rows, m_cols, vectors.data(), scaling_factors.data(), n_batch,
+      expected.data(), 1);
+    nnfw::cker::MatrixBatchVectorMultiplyAccumulate(matrix.data(), m_rows, m_cols, vectors.data(),
+                                                    scaling_factors.data(), n_batch, result.data(),
+                                                    1);
+    for (size_t i = 0; i < result.size(); ++i)
+      EXPECT_FLOAT_EQ(result[i], expected[i]);
+  }
+}
+
+TEST_P(CKer_X86, VectorUtils)
+{
+  const int size = 35;
+  auto values = makeFloats(size, 0.1f);
+
+  std::vector<float> expected(size), result(size);
+  nnfw::cker::PortableSub1Vector(values.data(), size, expected.data());
+  nnfw::cker::Sub1Vector(values.data(), size, result.data());
+  EXPECT_EQ(result, expected);
+
+  EXPECT_FALSE(nnfw::cker::IsZeroVector(values.data(), size));
+  std::vector<float> zeros(size, 0.f);
+  EXPECT_TRUE(nnfw::cker::IsZeroVector(zeros.data(), size));
+  zeros[size - 1] = 1.f;
+  EXPECT_FALSE(nnfw::cker::IsZeroVector(zeros.data(), size));
+
+  expected = values;
+  nnfw::cker::PortableCwiseClipping(expected.data(), size, 2.5f);
+  nnfw::cker::CwiseClipping(values.data(), size, 2.5f);
+  EXPECT_EQ(values, expected);
+}
+
+TEST_P(CKer_X86, SymmetricQuantizeFloats)
+{
+  for (int size : {13, 40})
+  {
+    auto values = makeFloats(size, 0.3f);
+    values[3] = 0.5f * 15.f / 127.f; // rounding at half
+    std::vector<int8_t> expected(size), result(size);
+    float expected_min, expected_max, expected_scale, min, max, scale;
+
+    nnfw::cker::PortableSymmetricQuantizeFloats(values.data(), size, expected.data(),
+                                                &expected_min, &expected_max, &expected_scale);
+    nnfw::cker::SymmetricQuantizeFloats(values.data(), size, result.data(), &min, &max, &scale);
+    EXPECT_EQ(result, expected);
+    EXPECT_EQ(min, expected_min);
+    EXPECT_EQ(max, expected_max);
+    EXPECT_EQ(scale, expected_scale);
+  }
+}
+
+TEST_P(CKer_X86, BinaryArithmeticFloat)
+{
+  using nnfw::cker::BinaryArithmeticOpType;
+
+  const int size = 37;
+  const auto input1 = makeFloats(size, 0.1f);
+  auto input2 = makeFloats(size, 0.07f);
+  for (auto &value : input2)
+    value = value == 0.f ? 1.f : value;
+  const Shape shape{1, size};
+
+  nnfw::cker::BinaryArithmeticOpParam params;
+  params.float_activation_min = -1.f;
+  params.float_activation_max = 2.f;
+  auto clamp = [](float value) { return std::min(2.f, std::max(-1.f, value)); };
+
+  std::vector<float> result(size);
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(
+    params, shape, input1.data(), shape, input2.data(), shape, result.data());
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(result[i], clamp(input1[i] + input2[i]));
+
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::SUB>(
+    params, shape, input1.data(), shape, input2.data(), shape, result.data());
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(result[i], clamp(input1[i] - input2[i]));
+
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::MUL>(
+    params, shape, input1.data(), shape, input2.data(), shape, result.data());
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(result[i], clamp(input1[i] * input2[i]));
+
+  nnfw::cker::BinaryArithmeticOp<BinaryArithmeticOpType::DIV>(
+    params, shape, input1.data(), shape, input2.data(), shape, result.data());
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(result[i], clamp(input1[i] / input2[i]));
+
+  // Scalar broadcast with swapped arguments
+  using SwappedSub =
+    nnfw::cker::optimized::BinaryOpFuncSwapArgs<nnfw::cker::optimized::BinaryOpFuncSubFloat>;
+  nnfw::cker::optimized::BinaryOpScalarBroadcast<
+    SwappedSub, nnfw::cker::optimized::BinaryOpActivationFloatMinMax>(size, params, 0.75f,
+                                                                      input2.data(), result.data());
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(result[i], clamp(input2[i] - 0.75f));
+}
+
+TEST_P(CKer_X86, Softmax)
+{
+  const int input_size = 21, batch_size = 2;
+  const auto input = makeFloats(input_size * batch_size, 0.2f);
+  std::vector<float> output(input.size());
+  nnfw::cker::Softmax(input.data(), input_size, batch_size, 0.5f, output.data());
+
+  for (int b = 0; b < batch_size; ++b)
+  {
+    const float *in = input.data() + b * input_size;
+    const float max = *std::max_element(in, in + input_size);
+    float sum = 0.f;
+    for (int i = 0; i < input_size; ++i)
+      sum += std::exp((in[i] - max) * 0.5f);
+    for (int i = 0; i < input_size; ++i)
+      EXPECT_NEAR(output[b * input_size + i], std::exp((in[i] - max) * 0.5f) / sum, 1e-6f);
+  }
+}
+
+TEST_P(CKer_X86, QuantizeDequantize)
+{
+  const int size = 45;
+  auto input = makeFloats(size, 0.5f);
+  input[1] = 2.5f; // rounding at half
+  input[2] = -2.5f;
+  input[3] = 1000.f; // saturation
+  const Shape shape{size};
+  const float scale = 0.5f;
+
+  std::vector<int8_t> int8_output(size);
+  nnfw::cker::Quantize(shape, input.data(), shape, int8_output.data(), scale, 3);
+  std::vector<uint8_t> uint8_output(size);
+  nnfw::cker::Quantize(shape, input.data(), shape, uint8_output.data(), scale, 128);
+  std::vector<int16_t> int16_output(size);
+  nnfw::cker::Quantize(shape, input.data(), shape, int16_output.data(), scale, 0);
+  for (int i = 0; i < size; ++i)
+  {
+    const int32_t rounded = static_cast<int32_t>(std::round(input[i] / scale));
+    EXPECT_EQ(int8_output[i], std::min(127, std::max(-128, rounded + 3)));
+    EXPECT_EQ(uint8_output[i], std::min(255, std::max(0, rounded + 128)));
+    EXPECT_EQ(int16_output[i], rounded);
+  }
+
+  std::vector<float> output(size);
+  nnfw::cker::Dequantize(shape, int8_output.data(), shape, output.data(), scale, 3);
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(output[i], scale * (int8_output[i] - 3));
+  nnfw::cker::Dequantize(shape, uint8_output.data(), shape, output.data(), scale, 128);
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(output[i], scale * (uint8_output[i] - 128));
+  nnfw::cker::Dequantize(shape, int16_output.data(), shape, output.data(), scale, 0);
+  for (int i = 0; i < size; ++i)
+    EXPECT_EQ(output[i], scale * int16_output[i]);
+}
+
+TEST_P(CKer_X86, ReduceSum)
+{
+  for (int reduce_size : {3, 8, 70})
+  {
+    const int outer_size = 3;
+    const auto input = makeFloats(outer_size * reduce_size, 0.1f);
+    std::vector<float> output(outer_size);
+    nnfw::cker::OptimizedReduceSum(input.data(), Shape{outer_size, reduce_size}, output.data());
+    for (int o = 0; o < outer_size; ++o)
+    {
+      float expected = 0.f;
+      for (int r = 0; r < reduce_size; ++r)
+        expected += input[o * reduce_size + r];
+      EXPECT_NEAR(output[o], expected, 1e-4f);
+    }
+  }
+}
+
+INSTANTIATE_TEST_SUITE_P(SimdLevels, CKer_X86,
+                         ::testing::Values(SimdLevel::kNone, SimdLevel::kAvx2, SimdLevel::kAvx512));
+
+#endif // USE_X86_SIMD
@@ -225,3 +225,66 @@ TEST(CKer_Optimizer, neg_AdamUnmatchedEMAShape2)
       beta2, epsilon, use_nesterov));
   }
 }
+
+TEST(CKer_Optimizer, AdamMultiTensor)
+{
+  // Sizes across blocks and packets, and an empty tensor
+  const std::vector<int> sizes = {3000, 0, 5, 2049};
+  std::vector<std::vector<float>> vars, grads, ms, vs;
+  for (const auto size : sizes)
+  {
+    std::vector<float> var(size), grad(size);
+    for (int i = 0; i < size; ++i)
+    {
+      var[i] = static_cast<float>(i % 17) - 8.f;
+      grad[i] = static_cast<float>(i % 13) * 0.25f - 1.5f;
+    }
+    vars.emplace_back(var);
+    grads.emplace_back(grad);
+    ms.emplace_back(size, 0.f);
+    vs.emplace_back(size, 0.f);
+  }
+  auto expected_vars = vars, expected_ms = ms, expected_vs = vs;
+
+  std::vector<nnfw::cker::train::OptimizerBuffers> tensors;
+  for (size_t t = 0; t < sizes.size(); ++t)
+    tensors.push_back({vars[t].data(), grads[t].data(), ms[t].data(), vs[t].data(), sizes[t]});
+
+  const float lr = 0.001, beta1 = 0.9, beta2 = 0.999, epsilon = 1e-07;
+  for (uint32_t step = 0; step < 3; ++step)
+  {
+    const float beta1_power = std::pow(beta1, step + 1);
+    const float beta2_power = std::pow(beta2, step + 1);
+    for (size_t t = 0; t < sizes.size(); ++t)
+    {
+      const nnfw::cker::Shape shape{sizes[t]};
+      nnfw::cker::train::Adam(shape, expected_vars[t].data(), shape, grads[t].data(), shape,
+                              expected_ms[t].data(), shape, expected_vs[t].data(), beta1_power,
+                              beta2_power, lr, beta1, beta2, epsilon, false);
+    }
+    nnfw::cker::train::MultiTensorAdam(tensors, beta1_power, beta2_power, lr, beta1, beta2,
+                                       epsilon);
+
+    for (size_t t = 0; t < sizes.size(); ++t)
+    {
+      for (int i = 0; i < sizes[t]; ++i)
+      {
+        EXPECT_NEAR(vars[t][i], expected_vars[t][i], 1e-6f);
+        EXPECT_NEAR(ms[t][i], expected_ms[t][i], 1e-6f);
+        EXPECT_NEAR(vs[t][i], expected_vs[t][i], 1e-6f);
+      }
+    }
+  }
+}
+
+TEST(CKer_Optimizer, neg_AdamMultiTensorNoMoments)
+{
+  std::vector<float> var = {-1, 2, -3};
+  std::vector<float> grad = {-1, 2, -3};
+  std::vector<float> m = {0, 0, 0};
+  std::vector<nnfw::cker::train::OptimizerBuffers> tensors{
+    {var.data(), grad.data(), m.data(), nullptr, 3}};
+
+  EXPECT_ANY_THROW(
+    nnfw::cker::train::MultiTensorAdam(tensors, 0.9f, 0.999f, 0.001f, 0.9f, 0.999f, 1e-07f));
+}
@@ -17,8 +17,40 @@
 #include <cker/train/operation/FullyConnected.h>
 
 #include <gtest/gtest.h>
+#include <ruy/context.h>
 #include <vector>
 
+namespace
+{
+
+// Reference of dX = dY * W and dW = dY^T * X
+void referenceFullyConnectedGrad(int batches, int num_units, int input_size,
+                                 const std::vector<float> &incoming,
+                                 const std::vector<float> &weights,
+                                 const std::vector<float> &input, std::vector<float> &input_grad,
+                                 std::vector<float> &weights_grad)
+{
+  input_grad.assign(batches * input_size, 0.f);
+  weights_grad.assign(num_units * input_size, 0.f);
+  for (int b = 0; b < batches; ++b)
+    for (int o = 0; o < num_units; ++o)
+      for (int i = 0; i < input_size; ++i)
+      {
+        input_grad[b * input_size + i] += incoming[b * num_units + o] * weights[o * input_size + i];
+        weights_grad[o * input_size + i] += incoming[b * num_units + o] * input[b * input_size + i];
+      }
+}
+
+std::vector<float> sequence(int size, float scale)
+{
+  std::vector<float> v(size);
+  for (int i = 0; i < size; ++i)
+    v[i] = static_cast<float>(i % 7 - 3) * scale;
+  return v;
+}
+
+} // namespace
+
 TEST(CKer_Operation, FullyConnectedBiasGrad)
 {
   {
@@ -81,3 +113,53 @@ TEST(CKer_Operation, neg_FullyConnectedBiasGrad)
                        bias_backward.data()););
   }
 }
+
+TEST(CKer_Operation, FullyConnectedGrad)
+{
+  const int batches = 3, num_units = 5, input_size = 4;
+  const auto incoming = sequence(batches * num_units, 0.5f);
+  const auto weights = sequence(num_units * input_size, 0.25f);
+  const auto input = sequence(batches * input_size, 1.f);
+  std::vector<float> expected_input_grad, expected_weights_grad;
+  referenceFullyConnectedGrad(batches, num_units, input_size, incoming, weights, input,
+                              expected_input_grad, expected_weights_grad);
+
+  const nnfw::cker::Shape incoming_shape{batches, num_units};
+  const nnfw::cker::Shape weights_shape{num_units, input_size};
+  const nnfw::cker::Shape input_shape{batches, input_size};
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(2);
+  // Eigen on the calling thread and ruy on threads
+  for (auto context : {static_cast<ruy::Context *>(nullptr), &ruy_context})
+  {
+    std::vector<float> input_grad(batches * input_size);
+    std::vector<float> weights_grad(num_units * input_size);
+    nnfw::cker::train::FullyConnectedInputGrad(incoming_shape, incoming.data(), weights_shape,
+                                               weights.data(), input_shape, input_grad.data(),
+                                               context);
+    nnfw::cker::train::FullyConnectedWeightsGrad(incoming_shape, incoming.data(), input_shape,
+                                                 input.data(), weights_shape, weights_grad.data(),
+                                                 context);
+
+    for (size_t i = 0; i < input_grad.size(); ++i)
+      EXPECT_FLOAT_EQ(input_grad[i], expected_input_grad[i]);
+    for (size_t i = 0; i < weights_grad.size(); ++i)
+      EXPECT_FLOAT_EQ(weights_grad[i], expected_weights_grad[i]);
+  }
+}
+
+TEST(CKer_Operation, neg_FullyConnectedGrad)
+{
+  std::vector<float> incoming(6), weights(12), input(8), grad(12);
+
+  // Unmatched number of units
+  EXPECT_ANY_THROW(nnfw::cker::train::FullyConnectedInputGrad(
+    nnfw::cker::Shape{2, 3}, incoming.data(), nnfw::cker::Shape{4, 3}, weights.data(),
+    nnfw::cker::Shape{2, 3}, grad.data()));
+
+  // Unmatched input size
+  EXPECT_ANY_THROW(nnfw::cker::train::FullyConnectedWeightsGrad(
+    nnfw::cker::Shape{2, 3}, incoming.data(), nnfw::cker::Shape{2, 4}, input.data(),
+    nnfw::cker::Shape{3, 3}, grad.data()));
+}
@@ -101,3 +101,40 @@ TEST(CKer_Optimizer, neg_SGDUnmatchedGradientShape)
       nnfw::cker::Shape{static_cast<int>(gradient.size())}, gradient.data(), lr));
   }
 }
+
+TEST(CKer_Optimizer, SGDMultiTensor)
+{
+  // Sizes across blocks and packets, and an empty tensor
+  const std::vector<int> sizes = {3000, 0, 5, 2049};
+  std::vector<std::vector<float>> vars, grads;
+  for (const auto size : sizes)
+  {
+    std::vector<float> var(size), grad(size);
+    for (int i = 0; i < size; ++i)
+    {
+      var[i] = static_cast<float>(i % 17) - 8.f;
+      grad[i] = static_cast<float>(i % 13) * 0.25f - 1.5f;
+    }
+    vars.emplace_back(var);
+    grads.emplace_back(grad);
+  }
+  auto expected_vars = vars;
+
+  std::vector<nnfw::cker::train::OptimizerBuffers> tensors;
+  for (size_t t = 0; t < sizes.size(); ++t)
+    tensors.push_back({vars[t].data(), grads[t].data(), nullptr, nullptr, sizes[t]});
+
+  const float lr = 0.001;
+  for (size_t t = 0; t < sizes.size(); ++t)
+  {
+    const nnfw::cker::Shape shape{sizes[t]};
+    nnfw::cker::train::GradientDescent(shape, expected_vars[t].data(), shape, grads[t].data(), lr);
+  }
+  nnfw::cker::train::MultiTensorGradientDescent(tensors, lr);
+
+  for (size_t t = 0; t < sizes.size(); ++t)
+  {
+    for (int i = 0; i < sizes[t]; ++i)
+      EXPECT_FLOAT_EQ(vars[t][i], expected_vars[t][i]);
+  }
+}
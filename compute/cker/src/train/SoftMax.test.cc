@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cmath>
 #include <gtest/gtest.h>
+#include <ruy/context.h>
 #include <vector>
 
 // TODO Add tests that verifies result values
@@ -76,6 +77,51 @@ TEST(CKer_Operation, SoftMaxGrad)
   }
 }
 
+TEST(CKer_Operation, SoftMaxGradThreads)
+{
+  // Large enough to be split over threads
+  const int batches = 8, width = 2048;
+  nnfw::cker::Shape shape{batches, width};
+  std::vector<float> softmax(batches * width);
+  std::vector<float> incoming(batches * width);
+  for (int b = 0; b < batches; ++b)
+  {
+    float sum = 0.f;
+    for (int w = 0; w < width; ++w)
+    {
+      softmax[b * width + w] = std::exp(static_cast<float>((b + w) % 13) / 13.f);
+      sum += softmax[b * width + w];
+      incoming[b * width + w] = static_cast<float>((b * w) % 5) - 2.f;
+    }
+    std::for_each(softmax.begin() + b * width, softmax.begin() + (b + 1) * width,
+                  [sum](float &v) { v /= sum; });
+  }
+
+  // Product with full jacobian
+  std::vector<float> expected(batches * width);
+  for (int b = 0; b < batches; ++b)
+    for (int i = 0; i < width; ++i)
+    {
+      double sum = 0.;
+      for (int j = 0; j < width; ++j)
+      {
+        const double y_i = softmax[b * width + i];
+        const double y_j = softmax[b * width + j];
+        sum += y_i * ((i == j ? 1. : 0.) - y_j) * incoming[b * width + j];
+      }
+      expected[b * width + i] = static_cast<float>(sum);
+    }
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(4);
+  std::vector<float> grad(batches * width);
+  nnfw::cker::train::SoftMaxGrad(shape, softmax.data(), shape, incoming.data(), shape, grad.data(),
+                                 &ruy_context);
+
+  for (size_t i = 0; i < grad.size(); ++i)
+    EXPECT_NEAR(grad[i], expected[i], 1e-6);
+}
+
 TEST(CKer_Operation, neg_SoftMaxGrad)
 {
   // Invalid expected value
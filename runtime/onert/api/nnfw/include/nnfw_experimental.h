@@ -117,25 +117,238 @@ NNFW_STATUS nnfw_output_tensorindex(nnfw_session *session, const char *tensornam
 NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *backend_settings);
 
 /**
- * @brief Prepare session to be ready for inference
+ * @brief Create an execution context sharing the loaded model of the session
+ *
+ * This function creates a new session object with a copy of the model loaded on \p session.
+ * Each execution context is prepared and run as a normal session, and owns its own graphs,
+ * executors, activation memory and input/output bindings. Constant data of the model (e.g.
+ * weights) are shared instead of copied, so K execution contexts can run the same model in K
+ * threads concurrently without loading the model K times.
+ *
+ * @note This function should be called after model loading and before {@link nnfw_prepare}
+ *       on \p session. Compiler options (e.g. backends) set on \p session are copied to the
+ *       execution context.
+ *       Model level changes on \p session before this function (e.g.
+ *       {@link nnfw_set_input_tensorinfo}) are copied as well, and later ones are applied only to
+ *       the session they are made on.
+ *       The execution context should be closed by {@link nnfw_close_session}.
+ *
+ * @param[in]  session  The session which model is loaded on
+ * @param[out] context  The execution context created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session, nnfw_session **context);
+
+/**
+ *  Request batching APIs
+ *
+ * Request batching APIs merge concurrent single-sample requests into one batched run of a
+ * prepared session. They are designed to be used in the following order
+ * 1. nnfw_batcher_create
+ * 2. nnfw_batcher_run from many threads
+ * 3. nnfw_batcher_get_stats to tune batching configuration (optional)
+ * 4. nnfw_batcher_destroy
+ */
+
+/**
+ * @brief Maximum batch size of request batching
+ */
+#define NNFW_BATCHER_MAX_BATCH_SIZE (64)
+
+/**
+ * @brief Opaque request batcher object
+ */
+typedef struct nnfw_batcher nnfw_batcher;
+
+/**
+ * @brief Request batching configuration
+ */
+typedef struct nnfw_batcher_config
+{
+  /** Maximum number of requests merged into one run [1, NNFW_BATCHER_MAX_BATCH_SIZE] */
+  uint32_t max_batch_size;
+  /** Maximum time (in microseconds) the first request of a batch waits for others */
+  uint32_t max_wait_us;
+} nnfw_batcher_config;
+
+/**
+ * @brief Request batching statistics
+ */
+typedef struct nnfw_batcher_stats
+{
+  /** Number of requests waiting in queue now */
+  uint32_t queue_depth;
+  /** Maximum number of requests waited in queue */
+  uint32_t max_queue_depth;
+  /** Number of finished requests */
+  uint64_t num_requests;
+  /** Number of batched runs */
+  uint64_t num_batches;
+  /** Number of batched runs per batch size: batch_size_histogram[n - 1] is for batch size n */
+  uint64_t batch_size_histogram[NNFW_BATCHER_MAX_BATCH_SIZE];
+} nnfw_batcher_stats;
+
+/**
+ * @brief Create a request batcher on the prepared session
+ *
+ * Every input and output of the model should have batch size 1 on the first dimension.
+ * The batcher changes the batch dimension of inputs by {@link nnfw_set_input_tensorinfo}
+ * and runs the session once for the merged requests.
+ *
+ * @note The session should not be used directly until the batcher is destroyed.
+ *
+ * @param[in]  session  The session prepared by {@link nnfw_prepare}
+ * @param[in]  config   Batching configuration
+ * @param[out] batcher  The batcher created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_batcher_create(nnfw_session *session, const nnfw_batcher_config *config,
+                                nnfw_batcher **batcher);
+
+/**
+ * @brief Run a single-sample request through the batcher
+ *
+ * This function is thread-safe. It blocks until the batch including this request is finished.
+ *
+ * @param[in]  batcher  The batcher
+ * @param[in]  inputs   Input buffers of one sample, one buffer for each model input
+ * @param[out] outputs  Output buffers of one sample, one buffer for each model output
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_batcher_run(nnfw_batcher *batcher, const void **inputs, void **outputs);
+
+/**
+ * @brief Get request batching statistics
+ *
+ * @param[in]  batcher  The batcher
+ * @param[out] stats    Statistics collected since the batcher is created
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_batcher_get_stats(nnfw_batcher *batcher, nnfw_batcher_stats *stats);
+
+/**
+ * @brief Destroy the request batcher
  *
- * This phase may finalize model compilation, scheduling, and additional settings.
+ * @note All the requests should be finished before calling this function.
  *
- * @deprecated Deprecated since 1.22.1
+ * @param[in] batcher The batcher to be destroyed
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_batcher_destroy(nnfw_batcher *batcher);
+
+/**
+ * @brief Statistics of shape plan cache
  *
- * @param session the session to be prepared
+ * Shapes and memory plan of tensors inferred by an execution with dynamic input shapes are cached
+ * per input shapes if it is enabled by {@link NNFW_PREPARE_CONFIG_SHAPE_PLAN_CACHE_SIZE}.
+ * Execution with cached input shapes skips dynamic shape inference and memory allocation.
+ */
+typedef struct nnfw_shape_plan_cache_stats
+{
+  /** Number of cached input shapes */
+  uint32_t num_buckets;
+  /** Number of executions with dynamic input shapes served by cache */
+  uint64_t num_hits;
+  /** Number of executions with dynamic input shapes not served by cache */
+  uint64_t num_misses;
+} nnfw_shape_plan_cache_stats;
+
+/**
+ * @brief Get statistics of shape plan cache
+ *
+ * This can be used to check whether expected input shapes are pre-warmed by running them once
+ * after {@link nnfw_prepare}.
+ *
+ * @param[in]  session  The session prepared by {@link nnfw_prepare}
+ * @param[out] stats    Statistics collected since the session is prepared
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_shape_plan_cache_stats(nnfw_session *session,
+                                            nnfw_shape_plan_cache_stats *stats);
+
+/**
+ * @brief Usage of process-wide compute thread budget
+ *
+ * Each session is granted compute threads from the budget on prepare, and backends (cpu, ruy,
+ * xnnpack, train) size their thread pools by the granted number. Granted threads are returned
+ * when the session is closed.
+ */
+typedef struct nnfw_compute_thread_stats
+{
+  /** Maximum number of compute threads of all sessions, 0 for no limit */
+  uint32_t limit;
+  /** Number of compute threads granted to living sessions */
+  uint32_t used;
+} nnfw_compute_thread_stats;
+
+/**
+ * @brief Set maximum number of compute threads of all sessions in this process
+ *
+ * It is applied to sessions prepared after this call. If the limit is set, a session is granted
+ * threads as many as remaining in the budget, and at least 1 thread (the thread calling
+ * {@link nnfw_run}) even if the budget is exhausted.
+ * Default value can be set by environment variable COMPUTE_THREAD_LIMIT.
+ *
+ * @param[in] max_threads Maximum number of compute threads, 0 for no limit
+ * @return    @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_set_compute_thread_limit(uint32_t max_threads);
+
+/**
+ * @brief Get usage of process-wide compute thread budget
+ *
+ * @param[out] stats Usage of compute thread budget
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_compute_thread_stats(nnfw_compute_thread_stats *stats);
+
+/**
+ * @brief Get number of compute threads granted to the session
+ *
+ * Requested number is set by {@link NNFW_PREPARE_CONFIG_NUM_THREADS}, and it can be reduced by
+ * the limit set by {@link nnfw_set_compute_thread_limit}.
+ *
+ * @param[in]  session     The session prepared by {@link nnfw_prepare}
+ * @param[out] num_threads Number of granted threads, 0 if each backend uses its default
+ * @return     @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_get_compute_threads(nnfw_session *session, uint32_t *num_threads);
+
+/**
+ * @brief Reset variable tensors kept across runs to start a new sequence
+ *
+ * Variable tensors are kept across {@link nnfw_run} calls if the session is prepared with
+ * {@link NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES}, or KEEP_VARIABLE_STATES in environment.
+ * After this call, they are initialized to zero on next run, and kv caches of attention are
+ * emptied.
+ *
+ * @param[in] session The session prepared by {@link nnfw_prepare}
+ * @return    @c NNFW_STATUS_NO_ERROR if successful,
+ *            @c NNFW_STATUS_ERROR if variable tensors are not kept across runs
+ */
+NNFW_STATUS nnfw_reset_variable_states(nnfw_session *session);
+
+/**
+ * @brief Prepare session for pipelined inference
+ *
+ * Each model of the loaded nnpackage (e.g. partitioned by circle-partitioner) is compiled as a
+ * pipeline stage running on its own thread. Stages are connected by bounded queues, so a stage
+ * can run the next request while later stages run the previous ones.
+ * Edges between models should go from a model to a later model only.
+ *
+ * @param session       the session to be prepared
+ * @param map_file_path Not supported, it should be nullptr
  * @return NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path = nullptr);
 
 /**
- * @brief     Set input buffer
- *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p inputs given to this
- * function can be reused for many inferences. \p lengths must be greater or equal than the operand
- * requires. if you give empty \p inputs to this function, then this function will join all threads.
+ * @brief     Push inputs of a request to the pipeline
  *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}. \p inputs are copied, so they
+ * can be reused for the next request after this function returns. This function blocks while the
+ * first stage has enough requests to run. If you give empty \p inputs to this function, the
+ * pipeline is closed: pushed requests are still processed and can be popped.
  *
  * @param[in] session Session to the input is to be set
  * @param[in] inputs  Raw buffers for input, it must be \p std::vector<void *> type pointer for
@@ -148,12 +361,11 @@ NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_pa
 NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths);
 
 /**
- * @brief       Get last outputs of partitioned model in session
- *
- * This function must be called after {@link nnfw_prepare_pipeline}, \p outputs given to this
- * function must be cleared for memory management.
+ * @brief       Get outputs of the oldest finished request in the pipeline
  *
- * @deprecated Deprecated since 1.22.1
+ * This function must be called after {@link nnfw_prepare_pipeline}, and blocks until a request is
+ * finished. Output buffers are allocated by this function, and they must be released by \p free.
+ * It returns @c NNFW_STATUS_ERROR if the pipeline is closed and there is no request to pop.
  *
  * @param[in]   session Session from last outputs is to be extracted
  * @param[out]  outputs Raw buffer for outputs, it must be \p std::vector<void *> type pointer for
@@ -230,6 +442,10 @@ typedef enum
  * @brief Training information to prepare training
  * @todo  Add more training information
  *        (e.g. optimizer, loss function, ...)
+ * @note  Fields from recompute_segment_size are appended to this struct, which changes its size
+ *        and layout. Applications built with an older header should be rebuilt.
+ *        Zero for these fields means their defaults, so a struct zero-initialized by memset
+ *        has no recomputation and no accumulation.
  */
 typedef struct nnfw_train_info
 {
@@ -249,6 +465,34 @@ typedef struct nnfw_train_info
    *  The special values are collected in NNFW_TRAIN_NUM_OF_TRAINABLE_OPS_SPECIAL_VALUES enum.
    */
   int32_t num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_NONE;
+
+  /** Number of consecutive operations in a segment of activation recomputation.
+   *  Activations used only in a segment are released after forwarding and the segment is
+   *  forwarded again during backwarding, which trades compute for peak memory.
+   *  "0" means that the segment size is chosen by activation_memory_budget.
+   */
+  uint32_t recompute_segment_size = 0;
+
+  /** Bytes of activations to be kept for backwarding. If activations do not fit in it,
+   *  the smallest recompute segment size that fits is chosen.
+   *  "0" means no limit, i.e. nothing is recomputed unless recompute_segment_size is set.
+   */
+  uint64_t activation_memory_budget = 0;
+
+  /** Number of micro-batches whose gradients are accumulated before a weight update.
+   *  Each {@link nnfw_train} with update_weights true runs forward and backward of a
+   *  micro-batch, and weights are updated with the mean gradient once every this number of
+   *  calls. It gives the update of a large batch at the peak memory of batch_size.
+   *  "1" means that weights are updated on every call, and "0" is the same as "1".
+   */
+  uint32_t gradient_accumulation_steps = 1;
+
+  /** Whether weights of all layers are updated at once after backwarding.
+   *  The optimizer updates all trainable tensors in one pass instead of per layer, which saves
+   *  the cost of many small updates. Gradients of all layers are kept until the update, so it
+   *  costs memory of the size of the trainable tensors.
+   */
+  bool multi_tensor_update = false;
 } nnfw_train_info;
 
 /**
@@ -349,6 +593,8 @@ NNFW_STATUS nnfw_train_set_output(nnfw_session *session, uint32_t index, NNFW_TY
  * @param[in] session The session to be trained
  * @param[in] update_weights If true, update weights of the model
  *                           If false, do not update weights of the model (for validation)
+ *                           With gradient_accumulation_steps of {@link nnfw_train_info},
+ *                           weights are updated once every that number of calls
  * @return  @c NNFW_STATUS_NO_ERROR if successful
  */
 NNFW_STATUS nnfw_train(nnfw_session *session, bool update_weights);
@@ -364,6 +610,36 @@ NNFW_STATUS nnfw_train(nnfw_session *session, bool update_weights);
  */
 NNFW_STATUS nnfw_train_get_loss(nnfw_session *session, uint32_t index, float *loss);
 
+/**
+ * @brief Time spent in each phase of {@link nnfw_train} with update_weights true
+ *
+ * Weights of an operation are updated right after its backward, so update time is measured per
+ * operation and excluded from backward time.
+ */
+typedef struct nnfw_train_phase_stats
+{
+  /** Number of training steps */
+  uint64_t num_steps;
+  /** Accumulated time of forward in microseconds */
+  uint64_t forward_us;
+  /** Accumulated time of backward in microseconds, including recomputation of activations */
+  uint64_t backward_us;
+  /** Accumulated time of weight update in microseconds */
+  uint64_t update_us;
+} nnfw_train_phase_stats;
+
+/**
+ * @brief Get time spent in each phase of training steps
+ * @note  This function should be called after {@link nnfw_train_prepare}
+ *
+ * Time of some steps can be taken as the difference of two calls.
+ *
+ * @param[in]   session The session prepared for training
+ * @param[out]  stats   Statistics accumulated since the session is prepared
+ * @return  @c NNFW_STATUS_NO_ERROR if successful
+ */
+NNFW_STATUS nnfw_train_get_phase_stats(nnfw_session *session, nnfw_train_phase_stats *stats);
+
 /**
  * @brief Export circle model
  * @note  This function should be called on training mode
@@ -566,6 +842,26 @@ typedef enum
    * TODO: Use workspace
    */
   NNFW_PREPARE_CONFIG_PROFILE,
+  /**
+   * Maximum number of dynamic input shapes whose inferred shapes and memory plan are cached
+   * (value: non-negative integer string, "0" to disable)
+   */
+  NNFW_PREPARE_CONFIG_SHAPE_PLAN_CACHE_SIZE,
+  /**
+   * Number of compute threads requested for thread pool of each backend
+   * (value: non-negative integer string, "0" for backend default)
+   */
+  NNFW_PREPARE_CONFIG_NUM_THREADS,
+  /**
+   * Cores to run compute threads on (value: comma separated core ids e.g. "0,2,3",
+   * "" for no restriction)
+   */
+  NNFW_PREPARE_CONFIG_CPU_AFFINITY,
+  /**
+   * Keep variable tensors (e.g. cell and hidden states of LSTM, kv cache of attention) across
+   * {@link nnfw_run} calls to feed a long sequence in chunks (not require value setting)
+   */
+  NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES,
 } NNFW_PREPARE_CONFIG;
 
 /**
@@ -0,0 +1,295 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RequestBatcher.h"
+#include "nnfw_api_internal.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+
+namespace
+{
+
+// Size of one sample: batch (first) dimension is excluded
+size_t getSampleSize(const nnfw_tensorinfo &info)
+{
+  size_t n = 1;
+  for (int32_t i = 1; i < info.rank; ++i)
+  {
+    assert(info.dims[i] >= 0);
+    n *= info.dims[i];
+  }
+  return getElementSize(info.dtype) * n;
+}
+
+} // namespace
+
+NNFW_STATUS nnfw_batcher::create(nnfw_session *session, const nnfw_batcher_config *config,
+                                 nnfw_batcher **batcher)
+{
+  if (session == nullptr || config == nullptr || batcher == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (config->max_batch_size == 0 || config->max_batch_size > NNFW_BATCHER_MAX_BATCH_SIZE)
+  {
+    std::cerr << "Error during nnfw_batcher::create : max_batch_size should be in [1, "
+              << NNFW_BATCHER_MAX_BATCH_SIZE << "]" << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    auto new_batcher = std::unique_ptr<nnfw_batcher>(new nnfw_batcher(session, *config));
+    auto status = new_batcher->init();
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+
+    new_batcher->_worker = std::thread(&nnfw_batcher::worker, new_batcher.get());
+    *batcher = new_batcher.release();
+  }
+  catch (const std::bad_alloc &e)
+  {
+    std::cerr << "Error during nnfw_batcher::create : " << e.what() << std::endl;
+    return NNFW_STATUS_OUT_OF_MEMORY;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_batcher::create : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+nnfw_batcher::nnfw_batcher(nnfw_session *session, const nnfw_batcher_config &config)
+  : _session{session}, _config(config), _stats{}
+{
+  // DO NOTHING
+}
+
+NNFW_STATUS nnfw_batcher::init()
+{
+  // Inputs and outputs of a batch are set to the session only after prepare
+  if (!_session->isPreparedForRun())
+  {
+    std::cerr << "Error during nnfw_batcher::create : "
+              << "batcher should be created after prepare" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  uint32_t num_inputs = 0;
+  uint32_t num_outputs = 0;
+  NNFW_STATUS status = _session->input_size(&num_inputs);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+  status = _session->output_size(&num_outputs);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  auto collect = [this](uint32_t count, bool is_input, std::vector<nnfw_tensorinfo> &infos,
+                        std::vector<size_t> &sample_sizes,
+                        std::vector<std::vector<uint8_t>> &buffers) {
+    infos.resize(count);
+    sample_sizes.resize(count);
+    buffers.resize(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      auto status = is_input ? _session->input_tensorinfo(i, &infos[i])
+                             : _session->output_tensorinfo(i, &infos[i]);
+      if (status != NNFW_STATUS_NO_ERROR)
+        return status;
+
+      if (infos[i].rank == 0 || infos[i].dims[0] != 1)
+      {
+        std::cerr << "Error during nnfw_batcher::create : " << (is_input ? "input " : "output ")
+                  << i << " should have batch size 1 on the first dimension" << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+
+      sample_sizes[i] = getSampleSize(infos[i]);
+      buffers[i].resize(sample_sizes[i] * _config.max_batch_size);
+    }
+    return NNFW_STATUS_NO_ERROR;
+  };
+
+  status = collect(num_inputs, true, _input_infos, _input_sample_sizes, _input_buffers);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+  status = collect(num_outputs, false, _output_infos, _output_sample_sizes, _output_buffers);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+nnfw_batcher::~nnfw_batcher()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _stop = true;
+  }
+  _cv_queue.notify_all();
+
+  if (_worker.joinable())
+    _worker.join();
+}
+
+NNFW_STATUS nnfw_batcher::run(const void **inputs, void **outputs)
+{
+  if ((inputs == nullptr && !_input_infos.empty()) ||
+      (outputs == nullptr && !_output_infos.empty()))
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  Request request;
+  request.inputs = inputs;
+  request.outputs = outputs;
+  request.arrival = std::chrono::steady_clock::now();
+
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    if (_stop)
+      return NNFW_STATUS_INVALID_STATE;
+
+    _queue.push_back(&request);
+    _stats.queue_depth = _queue.size();
+    _stats.max_queue_depth = std::max(_stats.max_queue_depth, _stats.queue_depth);
+  }
+  _cv_queue.notify_one();
+
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_done.wait(lock, [&request] { return request.done; });
+
+  return request.status;
+}
+
+NNFW_STATUS nnfw_batcher::get_stats(nnfw_batcher_stats *stats)
+{
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  std::lock_guard<std::mutex> lock{_mu};
+  *stats = _stats;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+void nnfw_batcher::worker()
+{
+  const auto max_wait = std::chrono::microseconds(_config.max_wait_us);
+
+  while (true)
+  {
+    std::vector<Request *> requests;
+
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      _cv_queue.wait(lock, [this] { return _stop || !_queue.empty(); });
+      if (_queue.empty())
+      {
+        assert(_stop);
+        return;
+      }
+
+      // Wait for more requests until the first request waits max_wait_us
+      const auto deadline = _queue.front()->arrival + max_wait;
+      _cv_queue.wait_until(lock, deadline,
+                           [this] { return _stop || _queue.size() >= _config.max_batch_size; });
+
+      const auto batch_size = std::min<size_t>(_queue.size(), _config.max_batch_size);
+      requests.assign(_queue.begin(), _queue.begin() + batch_size);
+      _queue.erase(_queue.begin(), _queue.begin() + batch_size);
+      _stats.queue_depth = _queue.size();
+    }
+
+    const auto status = runBatch(requests);
+
+    {
+      std::lock_guard<std::mutex> lock{_mu};
+      for (auto &&request : requests)
+      {
+        request->status = status;
+        request->done = true;
+      }
+      _stats.num_requests += requests.size();
+      _stats.num_batches++;
+      _stats.batch_size_histogram[requests.size() - 1]++;
+    }
+    _cv_done.notify_all();
+  }
+}
+
+NNFW_STATUS nnfw_batcher::runBatch(const std::vector<Request *> &requests)
+{
+  const uint32_t batch_size = requests.size();
+  assert(batch_size > 0 && batch_size <= _config.max_batch_size);
+
+  NNFW_STATUS status = NNFW_STATUS_NO_ERROR;
+
+  // Resize batch dimension only if it is changed from the last run
+  if (batch_size != _current_batch_size)
+  {
+    for (uint32_t i = 0; i < _input_infos.size(); ++i)
+    {
+      auto info = _input_infos[i];
+      info.dims[0] = batch_size;
+      status = _session->set_input_tensorinfo(i, &info);
+      if (status != NNFW_STATUS_NO_ERROR)
+        return status;
+    }
+    _current_batch_size = batch_size;
+  }
+
+  // Single request uses user buffers directly without gathering and scattering
+  for (uint32_t i = 0; i < _input_infos.size(); ++i)
+  {
+    const auto sample_size = _input_sample_sizes[i];
+    const void *buffer = requests[0]->inputs[i];
+    if (batch_size > 1)
+    {
+      for (uint32_t n = 0; n < batch_size; ++n)
+        std::memcpy(_input_buffers[i].data() + n * sample_size, requests[n]->inputs[i],
+                    sample_size);
+      buffer = _input_buffers[i].data();
+    }
+    status = _session->set_input(i, _input_infos[i].dtype, buffer, sample_size * batch_size);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+
+  for (uint32_t i = 0; i < _output_infos.size(); ++i)
+  {
+    const auto sample_size = _output_sample_sizes[i];
+    void *buffer = batch_size > 1 ? _output_buffers[i].data() : requests[0]->outputs[i];
+    status = _session->set_output(i, _output_infos[i].dtype, buffer, sample_size * batch_size);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+
+  status = _session->run();
+  if (status != NNFW_STATUS_NO_ERROR || batch_size == 1)
+    return status;
+
+  for (uint32_t i = 0; i < _output_infos.size(); ++i)
+  {
+    const auto sample_size = _output_sample_sizes[i];
+    for (uint32_t n = 0; n < batch_size; ++n)
+      std::memcpy(requests[n]->outputs[i], _output_buffers[i].data() + n * sample_size,
+                  sample_size);
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
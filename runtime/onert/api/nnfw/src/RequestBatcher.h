@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __API_REQUEST_BATCHER_H__
+#define __API_REQUEST_BATCHER_H__
+
+#include "nnfw.h"
+#include "nnfw_experimental.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Request batcher which merges single-sample requests into one batched session run
+ *
+ * Requests are queued by caller threads, and a worker thread collects them until
+ * max_batch_size requests are queued or the first request waits max_wait_us.
+ */
+struct nnfw_batcher
+{
+private:
+  struct Request
+  {
+    const void **inputs;
+    void **outputs;
+    std::chrono::steady_clock::time_point arrival;
+    NNFW_STATUS status{NNFW_STATUS_ERROR};
+    bool done{false};
+  };
+
+public:
+  /**
+   * @brief Factory method. It creates a batcher and starts its worker thread
+   *
+   * @note  Use factory instead of constructor to get status
+   */
+  static NNFW_STATUS create(nnfw_session *session, const nnfw_batcher_config *config,
+                            nnfw_batcher **batcher);
+
+private:
+  nnfw_batcher(nnfw_session *session, const nnfw_batcher_config &config);
+  NNFW_STATUS init();
+
+public:
+  ~nnfw_batcher();
+
+  NNFW_STATUS run(const void **inputs, void **outputs);
+  NNFW_STATUS get_stats(nnfw_batcher_stats *stats);
+
+private:
+  void worker();
+  NNFW_STATUS runBatch(const std::vector<Request *> &requests);
+
+private:
+  nnfw_session *_session;
+  nnfw_batcher_config _config;
+  // Tensor info of one sample for each input/output
+  std::vector<nnfw_tensorinfo> _input_infos;
+  std::vector<nnfw_tensorinfo> _output_infos;
+  std::vector<size_t> _input_sample_sizes;
+  std::vector<size_t> _output_sample_sizes;
+  // Buffers for batched run, allocated for max_batch_size on creation
+  std::vector<std::vector<uint8_t>> _input_buffers;
+  std::vector<std::vector<uint8_t>> _output_buffers;
+  // Batch size of inputs currently set on the session
+  uint32_t _current_batch_size{1};
+
+  std::deque<Request *> _queue;
+  std::mutex _mu;
+  std::condition_variable _cv_queue;
+  std::condition_variable _cv_done;
+  bool _stop{false};
+  nnfw_batcher_stats _stats;
+  std::thread _worker;
+};
+
+#endif // __API_REQUEST_BATCHER_H__
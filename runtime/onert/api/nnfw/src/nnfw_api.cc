@@ -16,6 +16,7 @@
 
 #include "nnfw_api_internal.h"
 #include "nnfw_version.h"
+#include "RequestBatcher.h"
 
 // Double-check enum value changes
 
@@ -364,19 +365,82 @@ NNFW_STATUS nnfw_set_backends_per_operation(nnfw_session *session, const char *b
   return session->set_backends_per_operation(backend_settings);
 }
 
-NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *, const char *)
+NNFW_STATUS nnfw_create_execution_context(nnfw_session *session, nnfw_session **context)
 {
-  return nnfw_session::deprecated("nnfw_prepare_pipeline: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->create_execution_context(context);
+}
+
+NNFW_STATUS nnfw_batcher_create(nnfw_session *session, const nnfw_batcher_config *config,
+                                nnfw_batcher **batcher)
+{
+  return nnfw_batcher::create(session, config, batcher);
+}
+
+NNFW_STATUS nnfw_batcher_run(nnfw_batcher *batcher, const void **inputs, void **outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(batcher);
+  return batcher->run(inputs, outputs);
+}
+
+NNFW_STATUS nnfw_batcher_get_stats(nnfw_batcher *batcher, nnfw_batcher_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(batcher);
+  return batcher->get_stats(stats);
+}
+
+NNFW_STATUS nnfw_batcher_destroy(nnfw_batcher *batcher)
+{
+  delete batcher;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_get_shape_plan_cache_stats(nnfw_session *session,
+                                            nnfw_shape_plan_cache_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_shape_plan_cache_stats(stats);
+}
+
+NNFW_STATUS nnfw_set_compute_thread_limit(uint32_t max_threads)
+{
+  return nnfw_session::set_compute_thread_limit(max_threads);
 }
 
-NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *, void *, void *)
+NNFW_STATUS nnfw_get_compute_thread_stats(nnfw_compute_thread_stats *stats)
 {
-  return nnfw_session::deprecated("nnfw_push_pipeline_input: Deprecated");
+  return nnfw_session::get_compute_thread_stats(stats);
 }
 
-NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *, void *)
+NNFW_STATUS nnfw_get_compute_threads(nnfw_session *session, uint32_t *num_threads)
 {
-  return nnfw_session::deprecated("nnfw_pop_pipeline_output: Deprecated");
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->get_compute_threads(num_threads);
+}
+
+NNFW_STATUS nnfw_reset_variable_states(nnfw_session *session)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->reset_variable_states();
+}
+
+NNFW_STATUS nnfw_prepare_pipeline(nnfw_session *session, const char *map_file_path)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->prepare_pipeline(map_file_path);
+}
+
+NNFW_STATUS nnfw_push_pipeline_input(nnfw_session *session, void *inputs, void *lengths)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->push_pipeline_input(reinterpret_cast<std::vector<void *> *>(inputs),
+                                      reinterpret_cast<std::vector<uint32_t> *>(lengths));
+}
+
+NNFW_STATUS nnfw_pop_pipeline_output(nnfw_session *session, void *outputs)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->pop_pipeline_output(reinterpret_cast<std::vector<void *> *>(outputs));
 }
 
 NNFW_STATUS nnfw_set_workspace(nnfw_session *session, const char *dir)
@@ -452,6 +516,12 @@ NNFW_STATUS nnfw_train_get_loss(nnfw_session *session, uint32_t index, float *lo
   return session->train_get_loss(index, loss);
 }
 
+NNFW_STATUS nnfw_train_get_phase_stats(nnfw_session *session, nnfw_train_phase_stats *stats)
+{
+  NNFW_RETURN_ERROR_IF_NULL(session);
+  return session->train_get_phase_stats(stats);
+}
+
 NNFW_STATUS nnfw_train_export_circle(nnfw_session *session, const char *path)
 {
   NNFW_RETURN_ERROR_IF_NULL(session);
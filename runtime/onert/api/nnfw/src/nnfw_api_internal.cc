@@ -16,11 +16,13 @@
 
 #include "nnfw_api_internal.h"
 #include "CustomKernelRegistry.h"
+#include "compiler/Compiler.h"
 #include "compiler/CompilerFactory.h"
 #include "util/ConfigSource.h"
 #include "util/Exceptions.h"
 #include "util/logging.h"
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
 #include "loader/CircleLoader.h"
 #include "loader/ModelLoader.h"
 #include "loader/TFLiteLoader.h"
@@ -29,13 +31,18 @@
 #include "exporter/CircleExporter.h"
 #include "exporter/train/CheckpointExporter.h"
 #include "json/json.h"
+#include "ir/Graph.h"
 #include "ir/NNPkg.h"
 #include "ir/OpCode.h"
 #include "ir/train/TrainingInfo.h"
+#include "util/ThreadBudget.h"
 #include "util/TracingCtx.h"
 #include "odc/QuantizeManager.h"
 #include "odc/CodegenManager.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -221,6 +228,39 @@ loadTrainingInfo(const std::shared_ptr<onert::ir::Model> &model)
 }
 
 uint64_t getBufSize(const nnfw_tensorinfo *info)
+{
+  uint64_t n = 1;
+  for (int32_t i = 0; i < info->rank; ++i)
+  {
+    assert(info->dims[i] >= 0);
+    n *= info->dims[i];
+  }
+  return getElementSize(info->dtype) * n;
+}
+// Copy of nnpkg whose graphs can be compiled independently of the original ones
+// Operand data are shared, and metadata are not copied as they are consumed on loading
+std::shared_ptr<onert::ir::NNPkg> cloneNNPkg(const onert::ir::NNPkg &nnpkg)
+{
+  auto cloned = std::make_shared<onert::ir::NNPkg>(nnpkg);
+  for (uint16_t i = 0; i < nnpkg.model_count(); i++)
+  {
+    const auto &model = nnpkg.model(onert::ir::ModelIndex{i});
+    auto cloned_model = std::make_shared<onert::ir::Model>();
+    model->iterate([&](const onert::ir::SubgraphIndex &index, const onert::ir::IGraph &subg) {
+      const auto graph = dynamic_cast<const onert::ir::Graph *>(&subg);
+      if (graph == nullptr)
+        throw std::runtime_error{"Cannot copy a subgraph which is not ir::Graph"};
+      cloned_model->push(index, std::make_shared<onert::ir::Graph>(*graph));
+    });
+    cloned_model->bindKernelBuilder(model->getKernelBuilder());
+    cloned->model(onert::ir::ModelIndex{i}) = cloned_model;
+  }
+  return cloned;
+}
+
+} // namespace
+
+uint64_t getElementSize(NNFW_TYPE type)
 {
   static int elmsize[] = {
     sizeof(float),   /* NNFW_TYPE_TENSOR_FLOAT32 = 0 */
@@ -233,15 +273,8 @@ uint64_t getBufSize(const nnfw_tensorinfo *info)
     sizeof(int16_t), /* NNFW_TYPE_TENSOR_QUANT16_SYMM_SIGNED = 7 */
   };
 
-  uint64_t n = 1;
-  for (int32_t i = 0; i < info->rank; ++i)
-  {
-    assert(info->dims[i] >= 0);
-    n *= info->dims[i];
-  }
-  return elmsize[info->dtype] * n;
+  return elmsize[type];
 }
-} // namespace
 
 nnfw_session::nnfw_session()
   : _nnpkg{nullptr}, _coptions{onert::compiler::CompilerOptions::fromGlobalConfig()},
@@ -502,6 +535,7 @@ NNFW_STATUS nnfw_session::run()
 
   try
   {
+    onert::util::AffinityScope affinity{computeCores()};
     _execution->execute();
   }
   catch (const onert::InsufficientBufferSizeException &e)
@@ -529,7 +563,11 @@ NNFW_STATUS nnfw_session::run_async()
     return NNFW_STATUS_INVALID_STATE;
   }
 
-  _execution->startExecute();
+  {
+    // Thread for asynchronous execution inherits the affinity
+    onert::util::AffinityScope affinity{computeCores()};
+    _execution->startExecute();
+  }
 
   _state = State::RUNNING;
   return NNFW_STATUS_NO_ERROR;
@@ -1117,6 +1155,21 @@ bool nnfw_session::isStatePreparedOrFinishedRun()
   return isStatePrepared() || isStateFinishedRun();
 }
 
+bool nnfw_session::isStatePreparedPipeline()
+{
+  if (_state == State::PREPARED_PIPELINE)
+  {
+    assert(_nnpkg == nullptr);
+    assert(_execution == nullptr);
+    assert(_pipeline != nullptr);
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+}
+
 NNFW_STATUS nnfw_session::input_tensorindex(const char *tensorname, uint32_t *index)
 {
   return getTensorIndexImpl(*primary_subgraph(), tensorname, index, true);
@@ -1158,6 +1211,270 @@ NNFW_STATUS nnfw_session::set_backends_per_operation(const char *backend_setting
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::create_execution_context(nnfw_session **context)
+{
+  if (context == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStateModelLoaded())
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : "
+              << "execution context should be created after loading model and before prepare"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    auto new_session = std::unique_ptr<nnfw_session>(new nnfw_session());
+    // Compilation transforms graphs in place, so each execution context has its own graphs.
+    // Operand data are still shared, so constants are not copied for each execution context.
+    new_session->_nnpkg = cloneNNPkg(*_nnpkg);
+    new_session->_coptions = std::make_unique<onert::compiler::CompilerOptions>(*_coptions);
+    new_session->_kernel_registry = _kernel_registry;
+    new_session->_train_info = std::make_unique<onert::ir::train::TrainingInfo>(*_train_info);
+    new_session->_model_path = _model_path;
+    new_session->_state = State::MODEL_LOADED;
+    *context = new_session.release();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::create_execution_context : " << e.what()
+              << std::endl;
+    *context = nullptr;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_shape_plan_cache_stats(nnfw_shape_plan_cache_stats *stats)
+{
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::get_shape_plan_cache_stats : Invalid state"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto cache_stats = _execution->shapePlanCacheStats();
+  stats->num_buckets = cache_stats.num_buckets;
+  stats->num_hits = cache_stats.num_hits;
+  stats->num_misses = cache_stats.num_misses;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::set_compute_thread_limit(uint32_t max_threads)
+{
+  onert::util::ThreadBudget::get().setLimit(max_threads);
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_compute_thread_stats(nnfw_compute_thread_stats *stats)
+{
+  if (stats == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  auto &budget = onert::util::ThreadBudget::get();
+  stats->limit = budget.limit();
+  stats->used = budget.used();
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::get_compute_threads(uint32_t *num_threads)
+{
+  if (num_threads == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  if (!isStatePreparedOrFinishedRun() && !isStatePreparedOrFinishedTraining())
+  {
+    std::cerr << "Error during nnfw_session::get_compute_threads : Invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto &thread_quota = _compiler_artifact->_thread_quota;
+  *num_threads = thread_quota ? thread_quota->numThreads() : 0;
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::reset_variable_states()
+{
+  if (!isStatePreparedOrFinishedRun())
+  {
+    std::cerr << "Error during nnfw_session::reset_variable_states : Invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  const auto &variable_states = _compiler_artifact->_variable_states;
+  if (variable_states == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::reset_variable_states : Variable states are not kept"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+  variable_states->reset();
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+const std::vector<int> &nnfw_session::computeCores() const
+{
+  static const std::vector<int> no_restriction;
+  if (_compiler_artifact == nullptr || _compiler_artifact->_thread_quota == nullptr)
+    return no_restriction;
+  return _compiler_artifact->_thread_quota->cores();
+}
+
+NNFW_STATUS nnfw_session::prepare_pipeline(const char *map_file_path)
+{
+  if (!isStateModelLoaded())
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : "
+              << "prepare_pipeline should be run after loading model and before prepare"
+              << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (map_file_path != nullptr)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : "
+              << "partition map is not supported, use nnpackage partitioned by circle-partitioner"
+              << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  try
+  {
+    // Each model is compiled separately to run on its own stage
+    std::vector<std::shared_ptr<onert::exec::IExecutors>> stages;
+    for (uint16_t i = 0; i < _nnpkg->model_count(); i++)
+    {
+      auto compiler = std::make_unique<onert::compiler::Compiler>(
+        _nnpkg->model(onert::ir::ModelIndex{i}), _coptions.get());
+      _pipeline_artifacts.emplace_back(compiler->compile());
+      stages.emplace_back(_pipeline_artifacts.back()->_executors);
+    }
+
+    // Single model package does not describe package I/O, which is the model I/O
+    auto edges = _nnpkg->model_edges();
+    if (_nnpkg->model_count() == 1 && edges.pkg_inputs.empty() && edges.pkg_outputs.empty())
+    {
+      const auto &executors = stages.front();
+      for (uint32_t i = 0; i < executors->inputSize(); i++)
+        edges.pkg_inputs.emplace_back(onert::ir::ModelIndex{0}, onert::ir::SubgraphIndex{0},
+                                      onert::ir::IOIndex{i});
+      for (uint32_t i = 0; i < executors->outputSize(); i++)
+        edges.pkg_outputs.emplace_back(onert::ir::ModelIndex{0}, onert::ir::SubgraphIndex{0},
+                                       onert::ir::IOIndex{i});
+    }
+
+    _pipeline = std::make_unique<onert::exec::PipelineExecution>(stages, edges);
+    _nnpkg.reset();
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::prepare_pipeline : " << e.what() << std::endl;
+    _pipeline_artifacts.clear();
+    return NNFW_STATUS_ERROR;
+  }
+
+  _state = State::PREPARED_PIPELINE;
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::push_pipeline_input(std::vector<void *> *inputs,
+                                              std::vector<uint32_t> *lengths)
+{
+  if (!isStatePreparedPipeline())
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : "
+              << "push_pipeline_input should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (inputs == nullptr || lengths == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    // Empty inputs mean the end of input stream
+    if (inputs->empty())
+    {
+      _pipeline->close();
+      return NNFW_STATUS_NO_ERROR;
+    }
+
+    if (inputs->size() != lengths->size())
+    {
+      std::cerr << "Error during nnfw_session::push_pipeline_input : "
+                << "the number of inputs and lengths are different" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    _pipeline->push(std::vector<const void *>(inputs->begin(), inputs->end()),
+                    std::vector<size_t>(lengths->begin(), lengths->end()));
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::push_pipeline_input : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
+NNFW_STATUS nnfw_session::pop_pipeline_output(std::vector<void *> *outputs)
+{
+  if (!isStatePreparedPipeline())
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+              << "pop_pipeline_output should be run after prepare_pipeline" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  if (outputs == nullptr)
+    return NNFW_STATUS_UNEXPECTED_NULL;
+
+  try
+  {
+    std::vector<std::vector<uint8_t>> buffers;
+    if (!_pipeline->pop(buffers))
+    {
+      std::cerr << "Error during nnfw_session::pop_pipeline_output : "
+                << "pipeline is closed and there is no output" << std::endl;
+      return NNFW_STATUS_ERROR;
+    }
+
+    outputs->clear();
+    for (const auto &buffer : buffers)
+    {
+      void *output = std::malloc(buffer.size());
+      if (output == nullptr)
+      {
+        for (auto &&allocated : *outputs)
+          std::free(allocated);
+        outputs->clear();
+        return NNFW_STATUS_OUT_OF_MEMORY;
+      }
+      std::memcpy(output, buffer.data(), buffer.size());
+      outputs->emplace_back(output);
+    }
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::pop_pipeline_output : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
 {
   if (isStateInitialized())
@@ -1231,6 +1548,10 @@ NNFW_STATUS nnfw_session::train_get_traininfo(nnfw_train_info *info)
     info->loss_info.loss = convertLossCode(loss.loss_code);
     info->loss_info.reduction_type = convertLossReduction(loss.reduction_type);
     info->opt = convertOptimizerCode(optim.optim_code);
+    info->recompute_segment_size = _train_info->recomputeSegmentSize();
+    info->activation_memory_budget = _train_info->activationMemoryBudget();
+    info->gradient_accumulation_steps = _train_info->gradientAccumulationSteps();
+    info->multi_tensor_update = _train_info->multiTensorUpdate();
 
     if (_train_info->getTrainableOps().size() > 0)
     {
@@ -1333,6 +1654,13 @@ NNFW_STATUS nnfw_session::train_set_traininfo(const nnfw_train_info *info)
     _train_info->setBatchSize(info->batch_size);
     _train_info->setLossInfo(loss_info);
     _train_info->setOptimizerInfo(opt_info);
+    _train_info->setRecomputeSegmentSize(info->recompute_segment_size);
+    _train_info->setActivationMemoryBudget(info->activation_memory_budget);
+
+    // 0 of zero-initialized struct means default, i.e. no accumulation
+    _train_info->setGradientAccumulationSteps(
+      info->gradient_accumulation_steps == 0 ? 1 : info->gradient_accumulation_steps);
+    _train_info->setMultiTensorUpdate(info->multi_tensor_update);
 
     if (info->num_of_trainable_ops < -1)
     {
@@ -1587,6 +1915,7 @@ NNFW_STATUS nnfw_session::train_run(bool update_weights)
 
   try
   {
+    onert::util::AffinityScope affinity{computeCores()};
     if (update_weights)
     {
       auto &training_step = _train_info->trainingStep();
@@ -1645,6 +1974,37 @@ NNFW_STATUS nnfw_session::train_get_loss(uint32_t index, float *loss)
   return NNFW_STATUS_NO_ERROR;
 }
 
+NNFW_STATUS nnfw_session::train_get_phase_stats(nnfw_train_phase_stats *stats)
+{
+  if (stats == nullptr)
+  {
+    std::cerr << "Error during nnfw_session::train_get_phase_stats : stats is null" << std::endl;
+    return NNFW_STATUS_UNEXPECTED_NULL;
+  }
+
+  if (!isStatePreparedOrFinishedTraining())
+  {
+    std::cerr << "Error during nnfw_session::train_get_phase_stats : invalid state" << std::endl;
+    return NNFW_STATUS_INVALID_STATE;
+  }
+
+  try
+  {
+    const auto phase_stats = _execution->trainingPhaseStats();
+    stats->num_steps = phase_stats.num_steps;
+    stats->forward_us = phase_stats.forward_us;
+    stats->backward_us = phase_stats.backward_us;
+    stats->update_us = phase_stats.update_us;
+  }
+  catch (const std::exception &e)
+  {
+    std::cerr << "Error during nnfw_session::train_get_phase_stats : " << e.what() << std::endl;
+    return NNFW_STATUS_ERROR;
+  }
+
+  return NNFW_STATUS_NO_ERROR;
+}
+
 NNFW_STATUS nnfw_session::train_export_circle(const char *path)
 {
   if (path == nullptr)
@@ -1976,7 +2336,7 @@ NNFW_STATUS nnfw_session::codegen(const char *target, NNFW_CODEGEN_PREF pref)
   }
 }
 
-NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *)
+NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, const char *value)
 {
   if (!isStateModelLoaded())
   {
@@ -1989,6 +2349,73 @@ NNFW_STATUS nnfw_session::set_prepare_config(const NNFW_PREPARE_CONFIG key, cons
     case NNFW_PREPARE_CONFIG_PROFILE:
       _coptions->he_profiling_mode = true;
       break;
+    case NNFW_PREPARE_CONFIG_SHAPE_PLAN_CACHE_SIZE:
+    {
+      if (value == nullptr)
+        return NNFW_STATUS_UNEXPECTED_NULL;
+
+      int size = 0;
+      try
+      {
+        size = std::stoi(value);
+      }
+      catch (const std::exception &)
+      {
+        size = -1;
+      }
+      if (size < 0)
+      {
+        std::cerr << "Error during nnfw_session::set_prepare_config : Invalid cache size "
+                  << value << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+      _coptions->shape_plan_cache_size = static_cast<uint32_t>(size);
+      break;
+    }
+    case NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES:
+      _coptions->keep_variable_states = true;
+      break;
+    case NNFW_PREPARE_CONFIG_NUM_THREADS:
+    {
+      if (value == nullptr)
+        return NNFW_STATUS_UNEXPECTED_NULL;
+
+      int num_threads = 0;
+      try
+      {
+        num_threads = std::stoi(value);
+      }
+      catch (const std::exception &)
+      {
+        num_threads = -1;
+      }
+      if (num_threads < 0)
+      {
+        std::cerr << "Error during nnfw_session::set_prepare_config : Invalid number of threads "
+                  << value << std::endl;
+        return NNFW_STATUS_ERROR;
+      }
+      _coptions->num_threads = num_threads;
+      break;
+    }
+    case NNFW_PREPARE_CONFIG_CPU_AFFINITY:
+    {
+      if (value == nullptr)
+        return NNFW_STATUS_UNEXPECTED_NULL;
+
+      try
+      {
+        _coptions->setCpuAffinity(value);
+      }
+      catch (const std::exception &)
+      {
+        std::cerr << "Error during nnfw_session::set_prepare_config : Invalid cpu affinity "
+                  << value << std::endl;
+        _coptions->cpu_affinity.clear();
+        return NNFW_STATUS_ERROR;
+      }
+      break;
+    }
     default:
       return NNFW_STATUS_ERROR;
   }
@@ -2005,6 +2432,12 @@ NNFW_STATUS nnfw_session::reset_prepare_config()
   }
 
   _coptions->he_profiling_mode = false;
+  _coptions->shape_plan_cache_size = static_cast<uint32_t>(
+    std::max(0, onert::util::getConfigInt(onert::util::config::SHAPE_PLAN_CACHE_SIZE)));
+  _coptions->keep_variable_states =
+    onert::util::getConfigBool(onert::util::config::KEEP_VARIABLE_STATES);
+  _coptions->num_threads = onert::util::getConfigInt(onert::util::config::COMPUTE_THREADS);
+  _coptions->setCpuAffinity(onert::util::getConfigString(onert::util::config::CPU_AFFINITY));
 
   return NNFW_STATUS_NO_ERROR;
 }
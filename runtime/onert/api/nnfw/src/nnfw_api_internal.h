@@ -24,7 +24,6 @@
 
 #include <string>
 #include <memory>
-#include <thread>
 #include <vector>
 
 namespace onert
@@ -37,6 +36,7 @@ namespace exec
 {
 class Execution;
 struct ExecutionOptions;
+class PipelineExecution;
 } // namespace exec
 namespace ir
 {
@@ -103,6 +103,7 @@ private:
     INITIALIZED,       //< Session is initialized and nothing has done to it
     MODEL_LOADED,      //< Model is loaded
     PREPARED,          //< Prepared(compiled) for execution
+    PREPARED_PIPELINE, //< Prepared(compiled) for pipelined execution
     RUNNING,           //< Execution is in progress (only for asynchronous execution)
     FINISHED_RUN,      //< Executed at least once
     PREPARED_TRAINING, //< Prepared for training
@@ -169,6 +170,21 @@ public:
    *          (cpu, acl_cl)
    */
   NNFW_STATUS set_backends_per_operation(const char *backend_settings);
+  /**
+   * @brief   Create a new session sharing the loaded model with this session
+   */
+  NNFW_STATUS create_execution_context(nnfw_session **context);
+  NNFW_STATUS get_shape_plan_cache_stats(nnfw_shape_plan_cache_stats *stats);
+  static NNFW_STATUS set_compute_thread_limit(uint32_t max_threads);
+  static NNFW_STATUS get_compute_thread_stats(nnfw_compute_thread_stats *stats);
+  NNFW_STATUS get_compute_threads(uint32_t *num_threads);
+  NNFW_STATUS reset_variable_states();
+  /**
+   * @brief   Compile each model of the loaded nnpackage as a pipeline stage
+   */
+  NNFW_STATUS prepare_pipeline(const char *map_file_path);
+  NNFW_STATUS push_pipeline_input(std::vector<void *> *inputs, std::vector<uint32_t> *lengths);
+  NNFW_STATUS pop_pipeline_output(std::vector<void *> *outputs);
 
   NNFW_STATUS train_get_traininfo(nnfw_train_info *info);
   NNFW_STATUS train_set_traininfo(const nnfw_train_info *info);
@@ -182,6 +198,7 @@ public:
   NNFW_STATUS train_set_output(uint32_t index, NNFW_TYPE type, void *buffer, size_t length);
   NNFW_STATUS train_run(bool update_weights);
   NNFW_STATUS train_get_loss(uint32_t index, float *loss);
+  NNFW_STATUS train_get_phase_stats(nnfw_train_phase_stats *stats);
   NNFW_STATUS train_export_circle(const char *path);
   NNFW_STATUS train_export_circleplus(const char *path);
   NNFW_STATUS train_import_checkpoint(const char *path);
@@ -199,11 +216,17 @@ public:
   NNFW_STATUS set_execute_config(const NNFW_RUN_CONFIG key, const char *value);
   NNFW_STATUS reset_execute_config();
 
+  /**
+   * @brief Check whether the session is prepared for inference, so that inputs can be set and run
+   */
+  bool isPreparedForRun() { return isStatePreparedOrFinishedRun(); }
+
 private:
   const onert::ir::IGraph *primary_subgraph();
   uint32_t getInputSize();
   uint32_t getOutputSize();
   NNFW_STATUS loadModelFile(const std::string &model_file_path, const std::string &model_type);
+  const std::vector<int> &computeCores() const;
 
   bool isStateInitialized();
   bool isStateModelLoaded();
@@ -211,6 +234,7 @@ private:
   bool isStateRunning();
   bool isStateFinishedRun();
   bool isStatePreparedOrFinishedRun();
+  bool isStatePreparedPipeline();
   bool isStatePreparedTraining();
   bool isStateFinishedTraining();
   bool isStatePreparedOrFinishedTraining();
@@ -222,7 +246,9 @@ private:
   std::shared_ptr<onert::compiler::CompilerArtifact> _compiler_artifact;
   std::unique_ptr<onert::exec::Execution> _execution;
   std::shared_ptr<onert::api::CustomKernelRegistry> _kernel_registry;
-  std::vector<std::thread> _threads;
+  // Artifacts are kept for tracing context referred by executors of pipeline stages
+  std::vector<std::shared_ptr<onert::compiler::CompilerArtifact>> _pipeline_artifacts;
+  std::unique_ptr<onert::exec::PipelineExecution> _pipeline;
   std::unique_ptr<onert::ir::train::TrainingInfo> _train_info;
   std::unique_ptr<onert::odc::QuantizeManager> _quant_manager;
   std::unique_ptr<onert::odc::CodegenManager> _codegen_manager;
@@ -238,4 +264,9 @@ private:
   std::string _model_path;
 };
 
+/**
+ * @brief Get size of an element of @c type in bytes
+ */
+uint64_t getElementSize(NNFW_TYPE type);
+
 #endif // __API_NNFW_API_INTERNAL_H__
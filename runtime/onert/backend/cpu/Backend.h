@@ -42,14 +42,15 @@ public:
   std::unique_ptr<onert::backend::BackendContext> newContext(ContextData &&data) const override
   {
     auto custom_kernel_builder = data.custom_kernel_builder;
+    auto variable_states = data.variable_states;
     auto &graph = *data.graph;
     auto context = std::make_unique<BackendContext>(this, std::move(data));
     auto tr = std::make_shared<basic::TensorRegistry>();
     auto tb = std::make_shared<TensorBuilder>(tr);
     context->tensor_registry = tr;
     context->tensor_builder = tb;
-    context->kernel_gen = std::make_shared<KernelGenerator>(graph, tb, tr, custom_kernel_builder,
-                                                            context->external_context());
+    context->kernel_gen = std::make_shared<KernelGenerator>(
+      graph, tb, tr, custom_kernel_builder, context->external_context(), variable_states);
     return context;
   }
 
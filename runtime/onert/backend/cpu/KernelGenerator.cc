@@ -18,6 +18,7 @@
 
 #include "ops/AddNLayer.h"
 #include "ops/ArgMinMaxLayer.h"
+#include "ops/AttentionLayer.h"
 #include "ops/BatchToSpaceNDLayer.h"
 #include "ops/BinaryArithmeticLayer.h"
 #include "ops/CompareLayer.h"
@@ -69,6 +70,7 @@
 #include "ops/FusedBatchNormLayer.h"
 #include "ops/LogSoftMaxLayer.h"
 #include "ops/StatelessRandomUniformLayer.h"
+#include "ops/TransposeConvLayer.h"
 
 #include <backend/Backend.h>
 #include <backend/IConfig.h>
@@ -230,10 +232,11 @@ KernelGenerator::KernelGenerator(
   const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
   const std::shared_ptr<backend::custom::IKernelBuilder> &kernel_builder,
-  const std::shared_ptr<ExternalContext> &external_context)
+  const std::shared_ptr<ExternalContext> &external_context,
+  const std::shared_ptr<const exec::VariableStates> &variable_states)
   : basic::KernelGeneratorBase{graph}, _ctx(graph.operands()), _operations_ctx{graph.operations()},
     _tensor_builder(tensor_builder), _tensor_reg{tensor_reg}, _kernel_builder(kernel_builder),
-    _external_context(external_context)
+    _external_context(external_context), _variable_states(variable_states)
 {
   // DO NOTHING
 }
@@ -390,7 +393,7 @@ void KernelGenerator::visit(const ir::operation::Concat &node)
 
   auto fn = std::make_unique<ops::ConcatLayer>();
 
-  fn->configure(input_tensors, axis, output_tensor);
+  fn->configure(input_tensors, axis, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -512,7 +515,7 @@ void KernelGenerator::visit(const ir::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -532,7 +535,7 @@ void KernelGenerator::visit(const ir::operation::BinaryArithmetic &node)
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
 
   fn->configure(lhs_tensor, rhs_tensor, ofm_tensor, activation,
-                convertArithmeticType(node.param().arithmetic_type));
+                convertArithmeticType(node.param().arithmetic_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -571,7 +574,7 @@ void KernelGenerator::visit(const ir::operation::Gather &node)
 
   auto fn = std::make_unique<ops::GatherLayer>();
 
-  fn->configure(input_tensor, indices_tensor, output_tensor, axis);
+  fn->configure(input_tensor, indices_tensor, output_tensor, axis, _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -658,7 +661,7 @@ void KernelGenerator::visit(const ir::operation::ElementwiseActivation &node)
   auto fn = std::make_unique<ops::ElementwiseActivationLayer>();
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertElementwiseActivationType(node.param().op_type));
+                convertElementwiseActivationType(node.param().op_type), _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -800,7 +803,52 @@ void KernelGenerator::visit(const ir::operation::Transpose &node)
 
   auto fn = std::make_unique<ops::TransposeLayer>();
 
-  fn->configure(input_tensor, perm_tensor, output_tensor);
+  fn->configure(input_tensor, perm_tensor, output_tensor, _external_context);
+
+  _return_fn = std::move(fn);
+}
+
+void KernelGenerator::visit(const ir::operation::TransposeConv &node)
+{
+  using ir::operation::TransposeConv;
+
+  const auto ofm_index{node.getOutputs().at(0)};
+  const auto ker_index{node.getInputs().at(TransposeConv::Input::KERNEL)};
+  const auto ifm_index{node.getInputs().at(TransposeConv::Input::INPUT)};
+
+  auto ofm_tensor = _tensor_reg->getPortableTensor(ofm_index);
+  auto ifm_tensor = _tensor_reg->getPortableTensor(ifm_index);
+  auto ker_tensor = _tensor_reg->getPortableTensor(ker_index);
+
+  const auto stride = node.param().stride;
+  const auto &param_padding = node.param().padding;
+
+  auto fn = std::make_unique<ops::TransposeConvLayer>();
+
+  if (_ctx.at(ifm_index).info().isDynamic() || _ctx.at(ofm_index).info().isDynamic())
+  {
+    fn->configure(ifm_tensor, ker_tensor, param_padding.type, param_padding.param.left,
+                  param_padding.param.right, param_padding.param.top, param_padding.param.bottom,
+                  stride.horizontal, stride.vertical, ofm_tensor, _external_context);
+
+    _return_fn = std::move(fn);
+    return;
+  }
+  const auto ifm_shape = _ctx.at(ifm_index).shape().asFeature();
+  const auto ofm_shape = _ctx.at(ofm_index).shape().asFeature();
+  // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+  const auto &ker_shape = _ctx.at(ker_index).shape();
+  const auto ker_height = ker_shape.dim(1);
+  const auto ker_width = ker_shape.dim(2);
+
+  // NOTE The padding calculation formula of TransposeConv is opposite to Conv.
+  //      So the location of ifm and ofm is changed.
+  const auto padding =
+    ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+  fn->configure(ifm_tensor, ker_tensor, param_padding.type, padding.left, padding.right,
+                padding.top, padding.bottom, stride.horizontal, stride.vertical, ofm_tensor,
+                _external_context);
 
   _return_fn = std::move(fn);
 }
@@ -829,7 +877,8 @@ void KernelGenerator::visit(const ir::operation::Reduce &node)
     auto fn = std::make_unique<ops::ReduceLayer>();
 
     const auto reduce_type = convertReduceType(node.param().reduce_type);
-    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims);
+    fn->configure(input_tensor, axes_tensor, output_tensor, reduce_type, keep_dims,
+                  _external_context);
 
     _return_fn = std::move(fn);
   }
@@ -952,7 +1001,7 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
   if (node.getInputs().size() == 1)
   {
     fn->configure(input_tensor, output_tensor, node.param().height_out, node.param().width_out,
-                  align_corners, half_pixel_centers);
+                  align_corners, half_pixel_centers, _external_context);
   }
   else
   {
@@ -965,11 +1014,12 @@ void KernelGenerator::visit(const ir::operation::ResizeBilinear &node)
       const auto height_out = size_vec[0];
       const auto width_out = size_vec[1];
       fn->configure(input_tensor, output_tensor, height_out, width_out, align_corners,
-                    half_pixel_centers);
+                    half_pixel_centers, _external_context);
     }
     else
     {
-      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers);
+      fn->configure(input_tensor, output_tensor, size_tensor, align_corners, half_pixel_centers,
+                    _external_context);
     }
   }
 
@@ -1196,6 +1246,30 @@ void KernelGenerator::visit(const ir::operation::DetectionPostProcess &node)
   _return_fn = std::move(fn);
 }
 
+void KernelGenerator::visit(const ir::operation::Attention &node)
+{
+  const auto output_index{node.getOutputs().at(0)};
+  const auto query_index{node.getInputs().at(ir::operation::Attention::QUERY)};
+  const auto key_index{node.getInputs().at(ir::operation::Attention::KEY)};
+  const auto value_index{node.getInputs().at(ir::operation::Attention::VALUE)};
+  const auto mask_index{node.getInputs().size() > ir::operation::Attention::MASK
+                          ? node.getInputs().at(ir::operation::Attention::MASK)
+                          : ir::OperandIndex{}};
+
+  auto output_tensor = _tensor_reg->getPortableTensor(output_index);
+  auto query_tensor = _tensor_reg->getPortableTensor(query_index);
+  auto key_tensor = _tensor_reg->getPortableTensor(key_index);
+  auto value_tensor = _tensor_reg->getPortableTensor(value_index);
+  auto mask_tensor = mask_index.undefined() ? nullptr : _tensor_reg->getPortableTensor(mask_index);
+
+  auto fn = std::make_unique<ops::AttentionLayer>();
+
+  fn->configure(query_tensor, key_tensor, value_tensor, mask_tensor, node.param().scale,
+                node.param().cache_size, node.param().causal, output_tensor, _external_context,
+                _variable_states);
+  _return_fn = std::move(fn);
+}
+
 void KernelGenerator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto output_index{node.getOutputs().at(0)};
@@ -1538,7 +1612,7 @@ void KernelGenerator::visit(const ir::operation::LSTM &node)
     /*output_offset=*/0, scratch_buffer_tensor, output_state_out_tensor, cell_state_out_tensor,
     output_tensor,
     !_ctx.at(output_state_in_index).info().isVariable() /* means empty buffer on frontend now */,
-    !_ctx.at(cell_state_in_index).info().isVariable());
+    !_ctx.at(cell_state_in_index).info().isVariable(), _external_context, _variable_states);
 
   _return_fn = std::move(fn);
 }
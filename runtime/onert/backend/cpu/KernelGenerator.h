@@ -24,6 +24,7 @@
 
 #include <backend/CustomKernelBuilder.h>
 #include <backend/basic/KernelGeneratorBase.h>
+#include <exec/VariableStates.h>
 #include <ir/Operands.h>
 #include <ir/Operations.h>
 
@@ -40,12 +41,14 @@ public:
   KernelGenerator(const ir::Graph &graph, const std::shared_ptr<TensorBuilder> &tensor_builder,
                   const std::shared_ptr<basic::TensorRegistry> &tensor_reg,
                   const std::shared_ptr<custom::IKernelBuilder> &kernel_builder,
-                  const std::shared_ptr<ExternalContext> &external_context);
+                  const std::shared_ptr<ExternalContext> &external_context,
+                  const std::shared_ptr<const exec::VariableStates> &variable_states = nullptr);
 
   std::unique_ptr<exec::FunctionSequence> generate(ir::OperationIndex op_ind) override;
 
   void visit(const ir::operation::AddN &) override;
   void visit(const ir::operation::ArgMinMax &) override;
+  void visit(const ir::operation::Attention &) override;
   void visit(const ir::operation::BatchMatMul &) override;
   void visit(const ir::operation::BatchToSpaceND &) override;
   void visit(const ir::operation::BinaryArithmetic &) override;
@@ -95,6 +98,7 @@ public:
   void visit(const ir::operation::StridedSlice &) override;
   void visit(const ir::operation::Tile &) override;
   void visit(const ir::operation::Transpose &) override;
+  void visit(const ir::operation::TransposeConv &) override;
   void visit(const ir::operation::Unpack &) override;
 
 private:
@@ -104,6 +108,7 @@ private:
   std::shared_ptr<basic::TensorRegistry> _tensor_reg;
   std::shared_ptr<backend::custom::IKernelBuilder> _kernel_builder;
   const std::shared_ptr<ExternalContext> _external_context;
+  const std::shared_ptr<const exec::VariableStates> _variable_states;
 };
 
 } // namespace cpu
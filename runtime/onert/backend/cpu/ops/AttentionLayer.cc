@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "AttentionLayer.h"
+
+#include "OperationUtils.h"
+
+#include <cker/operation/Attention.h>
+
+#include <algorithm>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+void AttentionLayer::configure(const IPortableTensor *query, const IPortableTensor *key,
+                               const IPortableTensor *value, const IPortableTensor *mask,
+                               float scale, int32_t cache_size, bool causal,
+                               IPortableTensor *output,
+                               const std::shared_ptr<ExternalContext> &external_context,
+                               const std::shared_ptr<const exec::VariableStates> &variable_states)
+{
+  _query = query;
+  _key = key;
+  _value = value;
+  _mask = mask;
+  _scale = scale;
+  _cache_size = cache_size;
+  _causal = causal;
+  _output = output;
+  _external_context = external_context;
+  _variable_states = variable_states;
+}
+
+void AttentionLayer::appendToCache()
+{
+  const auto key_shape = nnfw::cker::Shape::ExtendedShape(4, getShape(_key));
+  const auto value_shape = nnfw::cker::Shape::ExtendedShape(4, getShape(_value));
+  const int heads = key_shape.Dims(0) * key_shape.Dims(1);
+  const int new_len = key_shape.Dims(2);
+  const int depth = key_shape.Dims(3);
+  const int value_depth = value_shape.Dims(3);
+
+  const nnfw::cker::Shape key_cache_shape{key_shape.Dims(0), key_shape.Dims(1), _cache_size,
+                                          depth};
+  const nnfw::cker::Shape value_cache_shape{value_shape.Dims(0), value_shape.Dims(1),
+                                            _cache_size, value_depth};
+
+  // Tokens are kept only in streaming mode, otherwise each run is a new sequence
+  const auto generation = _variable_states ? _variable_states->generation() : 0;
+  if (!_variable_states || generation != _cache_generation ||
+      key_cache_shape != _key_cache_shape || value_cache_shape != _value_cache_shape)
+  {
+    // Buffers are not reallocated while the shape is the same
+    _key_cache.resize(key_cache_shape.FlatSize());
+    _value_cache.resize(value_cache_shape.FlatSize());
+    _key_cache_shape.ReplaceWith(key_cache_shape);
+    _value_cache_shape.ReplaceWith(value_cache_shape);
+    _cache_generation = generation;
+    _cached_len = 0;
+  }
+
+  if (_cached_len + new_len > _cache_size)
+    throw std::runtime_error{"Attention: kv cache is full"};
+
+  // Only rows of new tokens are copied
+  const float *key_data = getBuffer<float>(_key);
+  const float *value_data = getBuffer<float>(_value);
+  for (int h = 0; h < heads; ++h)
+  {
+    std::copy_n(key_data + h * new_len * depth, new_len * depth,
+                _key_cache.data() + (h * _cache_size + _cached_len) * depth);
+    std::copy_n(value_data + h * new_len * value_depth, new_len * value_depth,
+                _value_cache.data() + (h * _cache_size + _cached_len) * value_depth);
+  }
+  _cached_len += new_len;
+}
+
+void AttentionLayer::run()
+{
+  if (_query->data_type() != OperandType::FLOAT32)
+    throw std::runtime_error{"Attention: unsupported data type"};
+
+  nnfw::cker::AttentionParams op_params;
+  op_params.scale = _scale;
+  op_params.causal = _causal;
+  auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+
+  if (_cache_size > 0)
+  {
+    appendToCache();
+    op_params.key_len = _cached_len;
+    nnfw::cker::Attention(op_params, getShape(_query), getBuffer<float>(_query), _key_cache_shape,
+                          _key_cache.data(), _value_cache_shape, _value_cache.data(),
+                          nnfw::cker::Shape{}, nullptr, getShape(_output),
+                          getBuffer<float>(_output), ruy_context);
+    return;
+  }
+
+  nnfw::cker::Attention(op_params, getShape(_query), getBuffer<float>(_query), getShape(_key),
+                        getBuffer<float>(_key), getShape(_value), getBuffer<float>(_value),
+                        getShape(_mask), _mask ? getBuffer<float>(_mask) : nullptr,
+                        getShape(_output), getBuffer<float>(_output), ruy_context);
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_ATTENTIONLAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_ATTENTIONLAYER_H__
+
+#include "../ExternalContext.h"
+
+#include <backend/IPortableTensor.h>
+#include <cker/Shape.h>
+
+#include <exec/IFunction.h>
+#include <exec/VariableStates.h>
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class AttentionLayer : public ::onert::exec::IFunction
+{
+public:
+  AttentionLayer()
+    : _query{nullptr}, _key{nullptr}, _value{nullptr}, _mask{nullptr}, _output{nullptr},
+      _scale{1.f}, _cache_size{0}, _causal{false}
+  {
+    // DO NOTHING
+  }
+
+public:
+  /**
+   * @param mask       nullptr if there is no mask
+   * @param cache_size Max number of tokens in kv cache, 0 for no kv cache
+   * @param causal     Whether each query attends only keys up to itself
+   */
+  void configure(const IPortableTensor *query, const IPortableTensor *key,
+                 const IPortableTensor *value, const IPortableTensor *mask, float scale,
+                 int32_t cache_size, bool causal, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr,
+                 const std::shared_ptr<const exec::VariableStates> &variable_states = nullptr);
+
+  void run() override;
+
+private:
+  void appendToCache();
+
+private:
+  const IPortableTensor *_query;
+  const IPortableTensor *_key;
+  const IPortableTensor *_value;
+  const IPortableTensor *_mask;
+  IPortableTensor *_output;
+
+  float _scale;
+  int32_t _cache_size;
+  bool _causal;
+  std::shared_ptr<ExternalContext> _external_context;
+
+  // kv cache of [batch, heads, _cache_size, depth], allocated once for its shape and kept across
+  // runs until _variable_states is reset
+  std::shared_ptr<const exec::VariableStates> _variable_states;
+  uint32_t _cache_generation{0};
+  int32_t _cached_len{0};
+  nnfw::cker::Shape _key_cache_shape{};
+  nnfw::cker::Shape _value_cache_shape{};
+  std::vector<float> _key_cache{};
+  std::vector<float> _value_cache{};
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_ATTENTIONLAYER_H__
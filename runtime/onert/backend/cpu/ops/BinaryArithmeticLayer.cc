@@ -37,10 +37,11 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
   nnfw::cker::Shape _output_shape;
   nnfw::cker::BinaryArithmeticOpParam _op_params;
   bool _need_broadcast;
+  ruy::Context *_ruy_context;
 
   Eval(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-       nnfw::cker::BinaryArithmeticOpParam op_params)
-    : _op_params(std::move(op_params)), _need_broadcast(false)
+       nnfw::cker::BinaryArithmeticOpParam op_params, ruy::Context *ruy_context)
+    : _op_params(std::move(op_params)), _need_broadcast(false), _ruy_context(ruy_context)
   {
     if (!output->is_dynamic())
       updateCache(lhs, rhs, output);
@@ -68,13 +69,15 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type, typename T> struct
     auto output_buffer = getBuffer<T>(output);
     if (_need_broadcast)
     {
-      nnfw::cker::BroadcastBinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BroadcastBinaryArithmeticOpParallel<arithmetic_type>(
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _ruy_context);
     }
     else
     {
-      nnfw::cker::BinaryArithmeticOp<arithmetic_type>(
-        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer);
+      nnfw::cker::BinaryArithmeticOpParallel<arithmetic_type>(
+        _op_params, _lhs_shape, lhs_buffer, _rhs_shape, rhs_buffer, _output_shape, output_buffer,
+        _ruy_context);
     }
   }
 };
@@ -83,7 +86,7 @@ template <nnfw::cker::BinaryArithmeticOpType arithmetic_type>
 std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)>
 generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
                       IPortableTensor *output, const ir::Activation activation,
-                      nnfw::cker::BinaryArithmeticOpParam &op_params)
+                      nnfw::cker::BinaryArithmeticOpParam &op_params, ruy::Context *ruy_context)
 {
   switch (lhs->data_type())
   {
@@ -93,7 +96,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.float_activation_max = output_activation_max;
       op_params.float_activation_min = output_activation_min;
-      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, float>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     case OperandType::INT32:
@@ -102,7 +105,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.quantized_activation_max = output_activation_max;
       op_params.quantized_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int32_t>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     case OperandType::INT64:
@@ -111,7 +114,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       op_params.int64_activation_max = output_activation_max;
       op_params.int64_activation_min = output_activation_min;
-      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, int64_t>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     case OperandType::BOOL8:
@@ -122,7 +125,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
       int32_t output_activation_min = 0, output_activation_max = 0;
       CalculateActivationRange(activation, &output_activation_min, &output_activation_max);
       static_assert(sizeof(bool) == 1, "cpu backend supports bool type which is 1 byte");
-      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params);
+      return Eval<arithmetic_type, bool>(lhs, rhs, output, op_params, ruy_context);
       break;
     }
     default:
@@ -132,7 +135,7 @@ generateKernelGeneric(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
                              IPortableTensor *output, ir::Activation activation,
-                             nnfw::cker::BinaryArithmeticOpParam *params)
+                             nnfw::cker::BinaryArithmeticOpParam *params, int left_shift = 20)
 {
   int32_t output_activation_min, output_activation_max;
   CalculateActivationRangeQuantized(activation, output, &output_activation_min,
@@ -141,7 +144,7 @@ void setAddOrSubQuant8Params(const IPortableTensor *lhs, const IPortableTensor *
   op_params.quantized_activation_max = output_activation_max;
   op_params.quantized_activation_min = output_activation_min;
   // Parameters for scaled quantized computation
-  op_params.left_shift = 20;
+  op_params.left_shift = left_shift;
   // Zero-points of input and output tensors
   op_params.input1_offset = -lhs->data_zero_point();
   op_params.input2_offset = -rhs->data_zero_point();
@@ -185,7 +188,8 @@ void setMulQuant8Params(const IPortableTensor *lhs, const IPortableTensor *rhs,
 
 void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortableTensor *rhs,
                                       IPortableTensor *output, const ir::Activation activation,
-                                      const ArithmeticType arithmetic_type)
+                                      const ArithmeticType arithmetic_type,
+                                      const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(lhs != nullptr);
   assert(rhs != nullptr);
@@ -194,6 +198,8 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
   _lhs = lhs;
   _rhs = rhs;
   _output = output;
+  _external_context = external_context;
+  auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
 
   nnfw::cker::BinaryArithmeticOpParam op_params;
   switch (arithmetic_type)
@@ -202,20 +208,27 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       if (_lhs->data_type() == OperandType::QUANT_UINT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        // int16 values are shifted less not to overflow 32-bit intermediates
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::ADD, int16_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::ADD>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kSub:
@@ -223,21 +236,29 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params);
         op_params.input2_multiplier *= -1;
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        // int16 values are shifted less not to overflow 32-bit intermediates
+        setAddOrSubQuant8Params(_lhs, _rhs, _output, activation, &op_params, 15);
+        op_params.input2_multiplier *= -1;
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::SUB, int16_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
 
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::SUB>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kMul:
@@ -245,27 +266,34 @@ void BinaryArithmeticLayer::configure(const IPortableTensor *lhs, const IPortabl
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, uint8_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else if (_lhs->data_type() == OperandType::QUANT_INT8_ASYMM)
       {
         nnfw::cker::BinaryArithmeticOpParam op_params;
         setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
-        _kernel =
-          Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output, op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int8_t>(_lhs, _rhs, _output,
+                                                                        op_params, ruy_context);
+      }
+      else if (isQuantInt16(_lhs->data_type()))
+      {
+        nnfw::cker::BinaryArithmeticOpParam op_params;
+        setMulQuant8Params(_lhs, _rhs, _output, activation, &op_params);
+        _kernel = Eval<nnfw::cker::BinaryArithmeticOpType::MUL, int16_t>(_lhs, _rhs, _output,
+                                                                         op_params, ruy_context);
       }
       else
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::MUL>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       break;
     case ArithmeticType::kDiv:
       if (_lhs->data_type() == OperandType::FLOAT32)
       {
         _kernel = generateKernelGeneric<nnfw::cker::BinaryArithmeticOpType::DIV>(
-          _lhs, _rhs, _output, activation, op_params);
+          _lhs, _rhs, _output, activation, op_params, ruy_context);
       }
       else
       {
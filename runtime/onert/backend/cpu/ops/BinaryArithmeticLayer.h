@@ -19,6 +19,7 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 
 #include <exec/IFunction.h>
 
@@ -49,7 +50,8 @@ public:
 
 public:
   void configure(const IPortableTensor *lhs, const IPortableTensor *rhs, IPortableTensor *output,
-                 const ir::Activation activation, const ArithmeticType arithmetic_type);
+                 const ir::Activation activation, const ArithmeticType arithmetic_type,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void run() override;
 
@@ -59,6 +61,7 @@ protected:
   IPortableTensor *_output;
 
   std::function<void(const IPortableTensor *, const IPortableTensor *, IPortableTensor *)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
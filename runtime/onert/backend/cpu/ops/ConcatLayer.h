@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_CONCATLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_CONCATLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -41,7 +43,8 @@ public:
   void concatenationQuant8();
 
   void configure(const std::vector<const IPortableTensor *> &inputs, int32_t axis,
-                 IPortableTensor *output);
+                 IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void run() override;
 
@@ -49,6 +52,7 @@ private:
   std::vector<const IPortableTensor *> _inputs;
   IPortableTensor *_output;
   int32_t _axis;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
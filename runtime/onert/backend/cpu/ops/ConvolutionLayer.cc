@@ -20,6 +20,7 @@
 
 #include "../Tensor.h"
 #include "ir/Padding.h"
+#include "ir/WeightStore.h"
 #include <cker/operation/Conv.h>
 
 namespace onert
@@ -153,6 +154,38 @@ void ConvolutionLayer::convQ8i()
          reinterpret_cast<int8_t *>(_output->buffer()));
 }
 
+void ConvolutionLayer::convQ16i()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::ConvParams op_params;
+  op_params.stride_height = _strideHeight;
+  op_params.stride_width = _strideWidth;
+  op_params.dilation_height_factor = _dilationHeightFactor;
+  op_params.dilation_width_factor = _dilationWidthFactor;
+  op_params.padding_values.height = _paddingTop;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  nnfw::cker::Conv &kernel = *_conv_kernel;
+  if (_bias && _bias->data_type() == OperandType::INT32)
+  {
+    kernel(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel),
+           getBuffer<int8_t>(_kernel), getShape(_bias), getBuffer<int32_t>(_bias),
+           getShape(_output), getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    kernel(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel),
+           getBuffer<int8_t>(_kernel), getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr,
+           getShape(_output), getBuffer<int16_t>(_output));
+  }
+}
+
 void ConvolutionLayer::convQ8iHybridPerChannel()
 {
   float output_activation_min = 0;
@@ -275,6 +308,10 @@ void ConvolutionLayer::run()
   {
     convQ8i();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    convQ16i();
+  }
   else
   {
     throw std::runtime_error{"Conv: unsupported data type"};
@@ -310,9 +347,33 @@ void ConvolutionLayer::prepare()
   nnfw::cker::Conv &kernel = *_conv_kernel;
   if (_input->data_type() == OperandType::FLOAT32 && _is_cachable_weights)
   {
+    // Transposed filter is shared with other sessions loading the same model
+    std::string weight_key;
+    if (auto kernel_tensor = dynamic_cast<const ExternalTensor *>(_kernel))
+      weight_key = ir::WeightStore::get().keyOf(kernel_tensor->data().get());
+
+    const auto filter_shape = getShape(_kernel);
+    std::string packing_kind = "cpu.conv.hwcn";
+    for (int i = 0; i < filter_shape.DimensionsCount(); ++i)
+      packing_kind += "." + std::to_string(filter_shape.Dims(i));
+
     bool is_transposed = false;
-    kernel.prepareF32(getShape(_kernel), getBuffer<float>(_kernel), getPaddingType(_paddingType),
-                      is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+    const auto shared_filter =
+      weight_key.empty() ? nullptr
+                         : ir::WeightStore::get().findPacked<std::vector<float>>(weight_key, packing_kind);
+    if (shared_filter)
+    {
+      kernel.prepareF32(shared_filter, getPaddingType(_paddingType), is_transposed,
+                        _dilationWidthFactor, _dilationHeightFactor);
+    }
+    else
+    {
+      kernel.prepareF32(filter_shape, getBuffer<float>(_kernel), getPaddingType(_paddingType),
+                        is_transposed, _dilationWidthFactor, _dilationHeightFactor);
+      if (is_transposed && !weight_key.empty())
+        ir::WeightStore::get().insertPacked(weight_key, packing_kind,
+                                            kernel.shareTransposedFilter());
+    }
 
     // Decrease reference of _kernel(weights) only when _kernel is constant
     if (is_transposed)
@@ -355,6 +416,20 @@ void ConvolutionLayer::prepare()
       throw std::runtime_error{"Conv2D: Int8 dynamic weight is not supported"};
     }
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    if (_is_cachable_weights && !_input->is_dynamic() && !_output->is_dynamic())
+    {
+      GetQuantizedConvolutionMultipliersAndShifts(
+        _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+        _kernel->data_scales().size(), getShape(_kernel).Dims(0),
+        kernel.per_channel_output_multiplier(), kernel.per_channel_output_shift());
+    }
+    else
+    {
+      throw std::runtime_error{"Conv2D: Int16 dynamic weight is not supported"};
+    }
+  }
   _prepare = true;
 }
 
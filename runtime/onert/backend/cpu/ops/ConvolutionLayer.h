@@ -66,6 +66,7 @@ private:
   void convQ8uPerChannel();
   void convQ8i();
   void convQ8iHybridPerChannel();
+  void convQ16i();
 
 protected:
   const IPortableTensor *_input;
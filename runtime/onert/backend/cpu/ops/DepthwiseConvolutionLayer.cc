@@ -198,6 +198,47 @@ void DepthwiseConvolutionLayer::convQ8i()
     _external_context->ruy_context());
 }
 
+void DepthwiseConvolutionLayer::convQ16i()
+{
+  if (!_prepared)
+  {
+    prepareQ8i();
+    _prepared = true;
+  }
+
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::DepthwiseConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.depth_multiplier = _multiplier;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.dilation_width_factor = _dilationWidth;
+  op_params.dilation_height_factor = _dilationHeight;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  if (_bias && _bias->data_type() == OperandType::INT32)
+  {
+    nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+      getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output), getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    nnfw::cker::reference_integer_ops::DepthwiseConvPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_kernel), getBuffer<int8_t>(_kernel),
+      getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+      getBuffer<int16_t>(_output));
+  }
+}
+
 void DepthwiseConvolutionLayer::convQ8iHybridPerChannel()
 {
   if (!_prepared)
@@ -319,7 +360,8 @@ void DepthwiseConvolutionLayer::configure(
   {
     prepareF32();
   }
-  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM ||
+           isQuantInt16(_input->data_type()))
   {
     if (_kernel->is_constant() && !_input->is_dynamic() && !_output->is_dynamic())
     {
@@ -361,6 +403,10 @@ void DepthwiseConvolutionLayer::run()
   {
     convQ8i();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    convQ16i();
+  }
   else
   {
     throw std::runtime_error{"DepthwiseConv: unsupported data type"};
@@ -46,6 +46,7 @@ public:
 
   void convQ8i();
   void convQ8iHybridPerChannel();
+  void convQ16i();
 
   void configure(const IPortableTensor *input, const IPortableTensor *kernel,
                  const IPortableTensor *bias, const uint32_t paddingLeft,
@@ -89,9 +90,10 @@ protected:
   std::unique_ptr<Tensor> _padded_filter{nullptr};
   std::unique_ptr<Tensor> _filter_buffers{nullptr};
 
-private:
   std::shared_ptr<ExternalContext> _external_context;
 
+private:
+
   bool _prepared{false};
 
   // Per channel output multiplier and shift.
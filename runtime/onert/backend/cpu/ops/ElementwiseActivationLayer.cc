@@ -18,6 +18,7 @@
 
 #include "OperationUtils.h"
 
+#include <cker/CpuBackendThreadpool.h>
 #include <cker/operation/ELU.h>
 #include <cker/operation/LeakyReLU.h>
 #include <cker/operation/Logistic.h>
@@ -34,6 +35,33 @@ namespace cpu
 namespace ops
 {
 
+namespace
+{
+
+// How many elements are needed to make it worth using one more thread, for kernels bound by
+// memory and for those computing a transcendental function of each element
+constexpr int64_t kMinElementsPerThreadMemoryBound = 1 << 14;    // 16k
+constexpr int64_t kMinElementsPerThreadTranscendental = 1 << 12; // 4k
+
+// Runs kernel(shape, input_data, output_data) on ranges of elements, which are split over threads
+// of ruy_context if it is given and tensors are large enough
+template <typename T, typename Kernel>
+void evalElementwise(const IPortableTensor *input, IPortableTensor *output,
+                     int64_t min_elements_per_thread, ruy::Context *ruy_context,
+                     const Kernel &kernel)
+{
+  const int size = MatchingFlatSize(getShape(input), getShape(output));
+  const T *input_data = getBuffer<T>(input);
+  T *output_data = getBuffer<T>(output);
+  nnfw::cker::cpu_backend_threadpool::ParallelFor(
+    size, 1, min_elements_per_thread, ruy_context, [&](int start, int end) {
+      const nnfw::cker::Shape shape{end - start};
+      kernel(shape, input_data + start, output_data + start);
+    });
+}
+
+} // namespace
+
 ElementwiseActivationLayer::ElementwiseActivationLayer()
   : _input(nullptr), _output(nullptr), _kernel()
 {
@@ -86,19 +114,24 @@ void ElementwiseActivationLayer::EvalUsingLookupTable(const IPortableTensor *inp
 
 void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortableTensor *output,
                                            float alpha, float beta,
-                                           ElementwiseActivationType op_type)
+                                           ElementwiseActivationType op_type,
+                                           const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
+  _external_context = external_context;
+  auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
 
   switch (op_type)
   {
     case ElementwiseActivationType::kElu:
       if (input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::ELU(getShape(input), getBuffer<float>(input), getShape(output),
-                          getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<float>(input, output, kMinElementsPerThreadTranscendental, ruy_context,
+                                 [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                   nnfw::cker::ELU(shape, in, shape, out);
+                                 });
         };
       }
       else
@@ -115,9 +148,23 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::Logistic(getShape(input), getBuffer<float>(input), getShape(output),
-                               getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<float>(input, output, kMinElementsPerThreadTranscendental, ruy_context,
+                                 [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                   nnfw::cker::Logistic(shape, in, shape, out);
+                                 });
+        };
+      }
+      else if (isQuantInt16(_input->data_type()))
+      {
+        nnfw::cker::PopulateLogisticInt16LookupTable(_input->data_scale(), _output->data_scale(),
+                                                     _int16_table);
+        _kernel = [this, ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<int16_t>(
+            input, output, kMinElementsPerThreadMemoryBound, ruy_context,
+            [this](const nnfw::cker::Shape &shape, const int16_t *in, int16_t *out) {
+              nnfw::cker::Logistic(_int16_table, shape, in, shape, out);
+            });
         };
       }
       else
@@ -130,16 +177,20 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       {
         if (alpha == std::numeric_limits<float>::infinity() && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-            nnfw::cker::ReLU(getShape(input), getBuffer<float>(input), getShape(output),
-                             getBuffer<float>(output));
+          _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+            evalElementwise<float>(input, output, kMinElementsPerThreadMemoryBound, ruy_context,
+                                   [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                     nnfw::cker::ReLU(shape, in, shape, out);
+                                   });
           };
         }
         else if (alpha == 6.f && beta == 0.f)
         {
-          _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-            nnfw::cker::ReLU6(getShape(input), getBuffer<float>(input), getShape(output),
-                              getBuffer<float>(output));
+          _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+            evalElementwise<float>(input, output, kMinElementsPerThreadMemoryBound, ruy_context,
+                                   [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                     nnfw::cker::ReLU6(shape, in, shape, out);
+                                   });
           };
         }
         else
@@ -162,9 +213,23 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
       }
       else if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::Tanh(getShape(input), getBuffer<float>(input), getShape(output),
-                           getBuffer<float>(output));
+        _kernel = [ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<float>(input, output, kMinElementsPerThreadTranscendental, ruy_context,
+                                 [](const nnfw::cker::Shape &shape, const float *in, float *out) {
+                                   nnfw::cker::Tanh(shape, in, shape, out);
+                                 });
+        };
+      }
+      else if (isQuantInt16(_input->data_type()))
+      {
+        nnfw::cker::PopulateTanhInt16LookupTable(_input->data_scale(), _output->data_scale(),
+                                                 _int16_table);
+        _kernel = [this, ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<int16_t>(
+            input, output, kMinElementsPerThreadMemoryBound, ruy_context,
+            [this](const nnfw::cker::Shape &shape, const int16_t *in, int16_t *out) {
+              nnfw::cker::Tanh(_int16_table, shape, in, shape, out);
+            });
         };
       }
       else
@@ -175,10 +240,12 @@ void ElementwiseActivationLayer::configure(const IPortableTensor *input, IPortab
     case ElementwiseActivationType::kLeakyReLU:
       if (_input->data_type() == OperandType::FLOAT32)
       {
-        _kernel = [alpha](const IPortableTensor *input, IPortableTensor *output) {
-          nnfw::cker::LeakyReLU(nnfw::cker::LeakyReluParams{alpha}, getShape(input),
-                                getBuffer<float>(input), getShape(output),
-                                getBuffer<float>(output));
+        _kernel = [alpha, ruy_context](const IPortableTensor *input, IPortableTensor *output) {
+          evalElementwise<float>(
+            input, output, kMinElementsPerThreadMemoryBound, ruy_context,
+            [alpha](const nnfw::cker::Shape &shape, const float *in, float *out) {
+              nnfw::cker::LeakyReLU(nnfw::cker::LeakyReluParams{alpha}, shape, in, shape, out);
+            });
         };
       }
       else
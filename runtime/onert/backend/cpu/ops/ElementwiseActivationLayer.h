@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_ElementwiseActivationLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -46,7 +48,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, IPortableTensor *output, float alpha, float beta,
-                 const ElementwiseActivationType op_type);
+                 const ElementwiseActivationType op_type,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void run() override;
 
@@ -58,7 +61,9 @@ protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
   uint8_t _table[256];
+  int16_t _int16_table[513];
   std::function<void(const IPortableTensor *input, IPortableTensor *output)> _kernel;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
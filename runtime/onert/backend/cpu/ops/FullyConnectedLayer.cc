@@ -89,6 +89,34 @@ void FullyConnectedLayer::fullyConnectedQuant8()
                              getBuffer<uint8_t>(_output));
 }
 
+void FullyConnectedLayer::fullyConnectedQuant16()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(_activation, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::FullyConnectedParams op_params;
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  if (_bias && _bias->data_type() == OperandType::INT32)
+  {
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+      getShape(_bias), getBuffer<int32_t>(_bias), getShape(_output), getBuffer<int16_t>(_output));
+  }
+  else
+  {
+    nnfw::cker::FullyConnectedPerChannel(
+      op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+      getShape(_input), getBuffer<int16_t>(_input), getShape(_weights), getBuffer<int8_t>(_weights),
+      getShape(_bias), _bias ? getBuffer<int64_t>(_bias) : nullptr, getShape(_output),
+      getBuffer<int16_t>(_output));
+  }
+}
+
 void FullyConnectedLayer::fullyConnectedHybrid()
 {
   nnfw::cker::FCTempArena &temp_arena = *_temp_arena;
@@ -171,7 +199,8 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
     nnfw::cker::FullyConnectedSparseWeight16x1(
       op_params, getShape(_input), getBuffer<float>(_input), getShape(_weights),
       getBuffer<float>(_weights), getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
-      getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices);
+      getShape(_output), getBuffer<float>(_output), w1_segments, w1_indices,
+      _external_context->ruy_context());
   }
   else
     throw std::runtime_error{"FullyConnected: unsupported sparsity"};
@@ -179,20 +208,14 @@ void FullyConnectedLayer::fullyConnectedSparseWeight()
 
 void FullyConnectedLayer::fullyConnected16x1Float32()
 {
-#if defined(__aarch64__) && defined(USE_NEON)
-  float output_activation_min = 0, output_activation_max = 0;
-  CalculateActivationRange(_activation, &output_activation_min, &output_activation_max);
-
   nnfw::cker::FullyConnectedParams op_params;
   op_params.activation = convertActivationType(_activation);
 
   nnfw::cker::FullyConnected16x1Float32(op_params, getShape(_input), getBuffer<float>(_input),
                                         getShape(_weights), getBuffer<float>(_weights),
                                         getShape(_bias), _bias ? getBuffer<float>(_bias) : nullptr,
-                                        getShape(_output), getBuffer<float>(_output));
-#else
-  throw std::runtime_error{"FullyConnected: Shuffled16x1Float32 weights_format is not supported."};
-#endif
+                                        getShape(_output), getBuffer<float>(_output),
+                                        _external_context->ruy_context());
 }
 
 void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortableTensor *weights,
@@ -209,13 +232,6 @@ void FullyConnectedLayer::configure(const IPortableTensor *input, const IPortabl
   _is_hybrid = input->data_type() == OperandType::FLOAT32 &&
                weights->data_type() == OperandType::QUANT_INT8_SYMM;
   _is_shuffled16x1float32 = weights_format == ir::FullyConnectedWeightsFormat::Shuffled16x1Float32;
-#if !defined(__aarch64__) || !defined(USE_NEON)
-  if (_is_shuffled16x1float32)
-  {
-    throw std::runtime_error{
-      "FullyConnected: Shuffled16x1Float32 weights_format is not supported."};
-  }
-#endif
   _external_context = external_context;
 }
 
@@ -237,6 +253,10 @@ void FullyConnectedLayer::run()
   {
     fullyConnectedQuant8();
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    fullyConnectedQuant16();
+  }
   else
   {
     throw std::runtime_error{"FullyConnected: unsupported data type"};
@@ -245,7 +265,8 @@ void FullyConnectedLayer::run()
 
 void FullyConnectedLayer::prepare()
 {
-  if (_bias && _bias->is_constant())
+  // NOTE int64 bias of int16 FullyConnected cannot be checked as float vector
+  if (_bias && _bias->is_constant() && _bias->data_type() != OperandType::INT64)
   {
     const int bias_size = getShape(_bias).FlatSize();
     if (nnfw::cker::IsZeroVector(getBuffer<float>(_bias), bias_size))
@@ -254,6 +275,18 @@ void FullyConnectedLayer::prepare()
     }
   }
 
+  if (isQuantInt16(_input->data_type()))
+  {
+    if (!_weights->is_constant() || _input->is_dynamic() || _output->is_dynamic())
+      throw std::runtime_error{"FullyConnected: Int16 dynamic weight is not supported"};
+
+    GetQuantizedConvolutionMultipliersAndShifts(
+      _input->data_scale(), _output->data_scale(), _weights->data_scales().data(),
+      _weights->data_scales().size(), getShape(_weights).Dims(0), _per_channel_output_multiplier,
+      _per_channel_output_shift);
+    return;
+  }
+
 #if (defined(__ARM_NEON__) || defined(__ARM_NEON)) && defined(USE_RUY_GEMV)
   // TODO This is workaround
   // The only fc hybrid will use ruy kernel
@@ -51,6 +51,8 @@ public:
 
   void fullyConnectedQuant8();
 
+  void fullyConnectedQuant16();
+
   void fullyConnectedHybrid();
 
   void fullyConnectedSparseWeight();
@@ -80,6 +82,10 @@ protected:
   bool _is_hybrid : 1;
   bool _is_shuffled16x1float32 : 1;
 
+  // Per-channel requantization of int16 activations, prepared once in prepare()
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
 #ifdef USE_RUY_GEMV
   uint8_t *_cached_weights = nullptr; // weights to be cached and a key
   bool _is_weights_freed = false;     // is weights freed?
@@ -30,12 +30,14 @@ namespace ops
 {
 
 void GatherLayer::configure(const IPortableTensor *input, const IPortableTensor *indices,
-                            IPortableTensor *output, int32_t axis)
+                            IPortableTensor *output, int32_t axis,
+                            const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _indices = indices;
   _axis = axis;
   _output = output;
+  _external_context = external_context;
 }
 
 template <typename InputType> void GatherLayer::runByInputType()
@@ -43,6 +45,7 @@ template <typename InputType> void GatherLayer::runByInputType()
   using OutputType = InputType;
   nnfw::cker::GatherParams op_params;
   op_params.axis = _axis;
+  auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
 
   switch (_indices->data_type())
   {
@@ -52,7 +55,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        ruy_context);
       break;
     }
     case OperandType::INT64:
@@ -61,7 +65,8 @@ template <typename InputType> void GatherLayer::runByInputType()
 
       nnfw::cker::Gather<InputType, IndicesType>(
         op_params, getShape(_input), getBuffer<InputType>(_input), getShape(_indices),
-        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output));
+        getBuffer<IndicesType>(_indices), getShape(_output), getBuffer<OutputType>(_output),
+        ruy_context);
       break;
     }
     default:
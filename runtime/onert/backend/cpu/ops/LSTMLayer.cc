@@ -21,6 +21,9 @@
 
 #include <cker/operation/LSTM.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace onert
 {
 namespace backend
@@ -58,8 +61,44 @@ inline void initializeStateBuffer(const onert::backend::IPortableTensor *tensor_
   else
     memset(buffer, 0, tensor_in->total_size());
 }
+
+inline const float *getOptionalInputBuffer(const onert::backend::IPortableTensor *tensor)
+{
+  // If tensor is not given or the tensor size is 0, consider it was not given
+  return (tensor && tensor->total_size() > 0) ? getBuffer<float>(tensor) : nullptr;
+}
 } // namespace
 
+void LSTMLayer::stackInputWeights()
+{
+  const int n_cell = _input_to_output_weights->getShape().dim(0);
+  const int n_input = _input_to_output_weights->getShape().dim(1);
+  const bool use_cifg = (_input_to_input_weights == nullptr);
+  const int num_gates = use_cifg ? 3 : 4;
+
+  _stacked_input_weights.resize(num_gates * n_cell * n_input);
+  nnfw::cker::LstmStackGatesFloat(
+    {getOptionalInputBuffer(_input_to_input_weights), getBuffer<float>(_input_to_forget_weights),
+     getBuffer<float>(_input_to_cell_weights), getBuffer<float>(_input_to_output_weights)},
+    n_cell * n_input, _stacked_input_weights.data());
+
+  // Bias of gate with layer norm is added after normalization, not to input projection
+  const IPortableTensor *biases[] = {_input_gate_bias, _forget_gate_bias, _cell_gate_bias,
+                                     _output_gate_bias};
+  const IPortableTensor *layer_norms[] = {
+    _input_layer_norm_coefficients, _forget_layer_norm_coefficients,
+    _cell_layer_norm_coefficients, _output_layer_norm_coefficients};
+  _stacked_gate_bias.resize(num_gates * n_cell);
+  for (int gate = use_cifg ? 1 : 0, i = 0; gate < 4; ++gate, ++i)
+  {
+    float *bias = _stacked_gate_bias.data() + i * n_cell;
+    if (getOptionalInputBuffer(layer_norms[gate]) != nullptr)
+      std::fill_n(bias, n_cell, 0.0f);
+    else
+      std::copy_n(getBuffer<float>(biases[gate]), n_cell, bias);
+  }
+}
+
 void LSTMLayer::LSTMFloat()
 {
   auto in_shape = _input->getShape();
@@ -86,14 +125,35 @@ void LSTMLayer::LSTMFloat()
   // check the existence of only one to the get the condition.
   const bool use_cifg = (_input_to_input_weights == nullptr);
 
-  // Optional outputs
-  float *output_state_buf = getOptionalOutputBuffer<float>(_output_state, &_output_state_vec,
-                                                           _output_state_in->total_size());
-  float *cell_state_buf =
-    getOptionalOutputBuffer<float>(_cell_state, &_cell_state_vec, _cell_state_in->total_size());
+  float *output_state_buf = nullptr;
+  float *cell_state_buf = nullptr;
+  if (_keep_states)
+  {
+    // States continue from the last run until they are reset
+    const auto generation = _variable_states->generation();
+    const size_t output_state_size = _output_state_in->getShape().num_elements();
+    const size_t cell_state_size = _cell_state_in->getShape().num_elements();
+    if (generation != _states_generation || _kept_output_state.size() != output_state_size ||
+        _kept_cell_state.size() != cell_state_size)
+    {
+      _kept_output_state.assign(output_state_size, 0.0f);
+      _kept_cell_state.assign(cell_state_size, 0.0f);
+      _states_generation = generation;
+    }
+    output_state_buf = _kept_output_state.data();
+    cell_state_buf = _kept_cell_state.data();
+  }
+  else
+  {
+    // Optional outputs
+    output_state_buf = getOptionalOutputBuffer<float>(_output_state, &_output_state_vec,
+                                                      _output_state_in->total_size());
+    cell_state_buf =
+      getOptionalOutputBuffer<float>(_cell_state, &_cell_state_vec, _cell_state_in->total_size());
 
-  initializeStateBuffer(_output_state_in, output_state_buf, _has_output_state_data);
-  initializeStateBuffer(_cell_state_in, cell_state_buf, _has_cell_state_data);
+    initializeStateBuffer(_output_state_in, output_state_buf, _has_output_state_data);
+    initializeStateBuffer(_cell_state_in, cell_state_buf, _has_cell_state_data);
+  }
 
   // Index the scratch buffers pointers to the global scratch buffer.
   float *scratch_buffer_buf = getOptionalOutputBuffer<float>(
@@ -116,27 +176,24 @@ void LSTMLayer::LSTMFloat()
     output_gate_scratch = scratch_buffer_buf + 3 * n_cell * n_batch;
   }
 
-  auto optional_tensor_ptr = [](const IPortableTensor *tensor) {
-    // If tensor is not given or the tensor size is 0, consider it was not given
-    return (tensor && tensor->total_size() > 0) ? getBuffer<float>(tensor) : nullptr;
-  };
   // Optional inputs
-  const float *input_to_input_weights_ptr = optional_tensor_ptr(_input_to_input_weights);
-  const float *recurrent_to_input_weights_ptr = optional_tensor_ptr(_recurrent_to_input_weights);
-  const float *cell_to_input_weights_ptr = optional_tensor_ptr(_cell_to_input_weights);
-  const float *cell_to_forget_weights_ptr = optional_tensor_ptr(_cell_to_forget_weights);
-  const float *cell_to_output_weights_ptr = optional_tensor_ptr(_cell_to_output_weights);
-  const float *input_gate_bias_ptr = optional_tensor_ptr(_input_gate_bias);
-  const float *projection_weights_ptr = optional_tensor_ptr(_projection_weights);
-  const float *projection_bias_ptr = optional_tensor_ptr(_projection_bias);
+  const float *input_to_input_weights_ptr = getOptionalInputBuffer(_input_to_input_weights);
+  const float *recurrent_to_input_weights_ptr =
+    getOptionalInputBuffer(_recurrent_to_input_weights);
+  const float *cell_to_input_weights_ptr = getOptionalInputBuffer(_cell_to_input_weights);
+  const float *cell_to_forget_weights_ptr = getOptionalInputBuffer(_cell_to_forget_weights);
+  const float *cell_to_output_weights_ptr = getOptionalInputBuffer(_cell_to_output_weights);
+  const float *input_gate_bias_ptr = getOptionalInputBuffer(_input_gate_bias);
+  const float *projection_weights_ptr = getOptionalInputBuffer(_projection_weights);
+  const float *projection_bias_ptr = getOptionalInputBuffer(_projection_bias);
   const float *input_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_input_layer_norm_coefficients);
+    getOptionalInputBuffer(_input_layer_norm_coefficients);
   const float *forget_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_forget_layer_norm_coefficients);
+    getOptionalInputBuffer(_forget_layer_norm_coefficients);
   const float *cell_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_cell_layer_norm_coefficients);
+    getOptionalInputBuffer(_cell_layer_norm_coefficients);
   const float *output_layer_norm_coefficients_ptr =
-    optional_tensor_ptr(_output_layer_norm_coefficients);
+    getOptionalInputBuffer(_output_layer_norm_coefficients);
 
   // Copy out the LSTM specific params so they can be passed in the function.
   nnfw::cker::LSTMParams lstm_params;
@@ -144,6 +201,17 @@ void LSTMLayer::LSTMFloat()
   lstm_params.cell_clip = _params.cell_threshold;
   lstm_params.proj_clip = _params.projection_threshold;
 
+  // Input terms of gates do not depend on the recurrent state, so compute them for the whole
+  // sequence by one GEMM with stacked weights before the recurrent loop.
+  if (!_is_stacked_weights_constant)
+    stackInputWeights();
+  const int n_stacked = (use_cifg ? 3 : 4) * n_cell;
+  _input_projection.resize(static_cast<size_t>(max_time) * n_batch * n_stacked);
+  nnfw::cker::LstmInputProjectionFloat(
+    getBuffer<float>(_input), max_time * n_batch, n_input, _stacked_input_weights.data(),
+    _stacked_gate_bias.data(), n_stacked, _is_stacked_weights_constant, _input_projection.data(),
+    _external_context->ruy_context());
+
   auto out_shape = _output->getShape();
   const int output_batch_leading_dim = out_shape.dim(out_shape.rank() - 1);
   if (_time_major)
@@ -163,6 +231,7 @@ void LSTMLayer::LSTMFloat()
         aux_input_ptr = getBuffer<float>(_aux_input) + t_rel * input_step;
       }
       float *output_ptr = getBuffer<float>(_output) + t_rel * output_step + _output_offset;
+      const float *input_projection_ptr = _input_projection.data() + t_rel * n_batch * n_stacked;
 
       LstmStepFloat(
         input_ptr, input_to_input_weights_ptr, getBuffer<float>(_input_to_forget_weights),
@@ -182,7 +251,7 @@ void LSTMLayer::LSTMFloat()
         getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
         &lstm_params, n_batch, n_cell, n_input, aux_input_size, n_output, output_batch_leading_dim,
         output_state_buf, cell_state_buf, input_gate_scratch, forget_gate_scratch,
-        cell_gate_scratch, output_gate_scratch, output_ptr);
+        cell_gate_scratch, output_gate_scratch, output_ptr, input_projection_ptr);
     }
   }
   else
@@ -204,6 +273,7 @@ void LSTMLayer::LSTMFloat()
           aux_input_ptr = getBuffer<float>(_aux_input) + time_offset * input_step;
         }
         float *output_ptr = getBuffer<float>(_output) + time_offset * output_step + _output_offset;
+        const float *input_projection_ptr = _input_projection.data() + time_offset * n_stacked;
 
         // Offset the {output,cell}_state pointers to the right batch.
         float *output_state_ptr = output_state_buf + b * output_batch_leading_dim;
@@ -233,10 +303,19 @@ void LSTMLayer::LSTMFloat()
           getBuffer<float>(_output_gate_bias), projection_weights_ptr, projection_bias_ptr,
           &lstm_params, /*n_batch=*/1, n_cell, n_input, aux_input_size, n_output,
           output_batch_leading_dim, output_state_ptr, cell_state_ptr, input_gate_scratch_ptr,
-          forget_gate_scratch_ptr, cell_gate_scratch_ptr, output_gate_scratch_ptr, output_ptr);
+          forget_gate_scratch_ptr, cell_gate_scratch_ptr, output_gate_scratch_ptr, output_ptr,
+          input_projection_ptr);
       }
     }
   }
+
+  if (_keep_states)
+  {
+    if (_output_state)
+      memcpy(getBuffer<float>(_output_state), output_state_buf, _output_state->total_size());
+    if (_cell_state)
+      memcpy(getBuffer<float>(_cell_state), cell_state_buf, _cell_state->total_size());
+  }
 }
 
 void LSTMLayer::configure(
@@ -259,7 +338,9 @@ void LSTMLayer::configure(
   const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
   bool forward_sequence, bool time_major, int output_offset, IPortableTensor *scratch_buffer,
   IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-  bool has_output_state_data, bool has_cell_state_data)
+  bool has_output_state_data, bool has_cell_state_data,
+  const std::shared_ptr<ExternalContext> &external_context,
+  const std::shared_ptr<const exec::VariableStates> &variable_states)
 {
   _input = input;
   _input_to_input_weights = input_to_input_weights;
@@ -298,6 +379,29 @@ void LSTMLayer::configure(
   _output = output;
   _has_output_state_data = has_output_state_data;
   _has_cell_state_data = has_cell_state_data;
+  _external_context = external_context;
+  _variable_states = variable_states;
+  // Only states given as variable tensors are kept, others are given by user on each run
+  _keep_states = _variable_states && !_has_output_state_data && !_has_cell_state_data;
+}
+
+void LSTMLayer::prepare()
+{
+  if (_input->data_type() != OperandType::FLOAT32)
+    return;
+
+  auto is_constant = [](const IPortableTensor *tensor) {
+    return tensor == nullptr || tensor->is_constant();
+  };
+  // Stack constant weights once rather than on each run
+  if (is_constant(_input_to_input_weights) && is_constant(_input_to_forget_weights) &&
+      is_constant(_input_to_cell_weights) && is_constant(_input_to_output_weights) &&
+      is_constant(_input_gate_bias) && is_constant(_forget_gate_bias) &&
+      is_constant(_cell_gate_bias) && is_constant(_output_gate_bias))
+  {
+    stackInputWeights();
+    _is_stacked_weights_constant = true;
+  }
 }
 
 void LSTMLayer::run()
@@ -19,9 +19,14 @@
 
 #include <backend/IPortableTensor.h>
 #include "OperationUtils.h"
+#include "../ExternalContext.h"
 #include <ir/InternalType.h>
 #include <ir/operation/LSTM.h>
 #include <exec/IFunction.h>
+#include <exec/VariableStates.h>
+
+#include <memory>
+#include <vector>
 
 namespace nnfw
 {
@@ -72,10 +77,17 @@ public:
     const IPortableTensor *cell_state_in, const ir::operation::LSTM::Param &params,
     bool forward_sequence, bool time_major, int32_t output_offset, IPortableTensor *scratch_buffer,
     IPortableTensor *output_state, IPortableTensor *cell_state, IPortableTensor *output,
-    bool has_output_state_data, bool has_cell_state_data);
+    bool has_output_state_data, bool has_cell_state_data,
+    const std::shared_ptr<ExternalContext> &external_context,
+    const std::shared_ptr<const exec::VariableStates> &variable_states = nullptr);
 
   void run() override;
 
+  void prepare() override;
+
+private:
+  void stackInputWeights();
+
 private:
   const IPortableTensor *_input{nullptr};
   const IPortableTensor *_input_to_input_weights{nullptr};
@@ -119,6 +131,20 @@ private:
   int32_t _output_offset{0};
   bool _has_output_state_data{false};
   bool _has_cell_state_data{false};
+  std::shared_ptr<ExternalContext> _external_context;
+
+  // Streaming mode: states kept across runs until _variable_states is reset
+  std::shared_ptr<const exec::VariableStates> _variable_states;
+  bool _keep_states{false};
+  uint32_t _states_generation{0};
+  std::vector<float> _kept_output_state{};
+  std::vector<float> _kept_cell_state{};
+
+  // Input to gate weights and gate biases stacked for input projection of whole sequence
+  std::vector<float> _stacked_input_weights{};
+  std::vector<float> _stacked_gate_bias{};
+  bool _is_stacked_weights_constant{false};
+  std::vector<float> _input_projection{};
 };
 
 } // namespace ops
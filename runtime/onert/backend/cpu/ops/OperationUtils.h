@@ -141,6 +141,13 @@ inline int32_t getAxis(uint32_t rank, int32_t axis)
   return ret;
 }
 
+// int16 activations of A16W8 quantized models are loaded as either QUANT_INT16_ASYMM with zero
+// point 0 or QUANT_INT16_SYMM
+inline bool isQuantInt16(OperandType type)
+{
+  return type == OperandType::QUANT_INT16_ASYMM || type == OperandType::QUANT_INT16_SYMM;
+}
+
 void QuantizeMultiplier(double double_multiplier, int32_t *quantized_multiplier, int *shift);
 
 void GetQuantizedConvolutionMultiplier(const IPortableTensor *inputDescr,
@@ -134,6 +134,18 @@ void PoolLayer::configure(const IPortableTensor *input, const uint32_t paddingLe
       _kernel = generateKernelGeneric<int8_t>(op_params, op_type);
       break;
     }
+    case OperandType::QUANT_INT16_ASYMM:
+    case OperandType::QUANT_INT16_SYMM:
+    {
+      int32_t output_activation_min = 0;
+      int32_t output_activation_max = 0;
+      CalculateActivationRangeQuantized(activation, _output, &output_activation_min,
+                                        &output_activation_max);
+      op_params.quantized_activation_min = output_activation_min;
+      op_params.quantized_activation_max = output_activation_max;
+      _kernel = generateKernelGeneric<int16_t>(op_params, op_type);
+      break;
+    }
     default:
       throw std::runtime_error{"Pool: unsupported data type"};
   }
@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_REDUCESUMLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_REDUCESUMLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include "cker/neon/neon_check.h"
 
 #include <backend/IPortableTensor.h>
@@ -60,7 +62,8 @@ public:
 
 public:
   void configure(const IPortableTensor *input, const IPortableTensor *axes, IPortableTensor *output,
-                 ReduceType reduceType, bool keep_dims);
+                 ReduceType reduceType, bool keep_dims,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void run() override;
 
@@ -75,6 +78,7 @@ private:
     _kernel;
 
   ReduceType _reduceType;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
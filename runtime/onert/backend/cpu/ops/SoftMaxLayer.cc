@@ -36,27 +36,18 @@ SoftMaxLayer::SoftMaxLayer() : _input(nullptr), _output(nullptr), _beta(0.0)
 
 void SoftMaxLayer::softmaxFloat32()
 {
-  if (getNumberOfDimensions(_input) == 1)
+  const auto rank = getNumberOfDimensions(_input);
+  if (rank >= 1)
   {
-    uint32_t input_size = getNumberOfElements(_input);
-    nnfw::cker::Softmax(getBuffer<float>(_input), input_size, 1, _beta, getBuffer<float>(_output));
-  }
-  else if (getNumberOfDimensions(_input) == 2)
-  {
-    uint32_t batch_size = getSizeOfDimension(_input, 0);
-    if (batch_size == 0)
-      throw std::runtime_error("batch_size should not be 0");
+    // Softmax is applied along the innermost axis, so outer axes are flattened to batches
+    uint32_t input_size = getSizeOfDimension(_input, rank - 1);
+    if (input_size == 0)
+      throw std::runtime_error("input_size should not be 0");
 
-    uint32_t input_size = getNumberOfElements(_input) / batch_size;
+    uint32_t batch_size = getNumberOfElements(_input) / input_size;
+    auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
     nnfw::cker::Softmax(getBuffer<float>(_input), input_size, batch_size, _beta,
-                        getBuffer<float>(_output));
-  }
-  else if (getNumberOfDimensions(_input) == 4)
-  {
-    nnfw::cker::SoftmaxParams op_params;
-    op_params.beta = _beta;
-    nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<float>(_input), getShape(_output),
-                        getBuffer<float>(_output));
+                        getBuffer<float>(_output), ruy_context);
   }
   else
   {
@@ -85,12 +76,26 @@ template <typename T> void SoftMaxLayer::softmaxQuant8()
 #endif
 }
 
+void SoftMaxLayer::softmaxQuant16()
+{
+  nnfw::cker::SoftmaxParams op_params;
+  op_params.input_multiplier = _input_multiplier;
+  op_params.input_left_shift = _input_left_shift;
+  op_params.exp_lut = _exp_lut;
+  op_params.one_over_one_plus_x_lut = _one_over_one_plus_x_lut;
+
+  nnfw::cker::Softmax(op_params, getShape(_input), getBuffer<int16_t>(_input), getShape(_output),
+                      getBuffer<int16_t>(_output));
+}
+
 void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
-                             IPortableTensor *output)
+                             IPortableTensor *output,
+                             const std::shared_ptr<ExternalContext> &external_context)
 {
   _input = input;
   _output = output;
   _beta = beta;
+  _external_context = external_context;
 
   if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
       _input->data_type() == OperandType::QUANT_INT8_ASYMM)
@@ -104,6 +109,14 @@ void SoftMaxLayer::configure(const IPortableTensor *input, const float beta,
     nnfw::cker::PopulateSoftmaxLookupTable(_table, _input->data_scale(), _beta);
 #endif
   }
+  else if (isQuantInt16(_input->data_type()))
+  {
+    nnfw::cker::PopulateSoftmaxInt16LookupTables(_exp_lut, _one_over_one_plus_x_lut);
+    // Scale input differences so that [-65535, 0] corresponds to [-10.0, 0.0] of exp lookup table
+    const double input_scale_beta_rescale =
+      static_cast<double>(_input->data_scale()) * _beta / (10.0 / 65535.0);
+    QuantizeMultiplier(input_scale_beta_rescale, &_input_multiplier, &_input_left_shift);
+  }
 }
 
 void SoftMaxLayer::run()
@@ -119,6 +132,10 @@ void SoftMaxLayer::run()
     case OperandType::QUANT_INT8_ASYMM:
       softmaxQuant8<int8_t>();
       break;
+    case OperandType::QUANT_INT16_ASYMM:
+    case OperandType::QUANT_INT16_SYMM:
+      softmaxQuant16();
+      break;
     default:
       throw std::runtime_error{"SoftMax: unsupported data type"};
   }
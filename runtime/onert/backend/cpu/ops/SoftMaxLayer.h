@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 #define __ONERT_BACKEND_CPU_OPS_SOFTMAXLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 
 #include <exec/IFunction.h>
@@ -40,13 +42,17 @@ public:
 
   template <typename T> void softmaxQuant8();
 
-  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output);
+  void softmaxQuant16();
+
+  void configure(const IPortableTensor *input, const float beta, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void run() override;
 
 protected:
   const IPortableTensor *_input;
   IPortableTensor *_output;
+  std::shared_ptr<ExternalContext> _external_context;
 
 private:
   float _beta;
@@ -54,6 +60,11 @@ private:
   float _table[256];
   uint8_t _uint8_table1[256];
   uint8_t _uint8_table2[256];
+
+  int16_t _exp_lut[513];
+  int16_t _one_over_one_plus_x_lut[513];
+  int32_t _input_multiplier = 0;
+  int32_t _input_left_shift = 0;
 };
 
 } // namespace ops
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include "../Tensor.h"
+
+#include <cker/operation/TransposeConv.h>
+
+#include <algorithm>
+#include <type_traits>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+TransposeConvLayer::TransposeConvLayer()
+  : _input(nullptr), _kernel(nullptr), _output(nullptr), _paddingType(ir::PaddingType::EXPLICIT),
+    _paddingLeft(0), _paddingTop(0), _paddingRight(0), _paddingBottom(0), _strideWidth(0),
+    _strideHeight(0), _external_context(nullptr), _prepared(false)
+{
+  // DO NOTHING
+}
+
+TransposeConvLayer::~TransposeConvLayer() = default;
+
+void TransposeConvLayer::configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                                   ir::PaddingType paddingType, const uint32_t paddingLeft,
+                                   const uint32_t paddingRight, const uint32_t paddingTop,
+                                   const uint32_t paddingBottom, const uint32_t strideWidth,
+                                   const uint32_t strideHeight, IPortableTensor *output,
+                                   const std::shared_ptr<ExternalContext> &external_context)
+{
+  _input = input;
+  _kernel = kernel;
+  _paddingType = paddingType;
+  _paddingLeft = paddingLeft;
+  _paddingRight = paddingRight;
+  _paddingTop = paddingTop;
+  _paddingBottom = paddingBottom;
+  _strideWidth = strideWidth;
+  _strideHeight = strideHeight;
+  _output = output;
+  _external_context = external_context;
+}
+
+void TransposeConvLayer::prepareFilter()
+{
+  const auto kernel_shape = getShape(_kernel);
+  _hwoi_kernel.resize(_kernel->total_size());
+  if (_kernel->data_type() == OperandType::FLOAT32)
+  {
+    nnfw::cker::optimized::TransposeConvFilterToHWOI(
+      kernel_shape, getBuffer<float>(_kernel), reinterpret_cast<float *>(_hwoi_kernel.data()));
+  }
+  else
+  {
+    nnfw::cker::optimized::TransposeConvFilterToHWOI(kernel_shape, getBuffer<uint8_t>(_kernel),
+                                                     _hwoi_kernel.data());
+  }
+}
+
+void TransposeConvLayer::prepareQuant8()
+{
+  // int8 filter is quantized per channel and symmetric, so its zero points are all 0
+  if (_kernel->data_type() == OperandType::QUANT_INT8_SYMM ||
+      _kernel->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    const auto &zero_points = _kernel->data_zero_points();
+    if (std::any_of(zero_points.begin(), zero_points.end(), [](int32_t zp) { return zp != 0; }))
+      throw std::runtime_error{"TransposeConv: int8 filter must have zero points of 0"};
+  }
+
+  GetQuantizedConvolutionMultipliersAndShifts(
+    _input->data_scale(), _output->data_scale(), _kernel->data_scales().data(),
+    _kernel->data_scales().size(), getShape(_kernel).Dims(0), _per_channel_output_multiplier,
+    _per_channel_output_shift);
+}
+
+void TransposeConvLayer::transposeConvFloat32()
+{
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+
+  const auto input_shape = getShape(_input);
+  const auto kernel_shape = getShape(_kernel);
+  _col2im_float.resize(nnfw::cker::optimized::TransposeConvCol2imSize(input_shape, kernel_shape));
+
+  nnfw::cker::optimized::TransposeConv(
+    op_params, input_shape, getBuffer<float>(_input), kernel_shape,
+    reinterpret_cast<const float *>(_hwoi_kernel.data()), getShape(_output),
+    getBuffer<float>(_output), _col2im_float.data(), _kernel->is_constant(),
+    _external_context->ruy_context());
+}
+
+template <typename T> void TransposeConvLayer::transposeConvQuant8()
+{
+  int32_t output_activation_min = 0;
+  int32_t output_activation_max = 0;
+  CalculateActivationRangeQuantized(ir::Activation::NONE, _output, &output_activation_min,
+                                    &output_activation_max);
+
+  nnfw::cker::TransposeConvParams op_params;
+  op_params.padding_values.width = _paddingLeft;
+  op_params.padding_values.height = _paddingTop;
+  op_params.stride_width = _strideWidth;
+  op_params.stride_height = _strideHeight;
+  op_params.input_offset = -_input->data_zero_point();
+  // Filter of uint8 has a zero point per tensor, and filter of int8 is symmetric per channel
+  op_params.weights_offset = std::is_same<T, uint8_t>::value ? -_kernel->data_zero_point() : 0;
+  op_params.output_offset = _output->data_zero_point();
+  op_params.quantized_activation_min = output_activation_min;
+  op_params.quantized_activation_max = output_activation_max;
+
+  const auto input_shape = getShape(_input);
+  const auto kernel_shape = getShape(_kernel);
+  const auto output_shape = getShape(_output);
+  _col2im_int32.resize(nnfw::cker::optimized::TransposeConvCol2imSize(input_shape, kernel_shape));
+  _scratch_int32.resize(output_shape.FlatSize() / output_shape.Dims(0));
+
+  nnfw::cker::optimized::TransposeConv(
+    op_params, _per_channel_output_multiplier.data(), _per_channel_output_shift.data(),
+    input_shape, getBuffer<T>(_input), kernel_shape,
+    reinterpret_cast<const T *>(_hwoi_kernel.data()), output_shape, getBuffer<T>(_output),
+    _col2im_int32.data(), _scratch_int32.data(), _kernel->is_constant(),
+    _external_context->ruy_context());
+}
+
+void TransposeConvLayer::run()
+{
+  prepare();
+  if (_input->is_dynamic() || _output->is_dynamic())
+  {
+    const auto ifm_shape = _input->getShape().asFeature();
+    const auto ofm_shape = _output->getShape().asFeature();
+    // Kernel format is [depth_out, kernel_height, kernel_width, depth_in].
+    const auto ker_shape = _kernel->getShape();
+    const auto ker_height = ker_shape.dim(1);
+    const auto ker_width = ker_shape.dim(2);
+
+    ir::Stride stride;
+    stride.vertical = _strideHeight;
+    stride.horizontal = _strideWidth;
+
+    ir::Padding param_padding;
+    param_padding.type = _paddingType;
+    param_padding.param.left = _paddingLeft;
+    param_padding.param.right = _paddingRight;
+    param_padding.param.top = _paddingTop;
+    param_padding.param.bottom = _paddingBottom;
+
+    // NOTE The padding calculation formula of TransposeConv is opposite to Conv.
+    //      So the location of ifm and ofm is changed.
+    const auto padding =
+      ir::calculatePadding(param_padding, ofm_shape, ifm_shape, stride, ker_width, ker_height);
+
+    _paddingLeft = padding.left;
+    _paddingRight = padding.right;
+    _paddingTop = padding.top;
+    _paddingBottom = padding.bottom;
+  }
+
+  // Non-constant kernel is reordered on every run
+  if (!_kernel->is_constant())
+    prepareFilter();
+
+  if (_input->data_type() == OperandType::FLOAT32)
+  {
+    transposeConvFloat32();
+  }
+  else if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM)
+  {
+    transposeConvQuant8<uint8_t>();
+  }
+  else if (_input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    transposeConvQuant8<int8_t>();
+  }
+  else
+  {
+    throw std::runtime_error{"TransposeConv: unsupported data type"};
+  }
+}
+
+void TransposeConvLayer::prepare()
+{
+  if (_prepared)
+    return;
+
+  if (_input->data_type() == OperandType::QUANT_UINT8_ASYMM ||
+      _input->data_type() == OperandType::QUANT_INT8_ASYMM)
+  {
+    prepareQuant8();
+  }
+
+  if (_kernel->is_constant())
+  {
+    prepareFilter();
+
+    // Decrease reference of _kernel(weights) because it is not used after reordering
+    auto kernel_tensor = dynamic_cast<const Tensor *>(_kernel);
+    if (kernel_tensor)
+      // TODO Remove const_cast
+      const_cast<Tensor *>(kernel_tensor)->decrease_ref();
+  }
+  _prepared = true;
+}
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
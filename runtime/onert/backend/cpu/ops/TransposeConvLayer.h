@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_CPU_OPS_TRANSPOSE_CONV_LAYER_H__
+#define __ONERT_BACKEND_CPU_OPS_TRANSPOSE_CONV_LAYER_H__
+
+#include "../ExternalContext.h"
+#include "OperationUtils.h"
+
+#include <backend/IPortableTensor.h>
+#include <exec/IFunction.h>
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace cpu
+{
+namespace ops
+{
+
+class TransposeConvLayer : public ::onert::exec::IFunction
+{
+public:
+  TransposeConvLayer();
+  ~TransposeConvLayer();
+
+public:
+  void configure(const IPortableTensor *input, const IPortableTensor *kernel,
+                 ir::PaddingType paddingType, const uint32_t paddingLeft,
+                 const uint32_t paddingRight, const uint32_t paddingTop,
+                 const uint32_t paddingBottom, const uint32_t strideWidth,
+                 const uint32_t strideHeight, IPortableTensor *output,
+                 const std::shared_ptr<ExternalContext> &external_context);
+  void prepare() override;
+  void run() override;
+
+private:
+  void prepareFilter();
+  void prepareQuant8();
+  void transposeConvFloat32();
+  template <typename T> void transposeConvQuant8();
+
+private:
+  const IPortableTensor *_input;
+  const IPortableTensor *_kernel;
+  IPortableTensor *_output;
+
+  ir::PaddingType _paddingType;
+  uint32_t _paddingLeft;
+  uint32_t _paddingTop;
+  uint32_t _paddingRight;
+  uint32_t _paddingBottom;
+
+  uint32_t _strideWidth;
+  uint32_t _strideHeight;
+
+  std::shared_ptr<ExternalContext> _external_context;
+
+  // Kernel reordered to [kernel_height, kernel_width, depth_out, depth_in] for GEMM
+  std::vector<uint8_t> _hwoi_kernel;
+  std::vector<float> _col2im_float;
+  std::vector<int32_t> _col2im_int32;
+  std::vector<int32_t> _scratch_int32;
+  std::vector<int32_t> _per_channel_output_multiplier;
+  std::vector<int> _per_channel_output_shift;
+
+  bool _prepared;
+};
+
+} // namespace ops
+} // namespace cpu
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_CPU_OPS_TRANSPOSE_CONV_LAYER_H__
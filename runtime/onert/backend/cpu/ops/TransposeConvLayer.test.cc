@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TransposeConvLayer.h"
+
+#include <gtest/gtest.h>
+
+#include <cassert>
+#include <memory>
+#include <vector>
+
+namespace
+{
+
+using namespace onert;
+using namespace onert::backend;
+using namespace onert::ir;
+
+template <typename T> class MockUpTensor : public IPortableTensor
+{
+public:
+  MockUpTensor(const Shape &shape, const TypeInfo &type_info, const std::vector<T> &data,
+               bool is_const = false)
+    : IPortableTensor{OperandInfo{shape, type_info, MemAllocType::STATIC, is_const}}, _data{data}
+  {
+    assert(static_cast<uint64_t>(shape.num_elements()) == data.size());
+  }
+
+  uint8_t *buffer() const override
+  {
+    return reinterpret_cast<uint8_t *>(const_cast<T *>(_data.data()));
+  }
+
+  const std::vector<T> &data() const { return _data; }
+
+private:
+  std::vector<T> _data;
+};
+
+TypeInfo quantInfo(DataType type, std::vector<float> scales, std::vector<int32_t> zero_points)
+{
+  TypeInfo info{type};
+  info.quantization(std::move(scales), std::move(zero_points));
+  return info;
+}
+
+// Transpose convolution of dequantized values with VALID padding
+std::vector<float> referenceTransposeConv(const std::vector<float> &input, const Shape &in_shape,
+                                          const std::vector<float> &filter, const Shape &f_shape,
+                                          const Shape &out_shape, int stride)
+{
+  std::vector<float> output(out_shape.num_elements(), 0.f);
+  const auto out_depth = f_shape.dim(0);
+  const auto in_depth = f_shape.dim(3);
+  for (int32_t iy = 0; iy < in_shape.dim(1); ++iy)
+    for (int32_t ix = 0; ix < in_shape.dim(2); ++ix)
+      for (int32_t ky = 0; ky < f_shape.dim(1); ++ky)
+        for (int32_t kx = 0; kx < f_shape.dim(2); ++kx)
+          for (int32_t oc = 0; oc < out_depth; ++oc)
+            for (int32_t ic = 0; ic < in_depth; ++ic)
+            {
+              const auto oy = iy * stride + ky;
+              const auto ox = ix * stride + kx;
+              output[(oy * out_shape.dim(2) + ox) * out_depth + oc] +=
+                input[(iy * in_shape.dim(2) + ix) * in_depth + ic] *
+                filter[((oc * f_shape.dim(1) + ky) * f_shape.dim(2) + kx) * in_depth + ic];
+            }
+  return output;
+}
+
+template <typename T>
+std::vector<float> dequantize(const std::vector<T> &data, const TypeInfo &info, int32_t axis_size)
+{
+  std::vector<float> ret(data.size());
+  const auto &scales = info.scales();
+  const auto &zero_points = info.zero_points();
+  const auto channel_size = data.size() / axis_size;
+  for (size_t i = 0; i < data.size(); ++i)
+  {
+    const auto c = scales.size() == 1 ? 0 : i / channel_size;
+    ret[i] = scales[c] * (static_cast<int32_t>(data[i]) - zero_points[c]);
+  }
+  return ret;
+}
+
+template <typename T>
+void runQuantTransposeConv(const TypeInfo &in_info, const std::vector<T> &input,
+                           const TypeInfo &f_info, const std::vector<T> &filter,
+                           const TypeInfo &out_info)
+{
+  const Shape in_shape{1, 2, 2, 2};
+  const Shape f_shape{2, 2, 2, 2};
+  const Shape out_shape{1, 4, 4, 2};
+  constexpr int stride = 2;
+
+  MockUpTensor<T> in_tensor{in_shape, in_info, input};
+  MockUpTensor<T> f_tensor{f_shape, f_info, filter, true};
+  MockUpTensor<T> out_tensor{out_shape, out_info, std::vector<T>(out_shape.num_elements())};
+  auto external_context = std::make_shared<cpu::ExternalContext>();
+
+  cpu::ops::TransposeConvLayer layer;
+  layer.configure(&in_tensor, &f_tensor, PaddingType::VALID, 0, 0, 0, 0, stride, stride,
+                  &out_tensor, external_context);
+  layer.prepare();
+  layer.run();
+
+  const auto expected =
+    referenceTransposeConv(dequantize(input, in_info, 1), in_shape,
+                           dequantize(filter, f_info, f_shape.dim(0)), f_shape, out_shape, stride);
+  const auto output = dequantize(out_tensor.data(), out_info, 1);
+  for (size_t i = 0; i < expected.size(); ++i)
+  {
+    // Rounding of requantization differs within a quantum of output
+    EXPECT_NEAR(output[i], expected[i], out_info.scale()) << "at " << i;
+  }
+}
+
+} // namespace
+
+TEST(CPUBackendTransposeConvLayer, int8_per_channel)
+{
+  const auto in_info = quantInfo(DataType::QUANT_INT8_ASYMM, {0.5f}, {-1});
+  const auto f_info = quantInfo(DataType::QUANT_INT8_ASYMM, {0.25f, 0.5f}, {0, 0});
+  const auto out_info = quantInfo(DataType::QUANT_INT8_ASYMM, {0.25f}, {3});
+  const std::vector<int8_t> input{-1, 3, 5, -7, 2, 0, -4, 6};
+  const std::vector<int8_t> filter{1, -2, 3, 4, -5, 6, 7, -8, 2, 1, -1, -3, 4, 0, -2, 1};
+
+  runQuantTransposeConv<int8_t>(in_info, input, f_info, filter, out_info);
+}
+
+TEST(CPUBackendTransposeConvLayer, uint8_per_tensor)
+{
+  const auto in_info = quantInfo(DataType::QUANT_UINT8_ASYMM, {0.5f}, {127});
+  const auto f_info = quantInfo(DataType::QUANT_UINT8_ASYMM, {0.25f}, {128});
+  const auto out_info = quantInfo(DataType::QUANT_UINT8_ASYMM, {0.25f}, {130});
+  const std::vector<uint8_t> input{126, 130, 132, 120, 129, 127, 123, 133};
+  const std::vector<uint8_t> filter{129, 126, 131, 132, 123, 134, 135, 120,
+                                    130, 129, 127, 125, 132, 128, 126, 129};
+
+  runQuantTransposeConv<uint8_t>(in_info, input, f_info, filter, out_info);
+}
+
+TEST(CPUBackendTransposeConvLayer, neg_int8_asymmetric_filter)
+{
+  const Shape in_shape{1, 2, 2, 1};
+  const Shape f_shape{2, 2, 2, 1};
+  const Shape out_shape{1, 4, 4, 2};
+  MockUpTensor<int8_t> in_tensor{in_shape, quantInfo(DataType::QUANT_INT8_ASYMM, {0.5f}, {0}),
+                                 std::vector<int8_t>(4)};
+  MockUpTensor<int8_t> f_tensor{
+    f_shape, quantInfo(DataType::QUANT_INT8_ASYMM, {0.25f, 0.5f}, {0, 1}), std::vector<int8_t>(8),
+    true};
+  MockUpTensor<int8_t> out_tensor{out_shape, quantInfo(DataType::QUANT_INT8_ASYMM, {0.25f}, {0}),
+                                  std::vector<int8_t>(32)};
+
+  cpu::ops::TransposeConvLayer layer;
+  layer.configure(&in_tensor, &f_tensor, PaddingType::VALID, 0, 0, 0, 0, 2, 2, &out_tensor,
+                  std::make_shared<cpu::ExternalContext>());
+  EXPECT_ANY_THROW(layer.prepare());
+}
@@ -39,8 +39,22 @@ public:
                  std::shared_ptr<TensorBuilder> tensor_builder = nullptr,
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::BackendContext(backend, std::move(data), tensor_registry),
-      tensor_builder{tensor_builder}, kernel_gen{kernel_gen}, _external_context(new ExternalContext)
+      tensor_builder{tensor_builder}, kernel_gen{kernel_gen}
   {
+    // Ruy context is shared by backend contexts of the model, and its thread pool is bounded by
+    // threads granted to the model
+    const auto &thread_quota = _data.thread_quota;
+    if (thread_quota == nullptr)
+    {
+      _external_context = std::make_shared<ExternalContext>();
+      return;
+    }
+    _external_context = thread_quota->getOrCreate<ExternalContext>([&]() {
+      auto external_context = std::make_shared<ExternalContext>();
+      if (thread_quota->numThreads() > 0)
+        external_context->setMaxNumThreads(thread_quota->numThreads());
+      return external_context;
+    });
   }
 
   ITensorRegistry *genTensors() override;
@@ -59,9 +73,7 @@ public:
   std::shared_ptr<KernelGenerator> kernel_gen;
 
 private:
-  // NOTE ruy context has a thread pool, and when multiple ruy contexts are created,
-  //      the thread pool is also created in duplicate
-  // TODO Create one ruy context for session
+  // NOTE ruy context has a thread pool, so it is shared in the model not to duplicate the pool
   std::shared_ptr<ExternalContext> _external_context;
 };
 
@@ -60,7 +60,8 @@ public:
                                                            std::move(optimizer));
 
     context->kernel_gen = std::make_shared<train::KernelGenerator>(
-      tgraph, tr, context->external_context(), context->optimizer());
+      tgraph, tr, context->external_context(), context->optimizer(),
+      context->data()->gradient_accumulation_steps, context->data()->multi_tensor_update);
     return context;
   }
 
@@ -196,7 +196,8 @@ void BackendContext::planForwardTensors()
   });
 
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_plan.get()};
   tensor_planner.planTrainableTensors(_tensor_builder.get());
   tensor_planner.planNonConstTensors(_tensor_builder.get());
 }
@@ -219,6 +220,11 @@ void BackendContext::planBackwardTensors()
     const auto &operand = tgraph.operands().at(operand_index.index());
     tensor_builder->registerBackwardTensorInfo(operand_index.index(),
                                                createBackwardTensorInfo(operand));
+
+    // Gradients of trainable tensors are summed over micro-batches before being applied
+    if (operand.isConstant() && _tdata->gradient_accumulation_steps > 1)
+      tensor_builder->registerAccumulatedGradientTensorInfo(operand_index.index(),
+                                                            createBackwardTensorInfo(operand));
   }
 
   const auto disposable_indices = getDisposableBackPropTensorList(tgraph, external_operands());
@@ -231,10 +237,12 @@ void BackendContext::planBackwardTensors()
 
   // Plan tensors only in backwarding to reduce peak memory usage
   const auto ctx_data = data();
-  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands};
-  tensor_planner.planGradientTensors(tensor_builder.get());
+  TensorPlanner tensor_planner{*ctx_data->tgraph.get(), ctx_data->external_operands,
+                               ctx_data->recompute_plan.get()};
+  tensor_planner.planGradientTensors(tensor_builder.get(), ctx_data->multi_tensor_update);
   tensor_planner.planBackPropTensors(tensor_builder.get());
   tensor_planner.planDisposableBackPropTensors(tensor_builder.get());
+  tensor_planner.planAccumulatedGradientTensors(tensor_builder.get());
 }
 
 FunctionMap BackendContext::generateFunctionMap()
@@ -57,9 +57,22 @@ public:
                  std::unique_ptr<exec::train::optimizer::Optimizer> optimizer = nullptr,
                  std::shared_ptr<KernelGenerator> kernel_gen = nullptr)
     : onert::backend::train::TrainableBackendContext(backend, std::move(tdata), tensor_registry),
-      kernel_gen{kernel_gen}, _external_context(new ExternalContext),
-      _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}
+      kernel_gen{kernel_gen}, _tensor_builder{tensor_builder}, _optimizer{std::move(optimizer)}
   {
+    // Ruy context is shared by backend contexts of the model, and its thread pool is bounded by
+    // threads granted to the model
+    const auto &thread_quota = _tdata->thread_quota;
+    if (thread_quota == nullptr)
+    {
+      _external_context = std::make_shared<ExternalContext>();
+      return;
+    }
+    _external_context = thread_quota->getOrCreate<ExternalContext>([&]() {
+      auto external_context = std::make_shared<ExternalContext>();
+      if (thread_quota->numThreads() > 0)
+        external_context->setMaxNumThreads(thread_quota->numThreads());
+      return external_context;
+    });
   }
   BackendContext(const BackendContext &) = delete;
   ~BackendContext() = default;
@@ -87,9 +100,7 @@ public:
   std::shared_ptr<KernelGenerator> kernel_gen;
 
 private:
-  // NOTE ruy context has a thread pool, and when multiple ruy contexts are created,
-  //      the thread pool is also created in duplicate
-  // TODO Create one ruy context for session
+  // NOTE ruy context has a thread pool, so it is shared in the model not to duplicate the pool
   std::shared_ptr<ExternalContext> _external_context;
 
 private:
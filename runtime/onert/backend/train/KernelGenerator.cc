@@ -100,14 +100,6 @@ void appendBackPropAccumulators(const ir::train::ITrainableOperation &op,
   }
 }
 
-std::unique_ptr<ops::GradientApplier>
-generateGradientApplier(const exec::train::optimizer::Optimizer *optimizer,
-                        const IPortableTensor *gradient, ITrainableTensor *trainable)
-{
-  auto update_fn = std::make_unique<ops::GradientApplier>();
-  update_fn->configure(optimizer, gradient, trainable);
-  return update_fn;
-}
 } // namespace
 
 std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::OperationIndex idx)
@@ -127,9 +119,7 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
   assert(_return_fn);
   ret->append(std::move(_return_fn));
 
-  for (auto &&update_fn : _update_funcs)
-    ret->append(std::move(update_fn));
-  _update_funcs.clear();
+  appendGradientAppliers(op, ret.get());
 
   for (auto &&ind : (op.getInputs() | ir::Remove::UNDEFINED) + op.getOutputs())
   {
@@ -145,10 +135,18 @@ std::unique_ptr<exec::train::TrainableFnSequence> KernelGenerator::generate(ir::
 KernelGenerator::KernelGenerator(const ir::train::TrainableGraph &tgraph,
                                  const std::shared_ptr<TensorRegistry> &tensor_reg,
                                  const std::shared_ptr<ExternalContext> &external_context,
-                                 const exec::train::optimizer::Optimizer *optimizer)
+                                 const exec::train::optimizer::Optimizer *optimizer,
+                                 uint32_t gradient_accumulation_steps,
+                                 bool multi_tensor_update)
   : backend::train::KernelGeneratorBase{tgraph}, _tensor_reg{tensor_reg},
-    _external_context(external_context), _optimizer{optimizer}, _update_funcs{}, _node_to_idx{}
+    _external_context(external_context), _optimizer{optimizer},
+    _gradient_accumulation_steps{gradient_accumulation_steps}, _update_indices{},
+    _multi_tensor_applier{nullptr}, _node_to_idx{}
 {
+  if (multi_tensor_update)
+    _multi_tensor_applier =
+      std::make_shared<ops::MultiTensorApplier>(_optimizer, _gradient_accumulation_steps);
+
   tgraph.operations().iterate(
     [&](const onert::ir::OperationIndex &idx, const onert::ir::IOperation &op) {
       assert(_node_to_idx.find(&op) == _node_to_idx.end());
@@ -173,7 +171,7 @@ void KernelGenerator::visit(const ir::train::operation::BinaryArithmetic &node)
 
   auto fn = std::make_unique<ops::BinaryArithmeticLayer>();
   fn->configure(lhs_tensor, rhs_tensor, output_tensor, activation,
-                static_cast<cpu::ops::ArithmeticType>(arithmetic_type));
+                static_cast<cpu::ops::ArithmeticType>(arithmetic_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -236,13 +234,12 @@ void KernelGenerator::visit(const ir::train::operation::Conv2D &node)
     auto in_back_prop_tensor = getBackPropIn(node, in_index);
 
     fn->configureBackward(ker_tensor, in_back_prop_tensor, ker_grad_tensor, bias_grad_tensor,
-                          out_back_prop_tensor, activation);
+                          out_back_prop_tensor, activation, _external_context);
 
-    // Generate GradientApplier
+    // Trainable tensors to be updated by GradientAppliers
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      _update_indices.emplace_back(bias_index);
+    _update_indices.emplace_back(ker_index);
   }
 
   _return_fn = std::move(fn);
@@ -294,11 +291,10 @@ void KernelGenerator::visit(const ir::train::operation::DepthwiseConv2D &node)
     fn->configureBackward(ifm_back_prop_tensor, ker_grad_tensor, bias_grad_tensor,
                           ofm_back_prop_tensor, activation);
 
-    // Generate GradientApplier
+    // Trainable tensors to be updated by GradientAppliers
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(generateGradientApplier(_optimizer, ker_grad_tensor, ker_tensor));
+      _update_indices.emplace_back(bias_index);
+    _update_indices.emplace_back(ker_index);
   }
 
   _return_fn = std::move(fn);
@@ -327,7 +323,7 @@ void KernelGenerator::visit(const ir::train::operation::ElementwiseActivation &n
   };
 
   fn->configure(input_tensor, output_tensor, node.param().alpha, node.param().beta,
-                convertToInferActivationType(node.param().op_type));
+                convertToInferActivationType(node.param().op_type), _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -376,12 +372,10 @@ void KernelGenerator::visit(const ir::train::operation::FullyConnected &node)
                           weights_grad_tensor, bias_grad_tensor, out_back_prop_tensor, activation,
                           weights_format);
 
-    // Generate GradientAppliers
+    // Trainable tensors to be updated by GradientAppliers
     if (bias_tensor)
-      _update_funcs.emplace_back(
-        generateGradientApplier(_optimizer, bias_grad_tensor, bias_tensor));
-    _update_funcs.emplace_back(
-      generateGradientApplier(_optimizer, weights_grad_tensor, weights_tensor));
+      _update_indices.emplace_back(bias_index);
+    _update_indices.emplace_back(weights_index);
   }
 
   _return_fn = std::move(fn);
@@ -411,7 +405,8 @@ void KernelGenerator::visit(const ir::train::operation::Loss &node)
     case ir::train::LossCode::MeanSquaredError:
     {
       auto fn = std::make_unique<ops::LossMeanSquaredErrorLayer>();
-      fn->configure(y_pred_tensor, y_true_tensor, output_tensor, back_prop_y_pred_tensor);
+      fn->configure(y_pred_tensor, y_true_tensor, output_tensor, back_prop_y_pred_tensor,
+                    _external_context);
       _return_fn = std::move(fn);
       break;
     }
@@ -419,7 +414,7 @@ void KernelGenerator::visit(const ir::train::operation::Loss &node)
     {
       auto fn = std::make_unique<ops::LossCategoricalCrossentropyLayer>();
       fn->configure(y_pred_tensor, y_true_tensor, output_tensor, back_prop_y_pred_tensor,
-                    loss_param.cce.axis, loss_param.cce.label_smoothing);
+                    loss_param.cce.axis, loss_param.cce.label_smoothing, _external_context);
       _return_fn = std::move(fn);
       break;
     }
@@ -509,7 +504,7 @@ void KernelGenerator::visit(const ir::train::operation::Pool2D &node)
     auto in_back_prop_tensor = getBackPropIn(node, input_index);
     fn->configureBackward(padding.left, padding.right, padding.top, padding.bottom,
                           stride.horizontal, stride.vertical, kw, kh, activation, pool_type,
-                          out_tensor, in_back_prop_tensor, out_back_prop_tensor);
+                          out_tensor, in_back_prop_tensor, out_back_prop_tensor, _external_context);
   }
 
   _return_fn = std::move(fn);
@@ -592,7 +587,7 @@ void KernelGenerator::visit(const ir::train::operation::Softmax &node)
 
   auto fn = std::make_unique<ops::SoftMaxLayer>();
 
-  fn->configure(input_tensor, beta, output_tensor);
+  fn->configure(input_tensor, beta, output_tensor, _external_context);
 
   if (node.isRequiredForBackward())
   {
@@ -632,6 +627,42 @@ IPortableTensor *KernelGenerator::getBackPropOut(const ir::OperandIndex &output_
   return _tensor_reg->getBackPropTensor(output_index);
 }
 
+std::unique_ptr<exec::train::IGradientApplier>
+KernelGenerator::generateGradientApplier(const ir::OperandIndex &trainable_index)
+{
+  auto update_fn = std::make_unique<ops::GradientApplier>();
+  update_fn->configure(_optimizer, _tensor_reg->getGradientTensor(trainable_index),
+                       _tensor_reg->getTrainableTensor(trainable_index),
+                       _tensor_reg->getAccumulatedGradientTensor(trainable_index),
+                       _gradient_accumulation_steps);
+  return update_fn;
+}
+
+void KernelGenerator::appendGradientAppliers(const ir::train::ITrainableOperation &op,
+                                             exec::train::TrainableFnSequence *seq)
+{
+  if (!_multi_tensor_applier)
+  {
+    for (const auto &index : _update_indices)
+      seq->append(generateGradientApplier(index));
+  }
+  else if (op.isWeightsUpdateEnabled() && !_update_indices.empty())
+  {
+    // Tensors of operations not updating weights must not be updated with the others
+    std::vector<const IPortableTensor *> gradients;
+    std::vector<ITrainableTensor *> trainables;
+    std::vector<IPortableTensor *> accumulated_gradients;
+    for (const auto &index : _update_indices)
+    {
+      gradients.emplace_back(_tensor_reg->getGradientTensor(index));
+      trainables.emplace_back(_tensor_reg->getTrainableTensor(index));
+      accumulated_gradients.emplace_back(_tensor_reg->getAccumulatedGradientTensor(index));
+    }
+    seq->append(_multi_tensor_applier->append(gradients, trainables, accumulated_gradients));
+  }
+  _update_indices.clear();
+}
+
 } // namespace train
 } // namespace backend
 } // namespace onert
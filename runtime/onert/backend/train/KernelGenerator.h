@@ -21,6 +21,7 @@
 #include "backend/basic/TensorRegistry.h"
 #include "TensorBuilder.h"
 #include "Tensor.h"
+#include "ops/MultiTensorApplier.h"
 
 #include <backend/train/KernelGeneratorBase.h>
 #include <exec/train/IGradientApplier.h>
@@ -34,7 +35,6 @@ namespace backend
 {
 namespace train
 {
-
 // TODO Unify TensorRegistry
 class KernelGenerator : public backend::train::KernelGeneratorBase
 {
@@ -42,7 +42,8 @@ public:
   KernelGenerator(const ir::train::TrainableGraph &tgraph,
                   const std::shared_ptr<TensorRegistry> &tensor_reg,
                   const std::shared_ptr<ExternalContext> &external_context,
-                  const exec::train::optimizer::Optimizer *optimizer);
+                  const exec::train::optimizer::Optimizer *optimizer,
+                  uint32_t gradient_accumulation_steps = 1, bool multi_tensor_update = false);
 
   std::unique_ptr<exec::train::TrainableFnSequence> generate(ir::OperationIndex op_ind) override;
 
@@ -61,12 +62,21 @@ public:
 private:
   IPortableTensor *getBackPropIn(const ir::IOperation &node, const ir::OperandIndex &operand_index);
   IPortableTensor *getBackPropOut(const ir::OperandIndex &index);
+  std::unique_ptr<exec::train::IGradientApplier>
+  generateGradientApplier(const ir::OperandIndex &trainable_index);
+  void appendGradientAppliers(const ir::train::ITrainableOperation &op,
+                              exec::train::TrainableFnSequence *seq);
 
 private:
   std::shared_ptr<TensorRegistry> _tensor_reg;
   const std::shared_ptr<ExternalContext> _external_context;
   const exec::train::optimizer::Optimizer *_optimizer;
-  std::vector<std::unique_ptr<exec::train::IGradientApplier>> _update_funcs;
+  const uint32_t _gradient_accumulation_steps;
+  // Trainable tensors of the operation being generated
+  std::vector<ir::OperandIndex> _update_indices;
+  // Applier updating trainable tensors of all operations at once, nullptr to update them per
+  // operation
+  std::shared_ptr<ops::MultiTensorApplier> _multi_tensor_applier;
   std::unordered_map<const ir::IOperation *, ir::OperationIndex> _node_to_idx;
 };
 
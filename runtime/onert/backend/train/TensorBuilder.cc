@@ -95,6 +95,16 @@ void TensorBuilder::registerDisposableBackwardTensorInfo(const DisposableTensorI
   _disposable_backprops.add(index);
 }
 
+void TensorBuilder::registerAccumulatedGradientTensorInfo(const ir::OperandIndex &index,
+                                                          const ir::OperandInfo &info)
+{
+  assert(!info.isDynamic());
+  assert(_as_constants[index]);
+
+  auto tensor = std::make_unique<GradientTensor>(info);
+  _tensor_reg->setAccumulatedGradientTensor(index, std::move(tensor));
+}
+
 void TensorBuilder::notifyFirstUse(const ir::OperandIndex &index)
 {
   // TODO Support momory plan
@@ -155,6 +165,16 @@ void TensorBuilder::notifyDisposableBackPropLastUse(const DisposableTensorIndex
   _tensor_mgr->releaseDisposableBackPropPlan(index);
 }
 
+void TensorBuilder::notifyAccumulatedGradientFirstUse(const ir::OperandIndex &index)
+{
+  _tensor_mgr->claimAccumulatedGradientPlan(index);
+}
+
+void TensorBuilder::notifyAccumulatedGradientLastUse(const ir::OperandIndex &index)
+{
+  _tensor_mgr->releaseAccumulatedGradientPlan(index);
+}
+
 bool TensorBuilder::isRegistered(const ir::OperandIndex &index) const
 {
   return _tensor_info_map.find(index) != _tensor_info_map.end();
@@ -170,6 +190,11 @@ bool TensorBuilder::isRegisteredDisposableBackwardTensor(const DisposableTensorI
   return _disposable_backprops.contains(index);
 }
 
+bool TensorBuilder::isRegisteredAccumulatedGradient(const ir::OperandIndex &index) const
+{
+  return _tensor_reg->getAccumulatedGradientTensor(index) != nullptr;
+}
+
 void TensorBuilder::allocate(void)
 {
   _tensor_mgr->allocateNonConstTensors();
@@ -181,6 +206,7 @@ void TensorBuilder::allocateBackward(void)
   _tensor_mgr->allocateBackPropTensors();
   _tensor_mgr->allocateGradientTensors();
   _tensor_mgr->allocateDisposableBackPropTensors();
+  _tensor_mgr->allocateAccumulatedGradientTensors();
 }
 
 } // namespace train
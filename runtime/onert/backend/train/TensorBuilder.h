@@ -55,6 +55,14 @@ public:
   void registerDisposableBackwardTensorInfo(const DisposableTensorIndex &index,
                                             const ir::OperandInfo &info);
 
+  /**
+   * @brief     Register information of tensor to accumulate gradients over micro-batches
+   * @param[in] ind    Operand index of trainable tensor
+   * @param[in] info   Operand information
+   */
+  void registerAccumulatedGradientTensorInfo(const ir::OperandIndex &ind,
+                                             const ir::OperandInfo &info);
+
   // TODO Support memory plan of all tensors
   void notifyFirstUse(const ir::OperandIndex &);
   void notifyLastUse(const ir::OperandIndex &);
@@ -62,10 +70,13 @@ public:
   void notifyBackwardLastUse(const ir::OperandIndex &);
   void notifyDisposableBackPropFirstUse(const DisposableTensorIndex &);
   void notifyDisposableBackPropLastUse(const DisposableTensorIndex &);
+  void notifyAccumulatedGradientFirstUse(const ir::OperandIndex &);
+  void notifyAccumulatedGradientLastUse(const ir::OperandIndex &);
 
   bool isRegistered(const ir::OperandIndex &) const;
   bool isRegisteredBackward(const ir::OperandIndex &) const;
   bool isRegisteredDisposableBackwardTensor(const DisposableTensorIndex &index) const;
+  bool isRegisteredAccumulatedGradient(const ir::OperandIndex &index) const;
 
   void allocate(void);
   void allocateBackward(void);
@@ -58,7 +58,8 @@ TensorManager::TensorManager(const std::shared_ptr<TensorRegistry> &reg, uint32_
     _trainable_mgr{new TrainableMemoryManager(optim_vars_count)},
     _back_prop_mgr{new MemoryManager()}, _gradient_mgr{new MemoryManager()},
     // TODO Find a suitable planner of disposable tensors to reduce peak memory usage
-    _disposable_back_prop_mgr{new DisposableMemoryManager()}, _tensors{reg}
+    _disposable_back_prop_mgr{new DisposableMemoryManager()},
+    _accumulated_gradient_mgr{new MemoryManager()}, _tensors{reg}
 {
   // DO NOTHING
 }
@@ -106,6 +107,12 @@ void TensorManager::allocateDisposableBackPropTensors()
                  std::string{"DISPOSABLE BACK_PROP TENSOR "});
 }
 
+void TensorManager::allocateAccumulatedGradientTensors()
+{
+  allocateMemory(_accumulated_gradient_mgr.get(), _tensors->accumulated_gradient_tensors(),
+                 std::string{"ACCUMULATED GRADIENT TENSOR "});
+}
+
 void TensorManager::claimNonConstPlan(const ir::OperandIndex &index)
 {
   auto tensor = _tensors->getNonConstTensor(index);
@@ -187,6 +194,23 @@ void TensorManager::releaseDisposableBackPropPlan(const DisposableTensorIndex &i
   _disposable_back_prop_mgr->releasePlan(index);
 }
 
+void TensorManager::claimAccumulatedGradientPlan(const ir::OperandIndex &index)
+{
+  auto tensor = _tensors->getAccumulatedGradientTensor(index);
+  assert(tensor && !tensor->is_dynamic());
+
+  auto size = alignedSize(tensor->total_size(), _align);
+  _accumulated_gradient_mgr->claimPlan(index, size);
+}
+
+void TensorManager::releaseAccumulatedGradientPlan(const ir::OperandIndex &index)
+{
+  assert(_tensors->getAccumulatedGradientTensor(index) &&
+         !_tensors->getAccumulatedGradientTensor(index)->is_dynamic());
+
+  _accumulated_gradient_mgr->releasePlan(index);
+}
+
 } // namespace train
 } // namespace backend
 } // namespace onert
@@ -26,8 +26,9 @@ namespace train
 {
 
 TensorPlanner::TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                             const util::Set<ir::OperandIndex> &external_operands)
-  : _tgraph{tgraph}, _external_operands{external_operands}
+                             const util::Set<ir::OperandIndex> &external_operands,
+                             const compiler::train::RecomputePlan *recompute_plan)
+  : _tgraph{tgraph}, _external_operands{external_operands}, _recompute_plan{recompute_plan}
 {
   // DO NOTHING
   // TODO Remove the following lines
@@ -82,6 +83,78 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       operands_last_until_end.push_back(operand_index);
   }
 
+  // Activations to be recomputed are allocated only while their segment is forwarded again in
+  // backwarding. As they are also written in forwarding, the other activations alive while the
+  // segment is forwarded are kept until the segment is recomputed not to share memory with them.
+  const auto is_recomputed = [&](const ir::OperandIndex &index) {
+    return _recompute_plan != nullptr &&
+           _recompute_plan->recomputed.find(index) != _recompute_plan->recomputed.end() &&
+           !_external_operands.contains(index) && tensor_builder->isRegistered(index);
+  };
+  const auto num_segments = _recompute_plan ? _recompute_plan->segments.size() : 0;
+  std::vector<std::vector<ir::train::TrainingOperandIndex>> kept_by_segment(num_segments);
+  std::vector<bool> recomputed_segments(num_segments, false);
+  if (_recompute_plan)
+  {
+    for (const auto &[index, segments] : _recompute_plan->kept)
+    {
+      const auto operand_index = ir::train::TrainingOperandIndex{index, true};
+      if (!tensor_builder->isRegistered(index) || uses_map.find(operand_index) == uses_map.end())
+        continue;
+      // Operands looking unused last until the end anyway
+      if (uses_map[operand_index] == 0)
+        continue;
+
+      uses_map[operand_index] += segments.size();
+      for (const auto &segment : segments)
+        kept_by_segment[segment].push_back(operand_index);
+    }
+  }
+
+  const auto plan_recompute = [&](uint32_t segment) {
+    recomputed_segments[segment] = true;
+    for (const auto &op_index : _recompute_plan->segments[segment])
+    {
+      if (!_tgraph.operations().exist(op_index))
+        continue;
+
+      const auto &op = _tgraph.operations().at(op_index);
+      auto op_inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+      auto op_outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
+
+      for (const auto &output : op_outputs)
+      {
+        if (!is_recomputed(output))
+          continue;
+
+        const auto output_index = ir::train::TrainingOperandIndex{output, true};
+        assert(defs_map.at(output_index) == 1);
+        defs_map[output_index] = 0;
+        tensor_builder->notifyFirstUse(output);
+      }
+
+      for (const auto &input : op_inputs)
+      {
+        if (!is_recomputed(input))
+          continue;
+
+        const auto input_index = ir::train::TrainingOperandIndex{input, true};
+        assert(uses_map[input_index] > 0);
+        uses_map[input_index]--;
+        if (uses_map[input_index] == 0)
+          tensor_builder->notifyLastUse(input);
+      }
+    }
+
+    for (const auto &operand_index : kept_by_segment[segment])
+    {
+      assert(uses_map[operand_index] > 0);
+      uses_map[operand_index]--;
+      if (uses_map[operand_index] == 0)
+        tensor_builder->notifyLastUse(operand_index.index());
+    }
+  };
+
   // Plan used or defined tensors in forwarding nodes
   // At each operation,
   // 1. Scan DEF of outputs. If the DEF, allocate it
@@ -101,6 +174,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
         continue;
       if (!tensor_builder->isRegistered(output))
         continue;
+      if (is_recomputed(output))
+        continue;
 
       const auto output_index = ir::train::TrainingOperandIndex{output, true};
       assert(defs_map.find(output_index) != defs_map.end());
@@ -141,6 +216,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       const auto &operand = training_usedefs.at(input_index).operand();
       if (operand.isConstant())
         continue;
+      if (is_recomputed(input))
+        continue;
 
       assert(uses_map.find(input_index) != uses_map.end());
       assert(uses_map[input_index] > 0);
@@ -157,6 +234,14 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
   const auto border = _tgraph.essentialBackwardOrder();
   for (const auto &op_index : border)
   {
+    // The executor forwards the segment again right before the first backwarding of it
+    if (_recompute_plan)
+    {
+      const auto it = _recompute_plan->op_segments.find(op_index);
+      if (it != _recompute_plan->op_segments.end() && !recomputed_segments[it->second])
+        plan_recompute(it->second);
+    }
+
     const auto &op = _tgraph.operations().at(op_index);
     auto op_inputs = op.getInputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
     auto op_outputs = op.getOutputs() | ir::Remove::DUPLICATED | ir::Remove::UNDEFINED;
@@ -182,6 +267,8 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
       const auto &uses = operand_usedefs.getTrainingUses();
       if (uses.find(training_op_index) != uses.end())
       {
+        assert(!is_recomputed(index) ||
+               recomputed_segments[_recompute_plan->recomputed.at(index)]);
         assert(uses_map.find(operand_index) != uses_map.end());
         assert(uses_map[operand_index] > 0);
         uses_map[operand_index]--;
@@ -194,6 +281,13 @@ void TensorPlanner::planNonConstTensors(TensorBuilder *tensor_builder)
     }
   }
 
+  // Segments without backwarding of this backend have nothing to be used, but balance the plan
+  for (uint32_t segment = 0; segment < num_segments; ++segment)
+  {
+    if (!recomputed_segments[segment])
+      plan_recompute(segment);
+  }
+
   for (const auto &operand_index : operands_last_until_end)
   {
     tensor_builder->notifyLastUse(operand_index.index());
@@ -412,13 +506,14 @@ void TensorPlanner::planBackPropTensors(TensorBuilder *tensor_builder)
   VERBOSE(BackendContext) << "Finish planning back-propagated tensors" << std::endl;
 }
 
-void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
+void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder, bool keep_until_update)
 {
   VERBOSE(BackendContext) << "Start planning gradient tensors" << std::endl;
 
   // TODO Use DisposableTensor instead of GradientTensor to plan them together if possible
   //      Backward layers and the corresponding GradientApplier exist in the same back-propagated
   //      operation sequence. So we can use DisposableTensors to plan GradientTensors.
+  std::vector<ir::train::TrainingOperandIndex> kept_seq;
   for (const auto &op_index : _tgraph.essentialBackwardOrder())
   {
     std::vector<ir::train::TrainingOperandIndex> cur_seq;
@@ -447,12 +542,23 @@ void TensorPlanner::planGradientTensors(TensorBuilder *tensor_builder)
       }
     }
 
+    if (keep_until_update)
+    {
+      kept_seq.insert(kept_seq.end(), cur_seq.begin(), cur_seq.end());
+      continue;
+    }
+
     for (const auto &operand_index : cur_seq)
     {
       tensor_builder->notifyBackwardLastUse(operand_index.index());
     }
   }
 
+  for (const auto &operand_index : kept_seq)
+  {
+    tensor_builder->notifyBackwardLastUse(operand_index.index());
+  }
+
   VERBOSE(BackendContext) << "Finish planning gradient tensors" << std::endl;
 }
 
@@ -490,6 +596,30 @@ void TensorPlanner::planDisposableBackPropTensors(TensorBuilder *tensor_builder)
   VERBOSE(BackendContext) << "Finish planning disposable back-prop tensors" << std::endl;
 }
 
+void TensorPlanner::planAccumulatedGradientTensors(TensorBuilder *tensor_builder)
+{
+  VERBOSE(BackendContext) << "Start planning accumulated gradient tensors" << std::endl;
+
+  // Accumulated gradients are kept over training steps like trainable tensors
+  std::vector<ir::OperandIndex> accumulated;
+  _tgraph.operands().iterate([&](const ir::OperandIndex &index, const ir::Operand &) {
+    if (_external_operands.contains(index))
+      return;
+    if (!tensor_builder->isRegisteredAccumulatedGradient(index))
+      return;
+
+    tensor_builder->notifyAccumulatedGradientFirstUse(index);
+    accumulated.emplace_back(index);
+  });
+
+  for (const auto &index : accumulated)
+  {
+    tensor_builder->notifyAccumulatedGradientLastUse(index);
+  }
+
+  VERBOSE(BackendContext) << "Finish planning accumulated gradient tensors" << std::endl;
+}
+
 ir::OperandIndexSequence TensorPlanner::getOutgoingBackPropSeq(const ir::OperationIndex &op_index,
                                                                const TensorBuilder *tensor_builder)
 {
@@ -19,6 +19,7 @@
 
 #include "TensorBuilder.h"
 
+#include <compiler/train/RecomputePlan.h>
 #include <ir/train/TrainableGraph.h>
 #include <util/Set.h>
 
@@ -33,7 +34,8 @@ class TensorPlanner
 {
 public:
   TensorPlanner(const ir::train::TrainableGraph &tgraph,
-                const util::Set<ir::OperandIndex> &external_operands);
+                const util::Set<ir::OperandIndex> &external_operands,
+                const compiler::train::RecomputePlan *recompute_plan = nullptr);
   TensorPlanner(const TensorPlanner &) = delete;
   TensorPlanner(TensorPlanner &&) = delete;
   TensorPlanner &operator=(const TensorPlanner &) = delete;
@@ -43,8 +45,13 @@ public:
   void planNonConstTensors(TensorBuilder *tensor_builder);
   void planTrainableTensors(TensorBuilder *tensor_builder);
   void planBackPropTensors(TensorBuilder *tensor_builder);
-  void planGradientTensors(TensorBuilder *tensor_builder);
+  /**
+   * @param keep_until_update Keep all gradient tensors until the end of backwarding, e.g. to
+   *                          update trainable tensors of all operations at once
+   */
+  void planGradientTensors(TensorBuilder *tensor_builder, bool keep_until_update = false);
   void planDisposableBackPropTensors(TensorBuilder *tensor_builder);
+  void planAccumulatedGradientTensors(TensorBuilder *tensor_builder);
 
 private:
   ir::OperandIndexSequence getOutgoingBackPropSeq(const ir::OperationIndex &op_index,
@@ -53,6 +60,7 @@ private:
 private:
   const ir::train::TrainableGraph &_tgraph;
   const util::Set<ir::OperandIndex> &_external_operands;
+  const compiler::train::RecomputePlan *_recompute_plan;
 };
 
 } // namespace train
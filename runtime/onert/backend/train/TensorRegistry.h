@@ -60,9 +60,37 @@ public:
     return _disposable_back_prop;
   }
 
+  GradientTensor *getAccumulatedGradientTensor(const ir::OperandIndex &index)
+  {
+    auto itr = _accumulated_gradient.find(index);
+    if (itr != _accumulated_gradient.end())
+      return itr->second.get();
+
+    return nullptr;
+  }
+
+  void setAccumulatedGradientTensor(const ir::OperandIndex &index,
+                                    std::unique_ptr<GradientTensor> tensor)
+  {
+    assert(tensor != nullptr);
+    auto itr = _accumulated_gradient.find(index);
+    if (itr != _accumulated_gradient.end())
+      throw std::runtime_error{"Tried to set an accumulated gradient tensor but another "
+                               "accumulated gradient tensor already exists."};
+
+    _accumulated_gradient[index] = std::move(tensor);
+  }
+
+  const ir::OperandIndexMap<std::unique_ptr<GradientTensor>> &accumulated_gradient_tensors()
+  {
+    return _accumulated_gradient;
+  }
+
 private:
   // Disposable Tensors to be accumulated to BackPropTensor
   std::unordered_map<DisposableTensorIndex, std::unique_ptr<BackPropTensor>> _disposable_back_prop;
+  // Gradients summed over micro-batches until they are applied
+  ir::OperandIndexMap<std::unique_ptr<GradientTensor>> _accumulated_gradient;
 };
 
 } // namespace train
@@ -69,12 +69,14 @@ void ConvolutionLayer::configureBackward(const IPortableTensor *weights,
                                          IPortableTensor *back_prop_input,
                                          IPortableTensor *grad_weights, IPortableTensor *grad_bias,
                                          const IPortableTensor *back_prop_output,
-                                         const ir::Activation activation)
+                                         const ir::Activation activation,
+                                         const std::shared_ptr<ExternalContext> &external_context)
 {
   _back_prop_input = back_prop_input;
   _grad_weights = grad_weights;
   _grad_bias = grad_bias;
   _back_prop_output = back_prop_output;
+  _external_context = external_context;
 
   if (_dilationHeightFactor != 1 || _dilationWidthFactor != 1)
     throw std::runtime_error("train ConvolutionLayer: Unsupported dilation yet");
@@ -124,8 +126,9 @@ void ConvolutionLayer::backwardFloat32()
   const IPortableTensor *backprop_act;
   try
   {
-    backprop_act =
-      backpropActivation(_activation, _output, _back_prop_output, _act_back_prop_output.get());
+    auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+    backprop_act = backpropActivation(_activation, _output, _back_prop_output,
+                                      _act_back_prop_output.get(), ruy_context);
   }
   catch (const std::exception &e)
   {
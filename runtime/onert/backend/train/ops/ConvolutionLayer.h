@@ -19,6 +19,7 @@
 
 #include <ops/ConvolutionLayer.h>
 
+#include "../ExternalContext.h"
 #include "../Tensor.h"
 #include <exec/train/ITrainableFunction.h>
 
@@ -40,7 +41,8 @@ public:
 
   void configureBackward(const IPortableTensor *weights, IPortableTensor *back_prop_input,
                          IPortableTensor *grad_weights, IPortableTensor *grad_bias,
-                         const IPortableTensor *back_prop_output, const ir::Activation activation);
+                         const IPortableTensor *back_prop_output, const ir::Activation activation,
+                         const std::shared_ptr<ExternalContext> &external_context = nullptr);
   void forward(bool training) override;
   void backward() override;
 
@@ -58,6 +60,8 @@ private:
   std::unique_ptr<BackPropTensor> _conv_back_prop_output;
   std::unique_ptr<BackPropTensor> _act_back_prop_output;
   std::unique_ptr<GradientTensor> _transposed_grad_weights;
+
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
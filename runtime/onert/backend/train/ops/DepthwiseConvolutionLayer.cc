@@ -116,8 +116,9 @@ void DepthwiseConvolutionLayer::backwardFloat32()
   const IPortableTensor *backprop_act;
   try
   {
-    backprop_act =
-      backpropActivation(_activation, _output, _back_prop_output, _act_back_prop_output.get());
+    auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+    backprop_act = backpropActivation(_activation, _output, _back_prop_output,
+                                      _act_back_prop_output.get(), ruy_context);
   }
   catch (const std::exception &e)
   {
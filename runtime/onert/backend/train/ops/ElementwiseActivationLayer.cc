@@ -66,11 +66,13 @@ void ElementwiseActivationLayer::configureBackward(const IPortableTensor *input,
               throw std::runtime_error{"no supported relu kernel"};
           }();
 
-          _backward_kernel = [relu_cker](const IPortableTensor *output,
-                                         const IPortableTensor *incoming,
-                                         IPortableTensor *outgoing) {
+          auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+          _backward_kernel = [relu_cker, ruy_context](const IPortableTensor *output,
+                                                      const IPortableTensor *incoming,
+                                                      IPortableTensor *outgoing) {
             relu_cker(getShape(output), getBuffer<float>(output), getShape(incoming),
-                      getBuffer<float>(incoming), getShape(outgoing), getBuffer<float>(outgoing));
+                      getBuffer<float>(incoming), getShape(outgoing), getBuffer<float>(outgoing),
+                      ruy_context);
           };
         }
         else
@@ -18,30 +18,7 @@
 
 #include "OperationUtils.h"
 
-#include <cker/operation/FullyConnected.h>
-#include <cker/operation/Transpose.h>
 #include <cker/train/operation/FullyConnected.h>
-#include <cker/train/operation/ReLU.h>
-
-namespace
-{
-
-using namespace onert;
-
-std::unique_ptr<backend::train::Tensor>
-createTransposedTensor(const backend::IPortableTensor *origin_tensor)
-{
-  const auto &origin_shape = origin_tensor->getShape();
-  assert(origin_shape.rank() == 2);
-
-  auto transposed_info = origin_tensor->get_info();
-  auto transposed_shape = ir::Shape{origin_shape.dim(1), origin_shape.dim(0)};
-  transposed_info.shape(transposed_shape);
-
-  return std::make_unique<backend::train::Tensor>(transposed_info);
-}
-
-} // namespace
 
 namespace onert
 {
@@ -54,9 +31,7 @@ namespace ops
 
 FullyConnectedLayer::FullyConnectedLayer()
   : cpu::ops::FullyConnectedLayer{}, _grad_weights{nullptr}, _grad_bias{nullptr},
-    _back_prop_input{nullptr}, _back_prop_output{nullptr}, _transposed_weights{nullptr},
-    _transposed_input{nullptr}, _transposed_back_prop_output{nullptr},
-    _act_back_prop_output{nullptr}
+    _back_prop_input{nullptr}, _back_prop_output{nullptr}, _act_back_prop_output{nullptr}
 {
   // DO NOTHING
 }
@@ -85,16 +60,6 @@ void FullyConnectedLayer::configureBackward(
     throw std::runtime_error{
       "train FullyConnectedLayer: Input other ranks than 2 are not supported."};
 
-  _transposed_weights = createTransposedTensor(weights);
-  _transposed_weights->setBuffer(std::make_shared<basic::Allocator>(weights->total_size()));
-
-  _transposed_input = createTransposedTensor(input);
-  _transposed_input->setBuffer(std::make_shared<basic::Allocator>(input->total_size()));
-
-  _transposed_back_prop_output = createTransposedTensor(back_prop_output);
-  _transposed_back_prop_output->setBuffer(
-    std::make_shared<basic::Allocator>(back_prop_output->total_size()));
-
   if (activation != ir::Activation::NONE)
   {
     _act_back_prop_output = std::make_unique<Tensor>(_back_prop_output->get_info());
@@ -125,12 +90,14 @@ void FullyConnectedLayer::backward()
 
 void FullyConnectedLayer::backwardFloat32()
 {
+  auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
+
   // Calculate gradient for activation
   const IPortableTensor *backprop_act;
   try
   {
-    backprop_act =
-      backpropActivation(_activation, _output, _back_prop_output, _act_back_prop_output.get());
+    backprop_act = backpropActivation(_activation, _output, _back_prop_output,
+                                      _act_back_prop_output.get(), ruy_context);
   }
   catch (const std::exception &e)
   {
@@ -138,52 +105,19 @@ void FullyConnectedLayer::backwardFloat32()
   }
   assert(backprop_act != nullptr);
 
-  // Initialize TransposeParams
-  nnfw::cker::TransposeParams transpose_param;
-  transpose_param.perm_count = 2;
-  transpose_param.perm[0] = 1;
-  transpose_param.perm[1] = 0;
-
-  // Initialize FullyConnectedParams
-  nnfw::cker::FullyConnectedParams op_params;
-  float output_activation_min = 0;
-  float output_activation_max = 0;
-  CalculateActivationRange(ir::Activation::NONE, &output_activation_min, &output_activation_max);
-  op_params.activation = nnfw::cker::FusedActivationFunctionType::kNone;
-  op_params.float_activation_min = output_activation_min;
-  op_params.float_activation_max = output_activation_max;
-  op_params.lhs_cacheable = false;
-  op_params.rhs_cacheable = false;
-
-  // Transpose and compute gradient for input
-  // ∂L/∂X = fc(Incoming gradient, transposed W)
-  auto transposed_weights = _transposed_weights.get();
-  assert(transposed_weights->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_weights), getBuffer<float>(_weights),
-                        getShape(transposed_weights), getBuffer<float>(transposed_weights));
-
-  nnfw::cker::FullyConnected(op_params, getShape(backprop_act), getBuffer<float>(backprop_act),
-                             getShape(transposed_weights), getBuffer<float>(transposed_weights),
-                             getShape(nullptr), nullptr, getShape(_back_prop_input),
-                             getBuffer<float>(_back_prop_input));
-
-  // Transpose and compute gradient for weights
-  // ∂L/∂W = fc(transposed incomming gradient, transposed X)
-  auto transposed_input = _transposed_input.get();
-  assert(transposed_input->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(_input), getBuffer<float>(_input),
-                        getShape(transposed_input), getBuffer<float>(transposed_input));
-
-  auto transposed_back_prop_output = _transposed_back_prop_output.get();
-  assert(transposed_back_prop_output->getShape().rank() == 2);
-  nnfw::cker::Transpose(transpose_param, getShape(backprop_act), getBuffer<float>(backprop_act),
-                        getShape(transposed_back_prop_output),
-                        getBuffer<float>(transposed_back_prop_output));
-
-  nnfw::cker::FullyConnected(
-    op_params, getShape(transposed_back_prop_output), getBuffer<float>(transposed_back_prop_output),
-    getShape(transposed_input), getBuffer<float>(transposed_input), getShape(nullptr), nullptr,
-    getShape(_grad_weights), getBuffer<float>(_grad_weights));
+  // Compute gradient for input
+  // ∂L/∂X = Incoming gradient * W
+  nnfw::cker::train::FullyConnectedInputGrad(
+    getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_weights),
+    getBuffer<float>(_weights), getShape(_back_prop_input), getBuffer<float>(_back_prop_input),
+    ruy_context);
+
+  // Compute gradient for weights
+  // ∂L/∂W = transposed incoming gradient * X
+  nnfw::cker::train::FullyConnectedWeightsGrad(
+    getShape(backprop_act), getBuffer<float>(backprop_act), getShape(_input),
+    getBuffer<float>(_input), getShape(_grad_weights), getBuffer<float>(_grad_weights),
+    ruy_context);
 
   // Compute gradient for bias
   if (_bias)
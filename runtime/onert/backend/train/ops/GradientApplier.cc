@@ -16,6 +16,8 @@
 
 #include "GradientApplier.h"
 
+#include "OperationUtils.h"
+
 #include <exec/train/optimizer/Optimizer.h>
 
 namespace onert
@@ -27,23 +29,59 @@ namespace train
 namespace ops
 {
 
-GradientApplier::GradientApplier() : _optimizer{nullptr}, _gradient_tensor{}, _trainable_tensor{}
+GradientApplier::GradientApplier()
+  : _optimizer{nullptr}, _gradient_tensor{}, _trainable_tensor{},
+    _accumulated_gradient_tensor{nullptr}, _accumulation_steps{1}
 {
   // DO NOTHING
 }
 
 void GradientApplier::configure(const exec::train::optimizer::Optimizer *optimizer,
-                                const IPortableTensor *gradient, ITrainableTensor *trainable)
+                                const IPortableTensor *gradient, ITrainableTensor *trainable,
+                                IPortableTensor *accumulated_gradient,
+                                uint32_t accumulation_steps)
 {
   _optimizer = optimizer;
   _gradient_tensor = gradient;
   _trainable_tensor = trainable;
+  _accumulation_steps = accumulation_steps;
+
+  if (_accumulation_steps > 1)
+  {
+    if (accumulated_gradient == nullptr)
+      throw std::runtime_error{"GradientApplier: accumulated gradient tensor is not given"};
+    if (accumulated_gradient->getShape() != gradient->getShape())
+      throw std::runtime_error{"GradientApplier: Invalid accumulated gradient tensor"};
+    _accumulated_gradient_tensor = accumulated_gradient;
+  }
 }
 
 void GradientApplier::applyGradient(uint32_t training_step)
 {
+  if (_accumulation_steps <= 1)
+  {
+    _optimizer->applyGradient(
+      std::forward_as_tuple(*_gradient_tensor, *_trainable_tensor, training_step));
+    return;
+  }
+
+  // training_step counts micro-batches, and weights are updated once in _accumulation_steps
+  const auto micro_batch = training_step % _accumulation_steps;
+  const bool last = micro_batch + 1 == _accumulation_steps;
+  accumulateGradient(micro_batch == 0, last);
+  if (!last)
+    return;
+
+  const size_t update_step = training_step / _accumulation_steps;
   _optimizer->applyGradient(
-    std::forward_as_tuple(*_gradient_tensor, *_trainable_tensor, training_step));
+    std::forward_as_tuple(*_accumulated_gradient_tensor, *_trainable_tensor, update_step));
+}
+
+void GradientApplier::accumulateGradient(bool first, bool last)
+{
+  // The update uses the mean of gradients of micro-batches
+  const float scale = last ? 1.0f / _accumulation_steps : 1.0f;
+  ops::accumulateGradient(_gradient_tensor, _accumulated_gradient_tensor, first, scale);
 }
 
 } // namespace ops
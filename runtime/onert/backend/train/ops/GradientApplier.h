@@ -36,14 +36,26 @@ public:
   GradientApplier();
   ~GradientApplier() = default;
 
+  /**
+   * @param accumulated_gradient Tensor to sum gradients of micro-batches, used only if
+   *                             @c accumulation_steps is greater than 1
+   * @param accumulation_steps   Number of micro-batches whose gradients are averaged to update
+   *                             weights once
+   */
   void configure(const exec::train::optimizer::Optimizer *optimizer,
-                 const IPortableTensor *gradient, ITrainableTensor *trainable);
+                 const IPortableTensor *gradient, ITrainableTensor *trainable,
+                 IPortableTensor *accumulated_gradient = nullptr, uint32_t accumulation_steps = 1);
   void applyGradient(uint32_t training_step) override;
 
+private:
+  void accumulateGradient(bool first, bool last);
+
 private:
   const exec::train::optimizer::Optimizer *_optimizer;
   const IPortableTensor *_gradient_tensor;
   ITrainableTensor *_trainable_tensor;
+  IPortableTensor *_accumulated_gradient_tensor;
+  uint32_t _accumulation_steps;
 };
 
 } // namespace ops
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GradientApplier.h"
+#include "MockUpTensor.test.h"
+
+#include "../optimizer/SGD.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert;
+using namespace onert::backend;
+
+TEST(GradientApplier, apply_every_step)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor trainable{{1.f, 1.f}};
+  MockUpGradientTensor gradient{{1.f, 2.f}};
+
+  train::ops::GradientApplier applier;
+  applier.configure(&sgd, &gradient, &trainable);
+
+  applier.applyGradient(0);
+  EXPECT_EQ(trainable.data(), (std::vector<float>{0.f, -1.f}));
+  applier.applyGradient(1);
+  EXPECT_EQ(trainable.data(), (std::vector<float>{-1.f, -3.f}));
+}
+
+TEST(GradientApplier, accumulate_micro_batches)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor trainable{{1.f, 1.f}};
+  MockUpGradientTensor gradient{{0.f, 0.f}};
+  MockUpGradientTensor accumulated{{0.f, 0.f}};
+
+  train::ops::GradientApplier applier;
+  applier.configure(&sgd, &gradient, &trainable, &accumulated, 3);
+
+  // Weights are updated with the mean gradient of every 3 micro-batches
+  const std::vector<std::vector<float>> gradients{{1.f, 2.f}, {3.f, 4.f}, {5.f, 6.f},
+                                                  {3.f, 0.f}, {0.f, 3.f}, {0.f, 0.f}};
+  const std::vector<std::vector<float>> expected{{1.f, 1.f},   {1.f, 1.f},   {-2.f, -3.f},
+                                                 {-2.f, -3.f}, {-2.f, -3.f}, {-3.f, -4.f}};
+  for (uint32_t step = 0; step < gradients.size(); ++step)
+  {
+    gradient.setData(gradients[step]);
+    applier.applyGradient(step);
+    EXPECT_EQ(trainable.data(), expected[step]);
+  }
+}
+
+TEST(GradientApplier, neg_no_accumulated_gradient)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor trainable{{1.f, 1.f}};
+  MockUpGradientTensor gradient{{1.f, 2.f}};
+
+  train::ops::GradientApplier applier;
+  EXPECT_ANY_THROW(applier.configure(&sgd, &gradient, &trainable, nullptr, 2));
+}
@@ -28,13 +28,12 @@ namespace train
 namespace ops
 {
 
-void LossCategoricalCrossentropyLayer::configure(const IPortableTensor *y_pred,
-                                                 const IPortableTensor *y_true,
-                                                 IPortableTensor *output,
-                                                 IPortableTensor *back_prop_y_pred, int32_t axis,
-                                                 float label_smoothing)
+void LossCategoricalCrossentropyLayer::configure(
+  const IPortableTensor *y_pred, const IPortableTensor *y_true, IPortableTensor *output,
+  IPortableTensor *back_prop_y_pred, int32_t axis, float label_smoothing,
+  const std::shared_ptr<ExternalContext> &external_context)
 {
-  LossLayer::configure(y_pred, y_true, output, back_prop_y_pred);
+  LossLayer::configure(y_pred, y_true, output, back_prop_y_pred, external_context);
 
   _axis = axis;
   _label_smoothing = label_smoothing;
@@ -60,9 +59,10 @@ void LossCategoricalCrossentropyLayer::backward()
 
   if (_y_pred->data_type() == OperandType::FLOAT32)
   {
+    auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
     nnfw::cker::train::CategoricalCrossEntropyGrad(
       getShape(_y_pred), getBuffer<float>(_y_pred), getShape(_y_true), getBuffer<float>(_y_true),
-      getShape(_back_prop_y_pred), getBuffer<float>(_back_prop_y_pred));
+      getShape(_back_prop_y_pred), getBuffer<float>(_back_prop_y_pred), ruy_context);
   }
   else
   {
@@ -36,7 +36,8 @@ public:
 
   void configure(const IPortableTensor *y_pred, const IPortableTensor *y_true,
                  IPortableTensor *output, IPortableTensor *back_prop_y_pred, int32_t axis,
-                 float label_smoothing);
+                 float label_smoothing,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
   void forward(bool training) override;
   void backward() override;
 
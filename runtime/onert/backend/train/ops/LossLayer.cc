@@ -32,7 +32,8 @@ LossLayer::LossLayer()
 }
 
 void LossLayer::configure(const IPortableTensor *y_pred, const IPortableTensor *y_true,
-                          IPortableTensor *output, IPortableTensor *back_prop_y_pred)
+                          IPortableTensor *output, IPortableTensor *back_prop_y_pred,
+                          const std::shared_ptr<ExternalContext> &external_context)
 {
   assert(y_pred != nullptr);
   assert(y_true != nullptr);
@@ -43,6 +44,7 @@ void LossLayer::configure(const IPortableTensor *y_pred, const IPortableTensor *
   _y_true = y_true;
   _output = output;
   _back_prop_y_pred = back_prop_y_pred;
+  _external_context = external_context;
 }
 
 } // namespace ops
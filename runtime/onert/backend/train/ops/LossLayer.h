@@ -17,6 +17,8 @@
 #ifndef __ONERT_BACKEND_TRAIN_OPS_LOSSLAYER_H__
 #define __ONERT_BACKEND_TRAIN_OPS_LOSSLAYER_H__
 
+#include "../ExternalContext.h"
+
 #include <backend/IPortableTensor.h>
 #include <ops/ElementwiseActivationLayer.h>
 
@@ -42,13 +44,15 @@ public:
   LossLayer();
 
   void configure(const IPortableTensor *y_pred, const IPortableTensor *y_true,
-                 IPortableTensor *output, IPortableTensor *back_prop_y_pred);
+                 IPortableTensor *output, IPortableTensor *back_prop_y_pred,
+                 const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
 protected:
   const IPortableTensor *_y_pred;
   const IPortableTensor *_y_true;
   IPortableTensor *_output;
   IPortableTensor *_back_prop_y_pred;
+  std::shared_ptr<ExternalContext> _external_context;
 };
 
 } // namespace ops
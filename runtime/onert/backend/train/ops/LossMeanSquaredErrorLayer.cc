@@ -30,9 +30,10 @@ namespace ops
 
 void LossMeanSquaredErrorLayer::configure(const IPortableTensor *y_pred,
                                           const IPortableTensor *y_true, IPortableTensor *output,
-                                          IPortableTensor *back_prop_y_pred)
+                                          IPortableTensor *back_prop_y_pred,
+                                          const std::shared_ptr<ExternalContext> &external_context)
 {
-  LossLayer::configure(y_pred, y_true, output, back_prop_y_pred);
+  LossLayer::configure(y_pred, y_true, output, back_prop_y_pred, external_context);
 }
 
 void LossMeanSquaredErrorLayer::forward(bool)
@@ -55,9 +56,10 @@ void LossMeanSquaredErrorLayer::backward()
 
   if (_y_pred->data_type() == OperandType::FLOAT32)
   {
+    auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
     nnfw::cker::train::MSEGrad(getShape(_y_pred), getBuffer<float>(_y_pred), getShape(_y_true),
                                getBuffer<float>(_y_true), getShape(_back_prop_y_pred),
-                               getBuffer<float>(_back_prop_y_pred));
+                               getBuffer<float>(_back_prop_y_pred), ruy_context);
   }
   else
   {
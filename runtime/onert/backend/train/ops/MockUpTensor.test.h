@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_MOCKUP_TENSOR_TEST_H__
+#define __ONERT_BACKEND_TRAIN_OPS_MOCKUP_TENSOR_TEST_H__
+
+#include <backend/IPortableTensor.h>
+#include <backend/train/ITrainableTensor.h>
+
+#include <cassert>
+#include <vector>
+
+// 1D float tensor on a vector, whose data can be changed between steps
+template <typename Base> class MockUpTensor : public Base
+{
+public:
+  MockUpTensor(const std::vector<float> &data)
+    : Base{onert::ir::OperandInfo{onert::ir::Shape{static_cast<int32_t>(data.size())},
+                                  onert::ir::TypeInfo{onert::ir::DataType::FLOAT32},
+                                  onert::ir::MemAllocType::STATIC}},
+      _data{data}
+  {
+  }
+
+  uint8_t *buffer() const override
+  {
+    return reinterpret_cast<uint8_t *>(const_cast<float *>(_data.data()));
+  }
+
+  void setData(const std::vector<float> &data)
+  {
+    assert(data.size() == _data.size());
+    _data = data;
+  }
+  const std::vector<float> &data() const { return _data; }
+
+private:
+  std::vector<float> _data;
+};
+
+class MockUpTrainableTensor : public MockUpTensor<onert::backend::train::ITrainableTensor>
+{
+public:
+  using MockUpTensor<onert::backend::train::ITrainableTensor>::MockUpTensor;
+
+  std::vector<onert::backend::ITensor *> optVars() override { return {}; }
+};
+
+using MockUpGradientTensor = MockUpTensor<onert::backend::IPortableTensor>;
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_MOCKUP_TENSOR_TEST_H__
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiTensorApplier.h"
+
+#include "OperationUtils.h"
+
+#include <stdexcept>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+class MultiTensorApplier::OperationApplier : public exec::train::IGradientApplier
+{
+public:
+  OperationApplier(std::shared_ptr<MultiTensorApplier> owner) : _owner{std::move(owner)} {}
+
+  void applyGradient(uint32_t training_step) override
+  {
+    // The last operation of a training step updates the tensors of all the operations
+    if (++_owner->_num_applied < _owner->_num_operations)
+      return;
+    _owner->_num_applied = 0;
+    _owner->applyGradients(training_step);
+  }
+
+private:
+  std::shared_ptr<MultiTensorApplier> _owner;
+};
+
+MultiTensorApplier::MultiTensorApplier(const exec::train::optimizer::Optimizer *optimizer,
+                                       uint32_t accumulation_steps)
+  : _optimizer{optimizer}, _accumulation_steps{accumulation_steps}, _tensors{},
+    _accumulated_gradients{}, _accumulated_tensors{}, _num_operations{0}, _num_applied{0}
+{
+  // DO NOTHING
+}
+
+std::unique_ptr<exec::train::IGradientApplier>
+MultiTensorApplier::append(const std::vector<const IPortableTensor *> &gradients,
+                           const std::vector<ITrainableTensor *> &trainables,
+                           const std::vector<IPortableTensor *> &accumulated_gradients)
+{
+  if (gradients.size() != trainables.size())
+    throw std::runtime_error{"MultiTensorApplier: Invalid gradient tensors"};
+  if (_accumulation_steps > 1 && accumulated_gradients.size() != trainables.size())
+    throw std::runtime_error{"MultiTensorApplier: accumulated gradient tensors are not given"};
+
+  for (size_t i = 0; i < trainables.size(); ++i)
+  {
+    _tensors.emplace_back(gradients[i], trainables[i]);
+    if (_accumulation_steps <= 1)
+      continue;
+
+    if (accumulated_gradients[i] == nullptr ||
+        accumulated_gradients[i]->getShape() != gradients[i]->getShape())
+      throw std::runtime_error{"MultiTensorApplier: Invalid accumulated gradient tensor"};
+    _accumulated_gradients.emplace_back(accumulated_gradients[i]);
+    _accumulated_tensors.emplace_back(accumulated_gradients[i], trainables[i]);
+  }
+
+  _num_operations++;
+  return std::make_unique<OperationApplier>(shared_from_this());
+}
+
+void MultiTensorApplier::applyGradients(uint32_t training_step)
+{
+  if (_accumulation_steps <= 1)
+  {
+    _optimizer->applyGradients(_tensors, training_step);
+    return;
+  }
+
+  // training_step counts micro-batches, and weights are updated once in _accumulation_steps
+  const auto micro_batch = training_step % _accumulation_steps;
+  const bool last = micro_batch + 1 == _accumulation_steps;
+  // The update uses the mean of gradients of micro-batches
+  const float scale = last ? 1.0f / _accumulation_steps : 1.0f;
+  for (size_t i = 0; i < _accumulated_gradients.size(); ++i)
+    accumulateGradient(_tensors[i].first, _accumulated_gradients[i], micro_batch == 0, scale);
+  if (!last)
+    return;
+
+  _optimizer->applyGradients(_accumulated_tensors, training_step / _accumulation_steps);
+}
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
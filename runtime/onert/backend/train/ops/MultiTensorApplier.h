@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_BACKEND_TRAIN_OPS_MULTI_TENSOR_APPLIER_H__
+#define __ONERT_BACKEND_TRAIN_OPS_MULTI_TENSOR_APPLIER_H__
+
+#include <exec/train/IGradientApplier.h>
+
+#include <exec/train/optimizer/Optimizer.h>
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace backend
+{
+namespace train
+{
+namespace ops
+{
+
+/**
+ * @brief Apply gradients to trainable tensors of all operations in one pass
+ *
+ * Each operation updating weights gets an applier of its own from this. Once the appliers of all
+ * the operations are called in a training step, i.e. after backward of all of them, the optimizer
+ * updates all the trainable tensors at once. So gradient tensors must be kept until then.
+ */
+class MultiTensorApplier : public std::enable_shared_from_this<MultiTensorApplier>
+{
+public:
+  /**
+   * @param accumulation_steps Number of micro-batches whose gradients are averaged to update
+   *                           weights once
+   */
+  MultiTensorApplier(const exec::train::optimizer::Optimizer *optimizer,
+                     uint32_t accumulation_steps = 1);
+
+  /**
+   * @brief Add trainable tensors of an operation and get the applier of the operation
+   *
+   * @param gradients             Gradient tensor of each trainable tensor
+   * @param trainables            Trainable tensors of the operation
+   * @param accumulated_gradients Tensor to sum gradients of micro-batches for each trainable
+   *                              tensor, used only if accumulation steps are greater than 1
+   */
+  std::unique_ptr<exec::train::IGradientApplier>
+  append(const std::vector<const IPortableTensor *> &gradients,
+         const std::vector<ITrainableTensor *> &trainables,
+         const std::vector<IPortableTensor *> &accumulated_gradients = {});
+
+  uint32_t numOperations() const { return _num_operations; }
+
+private:
+  class OperationApplier;
+
+  void applyGradients(uint32_t training_step);
+
+private:
+  const exec::train::optimizer::Optimizer *_optimizer;
+  const uint32_t _accumulation_steps;
+  exec::train::optimizer::MultiUpdateTensors _tensors;
+  std::vector<IPortableTensor *> _accumulated_gradients;
+  exec::train::optimizer::MultiUpdateTensors _accumulated_tensors;
+  uint32_t _num_operations;
+  uint32_t _num_applied;
+};
+
+} // namespace ops
+} // namespace train
+} // namespace backend
+} // namespace onert
+
+#endif // __ONERT_BACKEND_TRAIN_OPS_MULTI_TENSOR_APPLIER_H__
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MultiTensorApplier.h"
+#include "MockUpTensor.test.h"
+
+#include "../optimizer/SGD.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace onert;
+using namespace onert::backend;
+
+TEST(MultiTensorApplier, apply_after_all_operations)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor kernel{{1.f, 1.f, 1.f}};
+  MockUpTrainableTensor bias{{1.f}};
+  MockUpTrainableTensor weights{{2.f, 2.f}};
+  MockUpGradientTensor kernel_grad{{1.f, 2.f, 3.f}};
+  MockUpGradientTensor bias_grad{{4.f}};
+  MockUpGradientTensor weights_grad{{1.f, -1.f}};
+
+  auto applier = std::make_shared<train::ops::MultiTensorApplier>(&sgd);
+  auto op0 = applier->append({&bias_grad, &kernel_grad}, {&bias, &kernel});
+  auto op1 = applier->append({&weights_grad}, {&weights});
+  EXPECT_EQ(applier->numOperations(), 2);
+
+  // Nothing is updated until the appliers of all operations are called
+  op1->applyGradient(0);
+  EXPECT_EQ(weights.data(), (std::vector<float>{2.f, 2.f}));
+  op0->applyGradient(0);
+  EXPECT_EQ(kernel.data(), (std::vector<float>{0.f, -1.f, -2.f}));
+  EXPECT_EQ(bias.data(), (std::vector<float>{-3.f}));
+  EXPECT_EQ(weights.data(), (std::vector<float>{1.f, 3.f}));
+
+  op1->applyGradient(1);
+  op0->applyGradient(1);
+  EXPECT_EQ(weights.data(), (std::vector<float>{0.f, 4.f}));
+}
+
+TEST(MultiTensorApplier, accumulate_micro_batches)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor trainable{{1.f, 1.f}};
+  MockUpGradientTensor gradient{{0.f, 0.f}};
+  MockUpGradientTensor accumulated{{0.f, 0.f}};
+
+  auto applier = std::make_shared<train::ops::MultiTensorApplier>(&sgd, 2);
+  auto op = applier->append({&gradient}, {&trainable}, {&accumulated});
+
+  // Weights are updated with the mean gradient of every 2 micro-batches
+  const std::vector<std::vector<float>> gradients{{1.f, 2.f}, {3.f, 4.f}, {2.f, 0.f}, {0.f, 2.f}};
+  const std::vector<std::vector<float>> expected{
+    {1.f, 1.f}, {-1.f, -2.f}, {-1.f, -2.f}, {-2.f, -3.f}};
+  for (uint32_t step = 0; step < gradients.size(); ++step)
+  {
+    gradient.setData(gradients[step]);
+    op->applyGradient(step);
+    EXPECT_EQ(trainable.data(), expected[step]);
+  }
+}
+
+TEST(MultiTensorApplier, neg_invalid_tensors)
+{
+  train::optimizer::SGD sgd{1.0};
+  MockUpTrainableTensor trainable{{1.f, 1.f}};
+  MockUpGradientTensor gradient{{1.f, 2.f}};
+
+  auto applier = std::make_shared<train::ops::MultiTensorApplier>(&sgd, 2);
+  EXPECT_ANY_THROW(applier->append({&gradient}, {}));
+  EXPECT_ANY_THROW(applier->append({&gradient}, {&trainable}));
+  EXPECT_ANY_THROW(applier->append({&gradient}, {&trainable}, {nullptr}));
+}
@@ -50,7 +50,8 @@ nnfw::cker::Shape getShape(const IPortableTensor *tensor)
 const IPortableTensor *backpropActivation(const ir::Activation &activation,
                                           const IPortableTensor *output,
                                           const IPortableTensor *input_backprop,
-                                          IPortableTensor *output_backprop)
+                                          IPortableTensor *output_backprop,
+                                          ruy::Context *ruy_context)
 {
   assert(output != nullptr);
   assert(input_backprop != nullptr);
@@ -69,12 +70,14 @@ const IPortableTensor *backpropActivation(const ir::Activation &activation,
     case ir::Activation::RELU:
       nnfw::cker::train::ReLUGrad(getShape(output), getBuffer<float>(output),
                                   getShape(input_backprop), getBuffer<float>(input_backprop),
-                                  getShape(output_backprop), getBuffer<float>(output_backprop));
+                                  getShape(output_backprop), getBuffer<float>(output_backprop),
+                                  ruy_context);
       break;
     case ir::Activation::RELU6:
       nnfw::cker::train::ReLU6Grad(getShape(output), getBuffer<float>(output),
                                    getShape(input_backprop), getBuffer<float>(input_backprop),
-                                   getShape(output_backprop), getBuffer<float>(output_backprop));
+                                   getShape(output_backprop), getBuffer<float>(output_backprop),
+                                   ruy_context);
       break;
     // TODO: Add other activation backpropagation here
     default:
@@ -97,6 +100,20 @@ void biasGrad(const IPortableTensor *input_backprop, IPortableTensor *bias_grad)
                                            bias_grad_buffer, bias_grad_shape);
 }
 
+void accumulateGradient(const IPortableTensor *gradient, IPortableTensor *accumulated, bool first,
+                        float scale)
+{
+  if (gradient->data_type() != ir::DataType::FLOAT32)
+    throw std::runtime_error{"accumulateGradient: Not supported data type"};
+  assert(accumulated->getShape() == gradient->getShape());
+
+  const auto grad = getBuffer<float>(gradient);
+  auto acc = getBuffer<float>(accumulated);
+  const auto size = gradient->getShape().num_elements();
+  for (int64_t i = 0; i < size; ++i)
+    acc[i] = ((first ? 0.0f : acc[i]) + grad[i]) * scale;
+}
+
 } // namespace ops
 } // namespace train
 } // namespace backend
@@ -19,6 +19,8 @@
 
 #include <ops/OperationUtils.h>
 
+#include <ruy/context.h>
+
 namespace onert
 {
 namespace backend
@@ -60,13 +62,16 @@ nnfw::cker::Shape getShape(const IPortableTensor *tensor);
  * @param output_backprop backward direction's output of activation,
  *                        In other words, outcoming gradient of current layer's acitvation
  *                        If activation is NONE, this param can be nullptr
+ * @param ruy_context     context whose threads compute the gradient, nullptr to compute it
+ *                        on the calling thread
  * @return tensor that holds backpropagate result of activation
  *         If activation is NONE, just return input_backprop
  */
 const IPortableTensor *backpropActivation(const ir::Activation &activation,
                                           const IPortableTensor *output,
                                           const IPortableTensor *input_backprop,
-                                          IPortableTensor *output_backprop);
+                                          IPortableTensor *output_backprop,
+                                          ruy::Context *ruy_context = nullptr);
 
 /**
  * @brief backpropagate bias
@@ -77,6 +82,17 @@ const IPortableTensor *backpropActivation(const ir::Activation &activation,
  */
 void biasGrad(const IPortableTensor *input_backprop, IPortableTensor *bias_grad);
 
+/**
+ * @brief Accumulate gradient of a micro-batch
+ *
+ * @param gradient    gradient of the micro-batch
+ * @param accumulated sum of gradients of the previous micro-batches
+ * @param first       whether it is the first micro-batch, which overwrites @c accumulated
+ * @param scale       factor multiplied to the sum, e.g. to take the mean after the last one
+ */
+void accumulateGradient(const IPortableTensor *gradient, IPortableTensor *accumulated, bool first,
+                        float scale);
+
 } // namespace ops
 } // namespace train
 } // namespace backend
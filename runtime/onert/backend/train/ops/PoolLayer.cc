@@ -40,6 +40,7 @@ private:
   const ir::Activation _activation;
   const IPortableTensor *_output;
   nnfw::cker::PoolParams _op_params;
+  ruy::Context *_ruy_context;
 
   std::unique_ptr<Tensor> _act_back_prop_output;
   std::unique_ptr<Tensor> _arg_max_index;
@@ -48,8 +49,8 @@ public:
   MaxPool2D(const uint32_t paddingLeft, const uint32_t, const uint32_t paddingTop, const uint32_t,
             const uint32_t strideWidth, const uint32_t strideHeight, const uint32_t kernelWidth,
             const uint32_t kernelHeight, const ir::Activation activation,
-            const IPortableTensor *output)
-    : _activation(activation), _output(output)
+            const IPortableTensor *output, ruy::Context *ruy_context)
+    : _activation(activation), _output(output), _ruy_context(ruy_context)
   {
     {
       _op_params.stride_height = strideHeight;
@@ -91,8 +92,8 @@ public:
     // activation backward
     try
     {
-      back_prop_out =
-        backpropActivation(_activation, _output, back_prop_out, _act_back_prop_output.get());
+      back_prop_out = backpropActivation(_activation, _output, back_prop_out,
+                                         _act_back_prop_output.get(), _ruy_context);
     }
     catch (const std::exception &e)
     {
@@ -104,7 +105,7 @@ public:
     auto arg_max_index = _arg_max_index.get();
     nnfw::cker::train::MaxPool2DGrad(getShape(back_prop_out), getBuffer<float>(back_prop_out),
                                      getBuffer<int>(arg_max_index), getShape(back_prop_in),
-                                     getBuffer<float>(back_prop_in));
+                                     getBuffer<float>(back_prop_in), _ruy_context);
   }
 };
 
@@ -122,7 +123,8 @@ void PoolLayer::configureBackward(const uint32_t paddingLeft, const uint32_t pad
                                   const uint32_t kernelWidth, const uint32_t kernelHeight,
                                   const ir::Activation activation, const PoolType op_type,
                                   IPortableTensor *output, IPortableTensor *back_prop_input,
-                                  const IPortableTensor *back_prop_output)
+                                  const IPortableTensor *back_prop_output,
+                                  const std::shared_ptr<ExternalContext> &external_context)
 {
   _back_prop_output = back_prop_output;
   _back_prop_input = back_prop_input;
@@ -133,12 +135,13 @@ void PoolLayer::configureBackward(const uint32_t paddingLeft, const uint32_t pad
   }
 
   // ready training kernel
+  auto ruy_context = external_context ? external_context->ruy_context() : nullptr;
   switch (op_type)
   {
     case PoolType::kMax:
       _kernel = std::make_unique<MaxPool2D>(paddingLeft, paddingRight, paddingTop, paddingBottom,
                                             strideWidth, strideHeight, kernelWidth, kernelHeight,
-                                            activation, output);
+                                            activation, output, ruy_context);
       break;
     default:
       throw std::runtime_error("PoolLayer: Unsupported pool type");
@@ -19,6 +19,8 @@
 
 #include <ops/PoolLayer.h>
 
+#include "../ExternalContext.h"
+
 #include <exec/train/ITrainableFunction.h>
 
 namespace onert
@@ -59,7 +61,8 @@ public:
                          const uint32_t kernelWidth, const uint32_t kernelHeight,
                          const ir::Activation activation, const PoolType op_type,
                          IPortableTensor *output, IPortableTensor *back_prop_input,
-                         const IPortableTensor *back_prop_output);
+                         const IPortableTensor *back_prop_output,
+                         const std::shared_ptr<ExternalContext> &external_context = nullptr);
 
   void forward(bool training) override;
   void backward() override;
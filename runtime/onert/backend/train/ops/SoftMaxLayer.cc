@@ -51,10 +51,11 @@ void SoftMaxLayer::backward()
   {
     case OperandType::FLOAT32:
     {
+      auto ruy_context = _external_context ? _external_context->ruy_context() : nullptr;
       nnfw::cker::train::SoftMaxGrad(
         getShape(_output), getBuffer<float>(_output), getShape(_back_prop_output),
         getBuffer<float>(_back_prop_output), getShape(_back_prop_input),
-        getBuffer<float>(_back_prop_input));
+        getBuffer<float>(_back_prop_input), ruy_context);
       break;
     }
     default:
@@ -73,6 +73,34 @@ void Adam::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+void Adam::applyGradients(const MultiUpdateTensors &tensors, size_t training_step) const
+{
+  std::vector<nnfw::cker::train::OptimizerBuffers> buffers;
+  buffers.reserve(tensors.size());
+  for (const auto &[grad_tensor, trainable_tensor] : tensors)
+  {
+    if (trainable_tensor->getShape() != grad_tensor->getShape())
+      throw std::runtime_error("Adam: Invalid gradient tensor");
+    if (grad_tensor->data_type() != ir::DataType::FLOAT32 ||
+        trainable_tensor->data_type() != ir::DataType::FLOAT32)
+      throw std::runtime_error("Adam: Not supported data type");
+
+    const auto opt_vars = trainable_tensor->optVars();
+    assert(opt_vars.size() == 2);
+    auto m_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(0));
+    auto v_tensor = nnfw::misc::polymorphic_downcast<IPortableTensor *>(opt_vars.at(1));
+
+    buffers.push_back({ops::getBuffer<float>(trainable_tensor), ops::getBuffer<float>(grad_tensor),
+                       ops::getBuffer<float>(m_tensor), ops::getBuffer<float>(v_tensor),
+                       trainable_tensor->getShape().num_elements()});
+  }
+
+  const auto beta1_power = std::pow(_props.beta1, training_step + 1);
+  const auto beta2_power = std::pow(_props.beta2, training_step + 1);
+  nnfw::cker::train::MultiTensorAdam(buffers, beta1_power, beta2_power, _learning_rate,
+                                     _props.beta1, _props.beta2, _props.epsilon);
+}
+
 } // namespace optimizer
 } // namespace train
 } // namespace backend
@@ -58,6 +58,25 @@ void SGD::applyGradient(const UpdateFactors &factors) const
   }
 }
 
+void SGD::applyGradients(const MultiUpdateTensors &tensors, size_t training_step) const
+{
+  std::vector<nnfw::cker::train::OptimizerBuffers> buffers;
+  buffers.reserve(tensors.size());
+  for (const auto &[grad_tensor, trainable_tensor] : tensors)
+  {
+    if (trainable_tensor->getShape() != grad_tensor->getShape())
+      throw std::runtime_error("SGD: Invalid gradient tensor");
+    if (grad_tensor->data_type() != ir::DataType::FLOAT32 ||
+        trainable_tensor->data_type() != ir::DataType::FLOAT32)
+      throw std::runtime_error("SGD: Not supported data type");
+
+    buffers.push_back({ops::getBuffer<float>(trainable_tensor), ops::getBuffer<float>(grad_tensor),
+                       nullptr, nullptr, trainable_tensor->getShape().num_elements()});
+  }
+
+  nnfw::cker::train::MultiTensorGradientDescent(buffers, getLearningRate(training_step));
+}
+
 } // namespace optimizer
 } // namespace train
 } // namespace backend
@@ -36,6 +36,7 @@ class SGD : public exec::train::optimizer::Optimizer
 {
 public:
   using UpdateFactors = exec::train::optimizer::UpdateFactors;
+  using MultiUpdateTensors = exec::train::optimizer::MultiUpdateTensors;
 
 public:
   struct Property
@@ -80,6 +81,14 @@ public:
    */
   void applyGradient(const UpdateFactors &factors) const override;
 
+  /**
+   * @brief Apply gradients to trainable tensors in one pass over all of their elements
+   *
+   * @param tensors       Gradient tensor and trainable tensor of each tensor
+   * @param training_step The number of training steps
+   */
+  void applyGradients(const MultiUpdateTensors &tensors, size_t training_step) const override;
+
 private:
   Property _props;
   double _learning_rate;
@@ -45,6 +45,10 @@ public:
     int num_threads = util::getConfigInt(util::config::XNNPACK_THREADS);
     if (num_threads < 1)
       num_threads = kDefaultNumThreadpoolThreads; // default num of threads
+    // pthreadpool is bounded by threads granted to the model
+    const auto &thread_quota = _data.thread_quota;
+    if (thread_quota && thread_quota->numThreads() > 0)
+      num_threads = static_cast<int>(thread_quota->numThreads());
     _external_context.reset(new ExternalContext(static_cast<size_t>(num_threads)));
   }
 
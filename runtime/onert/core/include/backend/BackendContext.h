@@ -22,7 +22,9 @@
 #include "ir/OperationIndexMap.h"
 #include "ir/OperandIndexMap.h"
 #include "exec/FunctionSequence.h"
+#include "exec/VariableStates.h"
 #include "util/Set.h"
+#include "util/ThreadBudget.h"
 
 namespace onert
 {
@@ -46,6 +48,10 @@ struct ContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Compute threads granted to the model, nullptr for backend default */
+  std::shared_ptr<const util::ThreadQuota> thread_quota;
+  /* Variable tensors kept across runs, nullptr to initialize them on each run */
+  std::shared_ptr<const exec::VariableStates> variable_states;
 };
 
 class BackendContext
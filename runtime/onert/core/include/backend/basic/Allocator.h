@@ -38,12 +38,22 @@ class Allocator
 {
 public:
   Allocator(uint32_t capacity);
+  /**
+   * @brief Construct a new Allocator object with memory allocated already
+   * @param base  Memory buffer to be owned by this allocator
+   */
+  Allocator(std::unique_ptr<uint8_t[]> &&base) : _base{std::move(base)} {}
   /**
    * @brief Get memory base pointer
    * @return base pointer
    */
   uint8_t *base() const { return _base.get(); }
   void release() { _base.reset(); }
+  /**
+   * @brief Take ownership of memory buffer back from this allocator
+   * @return Memory buffer, or @c nullptr if it is already released
+   */
+  std::unique_ptr<uint8_t[]> takeBase() { return std::move(_base); }
 
 private:
   std::unique_ptr<uint8_t[]> _base;
@@ -33,8 +33,6 @@ namespace backend
 namespace basic
 {
 
-// TODO Find optimized algorithm to manage memory.
-
 /**
  * @brief Class to manage dynamic tensor and its memory
  */
@@ -55,7 +53,7 @@ private:
 private:
   /**
    * @brief Memory manager for dynamic tensor.
-   * @todo  DynamicMemoryManager is not optimized. Optimized one is needed
+   *        Its pool size is limited by DYNAMIC_MEM_POOL_LIMIT_KB config
    */
   std::shared_ptr<DynamicMemoryManager> _dynamic_mem_mgr;
   const std::shared_ptr<TensorRegistry> _tensors;
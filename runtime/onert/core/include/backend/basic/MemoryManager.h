@@ -21,6 +21,9 @@
 #include "ir/Index.h"
 #include "IMemoryPlanner.h"
 
+#include <map>
+#include <vector>
+
 namespace onert
 {
 namespace backend
@@ -55,18 +58,74 @@ protected:
   std::shared_ptr<Allocator> _mem_alloc;
 };
 
+/**
+ * @brief Class to manage memory of dynamic tensors
+ *
+ * Memory is allocated in size classes, and freed blocks are kept in pool to be reused by
+ * later allocations in the same size class. So dynamic shape inference with repeated shapes
+ * does not allocate system memory once the pool is warmed up.
+ */
 class DynamicMemoryManager
 {
 public:
-  DynamicMemoryManager() = default;
+  /**
+   * @brief Statistics of memory managed by DynamicMemoryManager
+   */
+  struct Stats
+  {
+    size_t in_use_bytes = 0;      //< Bytes of blocks used by tensors
+    size_t pooled_bytes = 0;      //< Bytes of freed blocks kept for reuse
+    size_t peak_in_use_bytes = 0; //< High-water mark of in_use_bytes
+    size_t peak_total_bytes = 0;  //< High-water mark of in_use_bytes + pooled_bytes
+    uint64_t num_system_allocs = 0;
+    uint64_t num_reuses = 0;
+  };
+
+public:
+  /**
+   * @brief Construct a new DynamicMemoryManager object
+   * @param pool_limit  Maximum bytes of freed blocks kept in pool. Blocks exceeding the limit are
+   *                    released to system. Negative value means no limit.
+   */
+  DynamicMemoryManager(int64_t pool_limit = -1) : _pool_limit{pool_limit} {}
   virtual ~DynamicMemoryManager() = default;
 
   std::shared_ptr<Allocator> allocate(const ITensor *tensor, uint32_t capacity);
   void deallocate(const ITensor *tensor);
+  /**
+   * @brief Deallocate memory of all tensors. Freed blocks are kept in pool.
+   */
   void deallocate(void);
+  /**
+   * @brief Release freed blocks in pool to system until pooled bytes are not greater than
+   *        the given bytes
+   */
+  void trim(size_t max_pooled_bytes = 0);
+
+  const Stats &stats() const { return _stats; }
+
+  /**
+   * @brief  Get size class of the given capacity. Blocks of a size class are shared.
+   * @note   Size class is at most 25% larger than the capacity
+   */
+  static uint32_t sizeClass(uint32_t capacity);
+
+private:
+  struct Allocation
+  {
+    std::shared_ptr<Allocator> allocator;
+    uint32_t size;
+  };
+
+private:
+  void releaseToPool(Allocation &allocation);
 
 private:
-  std::unordered_map<const ITensor *, std::shared_ptr<Allocator>> _mem_alloc_map;
+  std::unordered_map<const ITensor *, Allocation> _mem_alloc_map;
+  // Freed blocks for each size class
+  std::map<uint32_t, std::vector<std::unique_ptr<uint8_t[]>>> _free_blocks;
+  const int64_t _pool_limit;
+  Stats _stats;
 };
 
 } // namespace basic
@@ -64,6 +64,12 @@ public:
     _buffer = alloc->base();
   }
 
+  /**
+   * @brief Set shape and the Buffer object planned outside. This method is called for dynamic
+   *        tensor whose shape and memory are decided before execution
+   */
+  void setPlannedBuffer(const ir::Shape &new_shape, uint8_t *buffer);
+
   /**
    * @brief Reset the buffer and deallocate the allocation if it is managed by itself
    */
@@ -178,6 +184,10 @@ public:
 
 public:
   uint8_t *buffer() const override { return _buffer; }
+  /**
+   * @brief Get Data of this tensor, nullptr if it is released by decrease_ref
+   */
+  const std::shared_ptr<const ir::Data> &data() const { return _data; }
 
   void set_dynamic() override
   {
@@ -20,11 +20,13 @@
 #include "backend/Backend.h"
 #include "backend/train/ITensorRegistry.h"
 #include "backend/train/ITrainableBackend.h"
+#include "compiler/train/RecomputePlan.h"
 #include "exec/train/TrainableFnSequence.h"
 #include "ir/OperandIndexMap.h"
 #include "ir/train/OptimizerInfo.h"
 #include "ir/train/TrainableGraph.h"
 #include "util/Set.h"
+#include "util/ThreadBudget.h"
 
 namespace onert
 {
@@ -50,8 +52,16 @@ struct TrainableContextData
   std::shared_ptr<custom::IKernelBuilder> custom_kernel_builder;
   /* Is linear executor or not */
   bool is_linear_executor;
+  /* Compute threads granted to the model, nullptr for backend default */
+  std::shared_ptr<const util::ThreadQuota> thread_quota;
   /* Optimizer information */
   ir::train::OptimizerInfo optim_info;
+  /* Plan of activation recomputation, nullptr if nothing is recomputed */
+  std::shared_ptr<const compiler::train::RecomputePlan> recompute_plan;
+  /* Number of micro-batches whose gradients are summed before a weight update */
+  uint32_t gradient_accumulation_steps = 1;
+  /* Update trainable tensors of all operations at once after backwarding */
+  bool multi_tensor_update = false;
 };
 
 class TrainableBackendContext
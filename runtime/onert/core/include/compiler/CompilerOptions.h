@@ -63,8 +63,16 @@ struct CompilerOptions
    */
   void verboseOptions();
 
+  /**
+   * @brief Set cores to run compute threads from comma separated core ids (e.g. "0,2,3")
+   */
+  void setCpuAffinity(const std::string &str);
+
   // GENERAL OPTIONS
   std::vector<std::string> backend_list;
+  uint32_t shape_plan_cache_size; //< Number of input shapes whose plans are cached, 0 to disable
+  int32_t num_threads;            //< Number of compute threads requested, -1 for backend default
+  std::vector<int> cpu_affinity;  //< Cores to run compute threads on, empty for no restriction
 
   // OPTIONS ONLY FOR DEBUGGING/PROFILING
   int graph_dump_level; //< Graph dump level, values between 0 and 2 are valid
@@ -74,6 +82,7 @@ struct CompilerOptions
   bool he_profiling_mode;    //< Whether HEScheduler profiling mode ON/OFF
   bool fp16_enable;          //< Whether fp16 mode ON/OFF
   std::string workspace_dir; //< Workspace directory path
+  bool keep_variable_states; //< Whether variable tensors (e.g. LSTM states) persist across runs
 };
 
 } // namespace compiler
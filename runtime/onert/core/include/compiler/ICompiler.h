@@ -23,6 +23,8 @@
 #define __ONERT_COMPILER_I_COMPILER_H_
 
 #include "exec/IExecutors.h"
+#include "exec/VariableStates.h"
+#include "util/ThreadBudget.h"
 #include "util/TracingCtx.h"
 
 namespace onert
@@ -34,11 +36,16 @@ struct CompilerArtifact
 {
   CompilerArtifact(void) = delete;
   CompilerArtifact(std::shared_ptr<exec::IExecutors> executors,
-                   std::unique_ptr<const util::TracingCtx> tracing_ctx)
-    : _executors{executors}, _tracing_ctx{std::move(tracing_ctx)} {};
+                   std::unique_ptr<const util::TracingCtx> tracing_ctx,
+                   std::shared_ptr<const util::ThreadQuota> thread_quota = nullptr,
+                   std::shared_ptr<exec::VariableStates> variable_states = nullptr)
+    : _executors{executors}, _tracing_ctx{std::move(tracing_ctx)},
+      _thread_quota{std::move(thread_quota)}, _variable_states{std::move(variable_states)} {};
 
   std::shared_ptr<exec::IExecutors> _executors;
   std::unique_ptr<const util::TracingCtx> _tracing_ctx;
+  std::shared_ptr<const util::ThreadQuota> _thread_quota;
+  std::shared_ptr<exec::VariableStates> _variable_states;
 };
 
 class ICompiler
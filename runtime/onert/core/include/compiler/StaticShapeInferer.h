@@ -118,6 +118,7 @@ private:
 private:
   // TODO Define visitors for operations. List them in alphabetic order.
   void visit(const ir::operation::ArgMinMax &op) override;
+  void visit(const ir::operation::Attention &op) override;
   void visit(const ir::operation::BatchMatMul &op) override;
   void visit(const ir::operation::BCQFullyConnected &op) override;
   void visit(const ir::operation::BCQGather &op) override;
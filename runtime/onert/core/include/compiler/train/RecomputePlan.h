@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_TRAIN_RECOMPUTE_PLAN_H__
+#define __ONERT_COMPILER_TRAIN_RECOMPUTE_PLAN_H__
+
+#include "ir/Index.h"
+#include "ir/OperandIndexMap.h"
+#include "ir/OperationIndexMap.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+/**
+ * @brief Plan of activation recomputation (a.k.a. activation checkpointing)
+ *
+ * Forward operations are split into segments of consecutive operations. Activations defined and
+ * used only in a segment are not kept until backward. They are released after the forward of the
+ * segment, and the segment runs forward again right before the backward of its first operation.
+ * Other activations are kept for backward as usual.
+ *
+ * Tensor planners of backends and the executor must follow the same plan.
+ */
+struct RecomputePlan
+{
+  // Number of operations in a segment, 0 if nothing is recomputed
+  uint32_t segment_size = 0;
+  // Operations of segments to be recomputed, in forward order
+  std::vector<std::vector<ir::OperationIndex>> segments;
+  // Segment of each operation in segments
+  ir::OperationIndexMap<uint32_t> op_segments;
+  // Activations which are recomputed, and their segment
+  ir::OperandIndexMap<uint32_t> recomputed;
+  // Other activations alive while a segment runs forward, and those segments. Memory of
+  // recomputed activations may be shared with them only after the segments are recomputed.
+  ir::OperandIndexMap<std::vector<uint32_t>> kept;
+
+  bool empty() const { return segments.empty(); }
+};
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_TRAIN_RECOMPUTE_PLAN_H__
@@ -24,6 +24,7 @@
 #include "backend/train/ITrainableTensor.h"
 #include "ir/Layout.h"
 #include "exec/IExecutors.h"
+#include "exec/train/TrainingPhaseStats.h"
 #include "ExecutionContext.h"
 
 #include <thread>
@@ -146,6 +147,15 @@ public:
    */
   bool isFinished(void) const;
 
+  /**
+   * @brief   Get statistics of shape plan cache of entry executor
+   * @return  Statistics, all zero if cache is not used
+   */
+  ShapePlanCacheStats shapePlanCacheStats() const
+  {
+    return entryExecutor()->shapePlanCacheStats();
+  }
+
   /**
    * @brief  Train
    * @note   It should be called after setting input and output buffer
@@ -162,6 +172,12 @@ public:
    */
   float getLoss(const ir::IOIndex &ind);
 
+  /**
+   * @brief   Get time spent in each phase of training steps
+   * @return  Statistics accumulated since the execution is created
+   */
+  train::TrainingPhaseStats trainingPhaseStats() const;
+
   /**
    * @brief     Iterate trainable tensors
    * @note      It should be called after training
@@ -36,6 +36,16 @@ namespace onert
 {
 namespace exec
 {
+/**
+ * @brief Statistics of cache of shapes and memory plans for dynamic input shapes
+ */
+struct ShapePlanCacheStats
+{
+  uint32_t num_buckets = 0; //< Number of cached input shapes
+  uint64_t num_hits = 0;    //< Number of executions with cached input shapes
+  uint64_t num_misses = 0;  //< Number of executions with dynamic input shapes not cached
+};
+
 /**
  * @brief Struct to define interface of Executor
  */
@@ -121,6 +131,12 @@ struct IExecutor
    * @return  Current execution configuration
    */
   virtual const ExecutionOptions &currentOptions() const = 0;
+
+  /**
+   * @brief   Return statistics of shape plan cache
+   * @return  Statistics, all zero if executor does not use the cache
+   */
+  virtual ShapePlanCacheStats shapePlanCacheStats() const { return ShapePlanCacheStats{}; }
 };
 
 } // namespace exec
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  PipelineExecution.h
+ * @brief This file defines pipelined execution of multi-model package
+ */
+#ifndef __ONERT_EXEC_PIPELINE_EXECUTION_H__
+#define __ONERT_EXEC_PIPELINE_EXECUTION_H__
+
+#include "exec/Execution.h"
+#include "exec/IExecutors.h"
+#include "ir/NNPkg.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to run models of nnpackage as pipeline stages
+ *
+ * Each model is a stage running on its own thread with its own Execution, and stages are
+ * connected by bounded queues. So stage k of a request overlaps with stage k+1 of the previous
+ * request. Inputs are copied on push, and each request owns its edge and output buffers.
+ *
+ * @note Like MultiModelExecutors, edges should go from a model to a later model only
+ * @note Dynamic shape is not supported yet
+ */
+class PipelineExecution
+{
+public:
+  /**
+   * @brief Request passing through pipeline stages
+   */
+  struct Request
+  {
+    std::vector<std::vector<uint8_t>> inputs;
+    // Buffers of model outputs, keyed by IODesc of the output
+    std::map<ir::IODesc, std::vector<uint8_t>> outputs;
+    std::exception_ptr error;
+  };
+
+private:
+  /**
+   * @brief Queue between stages, which blocks producer when full and consumer when empty
+   */
+  class RequestQueue
+  {
+  public:
+    RequestQueue(size_t capacity) : _capacity{capacity} {}
+
+  public:
+    void push(std::unique_ptr<Request> &&request);
+    /**
+     * @brief  Pop a request
+     * @return Request, or @c nullptr if the queue is closed and empty
+     */
+    std::unique_ptr<Request> pop();
+    void close();
+
+  private:
+    const size_t _capacity;
+    std::deque<std::unique_ptr<Request>> _queue;
+    std::mutex _mu;
+    std::condition_variable _cv_push;
+    std::condition_variable _cv_pop;
+    bool _closed{false};
+  };
+
+public:
+  /**
+   * @brief     Construct a new PipelineExecution object and start stage threads
+   * @note      Compiler artifacts of stages should outlive this object
+   * @param[in] stages          Compiled executors of each model, in model index order
+   * @param[in] edges           Package inputs/outputs and edges between models
+   * @param[in] queue_capacity  Maximum number of requests waiting for each stage
+   */
+  PipelineExecution(const std::vector<std::shared_ptr<IExecutors>> &stages,
+                    const ir::ModelEdges &edges, size_t queue_capacity = 2);
+  ~PipelineExecution();
+
+public:
+  /**
+   * @brief     Push a request to the first stage
+   * @note      It blocks while the first stage queue is full
+   * @param[in] inputs  Buffers of package inputs
+   * @param[in] lengths Lengths of package input buffers
+   */
+  void push(const std::vector<const void *> &inputs, const std::vector<size_t> &lengths);
+  /**
+   * @brief      Pop the oldest finished request
+   * @note       It blocks until a request is finished or the pipeline is closed
+   * @param[out] outputs  Buffers of package outputs
+   * @return     @c false if the pipeline is closed and there is no request, otherwise @c true
+   */
+  bool pop(std::vector<std::vector<uint8_t>> &outputs);
+  /**
+   * @brief Close the pipeline. Pushed requests are still processed and can be popped
+   */
+  void close();
+
+  uint32_t inputSize() const { return _edges.pkg_inputs.size(); }
+  uint32_t outputSize() const { return _edges.pkg_outputs.size(); }
+
+private:
+  void runStage(uint16_t stage);
+  void executeStage(uint16_t stage, Request &request);
+
+private:
+  std::vector<std::shared_ptr<IExecutors>> _stages_executors;
+  std::vector<std::unique_ptr<Execution>> _executions;
+  const ir::ModelEdges _edges;
+  // _queues[k] is the input queue of stage k, and the last one holds finished requests
+  std::vector<std::unique_ptr<RequestQueue>> _queues;
+  std::vector<std::thread> _threads;
+  std::mutex _mu_push;
+  bool _closed{false};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_PIPELINE_EXECUTION_H__
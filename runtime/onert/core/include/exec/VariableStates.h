@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  VariableStates.h
+ * @brief This file contains VariableStates class to keep variable tensors across runs
+ */
+
+#ifndef __ONERT_EXEC_VARIABLE_STATES_H__
+#define __ONERT_EXEC_VARIABLE_STATES_H__
+
+#include <atomic>
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Streaming mode of variable tensors of a compiled model
+ *
+ * Variable tensors (e.g. cell and hidden states of LSTM) are initialized to zero on each run by
+ * default. If a compiled model has this object, kernels keep their states in their own buffers
+ * and continue from them on next run, so that a long sequence can be fed in chunks.
+ *
+ * reset() starts a new sequence. Kernels compare generation() with the value they saw on last
+ * run and initialize their states again if it is changed.
+ */
+class VariableStates
+{
+public:
+  /**
+   * @brief Make kernels initialize their states on next run
+   */
+  void reset() { _generation.fetch_add(1, std::memory_order_relaxed); }
+
+  /**
+   * @brief  Number of reset() calls, states are kept while it is not changed
+   */
+  uint32_t generation() const { return _generation.load(std::memory_order_relaxed); }
+
+private:
+  std::atomic<uint32_t> _generation{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_VARIABLE_STATES_H__
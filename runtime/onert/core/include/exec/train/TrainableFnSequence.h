@@ -34,7 +34,8 @@ class TrainableFnSequence
 {
 public:
   void forward(bool training);
-  void backward(uint32_t training_step, bool weight_update_enabled);
+  void backward();
+  void applyGradients(uint32_t training_step);
 
   void append(std::unique_ptr<ITrainableFunction> &&fn);
   void append(std::unique_ptr<IGradientApplier> &&applier);
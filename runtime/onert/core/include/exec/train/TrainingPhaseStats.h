@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_TRAIN_TRAINING_PHASE_STATS_H__
+#define __ONERT_EXEC_TRAIN_TRAINING_PHASE_STATS_H__
+
+#include <cstdint>
+
+namespace onert
+{
+namespace exec
+{
+namespace train
+{
+
+/**
+ * @brief Time spent in each phase of training steps
+ *
+ * Weights of an operation are updated right after its backward, so update is timed per operation
+ * and excluded from backward.
+ */
+struct TrainingPhaseStats
+{
+  // Number of training steps
+  uint64_t num_steps = 0;
+  // Accumulated time of forward in microseconds
+  uint64_t forward_us = 0;
+  // Accumulated time of backward in microseconds, including recomputation of activations
+  uint64_t backward_us = 0;
+  // Accumulated time of weight update in microseconds
+  uint64_t update_us = 0;
+};
+
+} // namespace train
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_TRAIN_TRAINING_PHASE_STATS_H__
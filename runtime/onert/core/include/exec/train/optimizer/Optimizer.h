@@ -21,6 +21,8 @@
 #include "backend/train/ITrainableTensor.h"
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace onert
 {
@@ -35,6 +37,10 @@ namespace optimizer
 using UpdateFactors =
   std::tuple<const backend::IPortableTensor &, backend::train::ITrainableTensor &, size_t>;
 
+// Gradient tensor and Trainable tensor of each tensor to be updated at once
+using MultiUpdateTensors =
+  std::vector<std::pair<const backend::IPortableTensor *, backend::train::ITrainableTensor *>>;
+
 /**
  * @class   Optimizer Base class for optimizers
  * @brief   Base class for all optimizers
@@ -73,6 +79,21 @@ public:
    */
   virtual void applyGradient(const UpdateFactors &factors) const = 0;
 
+  /**
+   * @brief Apply gradients to multiple trainable tensors at once
+   *
+   * Optimizers may override it to update all the tensors in one pass. By default, they are
+   * updated one by one.
+   *
+   * @param tensors       Gradient tensor and trainable tensor of each tensor
+   * @param training_step The number of training steps
+   */
+  virtual void applyGradients(const MultiUpdateTensors &tensors, size_t training_step) const
+  {
+    for (const auto &[grad_tensor, trainable_tensor] : tensors)
+      applyGradient(std::forward_as_tuple(*grad_tensor, *trainable_tensor, training_step));
+  }
+
   // TODO Add member functions for exporting optimizer information
 };
 
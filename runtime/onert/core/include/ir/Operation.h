@@ -18,6 +18,8 @@
 #define __ONERT_IR_OPERATION_H__
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "ir/IOperation.h"
 #include "ir/Operand.h"
@@ -56,12 +58,16 @@ public:
   // It's for only input/output tensors but const data.
   void setInputs(const OperandIndexSequence &indexes);
   void setOutputs(const OperandIndexSequence &indexes);
+  // Names of operations which are fused into this operation by compiler passes
+  const std::vector<std::string> &fusedOperations() const { return _fused_operations; }
+  void setFusedOperations(const std::vector<std::string> &names) { _fused_operations = names; }
 
 private:
   OperandConstraint _input_constr;
   OperandConstraint _output_constr;
   OperandIndexSequence _inputs;
   OperandIndexSequence _outputs;
+  std::vector<std::string> _fused_operations;
 };
 
 } // namespace ir
@@ -145,6 +145,16 @@ inline bool operator!=(const Shape &lhs, const Shape &rhs) { return lhs.dims() !
  */
 Shape convertShape(const Shape &shape, const PermuteType &type);
 
+/**
+ * @brief   Check if permutation keeps the memory order of elements in the shape
+ *
+ * @param[in] shape Shape in the source layout of the permutation
+ * @param[in] type  Permutation type
+ * @return  @c true if permutation of the type is just a copy for the shape, i.e. rank is not 4,
+ *          channel is 1 or height * width is 1. @c false if any dimension is unspecified
+ */
+bool isIdentityPermutation(const Shape &shape, const PermuteType &type);
+
 /**
  * @brief Find out if tha rank in this shape is "maybe" unspecified.
  *        Note that when rank == 0, shape could represent scalar or unspecified rank
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  WeightStore.h
+ * @brief This file contains WeightStore class to share constant data across sessions
+ */
+
+#ifndef __ONERT_IR_WEIGHT_STORE_H__
+#define __ONERT_IR_WEIGHT_STORE_H__
+
+#include "ir/Data.h"
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace onert
+{
+namespace ir
+{
+
+/**
+ * @brief Process-wide store of constant data shared by sessions loading the same model
+ *
+ * Raw constant data is keyed by identity of model file and buffer index, and backend-packed
+ * forms of it (e.g. transposed filter) are keyed by key of raw data and kind of packing.
+ * Store keeps weak references only, so data is released when the last session using it is closed.
+ */
+class WeightStore
+{
+public:
+  static WeightStore &get();
+
+public:
+  /**
+   * @brief     Get raw data of the key, or create and store it if there is no living one
+   * @param[in] key     Key of data
+   * @param[in] create  Function to create data
+   * @return    Data shared by sessions
+   */
+  std::shared_ptr<Data> getOrCreate(const std::string &key,
+                                    const std::function<std::shared_ptr<Data>()> &create);
+  /**
+   * @brief     Get key of raw data created by this store
+   * @return    Key of data, or empty string if data is not from this store
+   */
+  std::string keyOf(const Data *data) const;
+
+  /**
+   * @brief     Find packed form of raw data
+   * @param[in] key   Key of raw data
+   * @param[in] kind  Kind of packing, it should include every property deciding packed form
+   * @return    Packed form, or nullptr if there is no living one
+   */
+  template <typename T>
+  std::shared_ptr<const T> findPacked(const std::string &key, const std::string &kind) const
+  {
+    return std::static_pointer_cast<const T>(findPackedImpl(key + "#" + kind));
+  }
+  /**
+   * @brief     Store packed form of raw data
+   * @return    Stored packed form, which is a living one stored by other session if exists
+   */
+  template <typename T>
+  std::shared_ptr<const T> insertPacked(const std::string &key, const std::string &kind,
+                                        const std::shared_ptr<const T> &packed)
+  {
+    return std::static_pointer_cast<const T>(insertPackedImpl(key + "#" + kind, packed));
+  }
+
+  /**
+   * @brief  Get number of living raw data in this store
+   */
+  size_t size() const;
+
+private:
+  WeightStore() = default;
+  std::shared_ptr<const void> findPackedImpl(const std::string &key) const;
+  std::shared_ptr<const void> insertPackedImpl(const std::string &key,
+                                               const std::shared_ptr<const void> &packed);
+  // Remove entries of released data, amortized by number of entries
+  void purge();
+
+private:
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, std::weak_ptr<Data>> _data;
+  std::unordered_map<const Data *, std::pair<std::weak_ptr<Data>, std::string>> _keys;
+  std::unordered_map<std::string, std::weak_ptr<const void>> _packed;
+  size_t _purge_threshold{64};
+};
+
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_WEIGHT_STORE_H__
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_IR_OPERATION_ATTENTION_H__
+#define __ONERT_IR_OPERATION_ATTENTION_H__
+
+#include "ir/Operation.h"
+
+namespace onert
+{
+namespace ir
+{
+namespace operation
+{
+
+/**
+ * @brief Scaled dot-product attention, softmax(QUERY * KEY^T * scale + MASK) * VALUE
+ *
+ * It is not a builtin operator of circle. Compiler fuses the pattern of
+ * BatchMatMul - Mul - Add - Softmax - BatchMatMul into custom operator "ScaledDotProductAttention".
+ *
+ * If causal is set, i-th row of QUERY attends KEY rows up to (key_len - query_len + i), i.e. the
+ * causal mask of the compiler is fused into the operation.
+ *
+ * If cache_size is not 0, KEY and VALUE are rows of new tokens which are appended to the kv cache
+ * of the operation, and QUERY attends all cached tokens. MASK is not allowed with it, as its
+ * columns cannot cover the cached tokens, so only causal masking is available.
+ */
+class Attention : public Operation
+{
+public:
+  enum Input
+  {
+    QUERY = 0,
+    KEY,
+    VALUE,
+    MASK // Optional
+  };
+
+  struct Param
+  {
+    float scale;
+    // Max number of tokens in kv cache, 0 for no kv cache
+    int32_t cache_size;
+    // Whether each query attends only keys up to its own position
+    bool causal;
+  };
+
+public:
+  Attention(const OperandIndexSequence &inputs, const OperandIndexSequence &outputs,
+            const Param &param);
+
+public:
+  void accept(OperationVisitor &v) const override;
+  OpCode opcode() const final { return OpCode::Attention; }
+
+public:
+  const Param &param() const { return _param; }
+
+private:
+  Param _param;
+};
+
+} // namespace operation
+} // namespace ir
+} // namespace onert
+
+#endif // __ONERT_IR_OPERATION_ATTENTION_H__
@@ -37,7 +37,8 @@ class TrainingInfo final
 public:
   TrainingInfo()
     : _version{0}, _loss_info(), _optimizer_info(), _batch_size(0), _training_step{0},
-      _trainable_ops{}
+      _trainable_ops{}, _recompute_segment_size{0}, _activation_memory_budget{0},
+      _gradient_accumulation_steps{1}, _multi_tensor_update{false}
   {
   }
   TrainingInfo(const TrainingInfo &) = default;
@@ -53,6 +54,10 @@ public:
   uint32_t batchSize() const { return _batch_size; }
   const uint32_t &trainingStep() const { return _training_step; }
   const std::set<OperationIndex> &getTrainableOps() const { return _trainable_ops; }
+  uint32_t recomputeSegmentSize() const { return _recompute_segment_size; }
+  uint64_t activationMemoryBudget() const { return _activation_memory_budget; }
+  uint32_t gradientAccumulationSteps() const { return _gradient_accumulation_steps; }
+  bool multiTensorUpdate() const { return _multi_tensor_update; }
 
   // setter
   void setVersion(const uint32_t version) { _version = version; }
@@ -64,6 +69,13 @@ public:
   {
     _trainable_ops = trainable_ops;
   }
+  void setRecomputeSegmentSize(const uint32_t segment_size)
+  {
+    _recompute_segment_size = segment_size;
+  }
+  void setActivationMemoryBudget(const uint64_t budget) { _activation_memory_budget = budget; }
+  void setGradientAccumulationSteps(const uint32_t steps) { _gradient_accumulation_steps = steps; }
+  void setMultiTensorUpdate(const bool enable) { _multi_tensor_update = enable; }
 
   bool isValid() const;
 
@@ -74,6 +86,14 @@ private:
   uint32_t _batch_size;
   uint32_t _training_step;
   std::set<OperationIndex> _trainable_ops;
+  // Number of operations in a segment to recompute in backwarding, 0 if not fixed
+  uint32_t _recompute_segment_size;
+  // Bytes of activations to be kept for backwarding, 0 if not limited
+  uint64_t _activation_memory_budget;
+  // Number of micro-batches whose gradients are averaged to update weights once
+  uint32_t _gradient_accumulation_steps;
+  // Whether trainable tensors of all operations are updated at once after backwarding
+  bool _multi_tensor_update;
 };
 
 } // namespace train
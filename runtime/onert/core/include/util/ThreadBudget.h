@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file  ThreadBudget.h
+ * @brief This file contains classes to bound compute threads of all sessions in a process
+ */
+
+#ifndef __ONERT_UTIL_THREAD_BUDGET_H__
+#define __ONERT_UTIL_THREAD_BUDGET_H__
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+namespace onert
+{
+namespace util
+{
+
+/**
+ * @brief Compute threads granted to a compiled model by ThreadBudget
+ *
+ * Backends size their thread pools (e.g. ruy context, xnnpack pthreadpool) by numThreads(), and
+ * compilation and execution run on cores() if it is not empty. Backend contexts of the model share
+ * a thread pool by getOrCreate() instead of creating one each.
+ * Granted threads are returned to the budget when this object is destroyed.
+ */
+class ThreadQuota
+{
+public:
+  ~ThreadQuota();
+  ThreadQuota(const ThreadQuota &) = delete;
+  ThreadQuota &operator=(const ThreadQuota &) = delete;
+
+public:
+  /**
+   * @brief  Number of threads for thread pool of each backend, 0 for backend default
+   */
+  uint32_t numThreads() const { return _num_threads; }
+  /**
+   * @brief  Cores to run compute threads on, empty for no restriction
+   */
+  const std::vector<int> &cores() const { return _cores; }
+  /**
+   * @brief  Get the object of type @c T shared in the model, which is made by @c create at first
+   */
+  template <typename T>
+  std::shared_ptr<T> getOrCreate(const std::function<std::shared_ptr<T>()> &create) const
+  {
+    std::lock_guard<std::mutex> lock{_shared_mutex};
+    auto &shared = _shared[std::type_index(typeid(T))];
+    if (shared == nullptr)
+      shared = create();
+    return std::static_pointer_cast<T>(shared);
+  }
+
+private:
+  friend class ThreadBudget;
+  ThreadQuota(uint32_t num_threads, uint32_t charged, const std::vector<int> &cores);
+
+private:
+  uint32_t _num_threads;
+  uint32_t _charged;
+  std::vector<int> _cores;
+  mutable std::mutex _shared_mutex;
+  mutable std::unordered_map<std::type_index, std::shared_ptr<void>> _shared;
+};
+
+/**
+ * @brief Process-wide budget of compute threads shared by all sessions
+ *
+ * Backends create their own thread pools, so the budget bounds the size of them instead of
+ * owning threads. A model has one thread pool for each kind of them, and they are used one at a
+ * time by linear executor, so that the number of busy compute threads does not exceed the limit.
+ *
+ * Eigen thread pool used by some kernels is the exception. It is shared by all sessions in the
+ * process and not charged to any model, and it has as many threads as the limit at its creation
+ * on first use, or hardware concurrency if the limit is not set.
+ */
+class ThreadBudget
+{
+public:
+  static ThreadBudget &get();
+
+public:
+  /**
+   * @brief Set maximum number of compute threads of all sessions, 0 for no limit
+   * @note  It is applied to models compiled after this call, and to Eigen thread pool if it is
+   *        not created yet
+   */
+  void setLimit(uint32_t limit);
+  uint32_t limit() const;
+  /**
+   * @brief Get number of compute threads granted to living models
+   */
+  uint32_t used() const;
+  /**
+   * @brief     Grant compute threads to a model
+   * @param[in] num_threads Requested number of threads, 0 or less for backend default
+   * @param[in] cores       Cores to run compute threads on, empty for no restriction
+   * @return    Granted quota
+   *
+   * If limit is set, threads are granted as many as remaining in the budget, and a model
+   * requesting backend default gets 1 thread. At least 1 thread (the calling thread) is granted
+   * even if the budget is exhausted.
+   */
+  std::shared_ptr<const ThreadQuota> acquire(int32_t num_threads, const std::vector<int> &cores);
+
+private:
+  ThreadBudget();
+  void release(uint32_t num_threads);
+
+private:
+  friend class ThreadQuota;
+  mutable std::mutex _mutex;
+  uint32_t _limit;
+  uint32_t _used;
+};
+
+/**
+ * @brief Scope to run the calling thread on given cores
+ *
+ * Threads created in this scope inherit the affinity. Thread pools of backends are created in
+ * compilation or on first execution, so that their threads also run on the cores.
+ * Previous affinity is restored at the end of scope.
+ */
+class AffinityScope
+{
+public:
+  AffinityScope(const std::vector<int> &cores);
+  ~AffinityScope();
+  AffinityScope(const AffinityScope &) = delete;
+  AffinityScope &operator=(const AffinityScope &) = delete;
+
+private:
+  bool _applied;
+  std::vector<int> _prev_cores;
+};
+
+} // namespace util
+} // namespace onert
+
+#endif // __ONERT_UTIL_THREAD_BUDGET_H__
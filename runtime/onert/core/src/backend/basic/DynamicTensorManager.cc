@@ -16,6 +16,7 @@
 
 #include "backend/basic/DynamicTensorManager.h"
 
+#include "util/ConfigSource.h"
 #include "util/logging.h"
 #include "misc/polymorphic_downcast.h"
 
@@ -27,9 +28,12 @@ namespace basic
 {
 
 DynamicTensorManager::DynamicTensorManager(const std::shared_ptr<TensorRegistry> &reg)
-  : _dynamic_mem_mgr{new DynamicMemoryManager()}, _tensors{reg}
+  : _tensors{reg}
 {
-  // DO NOTHING
+  // Negative limit means that all freed blocks are kept for reuse
+  const auto pool_limit_kb = util::getConfigInt(util::config::DYNAMIC_MEM_POOL_LIMIT_KB);
+  _dynamic_mem_mgr = std::make_shared<DynamicMemoryManager>(
+    pool_limit_kb < 0 ? -1 : static_cast<int64_t>(pool_limit_kb) * 1024);
 }
 
 void DynamicTensorManager::buildTensor(const ir::OperandIndex &ind,
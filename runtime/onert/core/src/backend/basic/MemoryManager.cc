@@ -16,7 +16,9 @@
 
 #include <backend/basic/MemoryManager.h>
 
+#include <algorithm>
 #include <cassert>
+#include <limits>
 
 #include "MemoryPlannerFactory.h"
 #include "util/ConfigSource.h"
@@ -72,6 +74,21 @@ uint8_t *MemoryManager::getBuffer(const ir::OperandIndex &ind) const
   return _mem_alloc->base() + mem_blk.offset;
 }
 
+uint32_t DynamicMemoryManager::sizeClass(uint32_t capacity)
+{
+  constexpr uint32_t min_size_class = 64;
+  if (capacity <= min_size_class)
+    return min_size_class;
+
+  // 4 size classes between two powers of two: 2^n * {1.25, 1.5, 1.75, 2}
+  uint32_t msb = 0;
+  for (auto v = capacity - 1; v > 1; v >>= 1)
+    msb++;
+  const uint64_t step = 1ull << (msb - 2);
+  const uint64_t size = (capacity + step - 1) & ~(step - 1);
+  return size > std::numeric_limits<uint32_t>::max() ? capacity : static_cast<uint32_t>(size);
+}
+
 std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *tensor,
                                                                  uint32_t capacity)
 {
@@ -79,8 +96,51 @@ std::shared_ptr<basic::Allocator> DynamicMemoryManager::allocate(const ITensor *
   if (find != _mem_alloc_map.end())
     throw std::runtime_error("Cannot allocate memory for a tensor. It was already allocated.");
 
-  _mem_alloc_map[tensor] = std::make_shared<basic::Allocator>(capacity);
-  return _mem_alloc_map[tensor];
+  const auto size = sizeClass(capacity);
+  std::unique_ptr<uint8_t[]> base;
+  auto free_blocks = _free_blocks.find(size);
+  if (free_blocks != _free_blocks.end() && !free_blocks->second.empty())
+  {
+    base = std::move(free_blocks->second.back());
+    free_blocks->second.pop_back();
+    _stats.pooled_bytes -= size;
+    _stats.num_reuses++;
+  }
+  else
+  {
+    base = std::unique_ptr<uint8_t[]>(new uint8_t[size]);
+    _stats.num_system_allocs++;
+    VERBOSE(ALLOC) << "dynamic allocation capacity: " << capacity << ", size class: " << size
+                   << std::endl;
+  }
+
+  _stats.in_use_bytes += size;
+  _stats.peak_in_use_bytes = std::max(_stats.peak_in_use_bytes, _stats.in_use_bytes);
+  _stats.peak_total_bytes =
+    std::max(_stats.peak_total_bytes, _stats.in_use_bytes + _stats.pooled_bytes);
+
+  auto &allocation = _mem_alloc_map[tensor];
+  allocation.allocator = std::make_shared<basic::Allocator>(std::move(base));
+  allocation.size = size;
+  return allocation.allocator;
+}
+
+void DynamicMemoryManager::releaseToPool(Allocation &allocation)
+{
+  assert(_stats.in_use_bytes >= allocation.size);
+  _stats.in_use_bytes -= allocation.size;
+
+  // Memory may be released already by the tensor
+  auto base = allocation.allocator->takeBase();
+  if (base == nullptr)
+    return;
+
+  // Release to system if pool is full
+  if (_pool_limit >= 0 && _stats.pooled_bytes + allocation.size > static_cast<size_t>(_pool_limit))
+    return;
+
+  _free_blocks[allocation.size].emplace_back(std::move(base));
+  _stats.pooled_bytes += allocation.size;
 }
 
 void DynamicMemoryManager::deallocate(const ITensor *tensor)
@@ -89,7 +149,7 @@ void DynamicMemoryManager::deallocate(const ITensor *tensor)
   if (find == _mem_alloc_map.end())
     throw std::runtime_error("Cannot find Allocator for the requested index");
 
-  find->second->release();    // explicitly erase memory
+  releaseToPool(find->second);
   _mem_alloc_map.erase(find); // remove tensor and alloc
 }
 
@@ -97,13 +157,28 @@ void DynamicMemoryManager::deallocate(void)
 {
   for (auto &&mem_alloc : _mem_alloc_map)
   {
-    // Release memory buffer of mem_alloc
-    mem_alloc.second->release();
+    // Move memory buffer of mem_alloc to pool
+    releaseToPool(mem_alloc.second);
   }
 
   _mem_alloc_map.clear();
 }
 
+void DynamicMemoryManager::trim(size_t max_pooled_bytes)
+{
+  // Release larger blocks first
+  for (auto it = _free_blocks.rbegin();
+       it != _free_blocks.rend() && _stats.pooled_bytes > max_pooled_bytes; ++it)
+  {
+    auto &blocks = it->second;
+    while (!blocks.empty() && _stats.pooled_bytes > max_pooled_bytes)
+    {
+      blocks.pop_back();
+      _stats.pooled_bytes -= it->first;
+    }
+  }
+}
+
 } // namespace basic
 } // namespace backend
 } // namespace onert
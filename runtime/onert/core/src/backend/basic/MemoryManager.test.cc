@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/Tensor.h"
+
+using namespace onert;
+using namespace onert::backend::basic;
+
+namespace
+{
+
+std::unique_ptr<Tensor> createTensor(DynamicMemoryManager *mgr)
+{
+  auto info = ir::OperandInfo::createStaticInfo(ir::Shape{1}, ir::TypeInfo{ir::DataType::FLOAT32});
+  return std::make_unique<Tensor>(info, mgr);
+}
+
+} // namespace
+
+TEST(DynamicMemoryManager, size_class)
+{
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(0), 64);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(64), 64);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(65), 80);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(128), 128);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(129), 160);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(1000), 1024);
+  EXPECT_EQ(DynamicMemoryManager::sizeClass(1025), 1280);
+}
+
+TEST(DynamicMemoryManager, reuse_freed_block)
+{
+  DynamicMemoryManager mgr;
+  auto tensor = createTensor(&mgr);
+
+  // Growing and shrinking shapes in the same size classes are served by pool after warming up
+  for (int run = 0; run < 3; ++run)
+  {
+    ASSERT_NE(mgr.allocate(tensor.get(), 1000)->base(), nullptr);
+    mgr.deallocate(tensor.get());
+    ASSERT_NE(mgr.allocate(tensor.get(), 2000)->base(), nullptr);
+    mgr.deallocate(tensor.get());
+  }
+
+  const auto &stats = mgr.stats();
+  EXPECT_EQ(stats.num_system_allocs, 2);
+  EXPECT_EQ(stats.num_reuses, 4);
+  EXPECT_EQ(stats.in_use_bytes, 0);
+  EXPECT_EQ(stats.pooled_bytes, 1024 + 2048);
+  EXPECT_EQ(stats.peak_in_use_bytes, 2048);
+  EXPECT_EQ(stats.peak_total_bytes, 1024 + 2048);
+
+  mgr.trim(1024);
+  EXPECT_EQ(mgr.stats().pooled_bytes, 1024);
+  mgr.trim();
+  EXPECT_EQ(mgr.stats().pooled_bytes, 0);
+}
+
+TEST(DynamicMemoryManager, pool_limit)
+{
+  DynamicMemoryManager mgr(1024);
+  auto tensor1 = createTensor(&mgr);
+  auto tensor2 = createTensor(&mgr);
+
+  mgr.allocate(tensor1.get(), 1024);
+  mgr.allocate(tensor2.get(), 1024);
+  mgr.deallocate();
+
+  // Only one block is kept in pool
+  EXPECT_EQ(mgr.stats().pooled_bytes, 1024);
+  EXPECT_EQ(mgr.stats().in_use_bytes, 0);
+}
+
+TEST(DynamicMemoryManager, neg_allocate_twice)
+{
+  DynamicMemoryManager mgr;
+  auto tensor = createTensor(&mgr);
+
+  mgr.allocate(tensor.get(), 16);
+  EXPECT_ANY_THROW(mgr.allocate(tensor.get(), 16));
+  mgr.deallocate(tensor.get());
+  EXPECT_ANY_THROW(mgr.deallocate(tensor.get()));
+}
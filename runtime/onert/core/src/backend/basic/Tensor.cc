@@ -52,6 +52,16 @@ bool Tensor::applyShape(const ir::Shape &new_shape)
   return true;
 }
 
+void Tensor::setPlannedBuffer(const ir::Shape &new_shape, uint8_t *buffer)
+{
+  deallocBuffer();
+
+  _info.shape(new_shape);
+  set_dynamic();
+  _size = _info.total_size();
+  _buffer = buffer;
+}
+
 void Tensor::deallocBuffer()
 {
   if (_allocator)
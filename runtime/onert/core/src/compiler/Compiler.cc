@@ -21,6 +21,7 @@
 #include "ShapeValidator.h"
 #include "pass/ConstantOutputPass.h"
 #include "pass/OddOutputPass.h"
+#include "pass/OperationFusionPass.h"
 #include "pass/PassRunner.h"
 #include "pass/UnusedOperandEliminationPass.h"
 #include "../dumper/dot/DotDumper.h"
@@ -78,8 +79,18 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
   _options->forceInternalOptions();
   _options->verboseOptions();
 
+  // Grant compute threads before thread pools of backends are created
+  auto thread_quota =
+    util::ThreadBudget::get().acquire(_options->num_threads, _options->cpu_affinity);
+  util::AffinityScope affinity{thread_quota->cores()};
+
   auto custom_kernel_builder = _model->getKernelBuilder();
 
+  // Variable tensors are kept across runs in streaming mode
+  std::shared_ptr<exec::VariableStates> variable_states;
+  if (_options->keep_variable_states)
+    variable_states = std::make_shared<exec::VariableStates>();
+
   _model->iterate([&](const ir::SubgraphIndex &, ir::IGraph &graph) {
     auto &subg = nnfw::misc::polymorphic_downcast<ir::Graph &>(graph);
 
@@ -90,7 +101,10 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
       .run();
 
     // Optimizations
-    pass::PassRunner{}.append(std::make_unique<pass::UnusedOperandEliminationPass>(subg)).run();
+    pass::PassRunner{}
+      .append(std::make_unique<pass::OperationFusionPass>(subg))
+      .append(std::make_unique<pass::UnusedOperandEliminationPass>(subg))
+      .run();
   });
 
   /***************************************************
@@ -172,6 +186,8 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
     args.options = _options;
     args.model_index = model_index;
     args.custom_kernel_builder = custom_kernel_builder;
+    args.thread_quota = thread_quota;
+    args.variable_states = variable_states;
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), executors, args)};
     executor->setIndexedRanks(indexed_ranks);
@@ -181,7 +197,8 @@ std::shared_ptr<CompilerArtifact> Compiler::compile(void)
   /********************************
    * Code generation phase finished
    ********************************/
-  return std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx));
+  return std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx), thread_quota,
+                                            variable_states);
 }
 
 } // namespace compiler
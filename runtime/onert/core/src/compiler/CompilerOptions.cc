@@ -23,6 +23,8 @@
 
 #include <misc/string_helpers.h>
 
+#include <algorithm>
+
 namespace
 {
 
@@ -78,12 +80,17 @@ std::unique_ptr<CompilerOptions> CompilerOptions::fromGlobalConfig()
 {
   auto o = std::make_unique<CompilerOptions>();
   o->backend_list = nnfw::misc::split(util::getConfigString(util::config::BACKENDS), ';');
+  o->shape_plan_cache_size =
+    static_cast<uint32_t>(std::max(0, util::getConfigInt(util::config::SHAPE_PLAN_CACHE_SIZE)));
+  o->num_threads = util::getConfigInt(util::config::COMPUTE_THREADS);
+  o->setCpuAffinity(util::getConfigString(util::config::CPU_AFFINITY));
   o->graph_dump_level = util::getConfigInt(util::config::GRAPH_DOT_DUMP);
   o->executor = util::getConfigString(util::config::EXECUTOR);
   o->he_scheduler = util::getConfigBool(util::config::USE_SCHEDULER);
   o->he_profiling_mode = util::getConfigBool(util::config::PROFILING_MODE);
   o->fp16_enable = util::getConfigBool(util::config::FP16_ENABLE);
   o->workspace_dir = util::getConfigString(util::config::WORKSPACE_DIR);
+  o->keep_variable_states = util::getConfigBool(util::config::KEEP_VARIABLE_STATES);
   {
     // Backend for all
     auto &ms_options = o->manual_scheduler_options;
@@ -126,11 +133,33 @@ void CompilerOptions::forceInternalOptions()
   manual_scheduler_options.opcode_to_backend[ir::OpCode::Bulk] = "trix";
 }
 
+void CompilerOptions::setCpuAffinity(const std::string &str)
+{
+  cpu_affinity.clear();
+  for (const auto &core_str : nnfw::misc::split(str, ','))
+  {
+    if (core_str.empty())
+      continue;
+
+    const auto core = std::stoi(core_str);
+    if (core < 0)
+      throw std::runtime_error{"Invalid core id: " + core_str};
+    cpu_affinity.emplace_back(core);
+  }
+}
+
 void CompilerOptions::verboseOptions()
 {
   VERBOSE(Compiler) << std::boolalpha << "==== Compiler Options ====" << std::endl;
   VERBOSE(Compiler) << "backend_list             : "
                     << nnfw::misc::join(backend_list.begin(), backend_list.end(), "/") << std::endl;
+  VERBOSE(Compiler) << "shape_plan_cache_size    : " << shape_plan_cache_size << std::endl;
+  VERBOSE(Compiler) << "num_threads              : " << num_threads << std::endl;
+  std::vector<std::string> cores;
+  for (const auto core : cpu_affinity)
+    cores.emplace_back(std::to_string(core));
+  VERBOSE(Compiler) << "cpu_affinity             : "
+                    << nnfw::misc::join(cores.begin(), cores.end(), ",") << std::endl;
   VERBOSE(Compiler) << "graph_dump_level         : " << graph_dump_level << std::endl;
   VERBOSE(Compiler) << "executor                 : " << executor << std::endl;
   VERBOSE(Compiler) << "manual backend_for_all   : " << manual_scheduler_options.backend_for_all
@@ -139,7 +168,8 @@ void CompilerOptions::verboseOptions()
                     << getOpBackends(manual_scheduler_options.opcode_to_backend) << std::endl;
   VERBOSE(Compiler) << "he_scheduler             : " << he_scheduler << std::endl;
   VERBOSE(Compiler) << "he_profiling_mode        : " << he_profiling_mode << std::endl;
-  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl
+  VERBOSE(Compiler) << "fp16_enable              : " << fp16_enable << std::endl;
+  VERBOSE(Compiler) << "keep_variable_states     : " << keep_variable_states << std::endl
                     << std::noboolalpha;
 }
 
@@ -17,6 +17,7 @@
 #include "ExecutorFactory.h"
 
 #include "Linear.h"
+#include "train/RecomputePlanner.h"
 #include "../backend/builtin/BackendContext.h"
 #include "../backend/builtin/Config.h"
 #include "../backend/builtin/UserTensor.h"
@@ -145,7 +146,9 @@ void initializeSubgraphIOTensors(compiler::ILoweredGraph &lowered_graph,
 
 backend::BackendContexts
 createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
-                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder)
+                      std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder,
+                      std::shared_ptr<const util::ThreadQuota> thread_quota,
+                      std::shared_ptr<const exec::VariableStates> variable_states = nullptr)
 {
   backend::BackendContexts contexts;
   std::unordered_map<const backend::Backend *, backend::ContextData> context_data_map;
@@ -242,6 +245,8 @@ createBackendContexts(compiler::ILoweredGraph &lgraph, bool linear_executor,
                  [&](const auto &ind) { return graph->operations().exist(ind); });
     data.is_linear_executor = linear_executor;
     data.custom_kernel_builder = custom_kernel_builder;
+    data.thread_quota = thread_quota;
+    data.variable_states = variable_states;
     contexts.emplace(backend, backend->newContext(std::move(data)));
   }
   return contexts;
@@ -389,7 +394,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
   auto &graph = lowered_graph->graph();
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          args.thread_quota, args.variable_states);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -493,7 +499,8 @@ ExecutorFactory::createLinearExecutor(std::unique_ptr<compiler::LoweredGraph> lo
                                        tensor_regs,
                                        std::move(code_map),
                                        order,
-                                       tracing_ctx};
+                                       tracing_ctx,
+                                       options->shape_plan_cache_size};
 
   if (!options->workspace_dir.empty())
   {
@@ -517,7 +524,8 @@ ExecutorFactory::createDataflowExecutor(std::unique_ptr<compiler::LoweredGraph>
   auto custom_kernel_builder = args.custom_kernel_builder;
 
   backend::BackendContexts backend_contexts =
-    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder);
+    createBackendContexts(*lowered_graph, options->executor == "Linear", custom_kernel_builder,
+                          args.thread_quota, args.variable_states);
 
   TensorRegistries tensor_regs{backend_contexts, true};
 
@@ -660,7 +668,33 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
   // TODO Create context only once instead of replacing
   backend::train::TrainableBackendContexts tbackend_contexts;
   backend::BackendContexts base_backend_contexts =
-    createBackendContexts(*lowered_graph, true, custom_kernel_builder);
+    createBackendContexts(*lowered_graph, true, custom_kernel_builder, args.thread_quota);
+
+  // linearize for forwarding
+  auto order = Linear::linearize(*lowered_graph);
+  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
+  Linear::dump(*lowered_graph, order);
+
+  // Plan activation recomputation which backends and the executor share
+  std::shared_ptr<const compiler::train::RecomputePlan> recompute_plan;
+  if (training_info.recomputeSegmentSize() > 0 || training_info.activationMemoryBudget() > 0)
+  {
+    // Operands shared with other backends or users are not recomputed
+    const auto &tgraph = lowered_graph->trainable_graph();
+    util::Set<ir::OperandIndex> excluded;
+    for (const auto &index : (tgraph.getInputs() + tgraph.getOutputs()) | ir::Remove::UNDEFINED)
+      excluded.add(index);
+    for (const auto &pair : base_backend_contexts)
+      for (const auto &index : pair.second->data().external_operands)
+        excluded.add(index);
+
+    const compiler::train::RecomputePlanner planner{tgraph, order, excluded};
+    auto plan = training_info.recomputeSegmentSize() > 0
+                  ? planner.plan(training_info.recomputeSegmentSize())
+                  : planner.planWithBudget(training_info.activationMemoryBudget());
+    if (!plan.empty())
+      recompute_plan = std::make_shared<const compiler::train::RecomputePlan>(std::move(plan));
+  }
 
   // Replace BackendContext with TrainbleBackendContext
   for (auto &&pair : base_backend_contexts)
@@ -719,7 +753,11 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     tdata.external_operands = std::move(external_operands);
     tdata.custom_kernel_builder = std::move(data.custom_kernel_builder);
     tdata.is_linear_executor = data.is_linear_executor;
+    tdata.thread_quota = data.thread_quota;
     tdata.optim_info = training_info.optimizerInfo();
+    tdata.recompute_plan = recompute_plan;
+    tdata.gradient_accumulation_steps = training_info.gradientAccumulationSteps();
+    tdata.multi_tensor_update = training_info.multiTensorUpdate();
 
     // TODO Remove dynamic_cast
     const auto tbackend = dynamic_cast<const backend::train::ITrainableBackend *>(backend);
@@ -739,11 +777,6 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
     (lowered_graph->graph().getInputs() + lowered_graph->graph().getOutputs()) |
       ir::Remove::DUPLICATED | ir::Remove::UNDEFINED);
 
-  // linearize for forwarding
-  auto order = Linear::linearize(*lowered_graph);
-  VERBOSE(ExecutorFactory) << "Linearize for forwarding order" << std::endl;
-  Linear::dump(*lowered_graph, order);
-
   // linearize for backwarding
   auto backward_order = lowered_graph->trainable_graph().essentialBackwardOrder();
   VERBOSE(ExecutorFactory) << "Linearize for backwarding order" << std::endl;
@@ -877,7 +910,8 @@ exec::IExecutor *ExecutorFactory::createTrainableExecutor(
                                                  order,
                                                  backward_order,
                                                  tracing_ctx,
-                                                 training_info.lossInfo()};
+                                                 training_info.lossInfo(),
+                                                 recompute_plan};
 
   if (!options->workspace_dir.empty())
   {
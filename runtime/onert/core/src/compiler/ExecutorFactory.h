@@ -41,6 +41,8 @@ struct ExecutorFactoryArgs
   const compiler::CompilerOptions *options;
   ir::ModelIndex model_index;
   std::shared_ptr<backend::custom::IKernelBuilder> custom_kernel_builder;
+  std::shared_ptr<const util::ThreadQuota> thread_quota;
+  std::shared_ptr<const exec::VariableStates> variable_states;
 };
 
 class ExecutorFactory
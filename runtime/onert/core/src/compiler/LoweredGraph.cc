@@ -164,7 +164,7 @@ void LoweredGraph::makeLowerInfo(const compiler::BackendResolver &backend_resolv
       // The variable operand with buffer is not supported yet
       assert(operand.data() == nullptr);
       assert(operand.getUses().size() == 1 && !operand.getDef().valid());
-      auto operand_li = lower_info().operand.at(index);
+      auto &operand_li = lower_info().operand.at(index);
       assert(operand_li.def_backends().empty());
       operand_li.addDefBackend(operand_li.use_backends().getOnlyElement());
     }
@@ -55,6 +55,58 @@ void ShapeValidator::operator()()
     [&](const ir::OperationIndex &, const ir::IOperation &node) { node.accept(*this); });
 }
 
+void ShapeValidator::visit(const ir::operation::Attention &node)
+{
+  const auto &operands = _graph.operands();
+  const auto query_index(node.getInputs().at(ir::operation::Attention::Input::QUERY));
+  const auto key_index(node.getInputs().at(ir::operation::Attention::Input::KEY));
+  const auto value_index(node.getInputs().at(ir::operation::Attention::Input::VALUE));
+  const auto out_index{node.getOutputs().at(0)};
+
+  if (operands.at(out_index).info().isDynamic())
+    return;
+
+  const auto &query_shape = operands.at(query_index).shape();
+  const auto &key_shape = operands.at(key_index).shape();
+  const auto &value_shape = operands.at(value_index).shape();
+  const auto rank = query_shape.rank();
+
+  OP_REQUIRES(rank >= 2 && rank <= 4);
+  OP_REQUIRES(key_shape.rank() == rank);
+  OP_REQUIRES(value_shape.rank() == rank);
+  // [..., query_len, depth] * [..., key_len, depth]^T * [..., key_len, value_depth]
+  OP_REQUIRES(key_shape.dim(rank - 1) == query_shape.dim(rank - 1));
+  OP_REQUIRES(value_shape.dim(rank - 2) == key_shape.dim(rank - 2));
+  // New tokens should fit in kv cache
+  const auto cache_size = node.param().cache_size;
+  OP_REQUIRES(cache_size == 0 || key_shape.dim(rank - 2) <= cache_size);
+  // Batch dims of key and value can be broadcasted to query
+  for (int i = 0; i < rank - 2; ++i)
+  {
+    OP_REQUIRES(key_shape.dim(i) == 1 || key_shape.dim(i) == query_shape.dim(i));
+    OP_REQUIRES(value_shape.dim(i) == 1 || value_shape.dim(i) == query_shape.dim(i));
+  }
+
+  const auto mask_index{node.getInputs().size() > ir::operation::Attention::Input::MASK
+                          ? node.getInputs().at(ir::operation::Attention::Input::MASK)
+                          : ir::OperandIndex{}};
+  if (!mask_index.undefined())
+  {
+    const auto &mask_shape = operands.at(mask_index).shape();
+    OP_REQUIRES(mask_shape.rank() <= rank);
+
+    // Mask is broadcasted to [..., query_len, key_len]
+    const int offset = rank - mask_shape.rank();
+    for (int i = 0; i < mask_shape.rank(); ++i)
+    {
+      const auto dim = mask_shape.dim(i);
+      const auto score_dim =
+        (i + offset == rank - 1) ? key_shape.dim(rank - 2) : query_shape.dim(i + offset);
+      OP_REQUIRES(dim == 1 || dim == score_dim);
+    }
+  }
+}
+
 void ShapeValidator::visit(const ir::operation::BatchMatMul &node)
 {
   const auto &operands = _graph.operands();
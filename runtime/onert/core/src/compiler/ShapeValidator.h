@@ -49,6 +49,7 @@ public:
   void operator()();
 
 public:
+  void visit(const ir::operation::Attention &node) override;
   void visit(const ir::operation::BatchMatMul &node) override;
   void visit(const ir::operation::BatchToSpaceND &node) override;
   void visit(const ir::operation::BCQFullyConnected &node) override;
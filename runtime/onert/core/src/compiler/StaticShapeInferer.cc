@@ -324,6 +324,20 @@ void StaticShapeInferer::visit(const ir::operation::ArgMinMax &op)
   output.info().shape(new_shape);
 }
 
+void StaticShapeInferer::visit(const ir::operation::Attention &op)
+{
+  auto &operands = _lowered_subg->graph().operands();
+
+  const auto query_index = op.getInputs().at(ir::operation::Attention::Input::QUERY);
+  const auto value_index = op.getInputs().at(ir::operation::Attention::Input::VALUE);
+  const auto output_index = op.getOutputs().at(0);
+  const auto &query = operands.at(query_index);
+  const auto &value = operands.at(value_index);
+  auto &output = operands.at(output_index);
+  auto new_shape = shape_inference::inferAttentionShape(query.shape(), value.shape());
+  output.info().shape(new_shape);
+}
+
 void StaticShapeInferer::visit(const ir::operation::BatchMatMul &op)
 {
   auto &operands = _lowered_subg->graph().operands();
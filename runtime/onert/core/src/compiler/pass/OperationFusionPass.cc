@@ -0,0 +1,336 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/DepthwiseConv2D.h"
+#include "ir/operation/ElementwiseActivation.h"
+#include "ir/operation/FullyConnected.h"
+#include "util/logging.h"
+
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+namespace
+{
+
+using ir::operation::BinaryArithmetic;
+using ir::operation::Conv2D;
+using ir::operation::DepthwiseConv2D;
+using ir::operation::ElementwiseActivation;
+using ir::operation::FullyConnected;
+
+bool hasBias(ir::OpCode opcode)
+{
+  return opcode == ir::OpCode::Conv2D || opcode == ir::OpCode::DepthwiseConv2D ||
+         opcode == ir::OpCode::FullyConnected;
+}
+
+bool hasFusedActivation(ir::OpCode opcode)
+{
+  return hasBias(opcode) || opcode == ir::OpCode::BinaryArithmetic;
+}
+
+ir::Activation fusedActivation(const ir::IOperation &node)
+{
+  switch (node.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      return dynamic_cast<const Conv2D &>(node).param().activation;
+    case ir::OpCode::DepthwiseConv2D:
+      return dynamic_cast<const DepthwiseConv2D &>(node).param().activation;
+    case ir::OpCode::FullyConnected:
+      return dynamic_cast<const FullyConnected &>(node).param().activation;
+    case ir::OpCode::BinaryArithmetic:
+      return dynamic_cast<const BinaryArithmetic &>(node).param().activation;
+    default:
+      throw std::runtime_error{"OperationFusionPass: Operation without fused activation"};
+  }
+}
+
+// Returns the fused activation equivalent to ReLU, or NONE if there is no such activation
+ir::Activation toFusedActivation(const ElementwiseActivation &node)
+{
+  const auto &param = node.param();
+  if (param.op_type != ElementwiseActivation::Type::RELU)
+    return ir::Activation::NONE;
+
+  if (param.alpha == ElementwiseActivation::infinity && param.beta == 0.f)
+    return ir::Activation::RELU;
+  if (param.alpha == 6.f && param.beta == 0.f)
+    return ir::Activation::RELU6;
+  if (param.alpha == 1.f && param.beta == -1.f)
+    return ir::Activation::RELU1;
+  return ir::Activation::NONE;
+}
+
+// Name of the consumer, ReLU6 and ReLU1 are named ReLU by ElementwiseActivation
+std::string fusedName(const ir::Operation &consumer)
+{
+  if (consumer.opcode() == ir::OpCode::ElementwiseActivation)
+  {
+    switch (toFusedActivation(dynamic_cast<const ElementwiseActivation &>(consumer)))
+    {
+      case ir::Activation::RELU6:
+        return "ReLU6";
+      case ir::Activation::RELU1:
+        return "ReLU1";
+      default:
+        break;
+    }
+  }
+  return consumer.name();
+}
+
+// Consumer may have fused operations already, e.g. ReLU of Add
+std::vector<std::string> fusedNames(const ir::Operation &producer, const ir::Operation &consumer)
+{
+  auto names = producer.fusedOperations();
+  names.emplace_back(fusedName(consumer));
+  for (const auto &name : consumer.fusedOperations())
+    names.emplace_back(name);
+  return names;
+}
+
+template <typename Node>
+std::unique_ptr<ir::Operation>
+createFused(const Node &producer, const ir::Operation &consumer,
+            const ir::OperandIndexSequence &inputs, ir::Activation activation)
+{
+  auto param = producer.param();
+  param.activation = activation;
+  auto fused = std::make_unique<Node>(inputs, consumer.getOutputs(), param);
+  fused->setFusedOperations(fusedNames(producer, consumer));
+  return fused;
+}
+
+std::unique_ptr<ir::Operation> createFused(const ir::IOperation &producer,
+                                           const ir::IOperation &consumer,
+                                           const ir::OperandIndexSequence &inputs,
+                                           ir::Activation activation)
+{
+  const auto &consumer_op = dynamic_cast<const ir::Operation &>(consumer);
+  switch (producer.opcode())
+  {
+    case ir::OpCode::Conv2D:
+      return createFused(dynamic_cast<const Conv2D &>(producer), consumer_op, inputs, activation);
+    case ir::OpCode::DepthwiseConv2D:
+      return createFused(dynamic_cast<const DepthwiseConv2D &>(producer), consumer_op, inputs,
+                         activation);
+    case ir::OpCode::FullyConnected:
+      return createFused(dynamic_cast<const FullyConnected &>(producer), consumer_op, inputs,
+                         activation);
+    case ir::OpCode::BinaryArithmetic:
+      return createFused(dynamic_cast<const BinaryArithmetic &>(producer), consumer_op, inputs,
+                         activation);
+    default:
+      throw std::runtime_error{"OperationFusionPass: Operation without fused activation"};
+  }
+}
+
+} // namespace
+
+void OperationFusionPass::run()
+{
+  std::vector<ir::OperationIndex> producers;
+  _graph.operations().iterate([&](const ir::OperationIndex &index, const ir::IOperation &node) {
+    if (hasFusedActivation(node.opcode()))
+      producers.emplace_back(index);
+  });
+
+  for (const auto &producer_index : producers)
+  {
+    // Skip BinaryArithmetic which has been fused into its producer already
+    if (!_graph.operations().exist(producer_index))
+      continue;
+
+    // Fuse consumers one by one, e.g. Add of bias and then ReLU
+    auto consumer_index = fusableConsumer(producer_index);
+    while (consumer_index.valid() && (fuseBiasAdd(producer_index, consumer_index) ||
+                                      fuseActivation(producer_index, consumer_index)))
+    {
+      consumer_index = fusableConsumer(producer_index);
+    }
+  }
+}
+
+ir::OperationIndex
+OperationFusionPass::fusableConsumer(const ir::OperationIndex &producer_index) const
+{
+  const auto &producer = _graph.operations().at(producer_index);
+  if (producer.getOutputs().size() != 1)
+    return ir::OperationIndex{};
+
+  // Intermediate tensor should be seen by nobody except for the consumer
+  const auto output_index = producer.getOutputs().at(0);
+  const auto &output = _graph.operands().at(output_index);
+  if (output.getUses().size() != 1 || _graph.getOutputs().contains(output_index))
+    return ir::OperationIndex{};
+
+  return *output.getUses().begin();
+}
+
+bool OperationFusionPass::fuseActivation(const ir::OperationIndex &producer_index,
+                                         const ir::OperationIndex &consumer_index)
+{
+  const auto &producer = _graph.operations().at(producer_index);
+  const auto &consumer = _graph.operations().at(consumer_index);
+  if (consumer.opcode() != ir::OpCode::ElementwiseActivation ||
+      fusedActivation(producer) != ir::Activation::NONE)
+    return false;
+
+  const auto activation = toFusedActivation(dynamic_cast<const ElementwiseActivation &>(consumer));
+  if (activation == ir::Activation::NONE)
+    return false;
+
+  VERBOSE(OperationFusionPass) << "Fuse " << consumer.name() << " " << consumer_index << " into "
+                               << producer.name() << " " << producer_index << std::endl;
+
+  auto fused = createFused(producer, consumer, producer.getInputs(), activation);
+  removeOperation(consumer_index);
+  replaceOperation(producer_index, std::move(fused));
+  return true;
+}
+
+bool OperationFusionPass::fuseBiasAdd(const ir::OperationIndex &producer_index,
+                                      const ir::OperationIndex &consumer_index)
+{
+  const auto &producer = _graph.operations().at(producer_index);
+  const auto &consumer = _graph.operations().at(consumer_index);
+  if (consumer.opcode() != ir::OpCode::BinaryArithmetic || !hasBias(producer.opcode()) ||
+      fusedActivation(producer) != ir::Activation::NONE)
+    return false;
+
+  const auto &arithmetic = dynamic_cast<const BinaryArithmetic &>(consumer);
+  const auto arithmetic_type = arithmetic.param().arithmetic_type;
+  if (arithmetic_type != BinaryArithmetic::ArithmeticType::ADD &&
+      arithmetic_type != BinaryArithmetic::ArithmeticType::SUB)
+    return false;
+
+  // Sub is fused only when the constant is subtracted
+  const auto output_index = producer.getOutputs().at(0);
+  const auto lhs_index = arithmetic.getInputs().at(BinaryArithmetic::Input::LHS);
+  const auto rhs_index = arithmetic.getInputs().at(BinaryArithmetic::Input::RHS);
+  ir::OperandIndex const_index;
+  if (lhs_index == output_index && rhs_index != output_index)
+    const_index = rhs_index;
+  else if (rhs_index == output_index && lhs_index != output_index &&
+           arithmetic_type == BinaryArithmetic::ArithmeticType::ADD)
+    const_index = lhs_index;
+  else
+    return false;
+
+  // TODO Fold constants into quantized bias
+  const auto &output = _graph.operands().at(output_index);
+  const auto &constant = _graph.operands().at(const_index);
+  if (!constant.isConstant() || constant.typeInfo().type() != ir::DataType::FLOAT32 ||
+      output.typeInfo().type() != ir::DataType::FLOAT32 || output.info().isDynamic() ||
+      output.shape().rank() == 0 || output.shape().hasUnspecifiedDims())
+    return false;
+
+  // Producer's output should not be broadcasted and the constant should be per-channel
+  const auto &output_shape = output.shape();
+  const auto &const_shape = constant.shape();
+  if (!(_graph.operands().at(arithmetic.getOutputs().at(0)).shape() == output_shape) ||
+      const_shape.rank() > output_shape.rank())
+    return false;
+  for (int axis = 0; axis < const_shape.rank() - 1; ++axis)
+  {
+    if (const_shape.dim(axis) != 1)
+      return false;
+  }
+  const auto num_channels = output_shape.dim(output_shape.rank() - 1);
+  const auto const_size = static_cast<int32_t>(const_shape.num_elements());
+  if (const_size != 1 && const_size != num_channels)
+    return false;
+
+  std::vector<float> bias(num_channels, 0.f);
+  const auto &inputs = producer.getInputs();
+  constexpr uint32_t kBiasIndex = 2;
+  if (inputs.size() > kBiasIndex && inputs.at(kBiasIndex).valid())
+  {
+    const auto &bias_operand = _graph.operands().at(inputs.at(kBiasIndex));
+    if (!bias_operand.isConstant() || bias_operand.typeInfo().type() != ir::DataType::FLOAT32 ||
+        static_cast<int32_t>(bias_operand.shape().num_elements()) != num_channels)
+      return false;
+    bias = bias_operand.asVector<float>();
+  }
+
+  const auto values = constant.asVector<float>();
+  const float sign = arithmetic_type == BinaryArithmetic::ArithmeticType::ADD ? 1.f : -1.f;
+  for (int32_t c = 0; c < num_channels; ++c)
+  {
+    bias[c] += sign * values[const_size == 1 ? 0 : c];
+  }
+
+  // Bias may be shared with other operations, so a new operand is added
+  const auto bias_index =
+    _graph.addOperand(ir::Shape{num_channels}, ir::TypeInfo{ir::DataType::FLOAT32});
+  _graph.setOperandValue(bias_index, std::make_shared<ir::CachedData>(
+                                       reinterpret_cast<const uint8_t *>(bias.data()),
+                                       bias.size() * sizeof(float)));
+
+  VERBOSE(OperationFusionPass) << "Fuse " << consumer.name() << " " << consumer_index << " into "
+                               << producer.name() << " " << producer_index << " with bias "
+                               << bias_index << std::endl;
+
+  const ir::OperandIndexSequence fused_inputs{inputs.at(0), inputs.at(1), bias_index};
+  auto fused = createFused(producer, consumer, fused_inputs, arithmetic.param().activation);
+  removeOperation(consumer_index);
+  replaceOperation(producer_index, std::move(fused));
+  return true;
+}
+
+void OperationFusionPass::replaceOperation(const ir::OperationIndex &index,
+                                           std::unique_ptr<ir::Operation> &&node)
+{
+  const auto &old_node = _graph.operations().at(index);
+  for (const auto &ind : old_node.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).removeUse(index);
+  for (const auto &ind : old_node.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).unsetDef();
+
+  for (const auto &ind : node->getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).insertUse(index);
+  for (const auto &ind : node->getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).setDef(index);
+
+  _graph.operations().set(index, std::move(node));
+}
+
+void OperationFusionPass::removeOperation(const ir::OperationIndex &index)
+{
+  const auto &node = _graph.operations().at(index);
+  for (const auto &ind : node.getInputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).removeUse(index);
+  for (const auto &ind : node.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    _graph.operands().at(ind).unsetDef();
+
+  _graph.operations().remove(index);
+}
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
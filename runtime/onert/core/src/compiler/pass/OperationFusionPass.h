@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+#define __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
+
+#include "Pass.h"
+#include "ir/Index.h"
+#include "ir/Operation.h"
+
+#include <memory>
+
+namespace onert
+{
+namespace compiler
+{
+namespace pass
+{
+
+/**
+ * @brief Pass to fuse elementwise epilogues into the operation producing their input
+ *
+ * Conv2D, DepthwiseConv2D, FullyConnected and BinaryArithmetic apply a fused activation to
+ * their output while it is still in cache. This pass merges the following single-use consumers
+ * into such a producer so that the intermediate tensor is neither written nor read again.
+ *
+ * Case 1 : ReLU, ReLU1 or ReLU6 after a producer without fused activation
+ *
+ * ```
+ * [#0 Conv2D(NONE)] -> ((#1)) -> [#1 ReLU] -> ((#2))
+ * becomes
+ * [#0 Conv2D(RELU)] -> ((#2))
+ * ```
+ *
+ * Case 2 : Add or Sub of a per-channel constant after float Conv2D, DepthwiseConv2D or
+ *          FullyConnected without fused activation. The constant is folded into a new bias and
+ *          the activation of Add or Sub is taken by the producer.
+ *
+ * ```
+ * [#0 Conv2D(NONE)] -> ((#1)) -> [#1 Add(RELU6) with ((#3 const))] -> ((#2))
+ * becomes
+ * [#0 Conv2D(RELU6) with bias + #3] -> ((#2))
+ * ```
+ *
+ * Names of fused operations are kept in the producer and shown in the tracing output.
+ * Operands left unused are removed by UnusedOperandEliminationPass.
+ */
+class OperationFusionPass : public Pass
+{
+public:
+  using Pass::Pass;
+
+public:
+  std::string id() final { return "OperationFusionPass"; }
+
+public:
+  void run() override;
+
+private:
+  ir::OperationIndex fusableConsumer(const ir::OperationIndex &producer_index) const;
+  bool fuseActivation(const ir::OperationIndex &producer_index,
+                      const ir::OperationIndex &consumer_index);
+  bool fuseBiasAdd(const ir::OperationIndex &producer_index,
+                   const ir::OperationIndex &consumer_index);
+  void replaceOperation(const ir::OperationIndex &index, std::unique_ptr<ir::Operation> &&node);
+  void removeOperation(const ir::OperationIndex &index);
+};
+
+} // namespace pass
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_PASS_OPERATION_FUSION_PASS_H__
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "OperationFusionPass.h"
+
+#include "ir/Graph.h"
+#include "ir/operation/BinaryArithmetic.h"
+#include "ir/operation/Conv2D.h"
+#include "ir/operation/ElementwiseActivation.h"
+
+#include <gtest/gtest.h>
+
+using namespace onert::ir;
+using namespace onert::compiler::pass;
+
+namespace
+{
+
+OperandIndex addConstant(Graph &graph, const Shape &shape, const std::vector<float> &values)
+{
+  auto ind = graph.addOperand(shape, TypeInfo{DataType::FLOAT32});
+  graph.setOperandValue(ind, std::make_shared<CachedData>(
+                               reinterpret_cast<const uint8_t *>(values.data()),
+                               values.size() * sizeof(float)));
+  return ind;
+}
+
+OperationIndex addConv2D(Graph &graph, OperandIndex in, OperandIndex out)
+{
+  auto kernel = addConstant(graph, Shape{2, 1, 1, 1}, {1.f, 2.f});
+  auto bias = addConstant(graph, Shape{2}, {0.5f, -0.5f});
+  operation::Conv2D::Param param;
+  param.stride = Stride{1, 1};
+  param.padding = Padding{PaddingType::VALID};
+  param.activation = Activation::NONE;
+  param.dilation = Dilation{1, 1};
+  return graph.addOperation(std::make_unique<operation::Conv2D>(
+    OperandIndexSequence{in, kernel, bias}, OperandIndexSequence{out}, param));
+}
+
+OperationIndex addBinaryArithmetic(Graph &graph, OperandIndex lhs, OperandIndex rhs,
+                                   OperandIndex out,
+                                   operation::BinaryArithmetic::ArithmeticType type)
+{
+  operation::BinaryArithmetic::Param param;
+  param.arithmetic_type = type;
+  param.activation = Activation::NONE;
+  return graph.addOperation(std::make_unique<operation::BinaryArithmetic>(
+    OperandIndexSequence{lhs, rhs}, OperandIndexSequence{out}, param));
+}
+
+OperationIndex addReLU6(Graph &graph, OperandIndex in, OperandIndex out)
+{
+  operation::ElementwiseActivation::Param param;
+  param.op_type = operation::ElementwiseActivation::Type::RELU;
+  param.alpha = 6.f;
+  param.beta = 0.f;
+  return graph.addOperation(std::make_unique<operation::ElementwiseActivation>(
+    OperandIndexSequence{in}, OperandIndexSequence{out}, param));
+}
+
+} // namespace
+
+TEST(OperationFusionPass, Conv2DAddReLU6)
+{
+  Graph graph;
+
+  Shape shape{1, 2, 2, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 2, 2, 1}, type);
+  auto conv_out = graph.addOperand(shape, type);
+  auto add_const = addConstant(graph, Shape{1, 1, 1, 2}, {1.f, 2.f});
+  auto add_out = graph.addOperand(shape, type);
+  auto out = graph.addOperand(shape, type);
+
+  auto conv = addConv2D(graph, in, conv_out);
+  addBinaryArithmetic(graph, conv_out, add_const, add_out,
+                      operation::BinaryArithmetic::ArithmeticType::ADD);
+  addReLU6(graph, add_out, out);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 1);
+  const auto &fused = dynamic_cast<const operation::Conv2D &>(graph.operations().at(conv));
+  EXPECT_EQ(fused.param().activation, Activation::RELU6);
+  EXPECT_EQ(fused.getOutputs().at(0), out);
+  EXPECT_EQ(graph.operands().at(out).getDef(), conv);
+  EXPECT_EQ(fused.fusedOperations(), (std::vector<std::string>{"Add", "ReLU6"}));
+
+  const auto &bias = graph.operands().at(fused.getInputs().at(operation::Conv2D::BIAS));
+  EXPECT_TRUE(bias.isConstant());
+  EXPECT_EQ(bias.asVector<float>(), (std::vector<float>{1.5f, 1.5f}));
+  EXPECT_TRUE(bias.getUses().contains(conv));
+}
+
+TEST(OperationFusionPass, neg_MultipleUses)
+{
+  Graph graph;
+
+  Shape shape{1, 2, 2, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 2, 2, 1}, type);
+  auto conv_out = graph.addOperand(shape, type);
+  auto out1 = graph.addOperand(shape, type);
+  auto out2 = graph.addOperand(shape, type);
+
+  addConv2D(graph, in, conv_out);
+  addReLU6(graph, conv_out, out1);
+  addBinaryArithmetic(graph, conv_out, conv_out, out2,
+                      operation::BinaryArithmetic::ArithmeticType::MUL);
+  graph.addInput(in);
+  graph.addOutput(out1);
+  graph.addOutput(out2);
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 3);
+}
+
+TEST(OperationFusionPass, neg_SubFromConstant)
+{
+  Graph graph;
+
+  Shape shape{1, 2, 2, 2};
+  TypeInfo type{DataType::FLOAT32};
+  auto in = graph.addOperand(Shape{1, 2, 2, 1}, type);
+  auto conv_out = graph.addOperand(shape, type);
+  auto sub_const = addConstant(graph, Shape{2}, {1.f, 2.f});
+  auto out = graph.addOperand(shape, type);
+
+  addConv2D(graph, in, conv_out);
+  addBinaryArithmetic(graph, sub_const, conv_out, out,
+                      operation::BinaryArithmetic::ArithmeticType::SUB);
+  graph.addInput(in);
+  graph.addOutput(out);
+
+  OperationFusionPass{graph}.run();
+
+  ASSERT_EQ(graph.operations().size(), 2);
+}
@@ -194,7 +194,7 @@ void LoweredTrainableGraph::makeLowerInfo(const compiler::BackendResolver &backe
       // The variable operand with buffer is not supported yet
       assert(operand.data() == nullptr);
       assert(operand.getUses().size() == 1 && !operand.getDef().valid());
-      auto operand_li = lower_info().operand.at(index);
+      auto &operand_li = lower_info().operand.at(index);
       assert(operand_li.def_backends().empty());
       operand_li.addDefBackend(operand_li.use_backends().getOnlyElement());
     }
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputePlanner.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+RecomputePlanner::RecomputePlanner(const ir::train::TrainableGraph &tgraph,
+                                   const std::vector<ir::OperationIndex> &order,
+                                   const util::Set<ir::OperandIndex> &excluded)
+  : _order{order}
+{
+  ir::OperationIndexMap<int32_t> positions;
+  for (uint32_t pos = 0; pos < order.size(); ++pos)
+    positions[order[pos]] = static_cast<int32_t>(pos);
+
+  const auto &training_usedefs = tgraph.trainingUseDefs();
+  tgraph.operands().iterate([&](const ir::OperandIndex &ind, const ir::Operand &operand) {
+    if (operand.isConstant() || operand.info().isVariable())
+      return;
+
+    Lifetime lifetime;
+    lifetime.def = -1;
+    lifetime.first_use = std::numeric_limits<int32_t>::max();
+    lifetime.last_use = -1;
+    lifetime.backward_use = false;
+    // Excluded operands are never recomputed, but may be alive while a segment runs forward
+    lifetime.recomputable = !excluded.contains(ind);
+    lifetime.size = operand.info().total_size();
+
+    const auto def = operand.getDef();
+    if (def.valid() && positions.find(def) != positions.end())
+      lifetime.def = positions.at(def);
+
+    for (const auto &use : operand.getUses())
+    {
+      if (positions.find(use) == positions.end())
+        continue;
+      lifetime.first_use = std::min(lifetime.first_use, positions.at(use));
+      lifetime.last_use = std::max(lifetime.last_use, positions.at(use));
+    }
+
+    const auto usedefs = training_usedefs.find(ir::train::TrainingOperandIndex{ind, true});
+    if (usedefs != training_usedefs.end())
+    {
+      const auto &uses = usedefs->second.getTrainingUses();
+      lifetime.backward_use = std::any_of(uses.begin(), uses.end(),
+                                          [](const auto &use) { return !use.is_forward(); });
+    }
+    if (lifetime.last_use < 0 && !lifetime.backward_use)
+      return;
+
+    _lifetimes[ind] = lifetime;
+  });
+}
+
+RecomputePlan RecomputePlanner::plan(uint32_t segment_size) const
+{
+  RecomputePlan plan;
+  if (segment_size == 0 || _order.empty())
+    return plan;
+
+  const auto k = static_cast<int32_t>(segment_size);
+  const auto num_segments = (static_cast<int32_t>(_order.size()) + k - 1) / k;
+
+  // Find activations defined and used only in a segment
+  std::vector<std::vector<ir::OperandIndex>> internals(num_segments);
+  std::vector<bool> needed(num_segments, false);
+  for (const auto &[ind, lifetime] : _lifetimes)
+  {
+    if (lifetime.def < 0 || !lifetime.recomputable)
+      continue;
+    const auto seg = lifetime.def / k;
+    if (lifetime.first_use / k != seg || lifetime.last_use / k != seg)
+      continue;
+    internals[seg].push_back(ind);
+    // Recomputing a segment is worth only if it drops activations kept for backward
+    if (lifetime.backward_use)
+      needed[seg] = true;
+  }
+
+  std::vector<int32_t> starts;
+  for (int32_t seg = 0; seg < num_segments; ++seg)
+  {
+    if (!needed[seg])
+      continue;
+
+    const auto id = static_cast<uint32_t>(plan.segments.size());
+    const auto start = seg * k;
+    const auto end = std::min(start + k, static_cast<int32_t>(_order.size()));
+    std::vector<ir::OperationIndex> ops{_order.begin() + start, _order.begin() + end};
+    for (const auto &op : ops)
+      plan.op_segments[op] = id;
+    for (const auto &ind : internals[seg])
+      plan.recomputed[ind] = id;
+    plan.segments.emplace_back(std::move(ops));
+    starts.push_back(start);
+  }
+
+  if (plan.empty())
+    return plan;
+  plan.segment_size = segment_size;
+
+  // Other activations alive while a recomputed segment runs forward
+  for (const auto &[ind, lifetime] : _lifetimes)
+  {
+    if (plan.recomputed.find(ind) != plan.recomputed.end())
+      continue;
+
+    const auto last = lifetime.backward_use ? std::numeric_limits<int32_t>::max()
+                                            : lifetime.last_use;
+    for (uint32_t id = 0; id < plan.segments.size(); ++id)
+    {
+      const auto start = starts[id];
+      const auto end = start + static_cast<int32_t>(plan.segments[id].size()) - 1;
+      if (lifetime.def <= end && last >= start)
+        plan.kept[ind].push_back(id);
+    }
+  }
+
+  return plan;
+}
+
+RecomputePlan RecomputePlanner::planWithBudget(uint64_t memory_budget) const
+{
+  RecomputePlan best;
+  auto best_memory = estimateMemory(best);
+  if (best_memory <= memory_budget)
+    return best;
+
+  // A segment of an operation has nothing to recompute
+  for (uint32_t segment_size = 2; segment_size <= _order.size(); ++segment_size)
+  {
+    auto candidate = plan(segment_size);
+    const auto memory = estimateMemory(candidate);
+    if (memory <= memory_budget)
+    {
+      VERBOSE(RecomputePlanner) << "Recompute segments of " << segment_size
+                                << " operations, estimated " << memory << " bytes" << std::endl;
+      return candidate;
+    }
+    if (memory < best_memory)
+    {
+      best = std::move(candidate);
+      best_memory = memory;
+    }
+  }
+
+  VERBOSE(RecomputePlanner) << "Activations do not fit in " << memory_budget
+                            << " bytes, recompute segments of " << best.segment_size
+                            << " operations, estimated " << best_memory << " bytes" << std::endl;
+  return best;
+}
+
+uint64_t RecomputePlanner::estimateMemory(const RecomputePlan &plan) const
+{
+  uint64_t kept = 0;
+  std::vector<uint64_t> recomputed(plan.segments.size(), 0);
+  for (const auto &[ind, lifetime] : _lifetimes)
+  {
+    const auto it = plan.recomputed.find(ind);
+    if (it != plan.recomputed.end())
+      recomputed[it->second] += lifetime.size;
+    else if (lifetime.backward_use && lifetime.recomputable)
+      kept += lifetime.size;
+  }
+
+  const auto largest = std::max_element(recomputed.begin(), recomputed.end());
+  return kept + (largest != recomputed.end() ? *largest : 0);
+}
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
+#define __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
+
+#include "compiler/train/RecomputePlan.h"
+#include "ir/train/TrainableGraph.h"
+#include "util/Set.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace onert
+{
+namespace compiler
+{
+namespace train
+{
+
+/**
+ * @brief Class to plan activation recomputation of a trainable graph
+ */
+class RecomputePlanner
+{
+public:
+  /**
+   * @param tgraph   Trainable graph whose training use-defs are initialized
+   * @param order    Forward order of operations that the executor runs
+   * @param excluded Operands not to be recomputed, e.g. operands shared by backends
+   */
+  RecomputePlanner(const ir::train::TrainableGraph &tgraph,
+                   const std::vector<ir::OperationIndex> &order,
+                   const util::Set<ir::OperandIndex> &excluded);
+
+public:
+  /**
+   * @brief Plan with segments of @c segment_size operations, nothing is recomputed if 0
+   */
+  RecomputePlan plan(uint32_t segment_size) const;
+
+  /**
+   * @brief Plan to fit activations kept for backward in @c memory_budget bytes
+   *
+   * Nothing is recomputed if all activations fit. Otherwise the smallest segment size that fits
+   * is chosen, which recomputes the least. If no segment size fits, the one that needs the least
+   * memory is chosen.
+   */
+  RecomputePlan planWithBudget(uint64_t memory_budget) const;
+
+  /**
+   * @brief Estimate bytes of activations alive at once during backward with @c plan
+   *
+   * They are activations kept for backward and recomputed ones of the largest segment.
+   */
+  uint64_t estimateMemory(const RecomputePlan &plan) const;
+
+private:
+  struct Lifetime
+  {
+    // Positions in forward order, def is -1 if it is not defined by an operation
+    int32_t def;
+    int32_t first_use;
+    int32_t last_use;
+    bool backward_use;
+    // False if the operand is excluded, which is not counted in activation memory either
+    bool recomputable;
+    uint64_t size;
+  };
+
+  const std::vector<ir::OperationIndex> &_order;
+  ir::OperandIndexMap<Lifetime> _lifetimes;
+};
+
+} // namespace train
+} // namespace compiler
+} // namespace onert
+
+#endif // __ONERT_COMPILER_TRAIN_RECOMPUTE_PLANNER_H__
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "RecomputePlanner.h"
+
+#include "ir/train/Operations.Include.h"
+
+#include <gtest/gtest.h>
+
+#include <array>
+
+namespace
+{
+
+using namespace onert::ir;
+using namespace onert::compiler::train;
+
+OperationIndex addFullyConnectedOperation(train::TrainableGraph &tgraph,
+                                          const OperandIndexSequence inputs,
+                                          const OperandIndexSequence outputs)
+{
+  // Add "FullyConnected" operation
+  operation::FullyConnected::Param param;
+  param.weights_format = FullyConnectedWeightsFormat::Default;
+  param.activation = Activation::NONE;
+  auto fc_op = operation::FullyConnected(inputs, outputs, param);
+  return tgraph.addOperation(std::make_unique<train::operation::FullyConnected>(fc_op));
+}
+
+OperationIndex addLossOperation(train::TrainableGraph &tgraph, const OperandIndexSequence inputs,
+                                const OperandIndexSequence outputs)
+{
+  // Add "Loss" operation
+  auto loss_op = operation::Loss(inputs, outputs);
+  return tgraph.addOperation(std::make_unique<train::operation::Loss>(loss_op, train::LossInfo{}));
+}
+
+/*
+ (input)⎼[FC0]⎼>(a0)⎼[FC1]⎼>(a1)⎼[FC2]⎼>(a2)⎼[FC3]⎼>(y_pred)⎼[Loss]⎼>(output)
+                                                       ╱
+                                               (y_true)
+*/
+class RecomputePlannerTest : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    Shape shape{2, 2};
+    TypeInfo type{DataType::FLOAT32};
+
+    input = tgraph.addOperand(shape, type);
+    const auto weights = tgraph.addOperand(shape, type);
+    for (auto &a : acts)
+      a = tgraph.addOperand(shape, type);
+    y_true = tgraph.addOperand(shape, type);
+    output = tgraph.addOperand(shape, type);
+
+    tgraph.operands().at(weights).data(std::make_unique<ExternalData>(
+      reinterpret_cast<uint8_t *>(data.data()), data.size() * sizeof(float)));
+
+    tgraph.addInput({input});
+    tgraph.addInput({y_true});
+    tgraph.addOutput({output});
+
+    auto x = input;
+    for (const auto &a : acts)
+    {
+      fcs.push_back(addFullyConnectedOperation(tgraph, {x, weights, OperandIndex{}}, {a}));
+      x = a;
+    }
+    loss = addLossOperation(tgraph, {acts.back(), y_true}, {output});
+
+    tgraph.operations().iterate(
+      [&](const OperationIndex &index, const IOperation &) { tgraph.enableBackward(index); });
+    tgraph.updateGraphDependency();
+
+    order = tgraph.topolSortOperations();
+    excluded.add(input);
+    excluded.add(y_true);
+    excluded.add(output);
+  }
+
+  train::TrainableGraph tgraph;
+  std::vector<float> data = std::vector<float>(4, 0.f);
+  OperandIndex input, y_true, output;
+  // a0, a1, a2 and y_pred, all of them are used in backwarding
+  std::array<OperandIndex, 4> acts;
+  std::vector<OperationIndex> fcs;
+  OperationIndex loss;
+  std::vector<OperationIndex> order;
+  onert::util::Set<OperandIndex> excluded;
+};
+
+} // namespace
+
+TEST_F(RecomputePlannerTest, plan)
+{
+  RecomputePlanner planner{tgraph, order, excluded};
+
+  // Segments of {FC0, FC1}, {FC2, FC3} and {Loss}, the last one has nothing to recompute
+  const auto plan = planner.plan(2);
+  ASSERT_EQ(plan.segment_size, 2);
+  ASSERT_EQ(plan.segments.size(), 2);
+  EXPECT_EQ(plan.segments[0], (std::vector<OperationIndex>{fcs[0], fcs[1]}));
+  EXPECT_EQ(plan.segments[1], (std::vector<OperationIndex>{fcs[2], fcs[3]}));
+  EXPECT_EQ(plan.op_segments.size(), 4);
+  EXPECT_EQ(plan.op_segments.count(loss), 0);
+
+  ASSERT_EQ(plan.recomputed.size(), 2);
+  EXPECT_EQ(plan.recomputed.at(acts[0]), 0);
+  EXPECT_EQ(plan.recomputed.at(acts[2]), 1);
+
+  // a1 and y_pred cross segments, input and y_true are excluded but used in backwarding
+  ASSERT_EQ(plan.kept.size(), 4);
+  EXPECT_EQ(plan.kept.at(acts[1]), (std::vector<uint32_t>{0, 1}));
+  EXPECT_EQ(plan.kept.at(acts[3]), (std::vector<uint32_t>{1}));
+  EXPECT_EQ(plan.kept.at(input), (std::vector<uint32_t>{0, 1}));
+  EXPECT_EQ(plan.kept.at(y_true), (std::vector<uint32_t>{0, 1}));
+
+  EXPECT_EQ(planner.estimateMemory(RecomputePlan{}), 64);
+  EXPECT_EQ(planner.estimateMemory(plan), 48);
+}
+
+TEST_F(RecomputePlannerTest, plan_with_budget)
+{
+  RecomputePlanner planner{tgraph, order, excluded};
+
+  EXPECT_TRUE(planner.plan(0).empty());
+  EXPECT_TRUE(planner.planWithBudget(64).empty());
+  EXPECT_EQ(planner.planWithBudget(48).segment_size, 2);
+  // Plan of the least memory even if nothing fits
+  EXPECT_EQ(planner.planWithBudget(0).segment_size, 2);
+}
+
+TEST_F(RecomputePlannerTest, neg_excluded)
+{
+  // Nothing is recomputed if activations are shared with other backends
+  for (const auto &a : acts)
+    excluded.add(a);
+  RecomputePlanner planner{tgraph, order, excluded};
+
+  EXPECT_TRUE(planner.plan(2).empty());
+  EXPECT_EQ(planner.estimateMemory(RecomputePlan{}), 0);
+}
@@ -78,6 +78,11 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
   _options->forceInternalOptions();
   _options->verboseOptions();
 
+  // Grant compute threads before thread pools of backends are created
+  auto thread_quota =
+    util::ThreadBudget::get().acquire(_options->num_threads, _options->cpu_affinity);
+  util::AffinityScope affinity{thread_quota->cores()};
+
   auto custom_kernel_builder = _model->getKernelBuilder();
 
   _model->iterate([&](const ir::SubgraphIndex &, ir::IGraph &graph) {
@@ -288,6 +293,7 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
     args.options = _options;
     args.model_index = model_index;
     args.custom_kernel_builder = custom_kernel_builder;
+    args.thread_quota = thread_quota;
     auto executor = std::unique_ptr<exec::IExecutor>{
       ExecutorFactory::get().create(std::move(lowered_subg), executors, args, _training_info)};
     executor->setIndexedRanks(indexed_ranks);
@@ -297,7 +303,7 @@ std::shared_ptr<CompilerArtifact> TrainingCompiler::compile(void)
   /********************************
    * Code generation phase finished
    ********************************/
-  return std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx));
+  return std::make_shared<CompilerArtifact>(executors, std::move(tracing_ctx), thread_quota);
 }
 
 } // namespace train
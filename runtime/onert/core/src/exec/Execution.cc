@@ -184,6 +184,17 @@ float Execution::getLoss(const ir::IOIndex &ind)
   return execs->getLoss(ind);
 }
 
+train::TrainingPhaseStats Execution::trainingPhaseStats() const
+{
+  auto execs = dynamic_cast<exec::train::TrainableExecutors *>(_executors.get());
+  if (!execs)
+  {
+    throw std::runtime_error{"Supported only TrainableExecutors"};
+  }
+
+  return execs->phaseStats();
+}
+
 void Execution::iterateTrainableTensors(
   const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)> &fn)
   const
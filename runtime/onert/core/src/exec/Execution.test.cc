@@ -15,6 +15,8 @@
  */
 
 #include "exec/Execution.h"
+#include "exec/PipelineExecution.h"
+#include "SingleModelExecutors.h"
 
 #include "compiler/Compiler.h"
 #include "compiler/CompilerFactory.h"
@@ -33,7 +35,7 @@ using namespace onert::ir;
 class CompiledMockUpModel
 {
 public:
-  CompiledMockUpModel()
+  CompiledMockUpModel(const Shape &shape = Shape{1, 2, 2, 1})
   {
     // Model: two elementwise add operation
     // model input: lhs, rhs1
@@ -41,11 +43,10 @@ public:
     // constant: rhs2
     // result1 <= (lhs + rhs)
     // result2 <= (result1 + rhs2)
-    // lhs, rhs1, rh2, result1, result2 shape: {1, 2, 2, 1}
+    // lhs, rhs1, rh2, result1, result2 shape: {1, 2, 2, 1} by default, 4 elements
     // activation: none (constant)
     graph = std::make_shared<Graph>();
     // 1st add operands (result1 <= lhs + rhs1)
-    Shape shape{1, 2, 2, 1};
     TypeInfo type{DataType::FLOAT32};
     static float rhs2_data[4] = {3, 1, -1, 5};
     auto operand_lhs = graph->addOperand(shape, type);
@@ -91,6 +92,66 @@ public:
   std::shared_ptr<onert::compiler::CompilerArtifact> artifact;
 };
 
+// Executor recording buffers of IO tensors given to a compiled executor
+class IORecordingExecutor : public onert::exec::IExecutor
+{
+public:
+  IORecordingExecutor(onert::exec::IExecutor *executor) : _executor{executor} {}
+
+  const Graph &graph() const override { return _executor->graph(); }
+  void setIndexedRanks(std::shared_ptr<OperationIndexMap<int64_t>> ranks) override
+  {
+    _executor->setIndexedRanks(ranks);
+  }
+  void execute(const std::vector<onert::backend::IPortableTensor *> &inputs,
+               const std::vector<onert::backend::IPortableTensor *> &outputs,
+               const onert::exec::ExecutionOptions &options) override
+  {
+    input_buffers.clear();
+    output_buffers.clear();
+    for (const auto tensor : inputs)
+      input_buffers.emplace_back(tensor->buffer());
+    for (const auto tensor : outputs)
+      output_buffers.emplace_back(tensor->buffer());
+    _executor->execute(inputs, outputs, options);
+  }
+  uint32_t inputSize() const override { return _executor->inputSize(); }
+  uint32_t outputSize() const override { return _executor->outputSize(); }
+  const OperandInfo &inputInfo(uint32_t index) const override
+  {
+    return _executor->inputInfo(index);
+  }
+  const OperandInfo &outputInfo(uint32_t index) const override
+  {
+    return _executor->outputInfo(index);
+  }
+  Layout inputLayout(uint32_t index) const override { return _executor->inputLayout(index); }
+  Layout outputLayout(uint32_t index) const override { return _executor->outputLayout(index); }
+  const onert::exec::ExecutionOptions &currentOptions() const override
+  {
+    return _executor->currentOptions();
+  }
+
+public:
+  std::vector<const void *> input_buffers;
+  std::vector<const void *> output_buffers;
+
+private:
+  onert::exec::IExecutor *_executor;
+};
+
+// Executors running the compiled executor of the model through IORecordingExecutor
+std::shared_ptr<onert::exec::IExecutors> recordIO(const CompiledMockUpModel &mockup,
+                                                  IORecordingExecutor **recorder)
+{
+  auto executor =
+    std::make_unique<IORecordingExecutor>(mockup.artifact->_executors->entryExecutor());
+  *recorder = executor.get();
+  auto executors = std::make_shared<onert::exec::SingleModelExecutors>();
+  executors->emplace(ModelIndex{0}, SubgraphIndex{0}, std::move(executor));
+  return executors;
+}
+
 class CompiledMockUpMultiModel
 {
 public:
@@ -334,6 +395,73 @@ TEST(ExecInstance, simple)
   }
 }
 
+TEST(ExecInstance, nchw_identity_layout)
+{
+  // Channel of NCHW inputs and H*W of NHWC output are 1, so permutation keeps memory order
+  auto mockup = CompiledMockUpModel(Shape{1, 4, 1, 1});
+  IORecordingExecutor *recorder = nullptr;
+  auto executors = recordIO(mockup, &recorder);
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+  execution.setInputLayout(input1, onert::ir::Layout::NCHW);
+  execution.setInputLayout(input2, onert::ir::Layout::NCHW);
+  execution.setOutputLayout(output, onert::ir::Layout::NCHW);
+  execution.execute();
+
+  // User buffers are bound to the executor without permutation
+  ASSERT_EQ(recorder->input_buffers.size(), 2);
+  ASSERT_EQ(recorder->output_buffers.size(), 1);
+  EXPECT_EQ(recorder->input_buffers[0], input1_buffer);
+  EXPECT_EQ(recorder->input_buffers[1], input2_buffer);
+  EXPECT_EQ(recorder->output_buffers[0], output_buffer);
+
+  for (auto i = 0; i < 4; i++)
+  {
+    EXPECT_EQ(output_buffer[i], output_expected[i]);
+  }
+}
+
+TEST(ExecInstance, neg_nchw_identity_layout)
+{
+  // NCHW input {1, 2, 2, 1} has 2 channels, but NHWC output {1, 2, 2, 1} has 1 channel
+  auto mockup = CompiledMockUpModel();
+  IORecordingExecutor *recorder = nullptr;
+  auto executors = recordIO(mockup, &recorder);
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  float output_buffer[4] = {};
+
+  onert::exec::Execution execution{executors};
+
+  execution.setInput(IOIndex{0}, reinterpret_cast<const void *>(input1_buffer), 16);
+  execution.setInput(IOIndex{1}, reinterpret_cast<const void *>(input2_buffer), 16);
+  execution.setOutput(IOIndex{0}, reinterpret_cast<void *>(output_buffer), 16);
+  execution.setInputLayout(IOIndex{0}, onert::ir::Layout::NCHW);
+  execution.setOutputLayout(IOIndex{0}, onert::ir::Layout::NCHW);
+  execution.execute();
+
+  // Only the input whose memory order is changed by permutation is not bound directly
+  ASSERT_EQ(recorder->input_buffers.size(), 2);
+  ASSERT_EQ(recorder->output_buffers.size(), 1);
+  EXPECT_NE(recorder->input_buffers[0], input1_buffer);
+  EXPECT_EQ(recorder->input_buffers[1], input2_buffer);
+  EXPECT_EQ(recorder->output_buffers[0], output_buffer);
+}
+
 TEST(ExecInstance, neg_small_outputbuffer)
 {
   auto mockup = CompiledMockUpModel();
@@ -475,6 +603,97 @@ TEST(ExecInstance, twoExecution)
   }
 }
 
+// Parallel executor reuses its worker threads across runs
+TEST(ExecInstance, parallelExecutor_repeatedRuns)
+{
+  auto mockup = CompiledMockUpModel();
+  auto graph = mockup.graph;
+
+  // Compile again with parallel executor
+  auto model = std::make_shared<onert::ir::Model>();
+  model->push(onert::ir::SubgraphIndex{0}, graph);
+  auto coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+  coptions->executor = "Parallel";
+  onert::compiler::Compiler compiler{model, coptions.get()};
+  std::shared_ptr<onert::compiler::CompilerArtifact> artifact = compiler.compile();
+  onert::exec::Execution execution{artifact->_executors};
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {5, -2, 0, -1};
+
+  for (auto run = 0; run < 3; run++)
+  {
+    float output_buffer[4] = {};
+    execution.setInput(input1, reinterpret_cast<const void *>(input1_buffer), 16);
+    execution.setInput(input2, reinterpret_cast<const void *>(input2_buffer), 16);
+    execution.setOutput(output, reinterpret_cast<void *>(output_buffer), 16);
+    execution.execute();
+
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+  }
+}
+
+// Linear executor reuses shapes and memory plan of cached dynamic input shapes
+TEST(ExecInstance, shapePlanCache)
+{
+  auto mockup = CompiledMockUpModel();
+  auto graph = mockup.graph;
+
+  // Compile again with shape plan cache
+  auto model = std::make_shared<onert::ir::Model>();
+  model->push(onert::ir::SubgraphIndex{0}, graph);
+  auto coptions = onert::compiler::CompilerOptions::fromGlobalConfig();
+  coptions->executor = "Linear";
+  coptions->shape_plan_cache_size = 2;
+  onert::compiler::Compiler compiler{model, coptions.get()};
+  std::shared_ptr<onert::compiler::CompilerArtifact> artifact = compiler.compile();
+  onert::exec::Execution execution{artifact->_executors};
+
+  auto input1 = IOIndex{0};
+  auto input2 = IOIndex{1};
+  auto output = IOIndex{0};
+  const float rhs2[4] = {3, 1, -1, 5};
+
+  // Batch 4 is not cached because cache is full
+  for (const uint32_t batch : {2, 3, 2, 4, 2})
+  {
+    const Shape shape{static_cast<int32_t>(batch), 2, 2, 1};
+    std::vector<float> input1_buffer(batch * 4);
+    std::vector<float> input2_buffer(batch * 4);
+    std::vector<float> output_buffer(batch * 4);
+    for (uint32_t i = 0; i < batch * 4; i++)
+    {
+      input1_buffer[i] = static_cast<float>(i);
+      input2_buffer[i] = static_cast<float>(batch);
+    }
+
+    const auto size = batch * 16;
+    execution.setInput(input1, shape, input1_buffer.data(), size);
+    execution.setInput(input2, shape, input2_buffer.data(), size);
+    execution.setOutput(output, output_buffer.data(), size);
+    execution.execute();
+
+    EXPECT_EQ(execution.getOutputShape(output), shape);
+    for (uint32_t i = 0; i < batch * 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], input1_buffer[i] + input2_buffer[i] + rhs2[i % 4]);
+    }
+  }
+
+  const auto stats = execution.shapePlanCacheStats();
+  EXPECT_EQ(stats.num_buckets, 2);
+  EXPECT_EQ(stats.num_hits, 2);
+  EXPECT_EQ(stats.num_misses, 3);
+}
+
 TEST(ExecInstance, quantModel_floatIO)
 {
   auto mockup = CompiledMockUpQuantModel();
@@ -778,6 +997,57 @@ TEST(ExecInstance, multi_model_dequant_input_quant_output)
   }
 }
 
+TEST(ExecInstance, multi_model_pipeline)
+{
+  auto mockup = CompiledMockUpMultiModel();
+
+  // Compile each model as a pipeline stage
+  std::vector<std::shared_ptr<onert::compiler::CompilerArtifact>> artifacts;
+  std::vector<std::shared_ptr<onert::exec::IExecutors>> stages;
+  for (const auto &graph : mockup.graphs)
+  {
+    auto model = std::make_shared<onert::ir::Model>();
+    model->push(SubgraphIndex{0}, graph);
+    auto compiler = std::make_unique<onert::compiler::Compiler>(model, mockup.coptions.get());
+    artifacts.emplace_back(compiler->compile());
+    stages.emplace_back(artifacts.back()->_executors);
+  }
+
+  constexpr int num_requests = 5;
+  const float input1_buffer[4] = {1, 0, -1, -2};
+  const float input2_buffer[4] = {1, -3, 2, -4};
+  const float output_expected[4] = {7, -5, 1, -7};
+
+  onert::exec::PipelineExecution pipeline{stages, mockup.edges};
+  ASSERT_EQ(pipeline.inputSize(), 2);
+  ASSERT_EQ(pipeline.outputSize(), 1);
+
+  // Push and pop on different threads to overlap stages of different requests
+  std::thread producer([&]() {
+    for (int n = 0; n < num_requests; n++)
+      pipeline.push({input1_buffer, input2_buffer}, {16, 16});
+    pipeline.close();
+  });
+
+  int num_outputs = 0;
+  std::vector<std::vector<uint8_t>> outputs;
+  while (pipeline.pop(outputs))
+  {
+    ASSERT_EQ(outputs.size(), 1);
+    ASSERT_EQ(outputs[0].size(), 16);
+    const auto output_buffer = reinterpret_cast<const float *>(outputs[0].data());
+    for (auto i = 0; i < 4; i++)
+    {
+      EXPECT_EQ(output_buffer[i], output_expected[i]);
+    }
+    num_outputs++;
+  }
+  producer.join();
+
+  EXPECT_EQ(num_outputs, num_requests);
+  EXPECT_ANY_THROW(pipeline.push({input1_buffer, input2_buffer}, {16, 16}));
+}
+
 // TODO Add an unittest multi_model_quant_input_dequant_output
 
 } // namespace
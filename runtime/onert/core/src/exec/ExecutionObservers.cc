@@ -62,6 +62,16 @@ void setUserData(const onert::ir::Graph &g, const onert::ir::IOperation *op,
     data.emplace_back(std::make_pair(key, value));
   }
 
+  // From operations fused into op, this will return a string "Add+ReLU"
+  if (auto operation = dynamic_cast<const onert::ir::Operation *>(op))
+  {
+    std::string fused_str;
+    for (const auto &name : operation->fusedOperations())
+      fused_str += (fused_str.empty() ? "" : "+") + name;
+    if (!fused_str.empty())
+      data.emplace_back(std::make_pair("fused", fused_str));
+  }
+
   // add other userData as needed
 }
 
@@ -26,6 +26,9 @@ namespace exec
 
 void LinearExecutor::executeImpl(const ExecutionObservee &subject)
 {
+  const bool dynamic_input = hasDynamicInput();
+  const bool planned = applyShapePlan(dynamic_input);
+
   if (!subject.isEmpty() && _tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
@@ -45,7 +48,7 @@ void LinearExecutor::executeImpl(const ExecutionObservee &subject)
       fn_seq->initRunning();
 
       bool handle_dynamic_tensor =
-        _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
+        !planned && (_lowered_graph->getHasDynamicTensor(code.op_ind) || dynamic_input);
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
       fn_seq->run();
 
@@ -67,11 +70,45 @@ void LinearExecutor::executeImpl(const ExecutionObservee &subject)
       fn_seq->initRunning();
 
       bool handle_dynamic_tensor =
-        _lowered_graph->getHasDynamicTensor(code.op_ind) || hasDynamicInput();
+        !planned && (_lowered_graph->getHasDynamicTensor(code.op_ind) || dynamic_input);
       fn_seq->enableDynamicShapeInferer(handle_dynamic_tensor);
       fn_seq->run();
     }
   }
+
+  recordShapePlan(dynamic_input, planned);
+}
+
+ShapePlanCacheStats LinearExecutor::shapePlanCacheStats() const
+{
+  if (!_shape_plan_cache)
+    return ShapePlanCacheStats{};
+
+  return _shape_plan_cache->stats();
+}
+
+bool LinearExecutor::applyShapePlan(bool dynamic_input)
+{
+  if (!dynamic_input || !_shape_plan_cache || !_shape_plan_cache->enabled())
+    return false;
+
+  return _shape_plan_cache->apply(inputShapes());
+}
+
+void LinearExecutor::recordShapePlan(bool dynamic_input, bool planned)
+{
+  if (!dynamic_input || planned || !_shape_plan_cache || !_shape_plan_cache->enabled())
+    return;
+
+  _shape_plan_cache->record(inputShapes());
+}
+
+std::vector<ir::Shape> LinearExecutor::inputShapes() const
+{
+  std::vector<ir::Shape> shapes;
+  for (const auto tensor : _input_tensors)
+    shapes.emplace_back(tensor->getShape());
+  return shapes;
 }
 
 } // namespace exec
@@ -23,6 +23,7 @@
 #define __ONERT_EXEC_EXECUTOR_H_
 
 #include "ExecutorBase.h"
+#include "ShapePlanCache.h"
 
 #include "compiler/CodeMap.h"
 #include "ir/Index.h"
@@ -45,24 +46,41 @@ public:
    * @param lowered_graph LoweredGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param shape_plan_cache_size Number of dynamic input shapes whose plans are cached
    */
   LinearExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
                  backend::BackendContexts &&backend_contexts,
                  const compiler::TensorRegistries &tensor_regs, compiler::CodeMap &&code_map,
-                 const std::vector<ir::OperationIndex> &order, const util::TracingCtx *tracing_ctx)
+                 const std::vector<ir::OperationIndex> &order, const util::TracingCtx *tracing_ctx,
+                 uint32_t shape_plan_cache_size = 0)
     : ExecutorBase{std::move(lowered_graph), std::move(backend_contexts), tensor_regs, tracing_ctx}
   {
     for (auto &&index : order)
     {
       _code.emplace_back(std::move(code_map.at(index)));
     }
+
+    if (shape_plan_cache_size > 0)
+      _shape_plan_cache =
+        std::make_unique<ShapePlanCache>(_graph, tensor_regs, order, shape_plan_cache_size);
   }
 
 public:
   void executeImpl(const ExecutionObservee &subject) override;
+  ShapePlanCacheStats shapePlanCacheStats() const override;
+
+private:
+  /**
+   * @brief  Apply cached shapes and memory plan if input shapes are dynamic and cached
+   * @return @c true if dynamic shape inference can be skipped in this execution
+   */
+  bool applyShapePlan(bool dynamic_input);
+  void recordShapePlan(bool dynamic_input, bool planned);
+  std::vector<ir::Shape> inputShapes() const;
 
 private:
   std::vector<compiler::CodeAndInfo> _code;
+  std::unique_ptr<ShapePlanCache> _shape_plan_cache;
 };
 
 } // namespace exec
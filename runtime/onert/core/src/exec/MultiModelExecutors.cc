@@ -299,8 +299,11 @@ void MultiModelExecutors::createPkgIOQuantLayers(const IODescription &desc)
       // Create EdgeTensor for nnpkg input if type is different
       const auto &orig_info = executor->inputInfo(io_index.value());
       const auto orig_layout = executor->inputLayout(io_index.value());
-      if ((input_desc->info.typeInfo().type() != orig_info.typeInfo().type()) ||
-          (input_desc->layout == ir::Layout::NCHW))
+      // Layout permutation is skipped if it does not change memory order of elements
+      const bool need_permute =
+        input_desc->layout == ir::Layout::NCHW &&
+        !ir::isIdentityPermutation(input_desc->info.shape(), ir::PermuteType::NCHW_TO_NHWC);
+      if ((input_desc->info.typeInfo().type() != orig_info.typeInfo().type()) || need_permute)
       {
         auto pkg_input_edge_tensor = std::make_unique<EdgeTensor>(orig_info, orig_layout);
         _pkg_input_quant_tensors[pkg_input] = std::move(pkg_input_edge_tensor);
@@ -309,7 +312,7 @@ void MultiModelExecutors::createPkgIOQuantLayers(const IODescription &desc)
         src_tensors.emplace_back(_pkg_input_tensors[pkg_input].get());
         dst_tensors.emplace_back(_pkg_input_quant_tensors[pkg_input].get());
 
-        if (input_desc->layout == ir::Layout::NCHW)
+        if (need_permute)
           permute_types.emplace_back(ir::PermuteType::NCHW_TO_NHWC);
         else
           permute_types.emplace_back(ir::PermuteType::COPY);
@@ -347,8 +350,11 @@ void MultiModelExecutors::createPkgIOQuantLayers(const IODescription &desc)
       // Create EdgeTensor for nnpkg output if type is different
       const auto &orig_info = executor->outputInfo(io_index.value());
       const auto orig_layout = executor->outputLayout(io_index.value());
-      if ((output_desc->info.typeInfo().type() != orig_info.typeInfo().type()) ||
-          (output_desc->layout == ir::Layout::NCHW))
+      const bool need_permute =
+        output_desc->layout == ir::Layout::NCHW &&
+        (orig_info.isDynamic() ||
+         !ir::isIdentityPermutation(orig_info.shape(), ir::PermuteType::NHWC_TO_NCHW));
+      if ((output_desc->info.typeInfo().type() != orig_info.typeInfo().type()) || need_permute)
       {
         auto pkg_output_edge_tensor = std::make_unique<EdgeTensor>(orig_info, orig_layout);
         _pkg_output_quant_tensors[pkg_output] = std::move(pkg_output_edge_tensor);
@@ -357,7 +363,7 @@ void MultiModelExecutors::createPkgIOQuantLayers(const IODescription &desc)
         src_tensors.emplace_back(_pkg_output_quant_tensors[pkg_output].get());
         dst_tensors.emplace_back(_pkg_output_tensors[pkg_output].get());
 
-        if (output_desc->layout == ir::Layout::NCHW)
+        if (need_permute)
           permute_types.emplace_back(ir::PermuteType::NHWC_TO_NCHW);
         else
           permute_types.emplace_back(ir::PermuteType::COPY);
@@ -55,8 +55,16 @@ void ParallelExecutor::notify(uint32_t finished_job_id)
 
   DataflowExecutor::notify(finished_job_id);
 
-  lock.unlock();
-  _cv_jobs.notify_all();
+  // Dispatch jobs that became ready on the worker thread that finished the job, so that the
+  // main thread does not need to wake up for each job
+  assignReadyJobs();
+
+  assert(_num_unfinished_jobs > 0);
+  if (--_num_unfinished_jobs == 0)
+  {
+    lock.unlock();
+    _cv_jobs.notify_all();
+  }
 }
 
 ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lowered_graph,
@@ -68,69 +76,34 @@ ParallelExecutor::ParallelExecutor(std::unique_ptr<compiler::LoweredGraph> lower
                      std::move(code_map), tracing_ctx}
 {
   VERBOSE(ParallelExecutor) << "Constructing Parallel Executor" << std::endl;
-}
-
-void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
-{
-  bool dynamic_input_exists = hasDynamicInput();
 
-  // Init scheduler
+  // Init scheduler once: worker threads are reused for every execution
   // TODO Consider to have distinct backend set in GraphLowerInfo
   BackendSet backends;
   for (const auto &[idx, backend] : _lowered_graph->lower_info().operation)
     backends.add(backend);
 
   _scheduler = std::make_unique<ParallelScheduler>(backends);
+}
 
-  assert(noWaitingJobs());
-
-  // Execution setup
-  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
-
-  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
-  {
-    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
-    if (_input_info[i] == 0)
-    {
-      emplaceToReadyJobs(i);
-    }
-  }
-  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
-
-  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
-
-  auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
-
-  subject.notifySubgraphBegin(profiling_subg_index);
-
-  while (true)
+void ParallelExecutor::assignReadyJobs()
+{
+  while (!_ready_jobs.empty())
   {
-    std::unique_lock<std::mutex> lock{_mu_jobs};
-
-    if (_ready_jobs.empty())
-    {
-      _cv_jobs.wait(lock, [this] { return !_ready_jobs.empty() || noWaitingJobs(); });
-      // Check finish condition
-      if (_ready_jobs.empty() && noWaitingJobs())
-      {
-        break;
-      }
-    }
-
     auto job = std::move(_ready_jobs.begin()->second);
     _ready_jobs.erase(_ready_jobs.begin());
 
-    lock.unlock();
-
     VERBOSE(ParallelExecutor) << "Assigning fn " << job->index() << std::endl;
 
     auto job_index = job->index();
     auto op_ind = _job_to_op[job_index];
     const auto backend = _lowered_graph->lower_info().operation.at(op_ind);
-    auto setup = [&, op_ind, backend]() {
+    const auto &subject = *_subject;
+    const auto profiling_subg_index = _profiling_subg_index;
+    auto setup = [&subject, this, profiling_subg_index, op_ind, backend]() {
       subject.notifyJobBegin(this, profiling_subg_index, op_ind, backend);
     };
-    auto teardown = [&, job_index, op_ind, backend]() {
+    auto teardown = [&subject, this, profiling_subg_index, job_index, op_ind, backend]() {
       subject.notifyJobEnd(this, profiling_subg_index, op_ind, backend);
       notify(job_index);
     };
@@ -139,18 +112,57 @@ void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
 
     // dynamic tensor setting
     bool handle_dynamic_tensor =
-      _lowered_graph->getHasDynamicTensor(op_ind) || dynamic_input_exists;
+      _lowered_graph->getHasDynamicTensor(op_ind) || _dynamic_input_exists;
     job->fn_seq()->enableDynamicShapeInferer(handle_dynamic_tensor);
 
-    _scheduler->assign(std::make_unique<HookFunction>(job->fn_seq(), setup, teardown), backend);
+    auto fn = std::make_unique<HookFunction>(job->fn_seq(), setup, teardown);
     _finished_jobs[job_index] = std::move(job);
+    _scheduler->assign(std::move(fn), backend);
+  }
+}
+
+void ParallelExecutor::executeImpl(const ExecutionObservee &subject)
+{
+  _dynamic_input_exists = hasDynamicInput();
+  _subject = &subject;
+  _profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_graph);
+
+  assert(noWaitingJobs());
+
+  std::unique_lock<std::mutex> lock{_mu_jobs};
+
+  // Execution setup
+  _waiting_jobs.swap(_finished_jobs); // Move finished jobs to waiting jobs
+  _num_unfinished_jobs = _waiting_jobs.size();
+
+  for (uint32_t i = 0; i < _waiting_jobs.size(); ++i)
+  {
+    VERBOSE(ParallelExecutor) << i << ": " << _input_info[i] << std::endl;
+    if (_input_info[i] == 0)
+    {
+      emplaceToReadyJobs(i);
+    }
   }
+  assert(!_ready_jobs.empty()); // Cannot begin if there is no initial jobs
+
+  VERBOSE(ParallelExecutor) << "INITIAL JOBS : " << _ready_jobs.size() << std::endl;
+
+  subject.notifySubgraphBegin(_profiling_subg_index);
+
+  // Following jobs are assigned by worker threads on notify()
+  assignReadyJobs();
+
+  _cv_jobs.wait(lock, [this] { return _num_unfinished_jobs == 0; });
+  lock.unlock();
 
   assert(noWaitingJobs());
+  assert(_ready_jobs.empty());
 
-  // Wait for all the jobs done
+  // Wait for all the workers to leave the jobs
   _scheduler->finish();
-  subject.notifySubgraphEnd(profiling_subg_index);
+  subject.notifySubgraphEnd(_profiling_subg_index);
+
+  _subject = nullptr;
 
   // Reset input info for the next execution
   _input_info = _initial_input_info;
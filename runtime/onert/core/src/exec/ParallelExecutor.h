@@ -52,10 +52,29 @@ public:
 
   void executeImpl(const ExecutionObservee &subject) override;
 
+private:
+  /**
+   * @brief Hand over all jobs in @c _ready_jobs to the scheduler
+   * @note  @c _mu_jobs must be held by the caller
+   */
+  void assignReadyJobs();
+
 private:
   std::condition_variable _cv_jobs;
   std::mutex _mu_jobs;
+  /**
+   * @brief Scheduler that owns per-backend worker threads
+   *        It is created once and reused for every execution
+   */
   std::unique_ptr<ParallelScheduler> _scheduler;
+  /**
+   * @brief Number of jobs not finished yet in current execution
+   */
+  uint32_t _num_unfinished_jobs{0};
+  // States of current execution, valid only during executeImpl()
+  const ExecutionObservee *_subject{nullptr};
+  ir::SubgraphIndex _profiling_subg_index;
+  bool _dynamic_input_exists{false};
 };
 
 } // namespace exec
@@ -47,7 +47,7 @@ void ParallelScheduler::finish()
 {
   for (auto &&itr : _thread_pools)
   {
-    itr.second->finish();
+    itr.second->wait();
   }
 }
 
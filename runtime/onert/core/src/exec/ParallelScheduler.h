@@ -46,7 +46,8 @@ public:
    */
   void assign(std::unique_ptr<IFunction> &&fn, const backend::Backend *backend);
   /**
-   * @brief Block until all jobs are finished
+   * @brief Block until all assigned jobs are finished
+   * @note  Worker threads are kept alive, so the scheduler can be reused for the next run
    */
   void finish();
 
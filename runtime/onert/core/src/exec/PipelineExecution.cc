@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "exec/PipelineExecution.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+
+namespace
+{
+
+using namespace onert;
+
+int32_t find_io_index(const std::vector<ir::IODesc> &pkg_ios, const ir::IODesc &desc)
+{
+  auto it = std::find(pkg_ios.begin(), pkg_ios.end(), desc);
+  if (it == pkg_ios.end())
+    return -1;
+  return static_cast<int32_t>(std::distance(pkg_ios.begin(), it));
+}
+
+const ir::IODesc &find_from(const ir::ModelEdges &edges, const ir::IODesc &to)
+{
+  for (const auto &edge : edges.edges)
+  {
+    if (edge.to == to)
+      return edge.from;
+  }
+
+  throw std::runtime_error{"Cannot find edge for model input"};
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+void PipelineExecution::RequestQueue::push(std::unique_ptr<Request> &&request)
+{
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    // Zero capacity means unbounded queue
+    _cv_push.wait(lock, [this] { return _capacity == 0 || _queue.size() < _capacity; });
+    _queue.emplace_back(std::move(request));
+  }
+  _cv_pop.notify_one();
+}
+
+std::unique_ptr<PipelineExecution::Request> PipelineExecution::RequestQueue::pop()
+{
+  std::unique_ptr<Request> request;
+  {
+    std::unique_lock<std::mutex> lock{_mu};
+    _cv_pop.wait(lock, [this] { return _closed || !_queue.empty(); });
+    if (_queue.empty())
+      return nullptr;
+
+    request = std::move(_queue.front());
+    _queue.pop_front();
+  }
+  _cv_push.notify_one();
+  return request;
+}
+
+void PipelineExecution::RequestQueue::close()
+{
+  {
+    std::lock_guard<std::mutex> lock{_mu};
+    _closed = true;
+  }
+  _cv_pop.notify_all();
+}
+
+PipelineExecution::PipelineExecution(const std::vector<std::shared_ptr<IExecutors>> &stages,
+                                     const ir::ModelEdges &edges, size_t queue_capacity)
+  : _stages_executors{stages}, _edges{edges}
+{
+  if (stages.empty())
+    throw std::runtime_error{"PipelineExecution: no stage"};
+  if (queue_capacity == 0)
+    throw std::runtime_error{"PipelineExecution: queue capacity should be positive"};
+
+  // Allow below edges only (same as MultiModelExecutors)
+  //  m1 < m2, s1 == 0 and s2 == 0 if m1:s1:o1 -> m2:s2:o2'
+  for (const auto &edge : _edges.edges)
+  {
+    const auto model_from = std::get<ir::ModelIndex>(edge.from);
+    const auto model_to = std::get<ir::ModelIndex>(edge.to);
+    if ((model_from.value() >= model_to.value()) || (model_to.value() >= stages.size()) ||
+        (std::get<ir::SubgraphIndex>(edge.from) != ir::SubgraphIndex{0}) ||
+        (std::get<ir::SubgraphIndex>(edge.to) != ir::SubgraphIndex{0}))
+      throw std::runtime_error{"PipelineExecution: unsupported edge between models"};
+  }
+
+  for (uint16_t stage = 0; stage < stages.size(); ++stage)
+  {
+    auto &executors = _stages_executors[stage];
+    auto execution = std::make_unique<Execution>(executors);
+
+    // Edge input is given in the type of `from` output. Type-aware quantization is done by
+    // execution if types are different.
+    for (uint32_t i = 0; i < executors->inputSize(); ++i)
+    {
+      const auto to = ir::IODesc{ir::ModelIndex{stage}, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+      if (find_io_index(_edges.pkg_inputs, to) != -1)
+        continue;
+
+      const auto &from = find_from(_edges, to);
+      const auto from_stage = std::get<ir::ModelIndex>(from).value();
+      const auto &from_info =
+        _stages_executors[from_stage]->outputInfo(std::get<ir::IOIndex>(from));
+      if (from_info.typeInfo() != executors->inputInfo(ir::IOIndex{i}).typeInfo())
+        execution->setInputType(ir::IOIndex{i}, from_info.typeInfo());
+    }
+
+    _executions.emplace_back(std::move(execution));
+    _queues.emplace_back(std::make_unique<RequestQueue>(queue_capacity));
+  }
+  // Finished requests are kept until popped, so that push does not wait for pop
+  _queues.emplace_back(std::make_unique<RequestQueue>(0));
+
+  for (uint16_t stage = 0; stage < stages.size(); ++stage)
+    _threads.emplace_back(&PipelineExecution::runStage, this, stage);
+}
+
+PipelineExecution::~PipelineExecution()
+{
+  close();
+  for (auto &&thread : _threads)
+    thread.join();
+}
+
+void PipelineExecution::push(const std::vector<const void *> &inputs,
+                             const std::vector<size_t> &lengths)
+{
+  if (inputs.size() != inputSize() || lengths.size() != inputSize())
+    throw std::runtime_error{"PipelineExecution: invalid number of inputs"};
+
+  auto request = std::make_unique<Request>();
+  request->inputs.resize(inputs.size());
+  for (uint32_t i = 0; i < inputs.size(); ++i)
+  {
+    const auto src = reinterpret_cast<const uint8_t *>(inputs[i]);
+    request->inputs[i].assign(src, src + lengths[i]);
+  }
+
+  std::lock_guard<std::mutex> lock{_mu_push};
+  if (_closed)
+    throw std::runtime_error{"PipelineExecution: pipeline is already closed"};
+  _queues.front()->push(std::move(request));
+}
+
+bool PipelineExecution::pop(std::vector<std::vector<uint8_t>> &outputs)
+{
+  auto request = _queues.back()->pop();
+  if (request == nullptr)
+    return false;
+
+  if (request->error)
+    std::rethrow_exception(request->error);
+
+  outputs.clear();
+  for (const auto &pkg_output : _edges.pkg_outputs)
+    outputs.emplace_back(std::move(request->outputs.at(pkg_output)));
+
+  return true;
+}
+
+void PipelineExecution::close()
+{
+  std::lock_guard<std::mutex> lock{_mu_push};
+  if (_closed)
+    return;
+
+  _closed = true;
+  _queues.front()->close();
+}
+
+void PipelineExecution::runStage(uint16_t stage)
+{
+  auto &in_queue = *_queues[stage];
+  auto &out_queue = *_queues[stage + 1];
+
+  while (auto request = in_queue.pop())
+  {
+    // Failed request skips remaining stages and its error is reported on pop
+    if (!request->error)
+    {
+      try
+      {
+        executeStage(stage, *request);
+      }
+      catch (...)
+      {
+        request->error = std::current_exception();
+      }
+    }
+    out_queue.push(std::move(request));
+  }
+
+  // Previous stage is finished, so the next stage can finish after processing remaining requests
+  out_queue.close();
+  VERBOSE(PipelineExecution) << "Stage " << stage << " is finished" << std::endl;
+}
+
+void PipelineExecution::executeStage(uint16_t stage, Request &request)
+{
+  auto &execution = *_executions[stage];
+  const auto &executors = _stages_executors[stage];
+  const auto model_index = ir::ModelIndex{stage};
+
+  for (uint32_t i = 0; i < executors->inputSize(); ++i)
+  {
+    const auto io_desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+    const auto input_pkg_index = find_io_index(_edges.pkg_inputs, io_desc);
+    const auto &buffer = input_pkg_index != -1 ? request.inputs[input_pkg_index]
+                                               : request.outputs.at(find_from(_edges, io_desc));
+    execution.setInput(ir::IOIndex{i}, buffer.data(), buffer.size());
+  }
+
+  for (uint32_t i = 0; i < executors->outputSize(); ++i)
+  {
+    const auto io_desc = ir::IODesc{model_index, ir::SubgraphIndex{0}, ir::IOIndex{i}};
+    auto &buffer = request.outputs[io_desc];
+    buffer.resize(execution.getOutputTotalSize(ir::IOIndex{i}));
+    execution.setOutput(ir::IOIndex{i}, buffer.data(), buffer.size());
+  }
+
+  execution.execute();
+}
+
+} // namespace exec
+} // namespace onert
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ShapePlanCache.h"
+
+#include "util/logging.h"
+
+namespace
+{
+
+using namespace onert;
+
+// Returns inputs whose values decide output shape of the operation
+std::vector<uint32_t> shapeValueInputs(ir::OpCode opcode)
+{
+  switch (opcode)
+  {
+    case ir::OpCode::ArgMinMax:
+    case ir::OpCode::BroadcastTo:
+    case ir::OpCode::ExpandDims:
+    case ir::OpCode::OneHot:
+    case ir::OpCode::Pad:
+    case ir::OpCode::Reduce:
+    case ir::OpCode::Reshape:
+    case ir::OpCode::ResizeBilinear:
+    case ir::OpCode::ResizeNearestNeighbor:
+    case ir::OpCode::Tile:
+    case ir::OpCode::Transpose:
+      return {1};
+    case ir::OpCode::BatchToSpaceND:
+    case ir::OpCode::Slice:
+    case ir::OpCode::SpaceToBatchND:
+    case ir::OpCode::SplitV:
+      return {1, 2};
+    case ir::OpCode::StridedSlice:
+      return {1, 2, 3};
+    case ir::OpCode::Fill:
+    case ir::OpCode::Split:
+    case ir::OpCode::StatelessRandomUniform:
+      return {0};
+    case ir::OpCode::Range:
+      return {0, 1, 2};
+    default:
+      return {};
+  }
+}
+
+bool isShapeDecidedByInputShapes(const ir::Graph &graph, const ir::IOperation &op)
+{
+  switch (op.opcode())
+  {
+    // Output shapes depend on control flow or unknown kernels
+    case ir::OpCode::Bulk:
+    case ir::OpCode::Custom:
+    case ir::OpCode::If:
+    case ir::OpCode::While:
+      return false;
+    default:
+      break;
+  }
+
+  const auto &inputs = op.getInputs();
+  for (const auto input_index : shapeValueInputs(op.opcode()))
+  {
+    if (input_index >= inputs.size())
+      continue;
+
+    const auto &ind = inputs.at(input_index);
+    if (ind.valid() && !graph.operands().at(ind).isConstant())
+      return false;
+  }
+  return true;
+}
+
+} // namespace
+
+namespace onert
+{
+namespace exec
+{
+
+ShapePlanCache::ShapePlanCache(const ir::Graph &graph,
+                               const compiler::TensorRegistries &tensor_regs,
+                               const std::vector<ir::OperationIndex> &order,
+                               uint32_t max_buckets)
+  : _max_buckets{max_buckets}
+{
+  if (max_buckets == 0)
+    return;
+
+  for (const auto &op_ind : order)
+  {
+    if (!isShapeDecidedByInputShapes(graph, graph.operations().at(op_ind)))
+    {
+      VERBOSE(ShapePlanCache) << "Disabled by " << graph.operations().at(op_ind).name()
+                              << std::endl;
+      return;
+    }
+  }
+
+  // Collect candidates and their lifetime in execution order
+  const auto model_io =
+    (graph.getInputs() + graph.getOutputs()) | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED;
+  ir::OperandIndexMap<size_t> candidate_map;
+  _claims.resize(order.size());
+  _releases.resize(order.size());
+  ir::OperandIndexMap<size_t> last_use;
+  for (size_t step = 0; step < order.size(); ++step)
+  {
+    const auto &op = graph.operations().at(order[step]);
+    for (const auto &ind : op.getInputs() | ir::Remove::UNDEFINED)
+      last_use[ind] = step;
+
+    for (const auto &ind : op.getOutputs() | ir::Remove::UNDEFINED | ir::Remove::DUPLICATED)
+    {
+      const auto &operand = graph.operands().at(ind);
+      if (model_io.contains(ind) || operand.isConstant() || operand.info().isVariable())
+        continue;
+
+      auto tensor = dynamic_cast<backend::basic::Tensor *>(tensor_regs.getITensor(ind));
+      if (tensor == nullptr)
+      {
+        VERBOSE(ShapePlanCache) << "Disabled by tensor of operand " << ind << std::endl;
+        return;
+      }
+
+      candidate_map[ind] = _tensors.size();
+      _indices.emplace_back(ind);
+      _tensors.emplace_back(tensor);
+      _claims[step].emplace_back(candidate_map[ind]);
+      last_use[ind] = step;
+    }
+  }
+  for (const auto &[ind, candidate] : candidate_map)
+    _releases[last_use.at(ind)].emplace_back(candidate);
+
+  for (const auto &ind : graph.getOutputs() | ir::Remove::UNDEFINED)
+    _output_tensors.emplace_back(tensor_regs.getITensor(ind));
+
+  _enabled = true;
+}
+
+const ShapePlanCache::Bucket *
+ShapePlanCache::find(const std::vector<ir::Shape> &input_shapes) const
+{
+  for (const auto &bucket : _buckets)
+  {
+    if (bucket.input_shapes == input_shapes)
+      return &bucket;
+  }
+  return nullptr;
+}
+
+bool ShapePlanCache::apply(const std::vector<ir::Shape> &input_shapes)
+{
+  assert(_enabled);
+
+  const auto bucket = find(input_shapes);
+  bool usable = bucket != nullptr;
+  // Tensors become dynamic after the bucket is recorded cannot be handled by the bucket
+  for (size_t i = 0; usable && i < _tensors.size(); ++i)
+    usable = bucket->planned[i] || !_tensors[i]->is_dynamic();
+
+  if (!usable)
+  {
+    _num_misses++;
+    return false;
+  }
+
+  for (size_t i = 0; i < _tensors.size(); ++i)
+  {
+    if (bucket->planned[i])
+      _tensors[i]->setPlannedBuffer(bucket->shapes[i], bucket->mem_mgr->getBuffer(_indices[i]));
+  }
+  for (const auto &[tensor, shape] : bucket->output_shapes)
+    tensor->applyShape(shape);
+
+  _num_hits++;
+  return true;
+}
+
+void ShapePlanCache::record(const std::vector<ir::Shape> &input_shapes)
+{
+  assert(_enabled);
+
+  if (_buckets.size() >= _max_buckets || find(input_shapes) != nullptr)
+    return;
+
+  Bucket bucket;
+  bucket.input_shapes = input_shapes;
+  bucket.planned.resize(_tensors.size(), false);
+  bucket.shapes.resize(_tensors.size());
+  for (size_t i = 0; i < _tensors.size(); ++i)
+  {
+    if (_tensors[i]->is_dynamic())
+    {
+      bucket.planned[i] = true;
+      bucket.shapes[i] = _tensors[i]->getShape();
+    }
+  }
+  for (auto &&tensor : _output_tensors)
+    bucket.output_shapes.emplace_back(tensor, tensor->getShape());
+
+  // Plan memory with lifetime of tensors as static tensors
+  // NOTE Outputs are claimed before releasing inputs so that they do not share memory
+  bucket.mem_mgr = std::make_unique<backend::basic::MemoryManager>();
+  for (size_t step = 0; step < _claims.size(); ++step)
+  {
+    for (const auto candidate : _claims[step])
+    {
+      if (bucket.planned[candidate])
+        bucket.mem_mgr->claimPlan(_indices[candidate],
+                                  _tensors[candidate]->get_info().total_size());
+    }
+    for (const auto candidate : _releases[step])
+    {
+      if (bucket.planned[candidate])
+        bucket.mem_mgr->releasePlan(_indices[candidate]);
+    }
+  }
+  bucket.mem_mgr->allocate();
+
+  _buckets.emplace_back(std::move(bucket));
+  VERBOSE(ShapePlanCache) << "Recorded bucket #" << _buckets.size() << std::endl;
+}
+
+ShapePlanCacheStats ShapePlanCache::stats() const
+{
+  ShapePlanCacheStats stats;
+  stats.num_buckets = _buckets.size();
+  stats.num_hits = _num_hits;
+  stats.num_misses = _num_misses;
+  return stats;
+}
+
+} // namespace exec
+} // namespace onert
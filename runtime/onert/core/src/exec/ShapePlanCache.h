@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
+#define __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
+
+#include "../compiler/TensorRegistries.h"
+
+#include "backend/basic/MemoryManager.h"
+#include "backend/basic/Tensor.h"
+#include "exec/IExecutor.h"
+#include "ir/Graph.h"
+
+#include <memory>
+#include <vector>
+
+namespace onert
+{
+namespace exec
+{
+
+/**
+ * @brief Class to cache inferred shapes and planned memory of dynamic tensors per input shapes
+ *
+ * After an execution with dynamic input shapes, shapes of dynamic tensors are recorded and their
+ * memory is planned statically with the lifetime of tensors in execution order. When the same
+ * input shapes are given again, the recorded shapes and planned buffers are applied to tensors,
+ * so that the execution can skip dynamic shape inference and dynamic memory allocation.
+ *
+ * @note Cache is disabled for graphs where output shape of an operation depends on values of
+ *       non-constant input (e.g. Reshape with non-constant shape) or on control flow.
+ * @note Planned memory of each bucket is kept until executor is destroyed.
+ */
+class ShapePlanCache
+{
+private:
+  struct Bucket
+  {
+    std::vector<ir::Shape> input_shapes;
+    // Shapes of candidate tensors which were dynamic (planned)
+    std::vector<bool> planned;
+    std::vector<ir::Shape> shapes;
+    // Shapes of output tensors
+    std::vector<std::pair<backend::ITensor *, ir::Shape>> output_shapes;
+    std::unique_ptr<backend::basic::MemoryManager> mem_mgr;
+  };
+
+public:
+  /**
+   * @brief     Construct a new ShapePlanCache object
+   * @param[in] graph       Graph to be executed
+   * @param[in] tensor_regs Tensor registries having tensors of graph
+   * @param[in] order       Execution order of operations
+   * @param[in] max_buckets Maximum number of input shapes to be cached
+   */
+  ShapePlanCache(const ir::Graph &graph, const compiler::TensorRegistries &tensor_regs,
+                 const std::vector<ir::OperationIndex> &order, uint32_t max_buckets);
+
+public:
+  bool enabled() const { return _enabled; }
+  /**
+   * @brief     Apply cached shapes and buffers of the given input shapes to tensors
+   * @return    @c true if applied, @c false if there is no usable bucket
+   */
+  bool apply(const std::vector<ir::Shape> &input_shapes);
+  /**
+   * @brief     Record shapes of tensors inferred by the execution with the given input shapes
+   */
+  void record(const std::vector<ir::Shape> &input_shapes);
+  ShapePlanCacheStats stats() const;
+
+private:
+  const Bucket *find(const std::vector<ir::Shape> &input_shapes) const;
+
+private:
+  bool _enabled{false};
+  const uint32_t _max_buckets;
+  // Candidate tensors to be planned: non-constant intermediate tensors of graph
+  std::vector<ir::OperandIndex> _indices;
+  std::vector<backend::basic::Tensor *> _tensors;
+  // Candidates to be claimed and released at each execution step
+  std::vector<std::vector<size_t>> _claims;
+  std::vector<std::vector<size_t>> _releases;
+  std::vector<backend::ITensor *> _output_tensors;
+  std::vector<Bucket> _buckets;
+  uint64_t _num_hits{0};
+  uint64_t _num_misses{0};
+};
+
+} // namespace exec
+} // namespace onert
+
+#endif // __ONERT_EXEC_SHAPE_PLAN_CACHE_H__
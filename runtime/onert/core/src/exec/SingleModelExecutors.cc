@@ -89,8 +89,14 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
     auto user_type = desc->info.typeInfo().type();
     auto &model_info = entryExecutor()->inputInfo(i).typeInfo();
     auto model_type = model_info.type();
-    if ((user_type != model_type && user_type == ir::DataType::FLOAT32) ||
-        (desc->layout == ir::Layout::NCHW))
+    // User buffer is bound to executor directly (zero-copy) unless quantization or
+    // layout permutation changing memory order is required. Graph IO operands are external
+    // operands of backends, so they never take memory from backend arenas.
+    const bool need_quantize = user_type != model_type && user_type == ir::DataType::FLOAT32;
+    const bool need_permute =
+      desc->layout == ir::Layout::NCHW &&
+      !ir::isIdentityPermutation(desc->info.shape(), ir::PermuteType::NCHW_TO_NHWC);
+    if (need_quantize || need_permute)
     {
       auto quantized_info = desc->info;
       quantized_info.typeInfo(model_info);
@@ -101,7 +107,7 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
       input_tensors.push_back(tensorpool.back().get());
       input_qtensors.push_back(qtensorpool.back().get());
       inputs[i] = qtensorpool.back().get();
-      if (desc->layout == ir::Layout::NCHW)
+      if (need_permute)
         input_permute_types.push_back(ir::PermuteType::NCHW_TO_NHWC);
       else
         input_permute_types.push_back(ir::PermuteType::COPY);
@@ -110,6 +116,14 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
       inputs[i] = tensorpool.back().get();
   }
 
+  // Output shapes are same with model's ones only if input shapes are not changed
+  bool static_shape = true;
+  for (uint32_t i = 0; i < inputs.size(); i++)
+  {
+    if (ctx.desc.inputs[i]->info.shape() != entryExecutor()->inputInfo(i).shape())
+      static_shape = false;
+  }
+
   // Prepare UserTensor and EdgeTensor for output dequantization
   for (uint32_t i = 0; i < outputs.size(); i++)
   {
@@ -125,8 +139,14 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
     auto user_type = desc->info.typeInfo().type();
     auto &model_info = entryExecutor()->outputInfo(i).typeInfo();
     auto model_type = model_info.type();
-    if ((user_type != model_type && user_type == ir::DataType::FLOAT32) ||
-        (desc->layout == ir::Layout::NCHW))
+    // Output shape can be changed by execution, so memory order is checked with static shape only
+    const auto &model_output_info = entryExecutor()->outputInfo(i);
+    const bool need_quantize = user_type != model_type && user_type == ir::DataType::FLOAT32;
+    const bool need_permute =
+      desc->layout == ir::Layout::NCHW &&
+      (!static_shape || model_output_info.isDynamic() ||
+       !ir::isIdentityPermutation(model_output_info.shape(), ir::PermuteType::NHWC_TO_NCHW));
+    if (need_quantize || need_permute)
     {
       auto quantized_info = desc->info;
       quantized_info.typeInfo(model_info);
@@ -137,7 +157,7 @@ void SingleModelExecutors::execute(const ExecutionContext &ctx)
       output_qtensors.push_back(qtensorpool.back().get());
       output_tensors.push_back(tensorpool.back().get());
       outputs[i] = qtensorpool.back().get();
-      if (desc->layout == ir::Layout::NCHW)
+      if (need_permute)
         output_permute_types.push_back(ir::PermuteType::NHWC_TO_NCHW);
       else
         output_permute_types.push_back(ir::PermuteType::COPY);
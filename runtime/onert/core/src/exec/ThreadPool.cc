@@ -55,6 +55,8 @@ void ThreadPool::join()
   _threads.clear();
 }
 
+void ThreadPool::wait() { _worker.wait(); }
+
 void ThreadPool::finish()
 {
   _worker.finish();
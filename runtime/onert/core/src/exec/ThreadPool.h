@@ -59,6 +59,11 @@ public:
    */
   void finish();
 
+  /**
+   * @brief Block until all queued jobs are done, keeping worker threads alive for reuse
+   */
+  void wait();
+
 private:
   void join();
 
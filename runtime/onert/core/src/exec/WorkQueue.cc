@@ -59,11 +59,23 @@ void WorkQueue::operator()()
         assert(((_state == State::FINISHING) || (_state == State::ONLINE)) && !_functions.empty());
         fn = std::move(_functions.front());
         _functions.pop();
+        _num_running++;
       }
     }
 
     assert(fn);
     fn->run();
+    // Release the function before reporting idle so that nothing it captured outlives wait()
+    fn.reset();
+
+    bool idle = false;
+    {
+      std::unique_lock<std::mutex> lock{_mu};
+      _num_running--;
+      idle = _functions.empty() && _num_running == 0;
+    }
+    if (idle)
+      _cv_idle.notify_all();
   }
 }
 
@@ -94,6 +106,12 @@ void WorkQueue::finish()
   _cv.notify_all();
 }
 
+void WorkQueue::wait()
+{
+  std::unique_lock<std::mutex> lock{_mu};
+  _cv_idle.wait(lock, [this] { return _functions.empty() && _num_running == 0; });
+}
+
 uint32_t WorkQueue::numJobsInQueue()
 {
   std::unique_lock<std::mutex> lock{_mu};
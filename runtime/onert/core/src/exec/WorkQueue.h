@@ -66,6 +66,11 @@ public:
    * @brief Flag as terminating so all the worker threads can terminate
    */
   void finish();
+  /**
+   * @brief Block until the job queue is empty and no job is running. Unlike @c finish, worker
+   *        threads stay alive so that the queue can be reused for the next run
+   */
+  void wait();
   /**
    * @brief Check if it has pending jobs. Even if this returns fals, WorkQueue threads may be still
    * running
@@ -77,8 +82,10 @@ public:
 private:
   State _state{State::ONLINE};
   std::queue<std::unique_ptr<IFunction>> _functions;
+  uint32_t _num_running{0};
   std::mutex _mu;
   std::condition_variable _cv;
+  std::condition_variable _cv_idle;
 };
 
 } // namespace exec
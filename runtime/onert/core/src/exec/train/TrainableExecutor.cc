@@ -21,6 +21,8 @@
 
 #include <misc/polymorphic_downcast.h>
 
+#include <chrono>
+
 namespace onert
 {
 namespace exec
@@ -28,6 +30,18 @@ namespace exec
 namespace train
 {
 
+namespace
+{
+
+using Clock = std::chrono::steady_clock;
+
+uint64_t elapsedMicros(const Clock::time_point &begin)
+{
+  return std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - begin).count();
+}
+
+} // namespace
+
 TrainableExecutor::TrainableExecutor(
   std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
   backend::train::TrainableBackendContexts &&backend_contexts,
@@ -35,12 +49,14 @@ TrainableExecutor::TrainableExecutor(
   compiler::train::TrainableCodeMap &&code_map,
   const std::vector<ir::OperationIndex> &forward_order,
   const std::vector<ir::OperationIndex> &backward_order, const util::TracingCtx *tracing_ctx,
-  const ir::train::LossInfo &loss_info)
+  const ir::train::LossInfo &loss_info,
+  std::shared_ptr<const compiler::train::RecomputePlan> recompute_plan)
   : _code_map{std::move(code_map)}, _forward_order{std::move(forward_order)},
     _backward_order{std::move(backward_order)}, _lowered_graph{std::move(lowered_graph)},
     _backend_contexts{std::move(backend_contexts)},
     _trainable_graph{_lowered_graph->trainable_graph()}, _tensor_regs{std::move(tensor_regs)},
-    _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info)
+    _mutex(), _tracing_ctx(tracing_ctx), _loss_info(loss_info),
+    _recompute_plan{std::move(recompute_plan)}
 {
   auto build_tensor_list = [&](const auto &ind_seq, auto &tensors) {
     assert(tensors.empty());
@@ -90,7 +106,10 @@ void TrainableExecutor::forward(const std::vector<backend::IPortableTensor *> &i
   // Create observee
   ExecutionObservee subject(_observers, options);
 
+  const auto begin = Clock::now();
   forwardImpl(subject, training);
+  if (training)
+    _phase_stats.forward_us += elapsedMicros(begin);
 
   // TODO Update output(s) desc if desc has dynamic input
 }
@@ -145,11 +164,18 @@ void TrainableExecutor::backward(const ExecutionOptions &options, uint32_t train
   // Create observee
   ExecutionObservee subject(_observers, options);
 
+  const auto begin = Clock::now();
+  const auto update_us = _phase_stats.update_us;
   backwardImpl(subject, training_step);
+  _phase_stats.backward_us += elapsedMicros(begin) - (_phase_stats.update_us - update_us);
+  _phase_stats.num_steps++;
 }
 
 void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t training_step)
 {
+  // Segments which have been forwarded again in this backward
+  std::vector<bool> recomputed(_recompute_plan ? _recompute_plan->segments.size() : 0, false);
+
   if (!subject.isEmpty() && _tracing_ctx)
   {
     auto profiling_subg_index = _tracing_ctx->getSubgraphIndex(&_trainable_graph.graph());
@@ -157,6 +183,7 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
     subject.notifySubgraphBegin(profiling_subg_index);
     for (auto &&index : _backward_order)
     {
+      recompute(index, recomputed);
       const auto &code = _code_map.at(index);
       if (!code.op->isRequiredForBackward())
       {
@@ -169,8 +196,7 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
 #endif
       subject.notifyJobBegin(this, profiling_subg_index, code.op_ind, backend);
 
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      backwardOperation(code, training_step);
 
       subject.notifyJobEnd(this, profiling_subg_index, code.op_ind, backend);
     }
@@ -180,6 +206,7 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
   {
     for (auto &&index : _backward_order)
     {
+      recompute(index, recomputed);
       const auto &code = _code_map.at(index);
       if (!code.op->isRequiredForBackward())
       {
@@ -189,12 +216,46 @@ void TrainableExecutor::backwardImpl(const ExecutionObservee &subject, uint32_t
 #ifdef RUY_PROFILER
       ruy::profiler::ScopeLabel label(code.op->name());
 #endif
-      auto &tn_seq = code.tn_seq;
-      tn_seq->backward(training_step, code.op->isWeightsUpdateEnabled());
+      backwardOperation(code, training_step);
     }
   }
 }
 
+void TrainableExecutor::backwardOperation(const compiler::train::TrainableCodeAndInfo &code,
+                                          uint32_t training_step)
+{
+  auto &tn_seq = code.tn_seq;
+  tn_seq->backward();
+  if (code.op->isWeightsUpdateEnabled())
+  {
+    const auto begin = Clock::now();
+    tn_seq->applyGradients(training_step);
+    _phase_stats.update_us += elapsedMicros(begin);
+  }
+}
+
+void TrainableExecutor::recompute(const ir::OperationIndex &index, std::vector<bool> &recomputed)
+{
+  if (!_recompute_plan)
+    return;
+
+  const auto it = _recompute_plan->op_segments.find(index);
+  if (it == _recompute_plan->op_segments.end() || recomputed[it->second])
+    return;
+
+  // Activations of the segment have been released after forwarding, and tensor planners
+  // allocate them again from here on
+  recomputed[it->second] = true;
+  for (const auto &op_index : _recompute_plan->segments[it->second])
+  {
+    const auto &code = _code_map.at(op_index);
+#ifdef RUY_PROFILER
+    ruy::profiler::ScopeLabel label(code.op->name());
+#endif
+    code.tn_seq->forward(code.op->isRequiredForBackward());
+  }
+}
+
 float TrainableExecutor::getLoss(const ir::IOIndex &pred_io_ind) const
 {
   const auto &loss_ind = _trainable_graph.getLossIndex(pred_io_ind);
@@ -23,8 +23,10 @@
 #include "../../compiler/train/TensorRegistries.h"
 
 #include "backend/train/TrainableBackendContext.h"
+#include "compiler/train/RecomputePlan.h"
 #include "compiler/train/TrainableCodeMap.h"
 #include "compiler/train/LoweredTrainableGraph.h"
+#include "exec/train/TrainingPhaseStats.h"
 #include "ir/train/LossInfo.h"
 #include "ir/Index.h"
 #include "util/TracingCtx.h"
@@ -44,6 +46,7 @@ public:
    * @param lowered_graph LoweredTrainableGraph object
    * @param tensor_builders Tensor builders that are currently used
    * @param code_map @c ir::Operation and its code map
+   * @param recompute_plan Plan of activation recomputation, nullptr if nothing is recomputed
    */
   TrainableExecutor(std::unique_ptr<compiler::train::LoweredTrainableGraph> lowered_graph,
                     backend::train::TrainableBackendContexts &&backend_contexts,
@@ -51,7 +54,8 @@ public:
                     compiler::train::TrainableCodeMap &&code_map,
                     const std::vector<ir::OperationIndex> &forward_order,
                     const std::vector<ir::OperationIndex> &backward_order,
-                    const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info);
+                    const util::TracingCtx *tracing_ctx, const ir::train::LossInfo &training_info,
+                    std::shared_ptr<const compiler::train::RecomputePlan> recompute_plan = nullptr);
 
 public:
   const ir::Graph &graph() const final { return _trainable_graph.graph(); }
@@ -99,6 +103,11 @@ public:
 
   float getLoss(const ir::IOIndex &pred_io_ind) const;
 
+  /**
+   * @brief Get time spent in each phase of training steps since this executor is created
+   */
+  const TrainingPhaseStats &phaseStats() const { return _phase_stats; }
+
   void iterateTrainableTensors(
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
@@ -110,6 +119,12 @@ public:
 private:
   void forwardImpl(const ExecutionObservee &subject, bool training);
   void backwardImpl(const ExecutionObservee &subject, uint32_t training_step);
+  void backwardOperation(const compiler::train::TrainableCodeAndInfo &code,
+                         uint32_t training_step);
+  /**
+   * @brief Forward the segment of @c index again if it has not been recomputed in this backward
+   */
+  void recompute(const ir::OperationIndex &index, std::vector<bool> &recomputed);
 
 private:
   compiler::train::TrainableCodeMap _code_map;
@@ -126,6 +141,8 @@ private:
   std::mutex _mutex;
   const util::TracingCtx *_tracing_ctx;
   const ir::train::LossInfo _loss_info;
+  std::shared_ptr<const compiler::train::RecomputePlan> _recompute_plan;
+  TrainingPhaseStats _phase_stats;
   /**
    * It is set by execute() method only in thread-safe environment.
    * It is used for non-primary executor call on builtin backend
@@ -80,6 +80,8 @@ public:
 
   float getLoss(const ir::IOIndex &index) const;
 
+  const TrainingPhaseStats &phaseStats() const { return entryExecutor()->phaseStats(); }
+
   void iterateTrainableTensors(
     const std::function<void(const ir::OperandIndex &, const backend::train::ITrainableTensor *)>
       &fn) const;
@@ -31,18 +31,19 @@ void TrainableFnSequence::forward(bool training)
   }
 }
 
-void TrainableFnSequence::backward(uint32_t training_step, bool weight_update_enabled)
+void TrainableFnSequence::backward()
 {
   for (auto it = _functions.rbegin(); it != _functions.rend(); ++it)
   {
     (*it)->backward();
   }
-  if (weight_update_enabled)
+}
+
+void TrainableFnSequence::applyGradients(uint32_t training_step)
+{
+  for (const auto &applier : _appliers)
   {
-    for (const auto &applier : _appliers)
-    {
-      applier->applyGradient(training_step);
-    }
+    applier->applyGradient(training_step);
   }
 }
 
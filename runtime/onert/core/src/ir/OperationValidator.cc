@@ -113,6 +113,30 @@ void OperationValidator::visit(const operation::ArgMinMax &node)
   OP_REQUIRES(isValidType(output_index, output_type));
 }
 
+void OperationValidator::visit(const operation::Attention &node)
+{
+  const auto query_index(node.getInputs().at(operation::Attention::Input::QUERY));
+  const auto key_index(node.getInputs().at(operation::Attention::Input::KEY));
+  const auto value_index(node.getInputs().at(operation::Attention::Input::VALUE));
+  const auto output_index(node.getOutputs().at(0));
+
+  OP_REQUIRES(isValidType(query_index, DataType::FLOAT32));
+  OP_REQUIRES(isSameType(query_index, key_index));
+  OP_REQUIRES(isSameType(query_index, value_index));
+  OP_REQUIRES(isSameType(query_index, output_index));
+  OP_REQUIRES(node.param().cache_size >= 0);
+
+  const auto mask_index{node.getInputs().size() > operation::Attention::Input::MASK
+                          ? node.getInputs().at(operation::Attention::Input::MASK)
+                          : OperandIndex{}};
+  if (!mask_index.undefined())
+  {
+    OP_REQUIRES(isSameType(query_index, mask_index));
+    // Mask does not cover tokens in kv cache
+    OP_REQUIRES(node.param().cache_size == 0);
+  }
+}
+
 void OperationValidator::visit(const operation::BatchMatMul &node)
 {
   const auto lhs_index(node.getInputs().at(operation::BatchMatMul::Input::LHS));
@@ -261,18 +285,18 @@ void OperationValidator::visit(const operation::ElementwiseActivation &node)
                                   DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
       break;
     case operation::ElementwiseActivation::Type::LOGISTIC:
-      OP_REQUIRES(
-        isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
-                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
+      OP_REQUIRES(isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
+                                            DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                            DataType::QUANT_INT16_SYMM}));
       break;
     case operation::ElementwiseActivation::Type::RELU:
       OP_REQUIRES(isValidType(
         input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
       break;
     case operation::ElementwiseActivation::Type::TANH:
-      OP_REQUIRES(
-        isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
-                                  DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM}));
+      OP_REQUIRES(isValidType(input_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
+                                            DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                            DataType::QUANT_INT16_SYMM}));
       break;
   }
 }
@@ -468,8 +492,9 @@ void OperationValidator::visit(const operation::Softmax &node)
   const auto input_index{node.getInputs().at(operation::Softmax::INPUT)};
 
   OP_REQUIRES(isSameType(input_index, output_index));
-  OP_REQUIRES(isValidType(
-    output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM, DataType::QUANT_INT8_ASYMM}));
+  OP_REQUIRES(isValidType(output_index, {DataType::FLOAT32, DataType::QUANT_UINT8_ASYMM,
+                                         DataType::QUANT_INT8_ASYMM, DataType::QUANT_INT16_ASYMM,
+                                         DataType::QUANT_INT16_SYMM}));
 }
 
 void OperationValidator::visit(const operation::SpaceToBatchND &node)
@@ -47,6 +47,7 @@ public:
 public:
   void visit(const operation::AddN &node) override;
   void visit(const operation::ArgMinMax &node) override;
+  void visit(const operation::Attention &node) override;
   void visit(const operation::BatchMatMul &node) override;
   void visit(const operation::BatchToSpaceND &node) override;
   void visit(const operation::BinaryArithmetic &node) override;
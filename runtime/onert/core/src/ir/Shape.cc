@@ -92,5 +92,21 @@ Shape convertShape(const Shape &shape, const PermuteType &type)
   return ret;
 }
 
+bool isIdentityPermutation(const Shape &shape, const PermuteType &type)
+{
+  if (type == ir::PermuteType::COPY || shape.rank() != 4)
+    return true;
+
+  if (std::any_of(shape.dims().begin(), shape.dims().end(),
+                  [](int32_t dim) { return dim == Shape::kUnspecifiedDim; }))
+    return false;
+
+  // Memory order is kept if channel is 1 or H*W is 1, and batch is not permuted
+  const auto c = type == ir::PermuteType::NHWC_TO_NCHW ? shape.dim(3) : shape.dim(1);
+  const auto hw = type == ir::PermuteType::NHWC_TO_NCHW ? shape.dim(1) * shape.dim(2)
+                                                        : shape.dim(2) * shape.dim(3);
+  return c == 1 || hw == 1;
+}
+
 } // namespace ir
 } // namespace onert
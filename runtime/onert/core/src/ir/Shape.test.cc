@@ -56,3 +56,28 @@ TEST(ShapeTest, neg_basic_test)
     EXPECT_ANY_THROW(shape.num_elements());
   }
 }
+
+TEST(ShapeTest, identity_permutation)
+{
+  using onert::ir::PermuteType;
+  using onert::ir::Shape;
+
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 3, 4, 5}, PermuteType::COPY));
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 3, 4}, PermuteType::NCHW_TO_NHWC));
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 3, 4, 1}, PermuteType::NHWC_TO_NCHW));
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 1, 1, 5}, PermuteType::NHWC_TO_NCHW));
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 3, 1, 1}, PermuteType::NCHW_TO_NHWC));
+  EXPECT_TRUE(onert::ir::isIdentityPermutation(Shape{2, 1, 4, 5}, PermuteType::NCHW_TO_NHWC));
+}
+
+TEST(ShapeTest, neg_identity_permutation)
+{
+  using onert::ir::PermuteType;
+  using onert::ir::Shape;
+
+  EXPECT_FALSE(onert::ir::isIdentityPermutation(Shape{1, 3, 4, 5}, PermuteType::NCHW_TO_NHWC));
+  EXPECT_FALSE(onert::ir::isIdentityPermutation(Shape{1, 1, 4, 5}, PermuteType::NHWC_TO_NCHW));
+  EXPECT_FALSE(onert::ir::isIdentityPermutation(Shape{2, 3, 4, 1}, PermuteType::NCHW_TO_NHWC));
+  EXPECT_FALSE(onert::ir::isIdentityPermutation(
+    Shape{1, Shape::kUnspecifiedDim, 4, 1}, PermuteType::NHWC_TO_NCHW));
+}
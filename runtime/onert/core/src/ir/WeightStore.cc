@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/WeightStore.h"
+
+#include <algorithm>
+
+namespace onert
+{
+namespace ir
+{
+
+WeightStore &WeightStore::get()
+{
+  static WeightStore store;
+  return store;
+}
+
+std::shared_ptr<Data> WeightStore::getOrCreate(const std::string &key,
+                                               const std::function<std::shared_ptr<Data>()> &create)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _data.find(key);
+  if (it != _data.end())
+  {
+    if (auto data = it->second.lock())
+      return data;
+  }
+
+  auto data = create();
+  _data[key] = data;
+  _keys[data.get()] = {data, key};
+  purge();
+  return data;
+}
+
+std::string WeightStore::keyOf(const Data *data) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _keys.find(data);
+  if (it == _keys.end())
+    return "";
+
+  // Address can be reused by other data after stored data is released
+  const auto &[weak_data, key] = it->second;
+  if (weak_data.lock().get() != data)
+    return "";
+  return key;
+}
+
+size_t WeightStore::size() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return std::count_if(_data.begin(), _data.end(),
+                       [](const auto &entry) { return !entry.second.expired(); });
+}
+
+std::shared_ptr<const void> WeightStore::findPackedImpl(const std::string &key) const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto it = _packed.find(key);
+  if (it == _packed.end())
+    return nullptr;
+  return it->second.lock();
+}
+
+std::shared_ptr<const void>
+WeightStore::insertPackedImpl(const std::string &key, const std::shared_ptr<const void> &packed)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  auto &entry = _packed[key];
+  if (auto stored = entry.lock())
+    return stored;
+
+  entry = packed;
+  purge();
+  return packed;
+}
+
+void WeightStore::purge()
+{
+  if (_data.size() + _packed.size() < _purge_threshold)
+    return;
+
+  for (auto it = _data.begin(); it != _data.end();)
+    it = it->second.expired() ? _data.erase(it) : std::next(it);
+  for (auto it = _keys.begin(); it != _keys.end();)
+    it = it->second.first.expired() ? _keys.erase(it) : std::next(it);
+  for (auto it = _packed.begin(); it != _packed.end();)
+    it = it->second.expired() ? _packed.erase(it) : std::next(it);
+
+  _purge_threshold = std::max<size_t>(64, 2 * (_data.size() + _packed.size()));
+}
+
+} // namespace ir
+} // namespace onert
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/WeightStore.h"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace onert::ir;
+
+namespace
+{
+
+std::shared_ptr<Data> makeData(const std::vector<uint8_t> &buf)
+{
+  return std::make_shared<CachedData>(buf.data(), buf.size());
+}
+
+} // namespace
+
+TEST(WeightStore, getOrCreate)
+{
+  auto &store = WeightStore::get();
+  const std::vector<uint8_t> buf{1, 2, 3, 4};
+  int created = 0;
+  auto create = [&]() {
+    created++;
+    return makeData(buf);
+  };
+
+  auto data1 = store.getOrCreate("WeightStore.getOrCreate:0", create);
+  auto data2 = store.getOrCreate("WeightStore.getOrCreate:0", create);
+  EXPECT_EQ(created, 1);
+  EXPECT_EQ(data1, data2);
+  EXPECT_EQ(store.keyOf(data1.get()), "WeightStore.getOrCreate:0");
+
+  auto data3 = store.getOrCreate("WeightStore.getOrCreate:1", create);
+  EXPECT_EQ(created, 2);
+  EXPECT_NE(data1, data3);
+}
+
+TEST(WeightStore, release)
+{
+  auto &store = WeightStore::get();
+  const std::vector<uint8_t> buf{1, 2, 3, 4};
+  int created = 0;
+  auto create = [&]() {
+    created++;
+    return makeData(buf);
+  };
+
+  const auto size = store.size();
+  auto data = store.getOrCreate("WeightStore.release:0", create);
+  EXPECT_EQ(store.size(), size + 1);
+
+  // Data is released with the last user and created again
+  data.reset();
+  EXPECT_EQ(store.size(), size);
+  data = store.getOrCreate("WeightStore.release:0", create);
+  EXPECT_EQ(created, 2);
+}
+
+TEST(WeightStore, packed)
+{
+  auto &store = WeightStore::get();
+  const std::vector<uint8_t> buf{1, 2, 3, 4};
+  auto data = store.getOrCreate("WeightStore.packed:0", [&]() { return makeData(buf); });
+  const auto key = store.keyOf(data.get());
+
+  EXPECT_EQ(store.findPacked<std::vector<float>>(key, "kind"), nullptr);
+
+  auto packed1 = std::make_shared<const std::vector<float>>(4, 1.f);
+  auto stored1 = store.insertPacked(key, "kind", packed1);
+  EXPECT_EQ(stored1, packed1);
+  EXPECT_EQ(store.findPacked<std::vector<float>>(key, "kind"), packed1);
+  EXPECT_EQ(store.findPacked<std::vector<float>>(key, "other"), nullptr);
+
+  // Living packed form stored by other session wins
+  auto packed2 = std::make_shared<const std::vector<float>>(4, 2.f);
+  auto stored2 = store.insertPacked(key, "kind", packed2);
+  EXPECT_EQ(stored2, packed1);
+
+  stored1.reset();
+  stored2.reset();
+  packed1.reset();
+  EXPECT_EQ(store.findPacked<std::vector<float>>(key, "kind"), nullptr);
+}
+
+TEST(WeightStore, neg_keyOf)
+{
+  auto &store = WeightStore::get();
+  const std::vector<uint8_t> buf{1, 2, 3, 4};
+
+  // Data not from the store has no key
+  auto other = makeData(buf);
+  EXPECT_EQ(store.keyOf(other.get()), "");
+  EXPECT_EQ(store.keyOf(nullptr), "");
+
+  // Released data has no key
+  auto data = store.getOrCreate("WeightStore.neg_keyOf:0", [&]() { return makeData(buf); });
+  const Data *ptr = data.get();
+  data.reset();
+  EXPECT_EQ(store.keyOf(ptr), "");
+}
@@ -40,6 +40,9 @@ bool TrainingInfo::isValid() const
   if (_loss_info.reduction_type == LossReductionType::Undefined)
     return false;
 
+  if (_gradient_accumulation_steps == 0)
+    return false;
+
   // If there are invalid combination, add more condition-check here
   return true;
 }
@@ -35,6 +35,16 @@ operation::ArgMinMax generateArgMinMax()
   return operation::ArgMinMax{OperandIndexSequence{1, 2}, OperandIndexSequence{0}, param};
 }
 
+operation::Attention generateAttention()
+{
+  operation::Attention::Param param;
+  param.scale = 0.125f;
+  param.cache_size = 0;
+  param.causal = false;
+
+  return operation::Attention{OperandIndexSequence{1, 2, 3, 4}, OperandIndexSequence{0}, param};
+}
+
 operation::BatchMatMul generateBatchMatMul()
 {
   operation::BatchMatMul::Param param;
@@ -606,6 +616,9 @@ TEST(UntrainableOperation, testAllOps)
   const auto argminmax = generateArgMinMax();
   verifyOp(argminmax);
 
+  const auto attention = generateAttention();
+  verifyOp(attention);
+
   const auto batch_matmul = generateBatchMatMul();
   verifyOp(batch_matmul);
 
@@ -835,6 +848,12 @@ TEST(UntrainableOperation, neg_TrainableOperationVisitor)
     EXPECT_ANY_THROW(visitor.invoke(*untrainable));
   }
 
+  {
+    const auto attention = generateAttention();
+    auto untrainable = generateUntrainableOperation(attention);
+    EXPECT_ANY_THROW(visitor.invoke(*untrainable));
+  }
+
   {
     const auto batch_matmul = generateBatchMatMul();
     auto untrainable = generateUntrainableOperation(batch_matmul);
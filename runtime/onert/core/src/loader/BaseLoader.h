@@ -20,6 +20,7 @@
 
 #include "ir/Graph.h"
 #include "ir/Shape.h"
+#include "ir/WeightStore.h"
 #include "ir/Operations.Include.h"
 
 #include "flatbuffers/flexbuffers.h"
@@ -131,6 +132,7 @@ private:
 
   void loadAddV2(const Operator *op, ir::Graph &subg);
   void loadArgMinMax(const Operator *op, ir::Graph &subg, bool is_argmax);
+  void loadAttention(const Operator *op, ir::Graph &subg);
   void loadBatchMatMul(const Operator *op, ir::Graph &subg);
   void loadBinaryArithmetic(const Operator *op, ir::Graph &subg,
                             ir::operation::BinaryArithmetic::ArithmeticType op_type);
@@ -203,6 +205,8 @@ protected:
 
   std::unordered_map<uint32_t /* Buffer Index in circle file */, std::shared_ptr<ir::Data>>
     _buf_to_data;
+  // Identity of model file to share constant data with other sessions by ir::WeightStore
+  std::string _file_key;
 };
 
 template <typename LoaderDomain>
@@ -220,6 +224,9 @@ void BaseLoader<LoaderDomain>::BaseLoader::loadFromFile(const std::string &file_
     throw std::runtime_error("Fstat failed or file " + file_path + " is not a regular file");
   }
   int size = file_stat.st_size;
+  _file_key = std::to_string(file_stat.st_dev) + ":" + std::to_string(file_stat.st_ino) + ":" +
+              std::to_string(file_stat.st_size) + ":" + std::to_string(file_stat.st_mtim.tv_sec) +
+              "." + std::to_string(file_stat.st_mtim.tv_nsec);
 
   // Map model file into memory region
   _base = static_cast<uint8_t *>(mmap(NULL, size, PROT_READ, MAP_PRIVATE, _fd, 0));
@@ -419,22 +426,24 @@ ir::OperandIndex BaseLoader<LoaderDomain>::loadOperand(const Tensor *tensor, ir:
         // was already created. Let's reuse the Data
         data_obj = buffer_found->second;
       }
-      else if (_use_mmaped_data)
-      {
-        data_obj = std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
-                                                    unaligned_offset_start, data_size);
-        _buf_to_data[buf_idx] = data_obj;
-      }
       else
       {
-        size_t offset = unaligned_offset_start - aligned_offset_start;
-        uint8_t *mmap_base = static_cast<uint8_t *>(
-          mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
+        // Other sessions loading the same model file share the Data
+        const auto key = _file_key + ":" + std::to_string(buf_idx);
+        data_obj = ir::WeightStore::get().getOrCreate(key, [&]() -> std::shared_ptr<ir::Data> {
+          if (_use_mmaped_data)
+            return std::make_shared<ir::MMapedData>(_fd, aligned_offset_start, mmap_size,
+                                                    unaligned_offset_start, data_size);
 
-        data_obj = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
-        _buf_to_data[buf_idx] = data_obj;
+          size_t offset = unaligned_offset_start - aligned_offset_start;
+          uint8_t *mmap_base = static_cast<uint8_t *>(
+            mmap(NULL, mmap_size, PROT_READ, MAP_PRIVATE, _fd, aligned_offset_start));
 
-        munmap(mmap_base, mmap_size);
+          auto cached_data = std::make_shared<ir::CachedData>(mmap_base + offset, data_size);
+          munmap(mmap_base, mmap_size);
+          return cached_data;
+        });
+        _buf_to_data[buf_idx] = data_obj;
       }
     }
     subg.setOperandValue(operand_index, std::move(data_obj));
@@ -1086,6 +1095,27 @@ void BaseLoader<LoaderDomain>::loadBatchMatMul(const Operator *op, ir::Graph &su
   loadOperationTo<ir::operation::BatchMatMul>(op, subg, param);
 }
 
+template <typename LoaderDomain>
+void BaseLoader<LoaderDomain>::loadAttention(const Operator *op, ir::Graph &subg)
+{
+  ir::operation::Attention::Param param;
+  param.scale = 1.f;
+  param.cache_size = 0;
+  param.causal = false;
+  if (op->custom_options() != nullptr)
+  {
+    const auto attr_map = getCustomOpAttrMap(op);
+    if (!attr_map["scale"].IsNull())
+      param.scale = attr_map["scale"].AsFloat();
+    if (!attr_map["cache_size"].IsNull())
+      param.cache_size = attr_map["cache_size"].AsInt32();
+    if (!attr_map["causal"].IsNull())
+      param.causal = attr_map["causal"].AsBool();
+  }
+
+  loadOperationTo<ir::operation::Attention>(op, subg, param);
+}
+
 template <typename LoaderDomain>
 void BaseLoader<LoaderDomain>::loadSpaceToDepth(const Operator *op, ir::Graph &subg)
 {
@@ -1119,7 +1149,8 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
     FusedBatchNorm,
     StatelessRandomUniform,
     Erf,
-    DetectionPostProcess
+    DetectionPostProcess,
+    Attention
   };
 
   // Mapping from custom op name string to BuiltinOP enum
@@ -1134,6 +1165,7 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
     {"StatelessRandomUniform", BuiltinOP::StatelessRandomUniform},
     {"Erf", BuiltinOP::Erf},
     {"TFLite_Detection_PostProcess", BuiltinOP::DetectionPostProcess},
+    {"ScaledDotProductAttention", BuiltinOP::Attention},
   };
 
   try
@@ -1172,6 +1204,9 @@ void BaseLoader<LoaderDomain>::loadCustom(const Operator *op, ir::Graph &subg)
       case BuiltinOP::DetectionPostProcess:
         loadDetectionPostProcess(op, subg);
         break;
+      case BuiltinOP::Attention:
+        loadAttention(op, subg);
+        break;
       default:
         throw std::runtime_error{
           "Loader: Custom OP map is defined but operation loader function is not defined"};
@@ -356,6 +356,27 @@ TEST(ShapeInference, FullyConnected)
   ASSERT_EQ(infered_out_shape.dim(1), 3);
 }
 
+TEST(ShapeInference, Attention)
+{
+  Shape query_shape{2, 8, 128, 64};
+  Shape value_shape{2, 1, 256, 32};
+  auto infered_out_shape = onert::shape_inference::inferAttentionShape(query_shape, value_shape);
+
+  ASSERT_EQ(infered_out_shape.rank(), 4);
+  ASSERT_EQ(infered_out_shape.dim(0), 2);
+  ASSERT_EQ(infered_out_shape.dim(1), 8);
+  ASSERT_EQ(infered_out_shape.dim(2), 128);
+  ASSERT_EQ(infered_out_shape.dim(3), 32);
+}
+
+TEST(ShapeInference, neg_Attention)
+{
+  Shape query_shape{64};
+  Shape value_shape{256, 32};
+  ASSERT_THROW(onert::shape_inference::inferAttentionShape(query_shape, value_shape),
+               std::runtime_error);
+}
+
 TEST(ShapeInference, Transpose)
 {
   auto check = [&](Shape &in_shape, std::vector<int> perm, Shape &expected) {
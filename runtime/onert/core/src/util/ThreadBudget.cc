@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include "util/ConfigSource.h"
+#include "util/logging.h"
+
+#include <cker/eigen/EigenSupport.h>
+
+#include <algorithm>
+#include <cassert>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace onert
+{
+namespace util
+{
+
+ThreadQuota::ThreadQuota(uint32_t num_threads, uint32_t charged, const std::vector<int> &cores)
+  : _num_threads{num_threads}, _charged{charged}, _cores{cores}
+{
+}
+
+ThreadQuota::~ThreadQuota() { ThreadBudget::get().release(_charged); }
+
+ThreadBudget &ThreadBudget::get()
+{
+  // Never destroyed, as quotas of sessions not closed until exit are released after static
+  // objects are destroyed
+  static ThreadBudget *budget = new ThreadBudget;
+  return *budget;
+}
+
+ThreadBudget::ThreadBudget()
+  : _limit{static_cast<uint32_t>(std::max(0, getConfigInt(config::COMPUTE_THREAD_LIMIT)))},
+    _used{0}
+{
+  nnfw::cker::eigen_support::EigenContext::MaxNumThreads() = static_cast<int>(_limit);
+}
+
+void ThreadBudget::setLimit(uint32_t limit)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  _limit = limit;
+  nnfw::cker::eigen_support::EigenContext::MaxNumThreads() = static_cast<int>(_limit);
+}
+
+uint32_t ThreadBudget::limit() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _limit;
+}
+
+uint32_t ThreadBudget::used() const
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  return _used;
+}
+
+std::shared_ptr<const ThreadQuota> ThreadBudget::acquire(int32_t num_threads,
+                                                         const std::vector<int> &cores)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+
+  uint32_t granted = num_threads > 0 ? static_cast<uint32_t>(num_threads) : 0;
+  if (_limit > 0)
+  {
+    const uint32_t requested = std::max(granted, 1u);
+    const uint32_t available = _limit > _used ? _limit - _used : 0;
+    granted = std::min(requested, available);
+  }
+  _used += granted;
+
+  VERBOSE(ThreadBudget) << "Grant " << granted << " threads (requested: " << num_threads
+                        << ", used: " << _used << ", limit: " << _limit << ")" << std::endl;
+
+  // Exhausted budget runs kernels on the calling thread only
+  const uint32_t num_granted = (_limit > 0 && granted == 0) ? 1 : granted;
+  return std::shared_ptr<const ThreadQuota>(new ThreadQuota(num_granted, granted, cores));
+}
+
+void ThreadBudget::release(uint32_t num_threads)
+{
+  std::lock_guard<std::mutex> lock{_mutex};
+  assert(_used >= num_threads);
+  _used -= num_threads;
+}
+
+AffinityScope::AffinityScope(const std::vector<int> &cores) : _applied{false}
+{
+  if (cores.empty())
+    return;
+
+#if defined(__linux__)
+  cpu_set_t prev_set;
+  CPU_ZERO(&prev_set);
+  if (sched_getaffinity(0, sizeof(prev_set), &prev_set) != 0)
+    return;
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto core : cores)
+  {
+    if (core >= 0 && core < CPU_SETSIZE)
+      CPU_SET(core, &set);
+  }
+  if (sched_setaffinity(0, sizeof(set), &set) != 0)
+  {
+    VERBOSE(AffinityScope) << "Failed to set affinity of thread" << std::endl;
+    return;
+  }
+
+  for (int core = 0; core < CPU_SETSIZE; ++core)
+  {
+    if (CPU_ISSET(core, &prev_set))
+      _prev_cores.emplace_back(core);
+  }
+  _applied = true;
+#else
+  VERBOSE(AffinityScope) << "Thread affinity is not supported on this platform" << std::endl;
+#endif
+}
+
+AffinityScope::~AffinityScope()
+{
+  if (!_applied)
+    return;
+
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  for (const auto core : _prev_cores)
+    CPU_SET(core, &set);
+  sched_setaffinity(0, sizeof(set), &set);
+#endif
+}
+
+} // namespace util
+} // namespace onert
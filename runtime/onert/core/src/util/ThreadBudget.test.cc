@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "util/ThreadBudget.h"
+
+#include <gtest/gtest.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+using namespace onert::util;
+
+namespace
+{
+
+class ThreadBudgetTest : public ::testing::Test
+{
+protected:
+  void SetUp() override { _orig_limit = ThreadBudget::get().limit(); }
+  void TearDown() override { ThreadBudget::get().setLimit(_orig_limit); }
+
+  uint32_t _orig_limit = 0;
+};
+
+} // namespace
+
+TEST_F(ThreadBudgetTest, no_limit)
+{
+  auto &budget = ThreadBudget::get();
+  budget.setLimit(0);
+  const auto used = budget.used();
+
+  auto quota = budget.acquire(-1, {});
+  EXPECT_EQ(quota->numThreads(), 0u);
+  EXPECT_EQ(budget.used(), used);
+
+  auto quota2 = budget.acquire(3, {});
+  EXPECT_EQ(quota2->numThreads(), 3u);
+  EXPECT_EQ(budget.used(), used + 3);
+
+  quota2.reset();
+  EXPECT_EQ(budget.used(), used);
+}
+
+TEST_F(ThreadBudgetTest, limit)
+{
+  auto &budget = ThreadBudget::get();
+  const auto used = budget.used();
+  budget.setLimit(used + 4);
+
+  auto quota1 = budget.acquire(3, {0});
+  EXPECT_EQ(quota1->numThreads(), 3u);
+  ASSERT_EQ(quota1->cores().size(), 1u);
+  EXPECT_EQ(quota1->cores()[0], 0);
+
+  // Only remaining threads are granted
+  auto quota2 = budget.acquire(3, {});
+  EXPECT_EQ(quota2->numThreads(), 1u);
+  EXPECT_EQ(budget.used(), used + 4);
+
+  // Exhausted budget grants the calling thread only
+  auto quota3 = budget.acquire(2, {});
+  EXPECT_EQ(quota3->numThreads(), 1u);
+  EXPECT_EQ(budget.used(), used + 4);
+
+  // Released threads are granted again
+  quota1.reset();
+  auto quota4 = budget.acquire(-1, {});
+  EXPECT_EQ(quota4->numThreads(), 1u);
+  EXPECT_EQ(budget.used(), used + 2);
+}
+
+TEST_F(ThreadBudgetTest, shared_in_quota)
+{
+  auto &budget = ThreadBudget::get();
+  budget.setLimit(0);
+
+  auto quota1 = budget.acquire(2, {});
+  auto quota2 = budget.acquire(2, {});
+
+  // Objects of a type are created once in a quota, but not shared with other quotas
+  int created = 0;
+  const auto create = [&]() {
+    created++;
+    return std::make_shared<int>(created);
+  };
+  auto shared1 = quota1->getOrCreate<int>(create);
+  EXPECT_EQ(quota1->getOrCreate<int>(create), shared1);
+  EXPECT_EQ(created, 1);
+
+  auto shared2 = quota2->getOrCreate<int>(create);
+  EXPECT_NE(shared2, shared1);
+  EXPECT_EQ(*shared2, 2);
+
+  auto other = quota1->getOrCreate<float>([]() { return std::make_shared<float>(1.f); });
+  EXPECT_EQ(*other, 1.f);
+  EXPECT_EQ(created, 2);
+}
+
+TEST(AffinityScope, restore)
+{
+#if defined(__linux__)
+  cpu_set_t orig_set;
+  CPU_ZERO(&orig_set);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(orig_set), &orig_set), 0);
+
+  int core = 0;
+  while (core < CPU_SETSIZE && !CPU_ISSET(core, &orig_set))
+    core++;
+  ASSERT_LT(core, CPU_SETSIZE);
+
+  {
+    AffinityScope scope{{core}};
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+    EXPECT_EQ(CPU_COUNT(&set), 1);
+    EXPECT_TRUE(CPU_ISSET(core, &set));
+  }
+
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  ASSERT_EQ(sched_getaffinity(0, sizeof(set), &set), 0);
+  EXPECT_TRUE(CPU_EQUAL(&set, &orig_set));
+#endif
+}
+
+TEST(AffinityScope, neg_invalid_cores)
+{
+  // Invalid core ids are ignored and affinity is not changed
+  AffinityScope scope{{-1}};
+  SUCCEED();
+}
@@ -128,6 +128,26 @@ uint32_t CircleGen::addOperatorArgMin(const OperatorParams &params, circle::Tens
                                 circle::BuiltinOptions_ArgMinOptions, options);
 }
 
+uint32_t CircleGen::addOperatorAttention(const OperatorParams &params, float scale,
+                                         int32_t cache_size, bool causal)
+{
+  // flexbuffer custom_option
+  auto flex_buffers = std::make_unique<flexbuffers::Builder>();
+  size_t map_start = flex_buffers->StartMap();
+  flex_buffers->Float("scale", scale);
+  if (cache_size > 0)
+    flex_buffers->Int("cache_size", cache_size);
+  if (causal)
+    flex_buffers->Bool("causal", true);
+  flex_buffers->EndMap(map_start);
+  flex_buffers->Finish();
+
+  return addCustomOperatorWithOptions(params, "ScaledDotProductAttention",
+                                      circle::BuiltinOptions_NONE, 0, &flex_buffers->GetBuffer(),
+                                      circle::CustomOptionsFormat::CustomOptionsFormat_FLEXBUFFERS,
+                                      nullptr, nullptr);
+}
+
 uint32_t CircleGen::addOperatorAveragePool2D(const OperatorParams &params, circle::Padding padding,
                                              int stride_w, int stride_h, int filter_w, int filter_h,
                                              circle::ActivationFunctionType actfn)
@@ -562,6 +582,17 @@ uint32_t CircleGen::addOperatorTranspose(const OperatorParams &params)
                                 circle::BuiltinOptions_TransposeOptions, options);
 }
 
+uint32_t CircleGen::addOperatorUnidirectionalSequenceLSTM(const OperatorParams &params,
+                                                          circle::ActivationFunctionType actfn,
+                                                          bool time_major)
+{
+  auto options = circle::CreateUnidirectionalSequenceLSTMOptions(_fbb, actfn, 0.f /* cell_clip */,
+                                                                 0.f /* proj_clip */, time_major)
+                   .Union();
+  return addOperatorWithOptions(params, circle::BuiltinOperator_UNIDIRECTIONAL_SEQUENCE_LSTM,
+                                circle::BuiltinOptions_UnidirectionalSequenceLSTMOptions, options);
+}
+
 uint32_t CircleGen::addOperatorSqrt(const OperatorParams &params)
 {
   return addOperatorWithOptions(params, circle::BuiltinOperator_SQRT, circle::BuiltinOptions_NONE,
@@ -657,7 +688,7 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
   auto shape = _fbb.CreateVector(params.shape);
   auto name = _fbb.CreateString(params.name);
   return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name,
-                              0 /* QuantParam */, false /* is_variable */, 0 /* sparsity */,
+                              0 /* QuantParam */, params.is_variable, 0 /* sparsity */,
                               0 /* shape_signature */);
 }
 
@@ -671,7 +702,7 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
   auto quantization = circle::CreateQuantizationParametersDirect(_fbb, nullptr, nullptr,
                                                                  &scale_vector, &zero_point_vector);
   return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name, quantization,
-                              false /* is_variable */, 0 /* sparsity */, 0 /* shape_signature */);
+                              params.is_variable, 0 /* sparsity */, 0 /* shape_signature */);
 }
 
 flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &params,
@@ -683,7 +714,7 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
   auto quantization =
     circle::CreateQuantizationParametersDirect(_fbb, nullptr, nullptr, &scales, &zero_points);
   return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name, quantization,
-                              false /* is_variable */, 0 /* sparsity */, 0 /* shape_signature */);
+                              params.is_variable, 0 /* sparsity */, 0 /* shape_signature */);
 }
 
 flatbuffers::Offset<circle::SparsityParameters>
@@ -719,7 +750,7 @@ flatbuffers::Offset<circle::Tensor> CircleGen::buildTensor(const TensorParams &p
   auto name = _fbb.CreateString(params.name);
   auto sparsity = buildSparsityParameters(sp);
   return circle::CreateTensor(_fbb, shape, params.tensor_type, params.buffer, name,
-                              0 /* QuantParam */, false /* is_variable */, sparsity,
+                              0 /* QuantParam */, params.is_variable, sparsity,
                               0 /* shape_signature */);
 }
 
@@ -99,6 +99,7 @@ public:
     circle::TensorType tensor_type = circle::TensorType::TensorType_FLOAT32;
     uint32_t buffer = 0;
     std::string name;
+    bool is_variable = false;
   };
 
   struct OperatorParams
@@ -144,6 +145,8 @@ public:
                              circle::TensorType output_type = circle::TensorType::TensorType_INT32);
   uint32_t addOperatorArgMin(const OperatorParams &params,
                              circle::TensorType output_type = circle::TensorType::TensorType_INT32);
+  uint32_t addOperatorAttention(const OperatorParams &params, float scale, int32_t cache_size = 0,
+                                bool causal = false);
   uint32_t addOperatorAveragePool2D(const OperatorParams &params, circle::Padding padding,
                                     int stride_w, int stride_h, int filter_w, int filter_h,
                                     circle::ActivationFunctionType actfn);
@@ -226,6 +229,9 @@ public:
   uint32_t addOperatorSub(const OperatorParams &params, circle::ActivationFunctionType actfn);
   uint32_t addOperatorTile(const OperatorParams &params);
   uint32_t addOperatorTranspose(const OperatorParams &params);
+  uint32_t addOperatorUnidirectionalSequenceLSTM(const OperatorParams &params,
+                                                 circle::ActivationFunctionType actfn,
+                                                 bool time_major = false);
   uint32_t addOperatorWhile(const OperatorParams &params, uint32_t cond_subg, uint32_t body_subg);
 
   // NOTE Please add addOperator functions ABOVE this line in ALPHABETICAL ORDER
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Testing the following model:
+ *       #1, #2, #3 = placeholder (shape = [1, 1, 1, 2], dtype=float)
+ *       #4 = attention(#1, #2, #3, scale = 1, cache_size)
+ */
+CircleBuffer buildAttentionCacheModel(int32_t cache_size)
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  int query = cgen.addTensor({{1, 1, 1, 2}, f32});
+  int key = cgen.addTensor({{1, 1, 1, 2}, f32});
+  int value = cgen.addTensor({{1, 1, 1, 2}, f32});
+  int out = cgen.addTensor({{1, 1, 1, 2}, f32});
+  cgen.addOperatorAttention({{query, key, value}, {out}}, 1.f, cache_size);
+  cgen.setInputsAndOutputs({query, key, value}, {out});
+  return cgen.finish();
+}
+
+// Prepare a session keeping kv cache across runs
+void prepareStreaming(const CircleBuffer &cbuf, nnfw_session **session)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(*session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(*session, "cpu"));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_prepare_config(*session, NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(*session));
+}
+
+// Run a token whose query and key are the same
+NNFW_STATUS runToken(nnfw_session *session, const std::vector<float> &query_key,
+                     const std::vector<float> &value, std::vector<float> &output)
+{
+  const size_t size = query_key.size() * sizeof(float);
+  output.resize(value.size());
+  const void *inputs[] = {query_key.data(), query_key.data(), value.data()};
+  for (uint32_t i = 0; i < 3; ++i)
+  {
+    auto status = nnfw_set_input(session, i, NNFW_TYPE_TENSOR_FLOAT32, inputs[i], size);
+    if (status != NNFW_STATUS_NO_ERROR)
+      return status;
+  }
+  auto status = nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(), size);
+  if (status != NNFW_STATUS_NO_ERROR)
+    return status;
+  return nnfw_run(session);
+}
+
+} // namespace
+
+TEST(TestAttentionCache, attend_cached_tokens)
+{
+  const auto cbuf = buildAttentionCacheModel(4);
+  nnfw_session *session = nullptr;
+  ASSERT_NO_FATAL_FAILURE(prepareStreaming(cbuf, &session));
+
+  std::vector<float> output;
+  for (int sequence = 0; sequence < 2; ++sequence)
+  {
+    // Token 0 attends only itself
+    NNFW_ENSURE_SUCCESS(runToken(session, {1, 0}, {1, 2}, output));
+    EXPECT_NEAR(output[0], 1.f, 1e-5);
+    EXPECT_NEAR(output[1], 2.f, 1e-5);
+
+    // Token 1 attends token 0 in kv cache with scores {0, 1}, not only itself (= {3, 4})
+    NNFW_ENSURE_SUCCESS(runToken(session, {0, 1}, {3, 4}, output));
+    EXPECT_NEAR(output[0], 2.462118f, 1e-5);
+    EXPECT_NEAR(output[1], 3.462118f, 1e-5);
+
+    // Next sequence gives the same outputs
+    NNFW_ENSURE_SUCCESS(nnfw_reset_variable_states(session));
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestAttentionCache, neg_cache_full)
+{
+  const auto cbuf = buildAttentionCacheModel(2);
+  nnfw_session *session = nullptr;
+  ASSERT_NO_FATAL_FAILURE(prepareStreaming(cbuf, &session));
+
+  std::vector<float> output;
+  NNFW_ENSURE_SUCCESS(runToken(session, {1, 0}, {1, 2}, output));
+  NNFW_ENSURE_SUCCESS(runToken(session, {0, 1}, {3, 4}, output));
+  EXPECT_NE(runToken(session, {1, 1}, {5, 6}, output), NNFW_STATUS_NO_ERROR);
+
+  // Cache is emptied by reset
+  NNFW_ENSURE_SUCCESS(nnfw_reset_variable_states(session));
+  NNFW_ENSURE_SUCCESS(runToken(session, {1, 1}, {5, 6}, output));
+  EXPECT_NEAR(output[0], 5.f, 1e-5);
+  EXPECT_NEAR(output[1], 6.f, 1e-5);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+
+constexpr int32_t kSteps = 2;
+constexpr int32_t kInput = 2;
+constexpr int32_t kCell = 2;
+
+// Gates in order of input, forget, cell and output
+constexpr int32_t kGates = 4;
+
+float weight(int32_t gate, int32_t k, int32_t seed)
+{
+  return static_cast<float>((k * 5 + gate * 3 + seed) % 7 - 3) * 0.1f;
+}
+
+std::vector<float> weights(int32_t gate, int32_t size, int32_t seed)
+{
+  std::vector<float> values(size);
+  for (int32_t k = 0; k < size; ++k)
+    values[k] = weight(gate, k, seed);
+  return values;
+}
+
+/**
+ * @brief Testing the following model:
+ *       #1 = placeholder (shape = [1, kSteps, kInput], dtype=float)
+ *       #2, #3 = variable (shape = [1, kCell], dtype=float), output state and cell state
+ *       #4 = unidirectional_sequence_lstm(#1, ..., #2, #3), without CIFG, peephole and projection
+ */
+CircleBuffer buildLSTMModel()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+
+  std::vector<int32_t> input_weights(kGates);
+  std::vector<int32_t> recurrent_weights(kGates);
+  std::vector<int32_t> biases(kGates);
+  for (int32_t gate = 0; gate < kGates; ++gate)
+  {
+    uint32_t input_buf = cgen.addBuffer(weights(gate, kCell * kInput, 0));
+    uint32_t recurrent_buf = cgen.addBuffer(weights(gate, kCell * kCell, 1));
+    uint32_t bias_buf = cgen.addBuffer(weights(gate, kCell, 2));
+    input_weights[gate] = cgen.addTensor({{kCell, kInput}, f32, input_buf});
+    recurrent_weights[gate] = cgen.addTensor({{kCell, kCell}, f32, recurrent_buf});
+    biases[gate] = cgen.addTensor({{kCell}, f32, bias_buf});
+  }
+
+  int input = cgen.addTensor({{1, kSteps, kInput}, f32});
+  int output_state = cgen.addTensor({{1, kCell}, f32, 0, "output_state", true});
+  int cell_state = cgen.addTensor({{1, kCell}, f32, 0, "cell_state", true});
+  int output = cgen.addTensor({{1, kSteps, kCell}, f32});
+
+  // clang-format off
+  std::vector<int32_t> inputs{
+    input,
+    input_weights[0], input_weights[1], input_weights[2], input_weights[3],
+    recurrent_weights[0], recurrent_weights[1], recurrent_weights[2], recurrent_weights[3],
+    -1, -1, -1, // peephole
+    biases[0], biases[1], biases[2], biases[3],
+    -1, -1, // projection
+    output_state, cell_state,
+    -1, -1, -1, -1 // layer norm
+  };
+  // clang-format on
+  cgen.addOperatorUnidirectionalSequenceLSTM({inputs, {output}},
+                                             circle::ActivationFunctionType_TANH);
+  cgen.setInputsAndOutputs({input}, {output});
+
+  return cgen.finish();
+}
+
+float sigmoid(float x) { return 1.f / (1.f + std::exp(-x)); }
+
+// Reference of the model that keeps its states in members
+class LSTMReference
+{
+public:
+  std::vector<float> run(const std::vector<float> &input)
+  {
+    std::vector<float> output;
+    for (int32_t t = 0; t < kSteps; ++t)
+    {
+      float gates[kGates][kCell];
+      for (int32_t gate = 0; gate < kGates; ++gate)
+      {
+        for (int32_t c = 0; c < kCell; ++c)
+        {
+          float sum = weight(gate, c, 2);
+          for (int32_t i = 0; i < kInput; ++i)
+            sum += weight(gate, c * kInput + i, 0) * input[t * kInput + i];
+          for (int32_t h = 0; h < kCell; ++h)
+            sum += weight(gate, c * kCell + h, 1) * _output_state[h];
+          gates[gate][c] = gate == 2 ? std::tanh(sum) : sigmoid(sum);
+        }
+      }
+      for (int32_t c = 0; c < kCell; ++c)
+      {
+        _cell_state[c] = gates[1][c] * _cell_state[c] + gates[0][c] * gates[2][c];
+        _output_state[c] = gates[3][c] * std::tanh(_cell_state[c]);
+        output.emplace_back(_output_state[c]);
+      }
+    }
+    return output;
+  }
+
+private:
+  std::vector<float> _output_state = std::vector<float>(kCell, 0.f);
+  std::vector<float> _cell_state = std::vector<float>(kCell, 0.f);
+};
+
+void runChunk(nnfw_session *session, const std::vector<float> &input, std::vector<float> &output)
+{
+  output.resize(kSteps * kCell);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(session, 0, NNFW_TYPE_TENSOR_FLOAT32, input.data(),
+                                     input.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(session, 0, NNFW_TYPE_TENSOR_FLOAT32, output.data(),
+                                      output.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(session));
+}
+
+void expectNear(const std::vector<float> &expected, const std::vector<float> &actual)
+{
+  ASSERT_EQ(expected.size(), actual.size());
+  for (size_t i = 0; i < expected.size(); ++i)
+    EXPECT_NEAR(expected[i], actual[i], 1e-5) << "at " << i;
+}
+
+} // namespace
+
+TEST(TestLSTMStates, continue_states_across_runs)
+{
+  const auto cbuf = buildLSTMModel();
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_set_prepare_config(session, NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES, nullptr));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  const std::vector<float> chunk0{1.f, -0.5f, 0.25f, 2.f};
+  const std::vector<float> chunk1{-1.f, 0.5f, 1.5f, -2.f};
+
+  // Second chunk continues from states of the first one
+  LSTMReference reference;
+  std::vector<float> output0;
+  std::vector<float> output;
+  ASSERT_NO_FATAL_FAILURE(runChunk(session, chunk0, output0));
+  expectNear(reference.run(chunk0), output0);
+  ASSERT_NO_FATAL_FAILURE(runChunk(session, chunk1, output));
+  expectNear(reference.run(chunk1), output);
+
+  // New sequence starts from zero states
+  NNFW_ENSURE_SUCCESS(nnfw_reset_variable_states(session));
+  ASSERT_NO_FATAL_FAILURE(runChunk(session, chunk0, output));
+  expectNear(output0, output);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestLSTMStates, zero_states_without_keep_config)
+{
+  const auto cbuf = buildLSTMModel();
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  const std::vector<float> chunk0{1.f, -0.5f, 0.25f, 2.f};
+
+  // Each run is a new sequence
+  const auto expected = LSTMReference{}.run(chunk0);
+  std::vector<float> output;
+  for (int run = 0; run < 2; ++run)
+  {
+    ASSERT_NO_FATAL_FAILURE(runChunk(session, chunk0, output));
+    expectNear(expected, output);
+  }
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
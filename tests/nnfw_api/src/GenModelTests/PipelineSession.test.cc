@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <cstdlib>
+#include <thread>
+
+/**
+ * @brief Testing the following model:
+ *       #1 = placeholder (shape = [1, 2], dtype=float)
+ *       #2 = const (shape = [2], dtype=float, value = [10, 20])
+ *       #3 = add(#1, #2)
+ */
+auto build_model_add_pipeline()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t rhs_buf = cgen.addBuffer(std::vector<float>{10, 20});
+  int in = cgen.addTensor({{1, 2}, f32});
+  int rhs = cgen.addTensor({{2}, f32, rhs_buf});
+  int out = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorAdd({{in, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+TEST_F(ValidationTestPipelineSession, push_pop_in_threads)
+{
+  constexpr int num_requests = 4;
+
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+  const auto model_buf = build_model_add_pipeline();
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(_session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(_session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_pipeline(_session));
+
+  std::thread producer([&]() {
+    for (int n = 0; n < num_requests; ++n)
+    {
+      std::vector<float> input{static_cast<float>(n), static_cast<float>(-n)};
+      std::vector<void *> inputs{input.data()};
+      std::vector<uint32_t> lengths{static_cast<uint32_t>(input.size() * sizeof(float))};
+      NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(_session, &inputs, &lengths));
+    }
+
+    // Close pipeline
+    std::vector<void *> inputs;
+    std::vector<uint32_t> lengths;
+    NNFW_ENSURE_SUCCESS(nnfw_push_pipeline_input(_session, &inputs, &lengths));
+  });
+
+  for (int n = 0; n < num_requests; ++n)
+  {
+    std::vector<void *> outputs;
+    NNFW_ENSURE_SUCCESS(nnfw_pop_pipeline_output(_session, &outputs));
+    ASSERT_EQ(outputs.size(), 1);
+    const auto output = reinterpret_cast<float *>(outputs[0]);
+    EXPECT_FLOAT_EQ(output[0], n + 10.f);
+    EXPECT_FLOAT_EQ(output[1], -n + 20.f);
+    std::free(outputs[0]);
+  }
+  producer.join();
+
+  // No more request
+  std::vector<void *> outputs;
+  ASSERT_EQ(nnfw_pop_pipeline_output(_session, &outputs), NNFW_STATUS_ERROR);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session));
+}
+
+TEST_F(ValidationTestPipelineSession, neg_prepare_pipeline)
+{
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&_session));
+
+  // Not loaded
+  ASSERT_EQ(nnfw_prepare_pipeline(_session), NNFW_STATUS_INVALID_STATE);
+
+  const auto model_buf = build_model_add_pipeline();
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(_session, model_buf.buffer(), model_buf.size()));
+
+  // Not prepared for pipeline
+  std::vector<void *> outputs;
+  ASSERT_EQ(nnfw_pop_pipeline_output(_session, &outputs), NNFW_STATUS_INVALID_STATE);
+
+  // Partition map is not supported
+  ASSERT_EQ(nnfw_prepare_pipeline(_session, "partition_map.json"), NNFW_STATUS_ERROR);
+
+  ASSERT_EQ(nnfw_prepare_pipeline(nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  NNFW_ENSURE_SUCCESS(nnfw_prepare_pipeline(_session));
+  ASSERT_EQ(nnfw_run(_session), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_push_pipeline_input(_session, nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(_session));
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <unistd.h>
+
+namespace
+{
+
+std::vector<float> initialValues(size_t size, int32_t seed)
+{
+  std::vector<float> values(size);
+  for (size_t i = 0; i < size; ++i)
+    values[i] = static_cast<float>(static_cast<int32_t>((i * 7 + seed) % 11) - 5) * 0.05f;
+  return values;
+}
+
+/**
+ * @brief Testing the following model:
+ *       (( Input )) -> [ Conv2D ] -> [ Relu ] -> [ Reshape ] -> [ FC ] -> [ Relu ] -> [ FC ]
+ *                   -> (( Output ))
+ */
+CircleBuffer buildConvFCModel()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+
+  const auto new_shape = CircleGen::Shape{1, 18};
+  uint32_t conv_weight_buf = cgen.addBuffer(initialValues(2 * 3 * 3 * 1, 0));
+  uint32_t conv_bias_buf = cgen.addBuffer(initialValues(2, 1));
+  uint32_t shape_buf = cgen.addBuffer(std::vector<int32_t>(new_shape));
+  uint32_t fc1_weight_buf = cgen.addBuffer(initialValues(4 * 18, 2));
+  uint32_t fc1_bias_buf = cgen.addBuffer(initialValues(4, 3));
+  uint32_t fc2_weight_buf = cgen.addBuffer(initialValues(2 * 4, 4));
+  uint32_t fc2_bias_buf = cgen.addBuffer(initialValues(2, 5));
+
+  int input = cgen.addTensor({{1, 5, 5, 1}, f32});
+  int conv_weight = cgen.addTensor({{2, 3, 3, 1}, f32, conv_weight_buf});
+  int conv_bias = cgen.addTensor({{2}, f32, conv_bias_buf});
+  int conv_out = cgen.addTensor({{1, 3, 3, 2}, f32});
+  int relu1_out = cgen.addTensor({{1, 3, 3, 2}, f32});
+  int shape = cgen.addTensor({{2}, circle::TensorType::TensorType_INT32, shape_buf});
+  int reshape_out = cgen.addTensor({{1, 18}, f32});
+  int fc1_weight = cgen.addTensor({{4, 18}, f32, fc1_weight_buf});
+  int fc1_bias = cgen.addTensor({{4}, f32, fc1_bias_buf});
+  int fc1_out = cgen.addTensor({{1, 4}, f32});
+  int relu2_out = cgen.addTensor({{1, 4}, f32});
+  int fc2_weight = cgen.addTensor({{2, 4}, f32, fc2_weight_buf});
+  int fc2_bias = cgen.addTensor({{2}, f32, fc2_bias_buf});
+  int output = cgen.addTensor({{1, 2}, f32});
+
+  cgen.addOperatorConv2D({{input, conv_weight, conv_bias}, {conv_out}}, circle::Padding_VALID, 1,
+                         1, circle::ActivationFunctionType_NONE);
+  cgen.addOperatorRelu({{conv_out}, {relu1_out}});
+  cgen.addOperatorReshape({{relu1_out, shape}, {reshape_out}}, &new_shape);
+  cgen.addOperatorFullyConnected({{reshape_out, fc1_weight, fc1_bias}, {fc1_out}});
+  cgen.addOperatorRelu({{fc1_out}, {relu2_out}});
+  cgen.addOperatorFullyConnected({{relu2_out, fc2_weight, fc2_bias}, {output}});
+  cgen.setInputsAndOutputs({input}, {output});
+
+  return cgen.finish();
+}
+
+struct TrainResult
+{
+  std::vector<float> losses;
+  // Checkpoint has trained weights
+  std::vector<char> checkpoint;
+};
+
+void train(const CircleBuffer &cbuf, uint32_t recompute_segment_size,
+           uint64_t activation_memory_budget, TrainResult &result)
+{
+  constexpr uint32_t num_steps = 8;
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+
+  nnfw_train_info tri;
+  tri.learning_rate = 0.01f;
+  tri.batch_size = 1;
+  tri.loss_info.loss = NNFW_TRAIN_LOSS_MEAN_SQUARED_ERROR;
+  tri.loss_info.reduction_type = NNFW_TRAIN_LOSS_REDUCTION_SUM_OVER_BATCH_SIZE;
+  tri.opt = NNFW_TRAIN_OPTIMIZER_SGD;
+  tri.num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_ALL;
+  tri.recompute_segment_size = recompute_segment_size;
+  tri.activation_memory_budget = activation_memory_budget;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+  NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+
+  std::vector<float> input(1 * 5 * 5 * 1);
+  std::vector<float> expected(1 * 2);
+  nnfw_tensorinfo input_info;
+  nnfw_tensorinfo expected_info;
+  NNFW_ENSURE_SUCCESS(nnfw_input_tensorinfo(session, 0, &input_info));
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &expected_info));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_input(session, 0, input.data(), &input_info));
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_expected(session, 0, expected.data(), &expected_info));
+
+  for (uint32_t step = 0; step < num_steps; ++step)
+  {
+    for (uint32_t i = 0; i < input.size(); ++i)
+      input[i] = static_cast<float>(static_cast<int32_t>((i * 3 + step) % 9) - 4);
+    expected[0] = static_cast<float>(step % 3);
+    expected[1] = -static_cast<float>(step % 2);
+
+    NNFW_ENSURE_SUCCESS(nnfw_train(session, true));
+    float loss = 0.f;
+    NNFW_ENSURE_SUCCESS(nnfw_train_get_loss(session, 0, &loss));
+    result.losses.emplace_back(loss);
+  }
+
+  char path[] = "/tmp/nnfw_api_recompute_XXXXXX";
+  int fd = mkstemp(path);
+  ASSERT_NE(fd, -1);
+  close(fd);
+  NNFW_ENSURE_SUCCESS(nnfw_train_export_checkpoint(session, path));
+  {
+    std::ifstream ifs{path, std::ios::binary};
+    result.checkpoint.assign(std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{});
+  }
+  std::remove(path);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+} // namespace
+
+TEST(TestRecomputeTrain, segment_size_same_as_no_recompute)
+{
+  const auto cbuf = buildConvFCModel();
+
+  TrainResult base;
+  train(cbuf, 0, 0, base);
+  ASSERT_FALSE(base.checkpoint.empty());
+
+  TrainResult recompute;
+  train(cbuf, 2, 0, recompute);
+
+  // Recomputed activations are the same, so are losses and weights
+  EXPECT_EQ(recompute.losses, base.losses);
+  EXPECT_EQ(recompute.checkpoint, base.checkpoint);
+}
+
+TEST(TestRecomputeTrain, segment_size_1_same_as_no_recompute)
+{
+  const auto cbuf = buildConvFCModel();
+
+  TrainResult base;
+  train(cbuf, 0, 0, base);
+  ASSERT_FALSE(base.checkpoint.empty());
+
+  // A segment of an operation has no activation used only in it, so nothing is recomputed
+  TrainResult recompute;
+  train(cbuf, 1, 0, recompute);
+
+  EXPECT_EQ(recompute.losses, base.losses);
+  EXPECT_EQ(recompute.checkpoint, base.checkpoint);
+}
+
+TEST(TestRecomputeTrain, memory_budget_same_as_no_recompute)
+{
+  const auto cbuf = buildConvFCModel();
+
+  TrainResult base;
+  train(cbuf, 0, 0, base);
+  ASSERT_FALSE(base.checkpoint.empty());
+
+  // No segment size fits in 1 byte, so the one that needs the least memory is chosen
+  TrainResult recompute;
+  train(cbuf, 0, 1, recompute);
+
+  EXPECT_EQ(recompute.losses, base.losses);
+  EXPECT_EQ(recompute.checkpoint, base.checkpoint);
+}
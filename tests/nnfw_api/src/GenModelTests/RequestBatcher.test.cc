@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <thread>
+
+/**
+ * @brief Testing the following model:
+ *       #1 = placeholder (shape = [1, 2], dtype=float)
+ *       #2 = const (shape = [2], dtype=float, value = [10, 20])
+ *       #3 = add(#1, #2)
+ */
+auto build_model_add_batch1()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t rhs_buf = cgen.addBuffer(std::vector<float>{10, 20});
+  int in = cgen.addTensor({{1, 2}, f32});
+  int rhs = cgen.addTensor({{2}, f32, rhs_buf});
+  int out = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorAdd({{in, rhs}, {out}}, circle::ActivationFunctionType_NONE);
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+TEST(TestRequestBatcher, run_in_threads)
+{
+  constexpr int num_requests = 8;
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_add_batch1();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  nnfw_batcher_config config;
+  config.max_batch_size = 4;
+  config.max_wait_us = 1000;
+  nnfw_batcher *batcher = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_batcher_create(session, &config, &batcher));
+
+  std::vector<std::vector<float>> inputs(num_requests);
+  std::vector<std::vector<float>> outputs(num_requests, std::vector<float>(2));
+  std::vector<NNFW_STATUS> results(num_requests, NNFW_STATUS_ERROR);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_requests; ++i)
+  {
+    inputs[i] = {static_cast<float>(i), static_cast<float>(-i)};
+    threads.emplace_back([&, i]() {
+      const void *in_bufs[] = {inputs[i].data()};
+      void *out_bufs[] = {outputs[i].data()};
+      results[i] = nnfw_batcher_run(batcher, in_bufs, out_bufs);
+    });
+  }
+  for (auto &&thread : threads)
+    thread.join();
+
+  for (int i = 0; i < num_requests; ++i)
+  {
+    ASSERT_EQ(results[i], NNFW_STATUS_NO_ERROR);
+    ASSERT_FLOAT_EQ(outputs[i][0], i + 10.f);
+    ASSERT_FLOAT_EQ(outputs[i][1], -i + 20.f);
+  }
+
+  nnfw_batcher_stats stats;
+  NNFW_ENSURE_SUCCESS(nnfw_batcher_get_stats(batcher, &stats));
+  ASSERT_EQ(stats.num_requests, num_requests);
+  ASSERT_EQ(stats.queue_depth, 0);
+  uint64_t num_batches = 0;
+  uint64_t num_batched_requests = 0;
+  for (uint32_t n = 1; n <= NNFW_BATCHER_MAX_BATCH_SIZE; ++n)
+  {
+    if (n > config.max_batch_size)
+      ASSERT_EQ(stats.batch_size_histogram[n - 1], 0);
+    num_batches += stats.batch_size_histogram[n - 1];
+    num_batched_requests += stats.batch_size_histogram[n - 1] * n;
+  }
+  ASSERT_EQ(num_batches, stats.num_batches);
+  ASSERT_EQ(num_batched_requests, num_requests);
+
+  NNFW_ENSURE_SUCCESS(nnfw_batcher_destroy(batcher));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST(TestRequestBatcher, neg_create)
+{
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  const auto model_buf = build_model_add_batch1();
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, model_buf.buffer(), model_buf.size()));
+
+  nnfw_batcher_config config;
+  config.max_batch_size = 4;
+  config.max_wait_us = 1000;
+  nnfw_batcher *batcher = nullptr;
+
+  // Not prepared
+  ASSERT_EQ(nnfw_batcher_create(session, &config, &batcher), NNFW_STATUS_INVALID_STATE);
+
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+
+  // Invalid batch size
+  config.max_batch_size = 0;
+  ASSERT_EQ(nnfw_batcher_create(session, &config, &batcher), NNFW_STATUS_ERROR);
+  config.max_batch_size = NNFW_BATCHER_MAX_BATCH_SIZE + 1;
+  ASSERT_EQ(nnfw_batcher_create(session, &config, &batcher), NNFW_STATUS_ERROR);
+
+  ASSERT_EQ(nnfw_batcher_create(session, nullptr, &batcher), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_batcher_run(nullptr, nullptr, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <nnfw_experimental.h>
+
+#include "fixtures.h"
+#include "CircleGen.h"
+
+#include <cstring>
+
+namespace
+{
+
+/**
+ * @brief Testing the following model:
+ *       #1 = placeholder (shape = [1, 2], dtype=float)
+ *       #2 = const (shape = [2, 2], dtype=float)
+ *       #3 = fully_connected(#1, #2)
+ */
+CircleBuffer buildFCModel()
+{
+  CircleGen cgen;
+  auto f32 = circle::TensorType::TensorType_FLOAT32;
+  uint32_t weight_buf = cgen.addBuffer(std::vector<float>{1, 2, 3, 4});
+  int in = cgen.addTensor({{1, 2}, f32});
+  int weight = cgen.addTensor({{2, 2}, f32, weight_buf});
+  int out = cgen.addTensor({{1, 2}, f32});
+  cgen.addOperatorFullyConnected({{in, weight, -1}, {out}});
+  cgen.setInputsAndOutputs({in}, {out});
+  return cgen.finish();
+}
+
+} // namespace
+
+TEST(TestTrainInfo, zero_initialized_fields_are_default)
+{
+  const auto cbuf = buildFCModel();
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(nnfw_load_circle_from_buffer(session, cbuf.buffer(), cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "train"));
+
+  // Struct zero-initialized without default member initializers
+  nnfw_train_info tri;
+  std::memset(&tri, 0, sizeof(tri));
+  tri.learning_rate = 0.01f;
+  tri.batch_size = 1;
+  tri.loss_info.loss = NNFW_TRAIN_LOSS_MEAN_SQUARED_ERROR;
+  tri.loss_info.reduction_type = NNFW_TRAIN_LOSS_REDUCTION_SUM_OVER_BATCH_SIZE;
+  tri.opt = NNFW_TRAIN_OPTIMIZER_SGD;
+  tri.num_of_trainable_ops = NNFW_TRAIN_TRAINABLE_ALL;
+  NNFW_ENSURE_SUCCESS(nnfw_train_set_traininfo(session, &tri));
+
+  nnfw_train_info info;
+  NNFW_ENSURE_SUCCESS(nnfw_train_get_traininfo(session, &info));
+  EXPECT_EQ(info.recompute_segment_size, 0);
+  EXPECT_EQ(info.activation_memory_budget, 0);
+  EXPECT_EQ(info.gradient_accumulation_steps, 1);
+  EXPECT_FALSE(info.multi_tensor_update);
+
+  NNFW_ENSURE_SUCCESS(nnfw_train_prepare(session));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
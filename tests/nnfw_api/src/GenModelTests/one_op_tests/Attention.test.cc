@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2021 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "GenModelTest.h"
+
+#include <memory>
+
+// query/key/value/output shape: {1, 1, 2, 2}
+// query {1, 0, 0, 1} and key {1, 0, 0, 1} give scores {1, 0, 0, 1} with scale 1
+TEST_F(GenModelTest, OneOp_Attention)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->addTestCase(uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1.537882, 2.537882, 2.462118, 3.462118}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Attention_Mask)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int mask = cgen.addTensor({{2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value, mask}, {output}}, 1.f);
+  cgen.setInputsAndOutputs({query, key, value, mask}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Query 0 does not attend key 1
+  _context->addTestCase(
+    uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}, {0, -1e9, 0, 0}},
+                      {{1, 2, 2.462118, 3.462118}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Attention_Causal)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f, 0, true);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Same as the mask of OneOp_Attention_Mask
+  _context->addTestCase(uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1, 2, 2.462118, 3.462118}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Attention_Cache)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f, 4, true);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Without streaming, each run is a new sequence attended causally
+  _context->addTestCase(uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1, 2, 2.462118, 3.462118}}));
+  _context->addTestCase(uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1, 2, 2.462118, 3.462118}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, OneOp_Attention_Cache_NotCausal)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f, 4);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  // Every query attends all tokens in kv cache, same as OneOp_Attention
+  _context->addTestCase(uniformTCD<float>({{1, 0, 0, 1}, {1, 0, 0, 1}, {1, 2, 3, 4}},
+                                          {{1.537882, 2.537882, 2.462118, 3.462118}}));
+  _context->setBackends({"cpu"});
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Attention_DifferentDepth)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 3}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
+
+TEST_F(GenModelTest, neg_OneOp_Attention_CacheTooSmall)
+{
+  CircleGen cgen;
+
+  int query = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int key = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int value = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+  int output = cgen.addTensor({{1, 1, 2, 2}, circle::TensorType::TensorType_FLOAT32});
+
+  // New tokens do not fit in kv cache
+  cgen.addOperatorAttention({{query, key, value}, {output}}, 1.f, 1);
+  cgen.setInputsAndOutputs({query, key, value}, {output});
+
+  _context = std::make_unique<GenModelTestContext>(cgen.finish());
+  _context->setBackends({"cpu"});
+  _context->expectFailCompile();
+
+  SUCCEED();
+}
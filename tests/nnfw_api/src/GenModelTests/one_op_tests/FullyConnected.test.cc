@@ -57,7 +57,6 @@ TEST_F(GenModelTest, OneOp_FullyConnected)
   SUCCEED();
 }
 
-#if defined(__aarch64__)
 TEST_F(GenModelTest, OneOp_FullyConnectedShuffled16x1Float32)
 {
   CircleGen cgen;
@@ -85,9 +84,8 @@ TEST_F(GenModelTest, OneOp_FullyConnectedShuffled16x1Float32)
 
   SUCCEED();
 }
-#endif
 
-// Failure is expected except for aarch64 and cpu backend
+// Failure is expected except for cpu backend
 TEST_F(GenModelTest, OneOp_neg_FullyConnectedShuffled16x1Float32)
 {
   CircleGen cgen;
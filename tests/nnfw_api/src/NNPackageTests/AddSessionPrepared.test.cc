@@ -209,6 +209,13 @@ TEST_F(ValidationTestAddSessionPrepared, neg_set_prepare_config)
             NNFW_STATUS_INVALID_STATE);
 }
 
+TEST_F(ValidationTestAddSessionPrepared, neg_reset_variable_states)
+{
+  // Variable states are not kept without NNFW_PREPARE_CONFIG_KEEP_VARIABLE_STATES
+  EXPECT_EQ(nnfw_reset_variable_states(_session), NNFW_STATUS_ERROR);
+  EXPECT_EQ(nnfw_reset_variable_states(nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+}
+
 TEST_F(ValidationTestAddSessionPrepared, set_execute_config)
 {
   // Execution config should set after nnfw_prepare
@@ -17,6 +17,8 @@
 #include "fixtures.h"
 #include "GenModelTests/one_op_tests/WhileTestModel.h"
 
+#include <thread>
+
 TEST_F(ValidationTestTwoSessions, neg_two_sessions_create)
 {
   ASSERT_EQ(nnfw_create_session(&_session1), NNFW_STATUS_NO_ERROR);
@@ -137,4 +139,109 @@ TEST_F(ValidationTestTwoSessionsCreated, two_sessions_run_simple_While_model)
   SUCCEED();
 }
 
+TEST_F(ValidationTestSingleSession, execution_contexts_run_in_threads)
+{
+  constexpr int N = 4, H = 16, W = 16, C = 3;
+  constexpr int num_contexts = 4;
+  AveragePoolModel model(N, H, W, C);
+
+  nnfw_session *session = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(session, model.cbuf.buffer(), model.cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+
+  std::vector<nnfw_session *> contexts(num_contexts);
+  for (auto &&context : contexts)
+  {
+    NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(session, &context));
+    NNFW_ENSURE_SUCCESS(nnfw_prepare(context));
+  }
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+
+  constexpr int input_count = N * H * W * C;
+  constexpr int output_count = N * H / 2 * W / 2 * C;
+
+  std::vector<std::vector<float>> in_bufs(num_contexts);
+  std::vector<std::vector<float>> out_bufs(num_contexts);
+  for (int i = 0; i < num_contexts; ++i)
+  {
+    // Average of the same values is the value itself
+    in_bufs[i].resize(input_count, static_cast<float>(i + 1));
+    out_bufs[i].resize(output_count);
+    NNFW_ENSURE_SUCCESS(nnfw_set_input(contexts[i], 0, NNFW_TYPE_TENSOR_FLOAT32,
+                                       in_bufs[i].data(), in_bufs[i].size() * sizeof(float)));
+    NNFW_ENSURE_SUCCESS(nnfw_set_output(contexts[i], 0, NNFW_TYPE_TENSOR_FLOAT32,
+                                        out_bufs[i].data(), out_bufs[i].size() * sizeof(float)));
+  }
+
+  std::vector<NNFW_STATUS> results(num_contexts, NNFW_STATUS_ERROR);
+  std::vector<std::thread> threads;
+  for (int i = 0; i < num_contexts; ++i)
+    threads.emplace_back([&, i]() { results[i] = nnfw_run(contexts[i]); });
+  for (auto &&thread : threads)
+    thread.join();
+
+  for (int i = 0; i < num_contexts; ++i)
+  {
+    ASSERT_EQ(results[i], NNFW_STATUS_NO_ERROR);
+    for (auto &&value : out_bufs[i])
+      ASSERT_FLOAT_EQ(value, static_cast<float>(i + 1));
+    NNFW_ENSURE_SUCCESS(nnfw_close_session(contexts[i]));
+  }
+}
+
+TEST_F(ValidationTestSingleSession, execution_context_has_own_model)
+{
+  constexpr int N = 4, H = 16, W = 16, C = 3;
+  AveragePoolModel model(N, H, W, C);
+
+  nnfw_session *session = nullptr;
+  nnfw_session *context = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+  NNFW_ENSURE_SUCCESS(
+    nnfw_load_circle_from_buffer(session, model.cbuf.buffer(), model.cbuf.size()));
+  NNFW_ENSURE_SUCCESS(nnfw_set_available_backends(session, "cpu"));
+  NNFW_ENSURE_SUCCESS(nnfw_create_execution_context(session, &context));
+
+  // Input shape change on the execution context is not applied to the session
+  nnfw_tensorinfo ti = {NNFW_TYPE_TENSOR_FLOAT32, 4, {1, H, W, C}};
+  NNFW_ENSURE_SUCCESS(nnfw_set_input_tensorinfo(context, 0, &ti));
+
+  // The execution context is compiled from its own graphs, not the ones the session compiled
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(session));
+  NNFW_ENSURE_SUCCESS(nnfw_prepare(context));
+
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(session, 0, &ti));
+  ASSERT_EQ(ti.dims[0], N);
+  NNFW_ENSURE_SUCCESS(nnfw_output_tensorinfo(context, 0, &ti));
+  ASSERT_EQ(ti.dims[0], 1);
+
+  std::vector<float> in_buf(H * W * C, 2.f);
+  std::vector<float> out_buf(H / 2 * W / 2 * C);
+  NNFW_ENSURE_SUCCESS(nnfw_set_input(context, 0, NNFW_TYPE_TENSOR_FLOAT32, in_buf.data(),
+                                     in_buf.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_set_output(context, 0, NNFW_TYPE_TENSOR_FLOAT32, out_buf.data(),
+                                      out_buf.size() * sizeof(float)));
+  NNFW_ENSURE_SUCCESS(nnfw_run(context));
+  for (auto &&value : out_buf)
+    ASSERT_FLOAT_EQ(value, 2.f);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(context));
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
+TEST_F(ValidationTestSingleSession, neg_execution_context_not_loaded)
+{
+  nnfw_session *session = nullptr;
+  nnfw_session *context = nullptr;
+  NNFW_ENSURE_SUCCESS(nnfw_create_session(&session));
+
+  ASSERT_EQ(nnfw_create_execution_context(session, &context), NNFW_STATUS_INVALID_STATE);
+  ASSERT_EQ(nnfw_create_execution_context(session, nullptr), NNFW_STATUS_UNEXPECTED_NULL);
+  ASSERT_EQ(nnfw_create_execution_context(nullptr, &context), NNFW_STATUS_UNEXPECTED_NULL);
+
+  NNFW_ENSURE_SUCCESS(nnfw_close_session(session));
+}
+
 // TODO Write two-session-test with large models run by threads
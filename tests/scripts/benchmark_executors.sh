@@ -0,0 +1,109 @@
+#!/bin/bash
+#
+# Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#    http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# Compare Linear, Dataflow and Parallel executors on the given models
+#
+# Parallel executor only pays off on models with independent branches
+# (e.g. inception blocks, multi-head networks), so give such models.
+#
+# $ ./benchmark_executors.sh --backends="cpu" --num_runs=20 model1.circle nnpkg_dir2 ...
+
+MY_PATH="$( cd "$( dirname "${BASH_SOURCE[0]}" )" && pwd )"
+
+source $MY_PATH/common.sh
+
+# Caution: DO NOT USE "pipefail"
+#          We should run all the models
+
+onert_run="$INSTALL_PATH/bin/onert_run"
+executors="Linear Dataflow Parallel"
+backends="cpu"
+num_runs=10
+warmup_runs=3
+outfile="benchmark_executors_result.txt"
+models=()
+
+function usage()
+{
+  echo "Usage: ${BASH_SOURCE[0]} [OPTIONS] MODEL..."
+  echo "Options"
+  echo "    --backends=STRING  : backends to use (default: $backends)"
+  echo "    --executors=STRING : executors to compare (default: '$executors')"
+  echo "    --num_runs=N       : number of measured runs (default: $num_runs)"
+  echo "    --warmup_runs=N    : number of warmup runs (default: $warmup_runs)"
+  echo "    --out=FILE         : the file name of out results (default: $outfile)"
+  echo "    --help             : display this help message and exit"
+  exit 1
+}
+
+for i in "$@"
+do
+  case $i in
+    --backends=*)
+      backends="${i#*=}"
+      ;;
+    --executors=*)
+      executors="${i#*=}"
+      ;;
+    --num_runs=*)
+      num_runs="${i#*=}"
+      ;;
+    --warmup_runs=*)
+      warmup_runs="${i#*=}"
+      ;;
+    --out=*)
+      outfile="${i#*=}"
+      ;;
+    --help)
+      usage
+      ;;
+    *)
+      models+=("$i")
+      ;;
+  esac
+  shift
+done
+
+if [ ${#models[@]} -eq 0 ]; then
+  echo "No model is given."
+  usage
+fi
+
+rm -f ${outfile}
+
+printf '%-40s' "model" | tee -a ${outfile}
+for executor in ${executors}; do
+  printf '%12s' "${executor}" | tee -a ${outfile}
+done
+echo "" | tee -a ${outfile}
+
+for model in "${models[@]}"; do
+  printf '%-40s' "$(basename ${model})" | tee -a ${outfile}
+  for executor in ${executors}; do
+    log_file="$(mktemp)"
+    BACKENDS="${backends}" EXECUTOR="${executor}" \
+      ${onert_run} -r ${num_runs} -w ${warmup_runs} ${model} > ${log_file} 2>&1
+    if [[ $? -ne 0 ]]; then
+      result="FAIL"
+    else
+      # Mean latency of execution phase in ms
+      result=$(grep -E '^- MEAN ' ${log_file} | awk '{print $4}')
+    fi
+    rm -f ${log_file}
+    printf '%12s' "${result}" | tee -a ${outfile}
+  done
+  echo "" | tee -a ${outfile}
+done
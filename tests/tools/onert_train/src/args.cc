@@ -166,6 +166,11 @@ void Args::Initialize(void)
     .nargs(0)
     .default_value(false)
     .help("Check memory polling (default: false)");
+  _arser.add_argument("--phase_time")
+    .nargs(0)
+    .default_value(false)
+    .help({"Print time of forward, backward and weight update per training step",
+           "(default: false)"});
   _arser.add_argument("--epoch")
     .type(arser::DataType::INT32)
     .default_value(5)
@@ -206,6 +211,35 @@ void Args::Initialize(void)
     .help({"Number of the layers to be trained from the back of the model.",
            "\"-1\" means that all layers will be trained.",
            "\"0\" means that no layer will be trained."});
+  _arser.add_argument("--recompute_segment_size")
+    .type(arser::DataType::INT32)
+    .help({"Number of operations in a segment to be recomputed in backwarding",
+           "Activations used only in a segment are not kept for backwarding",
+           "\"0\" means that the segment size is chosen by --activation_memory_budget"});
+  _arser.add_argument("--activation_memory_budget")
+    .type(arser::DataType::INT32)
+    .help({"Memory of activations to be kept for backwarding in KB",
+           "Activations are recomputed to fit in it if not fit",
+           "\"0\" means no limit"});
+  _arser.add_argument("--gradient_accumulation_steps")
+    .type(arser::DataType::INT32)
+    .help({"Number of micro-batches whose gradients are averaged to update weights once",
+           "Effective batch size is batch_size * gradient_accumulation_steps"});
+  _arser.add_argument("--multi_tensor_update")
+    .nargs(0)
+    .default_value(false)
+    .help({"Update weights of all layers at once after backwarding (default: false)",
+           "Gradients of all layers are kept until the update"});
+  _arser.add_argument("--prefetch_depth")
+    .type(arser::DataType::INT32)
+    .default_value(2)
+    .help({"Number of batches loaded ahead on a background thread (default: 2)",
+           "The batch being trained is one of them, i.e. 2 means double buffering",
+           "\"0\" means that batches are loaded on the training thread"});
+  _arser.add_argument("--shuffle")
+    .nargs(0)
+    .default_value(false)
+    .help("Shuffle the order of training batches every epoch (default: false)");
 }
 
 void Args::Parse(const int argc, char **argv)
@@ -271,6 +305,9 @@ void Args::Parse(const int argc, char **argv)
     }
 
     _mem_poll = _arser.get<bool>("--mem_poll");
+    _phase_time = _arser.get<bool>("--phase_time");
+    _multi_tensor_update = _arser.get<bool>("--multi_tensor_update");
+    _shuffle = _arser.get<bool>("--shuffle");
     _epoch = _arser.get<int>("--epoch");
 
     if (_arser["--batch_size"])
@@ -323,6 +360,47 @@ void Args::Parse(const int argc, char **argv)
 
     if (_arser["--num_of_trainable_ops"])
       _num_of_trainable_ops = _arser.get<int>("--num_of_trainable_ops");
+
+    if (_arser["--recompute_segment_size"])
+    {
+      const auto segment_size = _arser.get<int>("--recompute_segment_size");
+      if (segment_size < 0)
+      {
+        std::cerr << "Invalid recompute_segment_size: " << segment_size << std::endl;
+        exit(1);
+      }
+      _recompute_segment_size = segment_size;
+    }
+
+    if (_arser["--activation_memory_budget"])
+    {
+      const auto budget = _arser.get<int>("--activation_memory_budget");
+      if (budget < 0)
+      {
+        std::cerr << "Invalid activation_memory_budget: " << budget << std::endl;
+        exit(1);
+      }
+      _activation_memory_budget = static_cast<uint64_t>(budget) * 1024;
+    }
+
+    if (_arser["--gradient_accumulation_steps"])
+    {
+      const auto steps = _arser.get<int>("--gradient_accumulation_steps");
+      if (steps <= 0)
+      {
+        std::cerr << "Invalid gradient_accumulation_steps: " << steps << std::endl;
+        exit(1);
+      }
+      _gradient_accumulation_steps = steps;
+    }
+
+    const auto prefetch_depth = _arser.get<int>("--prefetch_depth");
+    if (prefetch_depth < 0)
+    {
+      std::cerr << "Invalid prefetch_depth: " << prefetch_depth << std::endl;
+      exit(1);
+    }
+    _prefetch_depth = prefetch_depth;
   }
   catch (const std::bad_cast &e)
   {
@@ -57,6 +57,7 @@ public:
   const std::string &getLoadRawInputFilename(void) const { return _load_raw_input_filename; }
   const std::string &getLoadRawExpectedFilename(void) const { return _load_raw_expected_filename; }
   const bool getMemoryPoll(void) const { return _mem_poll; }
+  const bool getPhaseTime(void) const { return _phase_time; }
   const int getEpoch(void) const { return _epoch; }
   const std::optional<int> getBatchSize(void) const { return _batch_size; }
   const std::optional<float> getLearningRate(void) const { return _learning_rate; }
@@ -72,6 +73,21 @@ public:
   const int getVerboseLevel(void) const { return _verbose_level; }
   std::unordered_map<uint32_t, uint32_t> getOutputSizes(void) const { return _output_sizes; }
   uint32_t num_of_trainable_ops(void) const { return _num_of_trainable_ops; }
+  const std::optional<uint32_t> getRecomputeSegmentSize(void) const
+  {
+    return _recompute_segment_size;
+  }
+  const std::optional<uint64_t> getActivationMemoryBudget(void) const
+  {
+    return _activation_memory_budget;
+  }
+  const std::optional<uint32_t> getGradientAccumulationSteps(void) const
+  {
+    return _gradient_accumulation_steps;
+  }
+  const bool getMultiTensorUpdate(void) const { return _multi_tensor_update; }
+  uint32_t getPrefetchDepth(void) const { return _prefetch_depth; }
+  const bool getShuffle(void) const { return _shuffle; }
 
 private:
   void Initialize();
@@ -109,6 +125,7 @@ private:
   std::string _load_raw_input_filename;
   std::string _load_raw_expected_filename;
   bool _mem_poll;
+  bool _phase_time;
   int _epoch;
   std::optional<int> _batch_size;
   std::optional<float> _learning_rate;
@@ -121,6 +138,12 @@ private:
   int _verbose_level;
   std::unordered_map<uint32_t, uint32_t> _output_sizes;
   int32_t _num_of_trainable_ops;
+  std::optional<uint32_t> _recompute_segment_size;
+  std::optional<uint64_t> _activation_memory_budget;
+  std::optional<uint32_t> _gradient_accumulation_steps;
+  bool _multi_tensor_update;
+  uint32_t _prefetch_depth;
+  bool _shuffle;
 };
 
 } // end of namespace onert_train
@@ -49,8 +49,6 @@ public:
 protected:
   std::vector<nnfw_tensorinfo> _input_infos;
   std::vector<nnfw_tensorinfo> _expected_infos;
-  std::ifstream _input_file;
-  std::ifstream _expected_file;
   uint32_t _data_length;
 };
 
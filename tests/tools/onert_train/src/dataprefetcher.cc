@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dataprefetcher.h"
+#include "nnfw_util.h"
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace onert_train
+{
+
+DataPrefetcher::DataPrefetcher(const Generator &generator,
+                               const std::vector<nnfw_tensorinfo> &input_infos,
+                               const std::vector<nnfw_tensorinfo> &expected_infos,
+                               uint32_t queue_depth)
+  : _generator{generator}, _queue_depth{queue_depth}, _batches(std::max(queue_depth, 1u)),
+    _num_steps{0}, _num_loaded{0}, _num_released{0}, _done{true}, _stopping{false}
+{
+  for (auto &batch : _batches)
+  {
+    batch.inputs = std::vector<Allocation>(input_infos.size());
+    for (uint32_t i = 0; i < input_infos.size(); ++i)
+      batch.inputs[i].alloc(bufsize_for(&input_infos[i]));
+    batch.expecteds = std::vector<Allocation>(expected_infos.size());
+    for (uint32_t i = 0; i < expected_infos.size(); ++i)
+      batch.expecteds[i].alloc(bufsize_for(&expected_infos[i]));
+  }
+}
+
+DataPrefetcher::~DataPrefetcher() { stop(); }
+
+void DataPrefetcher::start(uint32_t num_steps, bool shuffle, uint32_t seed)
+{
+  stop();
+
+  _num_steps = num_steps;
+  _num_loaded = 0;
+  _num_released = 0;
+  _done = false;
+  _stopping = false;
+  _error = nullptr;
+
+  if (_queue_depth == 0)
+  {
+    _order = makeOrder(num_steps, shuffle, seed);
+    return;
+  }
+
+  _thread = std::thread([this, num_steps, shuffle, seed]() {
+    try
+    {
+      load(makeOrder(num_steps, shuffle, seed));
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _error = std::current_exception();
+      _done = true;
+      _cv.notify_all();
+    }
+  });
+}
+
+const DataPrefetcher::Batch *DataPrefetcher::next()
+{
+  if (_queue_depth == 0)
+  {
+    if (_num_released >= _num_steps)
+      return nullptr;
+    auto &batch = _batches[0];
+    if (!_generator(_order[_num_released], batch.inputs, batch.expecteds))
+      return nullptr;
+    return &batch;
+  }
+
+  std::unique_lock<std::mutex> lock(_mutex);
+  _cv.wait(lock, [this]() { return _num_loaded > _num_released || _done; });
+  if (_error)
+    std::rethrow_exception(_error);
+  if (_num_loaded <= _num_released)
+    return nullptr;
+  return &_batches[_num_released % _queue_depth];
+}
+
+void DataPrefetcher::release()
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _num_released++;
+  _cv.notify_all();
+}
+
+std::vector<uint32_t> DataPrefetcher::makeOrder(uint32_t num_steps, bool shuffle,
+                                                uint32_t seed) const
+{
+  std::vector<uint32_t> order(num_steps);
+  std::iota(order.begin(), order.end(), 0);
+  if (shuffle)
+    std::shuffle(order.begin(), order.end(), std::mt19937{seed});
+  return order;
+}
+
+void DataPrefetcher::load(std::vector<uint32_t> order)
+{
+  for (uint32_t step = 0; step < order.size(); ++step)
+  {
+    {
+      // Wait for a free buffer, the one being used by training is not released yet
+      std::unique_lock<std::mutex> lock(_mutex);
+      _cv.wait(lock, [&]() { return step < _num_released + _queue_depth || _stopping; });
+      if (_stopping)
+        break;
+    }
+
+    auto &batch = _batches[step % _queue_depth];
+    const bool loaded = _generator(order[step], batch.inputs, batch.expecteds);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!loaded)
+      break;
+    _num_loaded = step + 1;
+    _cv.notify_all();
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  _done = true;
+  _cv.notify_all();
+}
+
+void DataPrefetcher::stop()
+{
+  if (!_thread.joinable())
+    return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+    _cv.notify_all();
+  }
+  _thread.join();
+}
+
+} // namespace onert_train
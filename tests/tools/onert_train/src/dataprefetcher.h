@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef __ONERT_TRAIN_DATAPREFETCHER_H__
+#define __ONERT_TRAIN_DATAPREFETCHER_H__
+
+#include "dataloader.h"
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace onert_train
+{
+
+/**
+ * @brief Load batches of a Generator on a background thread ahead of training
+ *
+ * Batches are loaded into a ring of queue_depth buffers, so the next batch is ready when a
+ * training step ends. The buffer being used by training is one of them, i.e. 2 means double
+ * buffering. With queue_depth 0, batches are loaded on the calling thread when they are needed.
+ */
+class DataPrefetcher
+{
+public:
+  struct Batch
+  {
+    std::vector<Allocation> inputs;
+    std::vector<Allocation> expecteds;
+  };
+
+public:
+  DataPrefetcher(const Generator &generator, const std::vector<nnfw_tensorinfo> &input_infos,
+                 const std::vector<nnfw_tensorinfo> &expected_infos, uint32_t queue_depth);
+  DataPrefetcher(const DataPrefetcher &) = delete;
+  DataPrefetcher &operator=(const DataPrefetcher &) = delete;
+  ~DataPrefetcher();
+
+  /**
+   * @brief Start loading batches of an epoch, batches of the previous epoch are dropped
+   *
+   * @param num_steps Number of batches to load
+   * @param shuffle   Whether to load batches in a random order, which is made on the loading thread
+   * @param seed      Seed of the random order
+   */
+  void start(uint32_t num_steps, bool shuffle = false, uint32_t seed = 0);
+
+  /**
+   * @brief Wait for the next batch
+   *
+   * @return The batch valid until release(), nullptr if no batch is left or the generator fails
+   */
+  const Batch *next();
+
+  /**
+   * @brief Release the batch given by next() to load another batch into it
+   */
+  void release();
+
+private:
+  std::vector<uint32_t> makeOrder(uint32_t num_steps, bool shuffle, uint32_t seed) const;
+  void load(std::vector<uint32_t> order);
+  void stop();
+
+private:
+  Generator _generator;
+  uint32_t _queue_depth;
+  std::vector<Batch> _batches;
+
+  std::mutex _mutex;
+  std::condition_variable _cv;
+  std::thread _thread;
+  // Order of batches for loading on the calling thread
+  std::vector<uint32_t> _order;
+  uint32_t _num_steps;
+  uint32_t _num_loaded;
+  uint32_t _num_released;
+  bool _done;
+  bool _stopping;
+  std::exception_ptr _error;
+};
+
+} // namespace onert_train
+
+#endif // __ONERT_TRAIN_DATAPREFETCHER_H__
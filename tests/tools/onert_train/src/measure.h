@@ -19,12 +19,14 @@
 
 #include "benchmark/MemoryInfo.h"
 #include "benchmark/MemoryPoller.h"
+#include "nnfw_experimental.h"
 
 #include <algorithm>
 #include <ctime>
 #include <iostream>
 #include <iomanip>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 namespace
@@ -110,7 +112,8 @@ const std::string getMemoryTypeStr(MemoryType type)
 
 struct Step
 {
-  uint64_t time; // us
+  uint64_t time;  // us
+  uint64_t stall; // us, waiting for input data
 };
 
 struct Phase
@@ -176,6 +179,29 @@ public:
     _step_results[epoch][step].time = nowMicros() - _step_results[epoch][step].time;
   }
 
+  void waitData(const int epoch, const int step, const std::function<void()> &func)
+  {
+    if (_step_results.empty() || _step_results.size() <= epoch ||
+        _step_results[epoch].size() <= step)
+    {
+      throw std::runtime_error("Please set the number of epochs and steps first");
+    }
+
+    _step_results[epoch][step].stall = nowMicros();
+
+    func();
+
+    _step_results[epoch][step].stall = nowMicros() - _step_results[epoch][step].stall;
+  }
+
+  double sumStallMicro(const int epoch)
+  {
+    double sum = 0u;
+    std::for_each(_step_results[epoch].begin(), _step_results[epoch].end(),
+                  [&sum](auto &v) { sum += v.stall; });
+    return sum;
+  }
+
   double sumTimeMicro(const int epoch)
   {
     double sum = 0u;
@@ -222,7 +248,8 @@ public:
         {
           std::cout << "- "
                     << "Epoch " << j + 1 << std::setw(12) << std::right << " takes "
-                    << timeMicros(j, AggregateType::SUM) / 1e3 << " ms" << std::endl;
+                    << timeMicros(j, AggregateType::SUM) / 1e3 << " ms"
+                    << " (waits " << sumStallMicro(j) / 1e3 << " ms for input data)" << std::endl;
         }
       }
     }
@@ -245,6 +272,26 @@ public:
     }
   }
 
+  void printPhaseStats(const nnfw_train_phase_stats &stats)
+  {
+    if (stats.num_steps == 0)
+      return;
+
+    const auto total = stats.forward_us + stats.backward_us + stats.update_us;
+    const std::pair<const char *, uint64_t> phases[] = {{"forward", stats.forward_us},
+                                                        {"backward", stats.backward_us},
+                                                        {"update", stats.update_us}};
+    std::cout << "Training step takes " << static_cast<double>(total) / stats.num_steps / 1e3
+              << " ms on average over " << stats.num_steps << " steps" << std::endl;
+    for (const auto &[name, time] : phases)
+    {
+      std::cout << "- " << std::setw(12) << std::left << name << " takes "
+                << static_cast<double>(time) / stats.num_steps / 1e3 << " ms ("
+                << (total > 0 ? 100.0 * time / total : 0.0) << " %)" << std::endl;
+    }
+    std::cout << "===================================" << std::endl;
+  }
+
   void printResult()
   {
     printResultTime();
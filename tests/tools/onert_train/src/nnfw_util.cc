@@ -105,11 +105,15 @@ std::ostream &operator<<(std::ostream &os, const nnfw_loss_info &loss_info)
 
 std::ostream &operator<<(std::ostream &os, const nnfw_train_info &info)
 {
-  os << "- learning_rate        = " << info.learning_rate << "\n";
-  os << "- batch_size           = " << info.batch_size << "\n";
-  os << "- loss_info            = " << info.loss_info << "\n";
-  os << "- optimizer            = " << info.opt << "\n";
-  os << "- num_of_trainable_ops = " << info.num_of_trainable_ops << "\n";
+  os << "- learning_rate               = " << info.learning_rate << "\n";
+  os << "- batch_size                  = " << info.batch_size << "\n";
+  os << "- loss_info                   = " << info.loss_info << "\n";
+  os << "- optimizer                   = " << info.opt << "\n";
+  os << "- num_of_trainable_ops        = " << info.num_of_trainable_ops << "\n";
+  os << "- recompute_segment_size      = " << info.recompute_segment_size << "\n";
+  os << "- activation_memory_budget    = " << info.activation_memory_budget << "\n";
+  os << "- gradient_accumulation_steps = " << info.gradient_accumulation_steps << "\n";
+  os << "- multi_tensor_update         = " << info.multi_tensor_update << "\n";
 
   return os;
 }
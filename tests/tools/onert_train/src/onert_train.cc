@@ -25,6 +25,7 @@
 #include "randomgen.h"
 #include "rawformatter.h"
 #include "dataloader.h"
+#include "dataprefetcher.h"
 #include "rawdataloader.h"
 #include "metrics.h"
 
@@ -145,6 +146,14 @@ int main(const int argc, char **argv)
     tri.opt = args.getOptimizerType().value_or(tri.opt);
 
     tri.num_of_trainable_ops = args.num_of_trainable_ops();
+    tri.recompute_segment_size =
+      args.getRecomputeSegmentSize().value_or(tri.recompute_segment_size);
+    tri.activation_memory_budget =
+      args.getActivationMemoryBudget().value_or(tri.activation_memory_budget);
+    tri.gradient_accumulation_steps =
+      args.getGradientAccumulationSteps().value_or(tri.gradient_accumulation_steps);
+    if (args.getMultiTensorUpdate())
+      tri.multi_tensor_update = true;
 
     std::cout << "== training parameter ==" << std::endl;
     std::cout << tri;
@@ -168,15 +177,12 @@ int main(const int argc, char **argv)
     std::vector<nnfw_tensorinfo> expected_infos;
 
     // prepare data buffers
-    std::vector<Allocation> input_data(num_inputs);
-    std::vector<Allocation> expected_data(num_expecteds);
     std::vector<Allocation> output_data(num_expecteds);
 
     for (uint32_t i = 0; i < num_inputs; ++i)
     {
       nnfw_tensorinfo ti;
       NNPR_ENSURE_STATUS(nnfw_input_tensorinfo(session, i, &ti));
-      input_data[i].alloc(bufsize_for(&ti));
       input_infos.emplace_back(std::move(ti));
     }
 
@@ -191,7 +197,6 @@ int main(const int argc, char **argv)
       NNPR_ENSURE_STATUS(
         nnfw_train_set_output(session, i, ti.dtype, output_data[i].data(), output_size_in_bytes));
 
-      expected_data[i].alloc(output_size_in_bytes);
       expected_infos.emplace_back(std::move(ti));
     }
 
@@ -238,6 +243,12 @@ int main(const int argc, char **argv)
       exit(-1);
     }
 
+    // load batches of input and expected data ahead of training
+    DataPrefetcher tdata_prefetcher(tdata_generator, input_infos, expected_infos,
+                                    args.getPrefetchDepth());
+    DataPrefetcher vdata_prefetcher(vdata_generator, input_infos, expected_infos,
+                                    args.getPrefetchDepth());
+
     std::vector<float> losses(num_expecteds);
     std::vector<float> metrics(num_expecteds);
     measure.run(PhaseType::EXECUTE, [&]() {
@@ -252,31 +263,34 @@ int main(const int argc, char **argv)
         {
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
+          tdata_prefetcher.start(num_step, args.getShuffle(), epoch);
           for (uint32_t n = 0; n < num_step; ++n)
           {
             // get batchsize data
-            if (!tdata_generator(n, input_data, expected_data))
+            const DataPrefetcher::Batch *batch = nullptr;
+            measure.waitData(epoch, n, [&]() { batch = tdata_prefetcher.next(); });
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // train
             measure.run(epoch, n, [&]() { NNPR_ENSURE_STATUS(nnfw_train(session, true)); });
 
             // store loss
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch->expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -285,6 +299,7 @@ int main(const int argc, char **argv)
               if (args.getMetricType() == 0)
                 metrics[i] += metric.categoricalAccuracy(i);
             }
+            tdata_prefetcher.release();
 
             if (const auto name = args.getExportCheckpointFilename(); name != "")
               NNPR_ENSURE_STATUS(nnfw_train_export_checkpoint(session, name.c_str()));
@@ -320,31 +335,33 @@ int main(const int argc, char **argv)
           std::fill(losses.begin(), losses.end(), 0);
           std::fill(metrics.begin(), metrics.end(), 0);
           const int num_valid_step = vdata_length / tri.batch_size;
+          vdata_prefetcher.start(num_valid_step);
           for (uint32_t n = 0; n < num_valid_step; ++n)
           {
             // get batchsize validation data
-            if (!vdata_generator(n, input_data, expected_data))
+            const auto batch = vdata_prefetcher.next();
+            if (batch == nullptr)
               break;
 
             // prepare input
             for (uint32_t i = 0; i < num_inputs; ++i)
             {
               NNPR_ENSURE_STATUS(
-                nnfw_train_set_input(session, i, input_data[i].data(), &input_infos[i]));
+                nnfw_train_set_input(session, i, batch->inputs[i].data(), &input_infos[i]));
             }
 
             // prepare output
             for (uint32_t i = 0; i < num_expecteds; ++i)
             {
-              NNPR_ENSURE_STATUS(
-                nnfw_train_set_expected(session, i, expected_data[i].data(), &expected_infos[i]));
+              NNPR_ENSURE_STATUS(nnfw_train_set_expected(session, i, batch->expecteds[i].data(),
+                                                         &expected_infos[i]));
             }
 
             // validation
             NNPR_ENSURE_STATUS(nnfw_train(session, false));
 
             // get validation loss and accuracy
-            Metrics metric(output_data, expected_data, expected_infos);
+            Metrics metric(output_data, batch->expecteds, expected_infos);
             for (int32_t i = 0; i < num_expecteds; ++i)
             {
               float temp = 0.f;
@@ -353,6 +370,7 @@ int main(const int argc, char **argv)
               if (args.getMetricType() == 0)
                 metrics[i] += metric.categoricalAccuracy(i);
             }
+            vdata_prefetcher.release();
           }
 
           // print validation loss and accuracy
@@ -379,6 +397,10 @@ int main(const int argc, char **argv)
       }
     });
 
+    nnfw_train_phase_stats phase_stats;
+    if (args.getPhaseTime())
+      NNPR_ENSURE_STATUS(nnfw_train_get_phase_stats(session, &phase_stats));
+
     if (auto name = args.getExportCircleFilename(); name != "")
       NNPR_ENSURE_STATUS(nnfw_train_export_circle(session, name.c_str()));
 
@@ -388,6 +410,8 @@ int main(const int argc, char **argv)
     NNPR_ENSURE_STATUS(nnfw_close_session(session));
 
     measure.printResult();
+    if (args.getPhaseTime())
+      measure.printPhaseStats(phase_stats);
 
     return 0;
   }
@@ -21,6 +21,11 @@
 #include <stdexcept>
 #include <numeric>
 #include <cassert>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 
 namespace onert_train
 {
@@ -46,25 +51,65 @@ RawDataLoader::RawDataLoader(const std::string &input_file, const std::string &e
                              const std::vector<nnfw_tensorinfo> &expected_infos)
   : DataLoader(input_infos, expected_infos)
 {
-  _input_file = std::ifstream(input_file, std::ios::binary);
-  _expected_file = std::ifstream(expected_file, std::ios::binary);
+  _input_file = mapFile(input_file);
+  _expected_file = mapFile(expected_file);
 
-  _input_file.seekg(0, std::ios::end);
-  uint32_t input_file_size = _input_file.tellg();
-  uint32_t input_data_length = input_file_size / getRawTensorSize(_input_infos);
-
-  _expected_file.seekg(0, std::ios::end);
-  uint32_t expected_file_size = _expected_file.tellg();
-  uint32_t expected_data_length = expected_file_size / getRawTensorSize(_expected_infos);
+  uint32_t input_data_length = _input_file.size / getRawTensorSize(_input_infos);
+  uint32_t expected_data_length = _expected_file.size / getRawTensorSize(_expected_infos);
 
   if (input_data_length != expected_data_length)
   {
+    unmapFile(_input_file);
+    unmapFile(_expected_file);
     throw std::runtime_error("The length of input data and expected data does not match.");
   }
 
   _data_length = input_data_length;
 }
 
+RawDataLoader::~RawDataLoader()
+{
+  unmapFile(_input_file);
+  unmapFile(_expected_file);
+}
+
+RawDataLoader::MappedFile RawDataLoader::mapFile(const std::string &path)
+{
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd == -1)
+    throw std::runtime_error("Failed to open " + path);
+
+  struct stat st;
+  if (fstat(fd, &st) == -1)
+  {
+    close(fd);
+    throw std::runtime_error("Failed to get the size of " + path);
+  }
+
+  MappedFile file;
+  file.size = static_cast<size_t>(st.st_size);
+  if (file.size > 0)
+  {
+    void *data = mmap(nullptr, file.size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (data == MAP_FAILED)
+    {
+      close(fd);
+      throw std::runtime_error("Failed to map " + path);
+    }
+    file.data = static_cast<const uint8_t *>(data);
+  }
+  // The mapping is kept after closing the file
+  close(fd);
+  return file;
+}
+
+void RawDataLoader::unmapFile(MappedFile &file)
+{
+  if (file.data != nullptr)
+    munmap(const_cast<uint8_t *>(file.data), file.size);
+  file = MappedFile{};
+}
+
 std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_size, const float from,
                                                         const float to)
 {
@@ -74,8 +119,8 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
 
   int32_t split_size = _data_length * (to - from);
   int32_t split_start = _data_length * from;
-  std::vector<uint32_t> input_origins(_input_infos.size());
-  uint32_t start = 0;
+  std::vector<uint64_t> input_origins(_input_infos.size());
+  uint64_t start = 0;
   for (uint32_t i = 0; i < _input_infos.size(); ++i)
   {
     auto hwc_size = bufsize_for(&_input_infos[i]) / batch_size;
@@ -83,7 +128,7 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
     start += (hwc_size * _data_length);
   }
 
-  std::vector<uint32_t> expected_origins(_expected_infos.size());
+  std::vector<uint64_t> expected_origins(_expected_infos.size());
   start = 0;
   for (uint32_t i = 0; i < _expected_infos.size(); ++i)
   {
@@ -98,14 +143,18 @@ std::tuple<Generator, uint32_t> RawDataLoader::loadData(const uint32_t batch_siz
       for (uint32_t i = 0; i < _input_infos.size(); ++i)
       {
         auto bufsz = bufsize_for(&_input_infos[i]);
-        _input_file.seekg(input_origins[i] + idx * bufsz, std::ios::beg);
-        _input_file.read(reinterpret_cast<char *>(inputs[i].data()), bufsz);
+        const auto offset = input_origins[i] + idx * bufsz;
+        if (offset + bufsz > _input_file.size)
+          return false;
+        std::memcpy(inputs[i].data(), _input_file.data + offset, bufsz);
       }
       for (uint32_t i = 0; i < _expected_infos.size(); ++i)
       {
         auto bufsz = bufsize_for(&_expected_infos[i]);
-        _expected_file.seekg(expected_origins[i] + idx * bufsz, std::ios::beg);
-        _expected_file.read(reinterpret_cast<char *>(expecteds[i].data()), bufsz);
+        const auto offset = expected_origins[i] + idx * bufsz;
+        if (offset + bufsz > _expected_file.size)
+          return false;
+        std::memcpy(expecteds[i].data(), _expected_file.data + offset, bufsz);
       }
       return true;
     },
@@ -19,6 +19,9 @@
 
 #include "dataloader.h"
 
+#include <cstddef>
+#include <cstdint>
+
 namespace onert_train
 {
 
@@ -28,9 +31,30 @@ public:
   RawDataLoader(const std::string &input_file, const std::string &expected_file,
                 const std::vector<nnfw_tensorinfo> &input_infos,
                 const std::vector<nnfw_tensorinfo> &expected_infos);
+  RawDataLoader(const RawDataLoader &) = delete;
+  RawDataLoader &operator=(const RawDataLoader &) = delete;
+  ~RawDataLoader() override;
 
+  /**
+   * @note Generators only read the mapped files, so they can run on any thread
+   */
   std::tuple<Generator, uint32_t> loadData(const uint32_t batch_size, const float from = 0.0f,
                                            const float to = 1.0f) override;
+
+private:
+  // Data file mapped to memory, whose pages are read in by the kernel on access
+  struct MappedFile
+  {
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+  };
+
+  static MappedFile mapFile(const std::string &path);
+  static void unmapFile(MappedFile &file);
+
+private:
+  MappedFile _input_file;
+  MappedFile _expected_file;
 };
 
 } // namespace onert_train
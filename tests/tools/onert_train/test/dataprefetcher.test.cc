@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <nnfw.h>
+
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+
+#include "../src/dataprefetcher.h"
+
+namespace
+{
+using namespace onert_train;
+
+const nnfw_tensorinfo in_info = {
+  .dtype = NNFW_TYPE_TENSOR_INT32,
+  .rank = 2,
+  .dims = {2, 3},
+};
+
+const nnfw_tensorinfo expected_info = {
+  .dtype = NNFW_TYPE_TENSOR_INT32,
+  .rank = 2,
+  .dims = {2, 1},
+};
+
+// Fill all the elements of batch idx with idx, and fail from batch num_batches
+Generator makeGenerator(uint32_t num_batches)
+{
+  return [num_batches](uint32_t idx, std::vector<Allocation> &inputs,
+                       std::vector<Allocation> &expecteds) {
+    if (idx >= num_batches)
+      return false;
+    auto in = reinterpret_cast<int32_t *>(inputs[0].data());
+    std::fill(in, in + 6, static_cast<int32_t>(idx));
+    auto ex = reinterpret_cast<int32_t *>(expecteds[0].data());
+    std::fill(ex, ex + 2, static_cast<int32_t>(idx));
+    return true;
+  };
+}
+
+// Read the batch index, and check all the elements of the batch
+int32_t readBatch(const DataPrefetcher::Batch &batch)
+{
+  auto in = reinterpret_cast<const int32_t *>(batch.inputs[0].data());
+  auto ex = reinterpret_cast<const int32_t *>(batch.expecteds[0].data());
+  for (uint32_t i = 0; i < 6; ++i)
+    EXPECT_EQ(in[i], in[0]);
+  for (uint32_t i = 0; i < 2; ++i)
+    EXPECT_EQ(ex[i], in[0]);
+  return in[0];
+}
+
+std::vector<int32_t> readEpoch(DataPrefetcher &prefetcher, uint32_t num_steps, bool shuffle,
+                               uint32_t seed)
+{
+  std::vector<int32_t> order;
+  prefetcher.start(num_steps, shuffle, seed);
+  for (uint32_t n = 0; n < num_steps; ++n)
+  {
+    auto batch = prefetcher.next();
+    if (batch == nullptr)
+      break;
+    order.emplace_back(readBatch(*batch));
+    prefetcher.release();
+  }
+  return order;
+}
+
+std::vector<int32_t> iota(uint32_t n)
+{
+  std::vector<int32_t> v(n);
+  std::iota(v.begin(), v.end(), 0);
+  return v;
+}
+
+} // namespace
+
+TEST(DataPrefetcher, loadInOrder)
+{
+  for (uint32_t depth : {0u, 1u, 2u, 4u})
+  {
+    DataPrefetcher prefetcher(makeGenerator(10), {in_info}, {expected_info}, depth);
+    // Batches of an epoch are loaded again in the next epoch
+    for (uint32_t epoch = 0; epoch < 2; ++epoch)
+      EXPECT_EQ(readEpoch(prefetcher, 10, false, 0), iota(10));
+  }
+}
+
+TEST(DataPrefetcher, shuffle)
+{
+  DataPrefetcher prefetcher(makeGenerator(10), {in_info}, {expected_info}, 2);
+  auto order0 = readEpoch(prefetcher, 10, true, 0);
+  auto order1 = readEpoch(prefetcher, 10, true, 1);
+  EXPECT_NE(order0, order1);
+  EXPECT_EQ(order0, readEpoch(prefetcher, 10, true, 0));
+
+  // All the batches are loaded once
+  std::sort(order0.begin(), order0.end());
+  EXPECT_EQ(order0, iota(10));
+}
+
+TEST(DataPrefetcher, restartInEpoch)
+{
+  DataPrefetcher prefetcher(makeGenerator(10), {in_info}, {expected_info}, 2);
+  prefetcher.start(10);
+  auto batch = prefetcher.next();
+  ASSERT_NE(batch, nullptr);
+  EXPECT_EQ(readBatch(*batch), 0);
+  prefetcher.release();
+
+  // Batches left in the previous epoch are dropped
+  EXPECT_EQ(readEpoch(prefetcher, 10, false, 0), iota(10));
+}
+
+TEST(DataPrefetcher, neg_generatorFails)
+{
+  for (uint32_t depth : {0u, 2u})
+  {
+    DataPrefetcher prefetcher(makeGenerator(3), {in_info}, {expected_info}, depth);
+    EXPECT_EQ(readEpoch(prefetcher, 10, false, 0), iota(3));
+  }
+}
+
+TEST(DataPrefetcher, neg_generatorThrows)
+{
+  Generator generator = [](uint32_t, std::vector<Allocation> &, std::vector<Allocation> &) -> bool {
+    throw std::runtime_error{"Failed to load"};
+  };
+  DataPrefetcher prefetcher(generator, {in_info}, {expected_info}, 2);
+  prefetcher.start(10);
+  EXPECT_THROW(prefetcher.next(), std::runtime_error);
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file Transpose benchmark of cpu backend kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/Transpose.h>
+#include <ruy/context.h>
+
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace nnfw::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(DIM0, 1);
+NONIUS_PARAM(DIM1, 12);
+NONIUS_PARAM(DIM2, 128);
+NONIUS_PARAM(DIM3, 64);
+
+NONIUS_PARAM(PERM, std::string{"0,2,1,3"})
+
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+TransposeParams makeParams(const std::string &perm_str)
+{
+  TransposeParams params;
+  std::stringstream perm{perm_str};
+  std::string axis;
+  params.perm_count = 0;
+  while (std::getline(perm, axis, ',') && params.perm_count < 4)
+    params.perm[params.perm_count++] = std::stoi(axis);
+  if (params.perm_count != 4)
+    throw std::runtime_error{"Transpose benchmark: PERM should have 4 axes"};
+  return params;
+}
+
+struct Configuration
+{
+  int dims[4];
+  TransposeParams params;
+
+  Shape input_shape;
+  Shape output_shape;
+
+  Configuration(nonius::chronometer meter)
+    : dims{meter.param<DIM0>(), meter.param<DIM1>(), meter.param<DIM2>(), meter.param<DIM3>()},
+      params{makeParams(meter.param<PERM>())}, input_shape{dims[0], dims[1], dims[2], dims[3]},
+      output_shape{dims[params.perm[0]], dims[params.perm[1]], dims[params.perm[2]],
+                   dims[params.perm[3]]}
+  {
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CKerTranspose_Reference", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  std::vector<float> input(p.input_shape.FlatSize(), 1.0f);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    reference::Transpose(p.params, p.input_shape, input.data(), p.output_shape, output.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CKerTranspose_Optimized", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  std::vector<float> input(p.input_shape.FlatSize(), 1.0f);
+  std::vector<float> output(p.output_shape.FlatSize());
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Run!
+  meter.measure([&](int) {
+    Transpose(p.params, p.input_shape, input.data(), p.output_shape, output.data(),
+              &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
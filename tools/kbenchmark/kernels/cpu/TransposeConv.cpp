@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *    http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file TransposeConv benchmark of cpu backend kernels
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/operation/TransposeConv.h>
+#include <ruy/context.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace nnfw::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(BATCH, 1);
+
+NONIUS_PARAM(IFM_C, 3);
+NONIUS_PARAM(IFM_H, 244);
+NONIUS_PARAM(IFM_W, 244);
+
+NONIUS_PARAM(OFM_C, 3);
+NONIUS_PARAM(OFM_H, 244);
+NONIUS_PARAM(OFM_W, 244);
+
+NONIUS_PARAM(KER_H, 3);
+NONIUS_PARAM(KER_W, 3);
+
+NONIUS_PARAM(STRIDE_H, 1);
+NONIUS_PARAM(STRIDE_W, 1);
+
+NONIUS_PARAM(PADDING, std::string{"SAME"})
+
+NONIUS_PARAM(THREADS, 1);
+
+//
+// Configuration Helpers
+//
+namespace
+{
+
+struct Configuration
+{
+  Shape ifm_shape;
+  Shape ofm_shape;
+  Shape ker_shape;
+
+  TransposeConvParams params;
+
+  // NOTE Shape is not assignable, so shapes are built in the initializer list
+  Configuration(nonius::chronometer meter)
+    : ifm_shape{meter.param<BATCH>(), meter.param<IFM_H>(), meter.param<IFM_W>(),
+                meter.param<IFM_C>()},
+      ofm_shape{meter.param<BATCH>(), meter.param<OFM_H>(), meter.param<OFM_W>(),
+                meter.param<OFM_C>()},
+      ker_shape{meter.param<OFM_C>(), meter.param<KER_H>(), meter.param<KER_W>(),
+                meter.param<IFM_C>()}
+  {
+    const int ifm_H = meter.param<IFM_H>();
+    const int ifm_W = meter.param<IFM_W>();
+    const int ofm_H = meter.param<OFM_H>();
+    const int ofm_W = meter.param<OFM_W>();
+    const int ker_H = meter.param<KER_H>();
+    const int ker_W = meter.param<KER_W>();
+
+    params.stride_height = meter.param<STRIDE_H>();
+    params.stride_width = meter.param<STRIDE_W>();
+    params.padding_values.height = 0;
+    params.padding_values.width = 0;
+
+    // NOTE The padding calculation formula of TransposeConv is opposite to Conv.
+    //      So the location of ifm and ofm is changed.
+    if (meter.param<PADDING>() == "SAME")
+    {
+      const int vertical_needed = (ifm_H - 1) * params.stride_height + ker_H;
+      const int horizontal_needed = (ifm_W - 1) * params.stride_width + ker_W;
+      params.padding_values.height = std::max(0, vertical_needed - ofm_H) / 2;
+      params.padding_values.width = std::max(0, horizontal_needed - ofm_W) / 2;
+    }
+  }
+};
+
+} // namespace
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CKerTransposeConv_Reference", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  std::vector<float> ifm(p.ifm_shape.FlatSize(), 1.0f);
+  std::vector<float> ker(p.ker_shape.FlatSize(), 1.0f);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Run!
+  meter.measure([&](int) {
+    TransposeConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, ker.data(), p.ofm_shape,
+                  ofm.data());
+  });
+})
+
+NONIUS_LOCAL_BENCHMARK("CKerTransposeConv_GEMM", [](nonius::chronometer meter) {
+  // Configure
+  Configuration p{meter};
+
+  std::vector<float> ifm(p.ifm_shape.FlatSize(), 1.0f);
+  std::vector<float> ker(p.ker_shape.FlatSize(), 1.0f);
+  std::vector<float> ofm(p.ofm_shape.FlatSize());
+
+  // Filter is reordered once at prepare() of cpu backend
+  std::vector<float> hwoi_ker(ker.size());
+  optimized::TransposeConvFilterToHWOI(p.ker_shape, ker.data(), hwoi_ker.data());
+  std::vector<float> col2im(optimized::TransposeConvCol2imSize(p.ifm_shape, p.ker_shape));
+
+  ruy::Context ruy_context;
+  ruy_context.set_max_num_threads(meter.param<THREADS>());
+
+  // Run!
+  meter.measure([&](int) {
+    optimized::TransposeConv(p.params, p.ifm_shape, ifm.data(), p.ker_shape, hwoi_ker.data(),
+                             p.ofm_shape, ofm.data(), col2im.data(), true, &ruy_context);
+  });
+})
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}
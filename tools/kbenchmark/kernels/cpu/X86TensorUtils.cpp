@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Samsung Electronics Co., Ltd. All Rights Reserved
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/**
+ * @file X86 SIMD benchmark of cker kernels against portable code
+ */
+
+#include <nonius/nonius.h++>
+
+#include <cker/TensorUtils.h>
+#include <cker/operation/BinaryArithmeticOps.h>
+#include <cker/operation/SoftMax.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace nnfw::cker;
+
+//
+// Benchmark Parameters
+//
+NONIUS_PARAM(ROWS, 1024);
+NONIUS_PARAM(COLS, 1024);
+NONIUS_PARAM(BATCH, 1);
+
+//
+// Benchmark Implementations
+//
+namespace
+{
+
+inline nonius::benchmark_registry &local_benchmark_registry()
+{
+  static nonius::benchmark_registry registry;
+  return registry;
+}
+
+// Limit SIMD level of x86 kernels while benchmark runs
+class SimdLevelScope
+{
+public:
+  explicit SimdLevelScope(bool use_simd)
+  {
+#ifdef USE_X86_SIMD
+    _orig_level = x86::GetSimdLevel();
+    if (!use_simd)
+      x86::SetSimdLevel(x86::SimdLevel::kNone);
+#else
+    (void)use_simd;
+#endif
+  }
+  ~SimdLevelScope()
+  {
+#ifdef USE_X86_SIMD
+    x86::SetSimdLevel(_orig_level);
+#endif
+  }
+
+private:
+#ifdef USE_X86_SIMD
+  x86::SimdLevel _orig_level;
+#endif
+};
+
+void MatrixBatchVectorFloat(nonius::chronometer meter, bool use_simd)
+{
+  const int rows = meter.param<ROWS>();
+  const int cols = meter.param<COLS>();
+  const int batch = meter.param<BATCH>();
+
+  std::vector<float> matrix(rows * cols, 0.5f);
+  std::vector<float> vector(batch * cols, 0.25f);
+  std::vector<float> result(batch * rows, 0.0f);
+
+  SimdLevelScope scope{use_simd};
+  meter.measure([&](int) {
+    MatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vector.data(), batch,
+                                        result.data(), 1);
+  });
+}
+
+void MatrixBatchVectorInt8(nonius::chronometer meter, bool use_simd)
+{
+  const int rows = meter.param<ROWS>();
+  const int cols = meter.param<COLS>();
+  const int batch = meter.param<BATCH>();
+
+  std::vector<int8_t> matrix(rows * cols, 3);
+  std::vector<int8_t> vectors(batch * cols, -2);
+  std::vector<float> scaling_factors(batch, 0.1f);
+  std::vector<float> result(batch * rows, 0.0f);
+
+  SimdLevelScope scope{use_simd};
+  meter.measure([&](int) {
+    MatrixBatchVectorMultiplyAccumulate(matrix.data(), rows, cols, vectors.data(),
+                                        scaling_factors.data(), batch, result.data(), 1);
+  });
+}
+
+void AddFloat(nonius::chronometer meter, bool use_simd)
+{
+  const int size = meter.param<ROWS>() * meter.param<COLS>();
+  const Shape shape{1, size};
+
+  std::vector<float> input1(size, 1.0f);
+  std::vector<float> input2(size, 2.0f);
+  std::vector<float> output(size);
+
+  BinaryArithmeticOpParam params;
+  params.float_activation_min = 0.0f;
+  params.float_activation_max = 6.0f;
+
+  SimdLevelScope scope{use_simd};
+  meter.measure([&](int) {
+    BinaryArithmeticOp<BinaryArithmeticOpType::ADD>(params, shape, input1.data(), shape,
+                                                     input2.data(), shape, output.data());
+  });
+}
+
+void SoftmaxFloat(nonius::chronometer meter, bool use_simd)
+{
+  const int rows = meter.param<ROWS>();
+  const int cols = meter.param<COLS>();
+
+  std::vector<float> input(rows * cols, 0.5f);
+  std::vector<float> output(rows * cols);
+
+  SimdLevelScope scope{use_simd};
+  meter.measure([&](int) { Softmax(input.data(), cols, rows, 1.0f, output.data()); });
+}
+
+} // namespace
+
+#define NONIUS_LOCAL_BENCHMARK(name, ...)                                                          \
+  namespace                                                                                        \
+  {                                                                                                \
+  static ::nonius::benchmark_registrar                                                             \
+    NONIUS_DETAIL_UNIQUE_NAME(benchmark_registrar)(local_benchmark_registry(), name, __VA_ARGS__); \
+  }
+
+NONIUS_LOCAL_BENCHMARK("CKerMatrixBatchVectorFloat_Portable",
+                       [](nonius::chronometer meter) { MatrixBatchVectorFloat(meter, false); })
+NONIUS_LOCAL_BENCHMARK("CKerMatrixBatchVectorFloat_SIMD",
+                       [](nonius::chronometer meter) { MatrixBatchVectorFloat(meter, true); })
+NONIUS_LOCAL_BENCHMARK("CKerMatrixBatchVectorInt8_Portable",
+                       [](nonius::chronometer meter) { MatrixBatchVectorInt8(meter, false); })
+NONIUS_LOCAL_BENCHMARK("CKerMatrixBatchVectorInt8_SIMD",
+                       [](nonius::chronometer meter) { MatrixBatchVectorInt8(meter, true); })
+NONIUS_LOCAL_BENCHMARK("CKerAddFloat_Portable",
+                       [](nonius::chronometer meter) { AddFloat(meter, false); })
+NONIUS_LOCAL_BENCHMARK("CKerAddFloat_SIMD",
+                       [](nonius::chronometer meter) { AddFloat(meter, true); })
+NONIUS_LOCAL_BENCHMARK("CKerSoftmaxFloat_Portable",
+                       [](nonius::chronometer meter) { SoftmaxFloat(meter, false); })
+NONIUS_LOCAL_BENCHMARK("CKerSoftmaxFloat_SIMD",
+                       [](nonius::chronometer meter) { SoftmaxFloat(meter, true); })
+
+extern "C" nonius::benchmark_registry &benchmark_functions(void)
+{
+  return local_benchmark_registry();
+}